@@ -11,6 +11,40 @@ struct VSInput
     float4 Tangent : TANGENT;
 };
 
+// Resources::CompactVertex, see VertexQuantization.hpp
+struct VSInputCompact
+{
+    [[vk::location(0)]]
+    float3 Position : POSITION;
+    [[vk::location(1)]]
+    float2 Normal : NORMAL; // Octahedral, snorm16
+    [[vk::location(2)]]
+    float2 Tangent : TANGENT; // Octahedral, handedness in the sign of y
+    [[vk::location(3)]]
+    float2 UV0 : TEXCOORD0; // Half floats
+};
+
+float3 DecodeOctahedral(float2 e)
+{
+    float3 v = float3(e.x, e.y, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-v.z);
+    v.xy -= float2(e.x >= 0.0f ? t : -t, e.y >= 0.0f ? t : -t);
+    return normalize(v);
+}
+
+VSInput DecodeCompactVertex(VSInputCompact input)
+{
+    VSInput output;
+    output.Position = input.Position;
+    output.Normal = DecodeOctahedral(input.Normal);
+    output.UV0 = input.UV0;
+
+    float handedness = input.Tangent.y < 0.0f ? -1.0f : 1.0f;
+    float2 tangent = float2(input.Tangent.x, abs(input.Tangent.y) * 2.0f - 1.0f);
+    output.Tangent = float4(DecodeOctahedral(tangent), handedness);
+    return output;
+}
+
 struct PSInput
 {
     [[vk::location(0)]]
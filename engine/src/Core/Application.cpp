@@ -6,6 +6,8 @@
 #include "Events/ApplicationEvent.hpp"
 #include "Events/KeyEvent.hpp"
 #include "Logger.hpp"
+#include "Memory/PoolAllocator.hpp"
+#include "Platform/FileSystem/AsyncFileIO.hpp"
 #include "Platform/RHI/IRenderingHardware.hpp"
 #include "Window.hpp"
 
@@ -31,6 +33,7 @@ namespace VoidArchitect
         try
         {
             Jobs::g_JobSystem = std::make_unique<Jobs::JobSystem>();
+            Platform::g_AsyncFileIO = std::make_unique<Platform::AsyncFileIO>();
 
             g_ResourceSystem = std::make_unique<ResourceSystem>();
             Renderer::g_RenderSystem = std::make_unique<Renderer::RenderSystem>(
@@ -51,7 +54,17 @@ namespace VoidArchitect
         Renderer::g_RenderSystem = nullptr;
         g_ResourceSystem = nullptr;
 
+        // Read callbacks are submitted as jobs, the reads are done before the job system stops
+        Platform::g_AsyncFileIO = nullptr;
         Jobs::g_JobSystem = nullptr;
+
+        Memory::GetPoolAllocator().LogStats();
+
+        // Every subsystem has been shut down, anything still accounted for has leaked.
+        if constexpr (Memory::MEMORY_TRACKING_ENABLED)
+        {
+            Memory::GetMemoryTracker().LogSnapshot();
+        }
     }
 
     void Application::Run()
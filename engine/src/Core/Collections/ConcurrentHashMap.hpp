@@ -0,0 +1,259 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include "Core/Core.hpp"
+
+namespace VoidArchitect::Collections
+{
+    /// @brief Thread-safe hash map split into independently locked shards
+    ///
+    /// ConcurrentHashMap spreads its keys over SHARD_COUNT ordinary hash maps, each guarded
+    /// by its own reader/writer lock. Lookups only take a shared lock on one shard, so
+    /// concurrent readers never contend, and writers only block the keys that hash to the
+    /// same shard.
+    ///
+    /// Key features:
+    /// - Shared-lock lookups, exclusive-lock inserts, per shard
+    /// - Insert-once semantic through GetOrInsert(): the factory runs at most once per key,
+    ///   concurrent callers asking for the same key wait for it and observe its result
+    /// - Conditional erase, so a stale entry can be dropped without racing a fresh insert
+    /// - Shards are cache-line aligned to avoid false sharing between their locks
+    ///
+    /// @tparam K Key type (must be hashable with H)
+    /// @tparam V Value type, returned by copy (keep it small, e.g. a Handle)
+    /// @tparam SHARD_COUNT Number of shards, must be a power of two
+    /// @tparam H Hash function
+    ///
+    /// @note Values are returned by copy because a reference would outlive the shard lock.
+    ///
+    /// Usage example:
+    /// @code
+    /// ConcurrentHashMap<std::string, MeshHandle> nameToHandle;
+    ///
+    /// // From any thread: only the first caller for "rock" creates the node
+    /// auto [handle, inserted] = nameToHandle.GetOrInsert(
+    ///     "rock",
+    ///     [&]() -> std::optional<MeshHandle> { return CreateMeshNode("rock"); });
+    /// if (inserted) StartAsyncMeshLoading(*handle);
+    /// @endcode
+    template <typename K, typename V, size_t SHARD_COUNT = 64, typename H = std::hash<K>>
+    class ConcurrentHashMap
+    {
+        static_assert(
+            SHARD_COUNT > 0 && (SHARD_COUNT & (SHARD_COUNT - 1)) == 0,
+            "ConcurrentHashMap shard count must be a power of two.");
+
+    public:
+        ConcurrentHashMap() = default;
+        ~ConcurrentHashMap() = default;
+
+        // Non-copyable and non-movable (contains locks)
+        ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+        ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+        ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+        ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+
+        // === Lookup ===
+
+        /// @brief Find the value mapped to a key
+        /// @param key Key to look up
+        /// @return Copy of the value, or std::nullopt if the key is absent
+        std::optional<V> Find(const K& key) const;
+
+        /// @brief Check whether a key is present
+        bool Contains(const K& key) const { return Find(key).has_value(); }
+
+        // === Insertion ===
+
+        /// @brief Get the value mapped to a key, creating it if absent
+        /// @tparam F Callable returning std::optional<V>
+        /// @param key Key to look up or insert
+        /// @param factory Called at most once per key, under the shard's exclusive lock.
+        ///        Returning std::nullopt leaves the map unchanged.
+        /// @return The mapped value (std::nullopt if the factory failed) and whether this
+        ///         call inserted it
+        ///
+        /// @warning The factory must not access this map, it runs with the shard locked.
+        template <typename F>
+        std::pair<std::optional<V>, bool> GetOrInsert(const K& key, F&& factory);
+
+        /// @brief Map a key to a value, replacing any previous mapping
+        /// @return True if the key was inserted, false if an existing value was replaced
+        bool InsertOrAssign(const K& key, V value);
+
+        // === Removal ===
+
+        /// @brief Remove a key
+        /// @return True if the key was present
+        bool Erase(const K& key);
+
+        /// @brief Remove a key only if it is still mapped to `expected`
+        /// @return True if the entry was removed
+        ///
+        /// Lets a reader drop an entry it found stale without removing a value another
+        /// thread inserted in the meantime.
+        bool EraseIfEqual(const K& key, const V& expected);
+
+        /// @brief Remove every key
+        void Clear();
+
+        // === Iteration / Statistics ===
+
+        /// @brief Call `func(key, value)` for every entry, one shard at a time
+        /// @warning The shard being visited is locked, `func` must not access this map.
+        template <typename F>
+        void ForEach(F&& func) const;
+
+        /// @brief Count the entries of every shard (not a consistent snapshot)
+        size_t Size() const;
+
+        /// @brief Check whether every shard is empty (not a consistent snapshot)
+        bool IsEmpty() const { return Size() == 0; }
+
+    private:
+        struct alignas(64) Shard
+        {
+            mutable std::shared_mutex mutex;
+            VAHashMap<K, V, H> map;
+        };
+
+        Shard& GetShard(const K& key) { return m_Shards[GetShardIndex(key)]; }
+        const Shard& GetShard(const K& key) const { return m_Shards[GetShardIndex(key)]; }
+
+        size_t GetShardIndex(const K& key) const
+        {
+            // Mix the hash so that the shard index does not reuse the low bits the shard
+            // map itself buckets on.
+            const auto hash = static_cast<uint64_t>(m_Hasher(key));
+            return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> 32) & (SHARD_COUNT - 1);
+        }
+
+        std::array<Shard, SHARD_COUNT> m_Shards;
+        VA_NO_UNIQUE_ADDRESS H m_Hasher;
+    };
+
+    //==============================================================================================
+    // Template Implementation
+    //==============================================================================================
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    std::optional<V> ConcurrentHashMap<K, V, SHARD_COUNT, H>::Find(const K& key) const
+    {
+        const auto& shard = GetShard(key);
+        std::shared_lock lock(shard.mutex);
+
+        if (const auto it = shard.map.find(key); it != shard.map.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    template <typename F>
+    std::pair<std::optional<V>, bool> ConcurrentHashMap<K, V, SHARD_COUNT, H>::GetOrInsert(
+        const K& key,
+        F&& factory)
+    {
+        auto& shard = GetShard(key);
+
+        // Fast path: the key usually exists already
+        {
+            std::shared_lock lock(shard.mutex);
+            if (const auto it = shard.map.find(key); it != shard.map.end())
+            {
+                return {it->second, false};
+            }
+        }
+
+        std::unique_lock lock(shard.mutex);
+
+        // Another thread may have inserted the key between both locks
+        if (const auto it = shard.map.find(key); it != shard.map.end())
+        {
+            return {it->second, false};
+        }
+
+        std::optional<V> value = std::forward<F>(factory)();
+        if (!value.has_value())
+        {
+            return {std::nullopt, false};
+        }
+
+        shard.map.emplace(key, *value);
+        return {value, true};
+    }
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    bool ConcurrentHashMap<K, V, SHARD_COUNT, H>::InsertOrAssign(const K& key, V value)
+    {
+        auto& shard = GetShard(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.insert_or_assign(key, std::move(value)).second;
+    }
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    bool ConcurrentHashMap<K, V, SHARD_COUNT, H>::Erase(const K& key)
+    {
+        auto& shard = GetShard(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.erase(key) != 0;
+    }
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    bool ConcurrentHashMap<K, V, SHARD_COUNT, H>::EraseIfEqual(const K& key, const V& expected)
+    {
+        auto& shard = GetShard(key);
+        std::unique_lock lock(shard.mutex);
+
+        if (const auto it = shard.map.find(key); it != shard.map.end() && it->second == expected)
+        {
+            shard.map.erase(it);
+            return true;
+        }
+        return false;
+    }
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    void ConcurrentHashMap<K, V, SHARD_COUNT, H>::Clear()
+    {
+        for (auto& shard : m_Shards)
+        {
+            std::unique_lock lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    template <typename F>
+    void ConcurrentHashMap<K, V, SHARD_COUNT, H>::ForEach(F&& func) const
+    {
+        for (const auto& shard : m_Shards)
+        {
+            std::shared_lock lock(shard.mutex);
+            for (const auto& [key, value] : shard.map)
+            {
+                func(key, value);
+            }
+        }
+    }
+
+    template <typename K, typename V, size_t SHARD_COUNT, typename H>
+    size_t ConcurrentHashMap<K, V, SHARD_COUNT, H>::Size() const
+    {
+        size_t size = 0;
+        for (const auto& shard : m_Shards)
+        {
+            std::shared_lock lock(shard.mutex);
+            size += shard.map.size();
+        }
+        return size;
+    }
+} // namespace VoidArchitect::Collections
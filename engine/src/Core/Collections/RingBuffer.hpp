@@ -0,0 +1,572 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+
+namespace VoidArchitect::Collections
+{
+    /// @brief Size used to pad concurrently written members onto separate cache lines
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /// @brief Bounded lock-free multi-producer multi-consumer ring buffer
+    ///
+    /// MPMCRingBuffer is a fixed-capacity FIFO queue that can be pushed to and popped from
+    /// by any number of threads. It is based on the sequence-numbered cell design: every cell
+    /// carries a sequence counter telling producers and consumers whether the cell is ready
+    /// for them in the current lap, so a push or a pop only costs one CAS on the shared
+    /// position in the uncontended case.
+    ///
+    /// Key features:
+    /// - Fixed capacity (power of two) determined at compile time, no allocation after init
+    /// - Producer and consumer positions live on separate cache lines
+    /// - Batch push/pop claiming a whole range of ready cells with a single CAS
+    /// - Try-semantics: operations fail instead of blocking when the buffer is full/empty
+    ///
+    /// @tparam T Type of the stored elements (must be move-constructible)
+    /// @tparam CAPACITY Maximum number of elements, must be a power of two
+    ///
+    /// @note Batch operations never wait on another thread. A batch is cut short at the first
+    /// cell whose previous owner is still copying data in or out, so it may return fewer
+    /// elements than are about to be available.
+    ///
+    /// Usage example:
+    /// @code
+    /// MPMCRingBuffer<JobHandle, 1024> queue;
+    ///
+    /// // Any thread
+    /// if (!queue.TryPush(handle)) { /* queue full, retry later */ }
+    ///
+    /// // Any other thread
+    /// JobHandle handles[32];
+    /// const auto count = queue.TryPopBatch(handles, 32);
+    /// @endcode
+    template <typename T, size_t CAPACITY>
+    class MPMCRingBuffer
+    {
+        static_assert(CAPACITY >= 2 && std::has_single_bit(CAPACITY),
+            "MPMCRingBuffer capacity must be a power of two.");
+
+    public:
+        /// @brief Maximum number of elements the buffer can hold
+        static constexpr size_t MAX_ELEMENTS = CAPACITY;
+
+        // === Constructors / Destructors ===
+
+        MPMCRingBuffer();
+
+        /// @brief Destructor, destroys any element still in the buffer
+        ~MPMCRingBuffer();
+
+        // Non-copyable and non-movable (contains atomic members)
+        MPMCRingBuffer(const MPMCRingBuffer&) = delete;
+        MPMCRingBuffer& operator=(const MPMCRingBuffer&) = delete;
+        MPMCRingBuffer(MPMCRingBuffer&&) = delete;
+        MPMCRingBuffer& operator=(MPMCRingBuffer&&) = delete;
+
+        // === Single element operations ===
+
+        /// @brief Construct an element in-place at the back of the buffer
+        /// @param args Arguments forwarded to T's constructor
+        /// @return true if the element was pushed, false if the buffer is full
+        template <typename... Args>
+        bool TryEmplace(Args&&... args);
+
+        /// @brief Push a copy of an element at the back of the buffer
+        /// @return true if the element was pushed, false if the buffer is full
+        bool TryPush(const T& value) { return TryEmplace(value); }
+
+        /// @brief Move an element at the back of the buffer
+        /// @return true if the element was pushed, false if the buffer is full
+        bool TryPush(T&& value) { return TryEmplace(std::move(value)); }
+
+        /// @brief Pop the element at the front of the buffer
+        /// @param out Receives the popped element
+        /// @return true if an element was popped, false if the buffer is empty
+        bool TryPop(T& out);
+
+        // === Batch operations ===
+
+        /// @brief Push up to `count` elements, copying them in order
+        /// @param values Elements to push
+        /// @param count Number of elements available in `values`
+        /// @return Number of elements actually pushed (0 if the buffer is full)
+        size_t TryPushBatch(const T* values, size_t count);
+
+        /// @brief Pop up to `maxCount` elements in FIFO order
+        /// @param out Destination array, must hold at least `maxCount` elements
+        /// @param maxCount Maximum number of elements to pop
+        /// @return Number of elements actually popped (0 if the buffer is empty)
+        size_t TryPopBatch(T* out, size_t maxCount);
+
+        // === Statistics ===
+
+        /// @brief Get an approximation of the number of stored elements
+        /// @return Element count, only exact when no other thread is operating on the buffer
+        size_t GetSizeApprox() const;
+
+        /// @brief Check whether the buffer looks empty
+        bool IsEmptyApprox() const { return GetSizeApprox() == 0; }
+
+        /// @brief Get the maximum number of elements
+        constexpr size_t GetCapacity() const { return CAPACITY; }
+
+    private:
+        static constexpr size_t MASK = CAPACITY - 1;
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) std::byte storage[sizeof(T)];
+
+            T* GetPtr() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_EnqueuePos{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_DequeuePos{0};
+        alignas(CACHE_LINE_SIZE) std::array<Cell, CAPACITY> m_Cells;
+    };
+
+    /// @brief Bounded wait-free single-producer single-consumer ring buffer
+    ///
+    /// SPSCRingBuffer is the lightweight sibling of MPMCRingBuffer for handoffs between
+    /// exactly two threads, typically a worker thread feeding the main thread (completed
+    /// loads, log records, buffered events). Both sides only touch their own index and a
+    /// cached copy of the other side's index, so the shared cache lines are only read when
+    /// the cached view says the buffer is full or empty.
+    ///
+    /// @tparam T Type of the stored elements (must be move-constructible)
+    /// @tparam CAPACITY Maximum number of elements, must be a power of two
+    ///
+    /// @warning Push operations must only be called from one producer thread, and pop
+    /// operations from one consumer thread. The two may be different threads.
+    template <typename T, size_t CAPACITY>
+    class SPSCRingBuffer
+    {
+        static_assert(CAPACITY >= 2 && std::has_single_bit(CAPACITY),
+            "SPSCRingBuffer capacity must be a power of two.");
+
+    public:
+        /// @brief Maximum number of elements the buffer can hold
+        static constexpr size_t MAX_ELEMENTS = CAPACITY;
+
+        // === Constructors / Destructors ===
+
+        SPSCRingBuffer() = default;
+
+        /// @brief Destructor, destroys any element still in the buffer
+        ~SPSCRingBuffer();
+
+        // Non-copyable and non-movable (contains atomic members)
+        SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+        SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+        SPSCRingBuffer(SPSCRingBuffer&&) = delete;
+        SPSCRingBuffer& operator=(SPSCRingBuffer&&) = delete;
+
+        // === Producer side ===
+
+        /// @brief Construct an element in-place at the back of the buffer
+        /// @return true if the element was pushed, false if the buffer is full
+        template <typename... Args>
+        bool TryEmplace(Args&&... args);
+
+        /// @brief Push a copy of an element at the back of the buffer
+        bool TryPush(const T& value) { return TryEmplace(value); }
+
+        /// @brief Move an element at the back of the buffer
+        bool TryPush(T&& value) { return TryEmplace(std::move(value)); }
+
+        /// @brief Push up to `count` elements with a single publication
+        /// @param values Elements to push
+        /// @param count Number of elements available in `values`
+        /// @return Number of elements actually pushed
+        size_t TryPushBatch(const T* values, size_t count);
+
+        // === Consumer side ===
+
+        /// @brief Pop the element at the front of the buffer
+        /// @param out Receives the popped element
+        /// @return true if an element was popped, false if the buffer is empty
+        bool TryPop(T& out);
+
+        /// @brief Pop up to `maxCount` elements with a single release
+        /// @param out Destination array, must hold at least `maxCount` elements
+        /// @param maxCount Maximum number of elements to pop
+        /// @return Number of elements actually popped
+        size_t TryPopBatch(T* out, size_t maxCount);
+
+        /// @brief Get the element at the front without popping it
+        /// @return Pointer to the front element, nullptr if the buffer is empty
+        /// @note The pointer stays valid until the consumer pops the element.
+        T* Front();
+
+        // === Statistics ===
+
+        /// @brief Get an approximation of the number of stored elements
+        size_t GetSizeApprox() const;
+
+        /// @brief Check whether the buffer looks empty
+        bool IsEmptyApprox() const { return GetSizeApprox() == 0; }
+
+        /// @brief Get the maximum number of elements
+        constexpr size_t GetCapacity() const { return CAPACITY; }
+
+    private:
+        static constexpr size_t MASK = CAPACITY - 1;
+
+        struct Slot
+        {
+            alignas(T) std::byte storage[sizeof(T)];
+
+            T* GetPtr() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        // Producer-owned line: write index and its view of the consumer index.
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_WritePos{0};
+        size_t m_CachedReadPos = 0;
+
+        // Consumer-owned line: read index and its view of the producer index.
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_ReadPos{0};
+        size_t m_CachedWritePos = 0;
+
+        alignas(CACHE_LINE_SIZE) std::array<Slot, CAPACITY> m_Slots;
+    };
+
+    //=============================================================================================
+    // MPMCRingBuffer Template Implementation
+    //=============================================================================================
+
+    template <typename T, size_t CAPACITY>
+    MPMCRingBuffer<T, CAPACITY>::MPMCRingBuffer()
+    {
+        for (size_t i = 0; i < CAPACITY; ++i)
+        {
+            m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T, size_t CAPACITY>
+    MPMCRingBuffer<T, CAPACITY>::~MPMCRingBuffer()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const auto enqueuePos = m_EnqueuePos.load(std::memory_order_acquire);
+            for (auto pos = m_DequeuePos.load(std::memory_order_relaxed); pos != enqueuePos; ++pos)
+            {
+                m_Cells[pos & MASK].GetPtr()->~T();
+            }
+        }
+    }
+
+    template <typename T, size_t CAPACITY>
+    template <typename... Args>
+    bool MPMCRingBuffer<T, CAPACITY>::TryEmplace(Args&&... args)
+    {
+        auto pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &m_Cells[pos & MASK];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The cell still holds an element from the previous lap: the buffer is full.
+                return false;
+            }
+            else
+            {
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new(cell->storage) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t CAPACITY>
+    bool MPMCRingBuffer<T, CAPACITY>::TryPop(T& out)
+    {
+        auto pos = m_DequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &m_Cells[pos & MASK];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The cell has not been written for this lap yet: the buffer is empty.
+                return false;
+            }
+            else
+            {
+                pos = m_DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        auto* value = cell->GetPtr();
+        out = std::move(*value);
+        value->~T();
+        cell->sequence.store(pos + CAPACITY, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t CAPACITY>
+    size_t MPMCRingBuffer<T, CAPACITY>::TryPushBatch(const T* values, const size_t count)
+    {
+        if (count == 0) return 0;
+
+        auto pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        size_t claimed;
+        for (;;)
+        {
+            // Only the cells already released by the previous lap are claimed, the batch
+            // stops at the first one a consumer is still moving data out of.
+            claimed = 0;
+            const auto limit = std::min(count, CAPACITY);
+            while (claimed < limit &&
+                m_Cells[(pos + claimed) & MASK].sequence.load(std::memory_order_acquire) ==
+                pos + claimed)
+            {
+                ++claimed;
+            }
+
+            if (claimed == 0)
+            {
+                const auto sequence = m_Cells[pos & MASK].sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos) < 0)
+                {
+                    // The cell still holds an element from the previous lap: the buffer is full.
+                    return 0;
+                }
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (m_EnqueuePos.compare_exchange_weak(
+                pos,
+                pos + claimed,
+                std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < claimed; ++i)
+        {
+            auto& cell = m_Cells[(pos + i) & MASK];
+            new(cell.storage) T(values[i]);
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+
+        return claimed;
+    }
+
+    template <typename T, size_t CAPACITY>
+    size_t MPMCRingBuffer<T, CAPACITY>::TryPopBatch(T* out, const size_t maxCount)
+    {
+        if (maxCount == 0) return 0;
+
+        auto pos = m_DequeuePos.load(std::memory_order_relaxed);
+        size_t claimed;
+        for (;;)
+        {
+            // Only the cells whose element is already published are claimed, the batch stops
+            // at the first one a producer is still writing.
+            claimed = 0;
+            const auto limit = std::min(maxCount, CAPACITY);
+            while (claimed < limit &&
+                m_Cells[(pos + claimed) & MASK].sequence.load(std::memory_order_acquire) ==
+                pos + claimed + 1)
+            {
+                ++claimed;
+            }
+
+            if (claimed == 0)
+            {
+                const auto sequence = m_Cells[pos & MASK].sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0)
+                {
+                    // The cell has not been written for this lap yet: the buffer is empty.
+                    return 0;
+                }
+                pos = m_DequeuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (m_DequeuePos.compare_exchange_weak(
+                pos,
+                pos + claimed,
+                std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < claimed; ++i)
+        {
+            auto& cell = m_Cells[(pos + i) & MASK];
+            auto* value = cell.GetPtr();
+            out[i] = std::move(*value);
+            value->~T();
+            cell.sequence.store(pos + i + CAPACITY, std::memory_order_release);
+        }
+
+        return claimed;
+    }
+
+    template <typename T, size_t CAPACITY>
+    size_t MPMCRingBuffer<T, CAPACITY>::GetSizeApprox() const
+    {
+        const auto enqueuePos = m_EnqueuePos.load(std::memory_order_relaxed);
+        const auto dequeuePos = m_DequeuePos.load(std::memory_order_relaxed);
+        return enqueuePos > dequeuePos ? std::min(enqueuePos - dequeuePos, CAPACITY) : 0;
+    }
+
+    //=============================================================================================
+    // SPSCRingBuffer Template Implementation
+    //=============================================================================================
+
+    template <typename T, size_t CAPACITY>
+    SPSCRingBuffer<T, CAPACITY>::~SPSCRingBuffer()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const auto writePos = m_WritePos.load(std::memory_order_acquire);
+            for (auto pos = m_ReadPos.load(std::memory_order_relaxed); pos != writePos; ++pos)
+            {
+                m_Slots[pos & MASK].GetPtr()->~T();
+            }
+        }
+    }
+
+    template <typename T, size_t CAPACITY>
+    template <typename... Args>
+    bool SPSCRingBuffer<T, CAPACITY>::TryEmplace(Args&&... args)
+    {
+        const auto writePos = m_WritePos.load(std::memory_order_relaxed);
+        if (writePos - m_CachedReadPos == CAPACITY)
+        {
+            m_CachedReadPos = m_ReadPos.load(std::memory_order_acquire);
+            if (writePos - m_CachedReadPos == CAPACITY)
+            {
+                return false;
+            }
+        }
+
+        new(m_Slots[writePos & MASK].storage) T(std::forward<Args>(args)...);
+        m_WritePos.store(writePos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t CAPACITY>
+    size_t SPSCRingBuffer<T, CAPACITY>::TryPushBatch(const T* values, const size_t count)
+    {
+        const auto writePos = m_WritePos.load(std::memory_order_relaxed);
+        auto freeSlots = CAPACITY - (writePos - m_CachedReadPos);
+        if (freeSlots < count)
+        {
+            m_CachedReadPos = m_ReadPos.load(std::memory_order_acquire);
+            freeSlots = CAPACITY - (writePos - m_CachedReadPos);
+        }
+
+        const auto pushed = std::min(count, freeSlots);
+        for (size_t i = 0; i < pushed; ++i)
+        {
+            new(m_Slots[(writePos + i) & MASK].storage) T(values[i]);
+        }
+
+        if (pushed > 0)
+        {
+            m_WritePos.store(writePos + pushed, std::memory_order_release);
+        }
+        return pushed;
+    }
+
+    template <typename T, size_t CAPACITY>
+    bool SPSCRingBuffer<T, CAPACITY>::TryPop(T& out)
+    {
+        auto* value = Front();
+        if (!value)
+        {
+            return false;
+        }
+
+        out = std::move(*value);
+        value->~T();
+        m_ReadPos.store(m_ReadPos.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t CAPACITY>
+    size_t SPSCRingBuffer<T, CAPACITY>::TryPopBatch(T* out, const size_t maxCount)
+    {
+        const auto readPos = m_ReadPos.load(std::memory_order_relaxed);
+        auto available = m_CachedWritePos - readPos;
+        if (available < maxCount)
+        {
+            m_CachedWritePos = m_WritePos.load(std::memory_order_acquire);
+            available = m_CachedWritePos - readPos;
+        }
+
+        const auto popped = std::min(maxCount, available);
+        for (size_t i = 0; i < popped; ++i)
+        {
+            auto* value = m_Slots[(readPos + i) & MASK].GetPtr();
+            out[i] = std::move(*value);
+            value->~T();
+        }
+
+        if (popped > 0)
+        {
+            m_ReadPos.store(readPos + popped, std::memory_order_release);
+        }
+        return popped;
+    }
+
+    template <typename T, size_t CAPACITY>
+    T* SPSCRingBuffer<T, CAPACITY>::Front()
+    {
+        const auto readPos = m_ReadPos.load(std::memory_order_relaxed);
+        if (readPos == m_CachedWritePos)
+        {
+            m_CachedWritePos = m_WritePos.load(std::memory_order_acquire);
+            if (readPos == m_CachedWritePos)
+            {
+                return nullptr;
+            }
+        }
+
+        return m_Slots[readPos & MASK].GetPtr();
+    }
+
+    template <typename T, size_t CAPACITY>
+    size_t SPSCRingBuffer<T, CAPACITY>::GetSizeApprox() const
+    {
+        const auto writePos = m_WritePos.load(std::memory_order_acquire);
+        const auto readPos = m_ReadPos.load(std::memory_order_acquire);
+        return writePos - readPos;
+    }
+} // namespace VoidArchitect::Collections
@@ -0,0 +1,511 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <cstring>
+#include <span>
+#include <tuple>
+
+#include "Core/Logger.hpp"
+
+namespace VoidArchitect::Collections
+{
+    /// @brief Zipped iterator walking several SoA columns in lockstep
+    ///
+    /// Dereferencing yields a std::tuple of references, one per column, which makes it
+    /// usable with structured bindings:
+    /// @code
+    /// for (auto [position, normal] : soa) { normal = ...; }
+    /// @endcode
+    template <typename... Us>
+    class SoAZipIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Us&...>;
+        using reference = std::tuple<Us&...>;
+        using difference_type = std::ptrdiff_t;
+
+        SoAZipIterator() = default;
+
+        SoAZipIterator(std::tuple<Us*...> columns, const size_t index)
+            : m_Columns(columns),
+              m_Index(index)
+        {
+        }
+
+        reference operator*() const
+        {
+            return std::apply([this](Us*... columns) { return reference(columns[m_Index]...); },
+                m_Columns);
+        }
+
+        reference operator[](const difference_type offset) const { return *(*this + offset); }
+
+        SoAZipIterator& operator++()
+        {
+            ++m_Index;
+            return *this;
+        }
+
+        SoAZipIterator operator++(int)
+        {
+            auto copy = *this;
+            ++m_Index;
+            return copy;
+        }
+
+        SoAZipIterator& operator--()
+        {
+            --m_Index;
+            return *this;
+        }
+
+        SoAZipIterator operator--(int)
+        {
+            auto copy = *this;
+            --m_Index;
+            return copy;
+        }
+
+        SoAZipIterator& operator+=(const difference_type offset)
+        {
+            m_Index += offset;
+            return *this;
+        }
+
+        SoAZipIterator& operator-=(const difference_type offset)
+        {
+            m_Index -= offset;
+            return *this;
+        }
+
+        SoAZipIterator operator+(const difference_type offset) const
+        {
+            return SoAZipIterator(m_Columns, m_Index + offset);
+        }
+
+        SoAZipIterator operator-(const difference_type offset) const
+        {
+            return SoAZipIterator(m_Columns, m_Index - offset);
+        }
+
+        difference_type operator-(const SoAZipIterator& other) const
+        {
+            return static_cast<difference_type>(m_Index) -
+                static_cast<difference_type>(other.m_Index);
+        }
+
+        bool operator==(const SoAZipIterator& other) const { return m_Index == other.m_Index; }
+        auto operator<=>(const SoAZipIterator& other) const { return m_Index <=> other.m_Index; }
+
+        /// @brief Index of the element the iterator points to
+        size_t GetIndex() const { return m_Index; }
+
+    private:
+        std::tuple<Us*...> m_Columns{};
+        size_t m_Index = 0;
+    };
+
+    /// @brief Range over a subset of SoA columns, returned by SoAArray::Zip()
+    template <typename... Us>
+    class SoAZipView
+    {
+    public:
+        SoAZipView(std::tuple<Us*...> columns, const size_t size)
+            : m_Columns(columns),
+              m_Size(size)
+        {
+        }
+
+        SoAZipIterator<Us...> begin() const { return {m_Columns, 0}; }
+        SoAZipIterator<Us...> end() const { return {m_Columns, m_Size}; }
+        size_t size() const { return m_Size; }
+        bool empty() const { return m_Size == 0; }
+
+    private:
+        std::tuple<Us*...> m_Columns;
+        size_t m_Size;
+    };
+
+    /// @brief Dynamic struct-of-arrays container with aligned, padded columns
+    ///
+    /// SoAArray stores each member of a logical element in its own contiguous column, so
+    /// that loops touching a single attribute (positions for bounds, normals for
+    /// normalization, ...) stream through dense memory and can be auto-vectorized.
+    ///
+    /// Key features:
+    /// - Every column starts on a COLUMN_ALIGNMENT boundary
+    /// - Capacity is padded to a multiple of PADDING_ELEMENTS, and the padding is
+    ///   value-initialized, so SIMD loops may process PaddedColumn() without a scalar tail
+    /// - Per-column std::span access and zipped iteration over all or selected columns
+    ///
+    /// @tparam Ts Column types, must be trivially copyable and trivially destructible
+    ///
+    /// Usage example:
+    /// @code
+    /// SoAArray<float, float, float> positions; // X, Y, Z columns
+    /// positions.PushBack(1.0f, 2.0f, 3.0f);
+    ///
+    /// // Vectorizable single-column loop
+    /// for (auto& x : positions.Column<0>()) x *= 2.0f;
+    ///
+    /// // Zipped iteration
+    /// for (auto [x, y, z] : positions) { ... }
+    /// @endcode
+    template <typename... Ts>
+    class SoAArray
+    {
+        static_assert(sizeof...(Ts) > 0, "SoAArray needs at least one column.");
+        static_assert((std::is_trivially_copyable_v<Ts> && ...),
+            "SoAArray columns must be trivially copyable.");
+        static_assert((std::is_trivially_destructible_v<Ts> && ...),
+            "SoAArray columns must be trivially destructible.");
+
+    public:
+        /// @brief Number of columns
+        static constexpr size_t COLUMN_COUNT = sizeof...(Ts);
+
+        /// @brief Alignment of the first element of every column, in bytes
+        static constexpr size_t COLUMN_ALIGNMENT = 64;
+
+        /// @brief Capacity granularity, enough for a 16-wide float lane
+        static constexpr size_t PADDING_ELEMENTS = 16;
+
+        /// @brief Type stored in column I
+        template <size_t I>
+        using ColumnType = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+        using Reference = std::tuple<Ts&...>;
+        using ConstReference = std::tuple<const Ts&...>;
+        using Iterator = SoAZipIterator<Ts...>;
+        using ConstIterator = SoAZipIterator<const Ts...>;
+
+        // === Constructors / Destructors ===
+
+        SoAArray() = default;
+
+        /// @brief Create an array holding `count` value-initialized elements
+        explicit SoAArray(size_t count);
+
+        ~SoAArray();
+
+        SoAArray(const SoAArray& other);
+        SoAArray& operator=(const SoAArray& other);
+        SoAArray(SoAArray&& other) noexcept;
+        SoAArray& operator=(SoAArray&& other) noexcept;
+
+        // === Capacity ===
+
+        size_t Size() const { return m_Size; }
+        size_t Capacity() const { return m_Capacity; }
+        bool IsEmpty() const { return m_Size == 0; }
+
+        /// @brief Ensure room for at least `capacity` elements
+        void Reserve(size_t capacity);
+
+        /// @brief Change the number of elements, new elements are value-initialized
+        void Resize(size_t size);
+
+        /// @brief Remove all elements, keeping the allocated columns
+        void Clear() { m_Size = 0; }
+
+        // === Modifiers ===
+
+        /// @brief Append one element given the value of every column
+        void PushBack(const Ts&... values);
+
+        /// @brief Remove the last element
+        void PopBack();
+
+        /// @brief Remove an element by moving the last one in its place (O(1), unordered)
+        void SwapRemove(size_t index);
+
+        // === Element access ===
+
+        Reference operator[](size_t index);
+        ConstReference operator[](size_t index) const;
+
+        /// @brief Access one column value of one element
+        template <size_t I>
+        ColumnType<I>& Get(size_t index) { return std::get<I>(m_Columns)[index]; }
+
+        template <size_t I>
+        const ColumnType<I>& Get(size_t index) const { return std::get<I>(m_Columns)[index]; }
+
+        /// @brief Get a column as a span over the live elements
+        template <size_t I>
+        std::span<ColumnType<I>> Column() { return {std::get<I>(m_Columns), m_Size}; }
+
+        template <size_t I>
+        std::span<const ColumnType<I>> Column() const
+        {
+            return {std::get<I>(m_Columns), m_Size};
+        }
+
+        /// @brief Get a column as a span covering the padded capacity
+        ///
+        /// The span length is a multiple of PADDING_ELEMENTS. Elements past Size() hold
+        /// value-initialized or stale data and must not be interpreted.
+        template <size_t I>
+        std::span<ColumnType<I>> PaddedColumn()
+        {
+            return {std::get<I>(m_Columns), PadCount(m_Size)};
+        }
+
+        /// @brief Raw pointer to a column, aligned on COLUMN_ALIGNMENT
+        template <size_t I>
+        ColumnType<I>* Data() { return std::get<I>(m_Columns); }
+
+        template <size_t I>
+        const ColumnType<I>* Data() const { return std::get<I>(m_Columns); }
+
+        // === Iteration ===
+
+        Iterator begin() { return {m_Columns, 0}; }
+        Iterator end() { return {m_Columns, m_Size}; }
+        ConstIterator begin() const { return {GetConstColumns(), 0}; }
+        ConstIterator end() const { return {GetConstColumns(), m_Size}; }
+
+        /// @brief Iterate over a subset of columns in lockstep
+        /// @tparam Is Indices of the columns to visit
+        template <size_t... Is>
+        SoAZipView<ColumnType<Is>...> Zip()
+        {
+            return {std::tuple<ColumnType<Is>*...>(std::get<Is>(m_Columns)...), m_Size};
+        }
+
+        template <size_t... Is>
+        SoAZipView<const ColumnType<Is>...> Zip() const
+        {
+            return {
+                std::tuple<const ColumnType<Is>*...>(std::get<Is>(m_Columns)...),
+                m_Size
+            };
+        }
+
+    private:
+        static size_t PadCount(const size_t count)
+        {
+            return (count + PADDING_ELEMENTS - 1) / PADDING_ELEMENTS * PADDING_ELEMENTS;
+        }
+
+        std::tuple<const Ts*...> GetConstColumns() const
+        {
+            return std::apply([](Ts*... columns)
+            {
+                return std::tuple<const Ts*...>(columns...);
+            }, m_Columns);
+        }
+
+        /// @brief Move all columns to new storage of `newCapacity` elements
+        void Reallocate(size_t newCapacity);
+
+        void Release();
+
+        template <typename T>
+        static T* AllocateColumn(size_t capacity);
+
+        template <typename T>
+        static void FreeColumn(T* column);
+
+        std::tuple<Ts*...> m_Columns{};
+        size_t m_Size = 0;
+        size_t m_Capacity = 0;
+    };
+
+    //=============================================================================================
+    // SoAArray Template Implementation
+    //=============================================================================================
+
+    template <typename... Ts>
+    SoAArray<Ts...>::SoAArray(const size_t count)
+    {
+        Resize(count);
+    }
+
+    template <typename... Ts>
+    SoAArray<Ts...>::~SoAArray()
+    {
+        Release();
+    }
+
+    template <typename... Ts>
+    SoAArray<Ts...>::SoAArray(const SoAArray& other)
+    {
+        *this = other;
+    }
+
+    template <typename... Ts>
+    SoAArray<Ts...>& SoAArray<Ts...>::operator=(const SoAArray& other)
+    {
+        if (this == &other) return *this;
+
+        m_Size = 0;
+        Reserve(other.m_Size);
+        [&]<size_t... Is>(std::index_sequence<Is...>)
+        {
+            (std::memcpy(
+                std::get<Is>(m_Columns),
+                std::get<Is>(other.m_Columns),
+                other.m_Size * sizeof(ColumnType<Is>)), ...);
+        }(std::index_sequence_for<Ts...>{});
+        m_Size = other.m_Size;
+        return *this;
+    }
+
+    template <typename... Ts>
+    SoAArray<Ts...>::SoAArray(SoAArray&& other) noexcept
+        : m_Columns(std::exchange(other.m_Columns, {})),
+          m_Size(std::exchange(other.m_Size, 0)),
+          m_Capacity(std::exchange(other.m_Capacity, 0))
+    {
+    }
+
+    template <typename... Ts>
+    SoAArray<Ts...>& SoAArray<Ts...>::operator=(SoAArray&& other) noexcept
+    {
+        if (this == &other) return *this;
+
+        Release();
+        m_Columns = std::exchange(other.m_Columns, {});
+        m_Size = std::exchange(other.m_Size, 0);
+        m_Capacity = std::exchange(other.m_Capacity, 0);
+        return *this;
+    }
+
+    template <typename... Ts>
+    void SoAArray<Ts...>::Reserve(const size_t capacity)
+    {
+        if (capacity > m_Capacity)
+        {
+            Reallocate(PadCount(capacity));
+        }
+    }
+
+    template <typename... Ts>
+    void SoAArray<Ts...>::Resize(const size_t size)
+    {
+        if (size > m_Capacity)
+        {
+            Reallocate(std::max(PadCount(size), m_Capacity * 2));
+        }
+
+        if (size > m_Size)
+        {
+            [&]<size_t... Is>(std::index_sequence<Is...>)
+            {
+                (std::uninitialized_value_construct(
+                    std::get<Is>(m_Columns) + m_Size,
+                    std::get<Is>(m_Columns) + size), ...);
+            }(std::index_sequence_for<Ts...>{});
+        }
+        m_Size = size;
+    }
+
+    template <typename... Ts>
+    void SoAArray<Ts...>::PushBack(const Ts&... values)
+    {
+        if (m_Size == m_Capacity)
+        {
+            // The values may be elements of this array, copy them before their column is freed
+            const std::tuple<Ts...> copies(values...);
+            Reallocate(std::max(PADDING_ELEMENTS, m_Capacity * 2));
+            std::apply([this](const Ts&... copied) { PushBack(copied...); }, copies);
+            return;
+        }
+
+        std::apply([&](Ts*... columns) { ((columns[m_Size] = values), ...); }, m_Columns);
+        ++m_Size;
+    }
+
+    template <typename... Ts>
+    void SoAArray<Ts...>::PopBack()
+    {
+        VA_ENGINE_ASSERT(m_Size > 0, "PopBack called on an empty SoAArray.");
+        --m_Size;
+    }
+
+    template <typename... Ts>
+    void SoAArray<Ts...>::SwapRemove(const size_t index)
+    {
+        VA_ENGINE_ASSERT(index < m_Size, "SoAArray index out of range.");
+        const auto last = m_Size - 1;
+        if (index != last)
+        {
+            std::apply([&](Ts*... columns) { ((columns[index] = columns[last]), ...); },
+                m_Columns);
+        }
+        m_Size = last;
+    }
+
+    template <typename... Ts>
+    typename SoAArray<Ts...>::Reference SoAArray<Ts...>::operator[](const size_t index)
+    {
+        return std::apply([index](Ts*... columns) { return Reference(columns[index]...); },
+            m_Columns);
+    }
+
+    template <typename... Ts>
+    typename SoAArray<Ts...>::ConstReference SoAArray<Ts...>::operator[](
+        const size_t index) const
+    {
+        return std::apply([index](Ts*... columns)
+        {
+            return ConstReference(columns[index]...);
+        }, m_Columns);
+    }
+
+    template <typename... Ts>
+    void SoAArray<Ts...>::Reallocate(const size_t newCapacity)
+    {
+        [&]<size_t... Is>(std::index_sequence<Is...>)
+        {
+            (([&]()
+            {
+                using T = ColumnType<Is>;
+                auto* column = AllocateColumn<T>(newCapacity);
+                auto*& current = std::get<Is>(m_Columns);
+                if (current)
+                {
+                    std::memcpy(column, current, m_Size * sizeof(T));
+                }
+                // Value-initialize everything past the live range so that padded SIMD
+                // loops never read indeterminate memory.
+                std::uninitialized_value_construct(column + m_Size, column + newCapacity);
+                FreeColumn(current);
+                current = column;
+            }()), ...);
+        }(std::index_sequence_for<Ts...>{});
+
+        m_Capacity = newCapacity;
+    }
+
+    template <typename... Ts>
+    void SoAArray<Ts...>::Release()
+    {
+        std::apply([](auto*&... columns) { (FreeColumn(std::exchange(columns, nullptr)), ...); },
+            m_Columns);
+        m_Size = 0;
+        m_Capacity = 0;
+    }
+
+    template <typename... Ts>
+    template <typename T>
+    T* SoAArray<Ts...>::AllocateColumn(const size_t capacity)
+    {
+        return static_cast<T*>(::operator new(
+            capacity * sizeof(T),
+            std::align_val_t{std::max(COLUMN_ALIGNMENT, alignof(T))}));
+    }
+
+    template <typename... Ts>
+    template <typename T>
+    void SoAArray<Ts...>::FreeColumn(T* column)
+    {
+        if (!column) return;
+
+        ::operator delete(column, std::align_val_t{std::max(COLUMN_ALIGNMENT, alignof(T))});
+    }
+} // namespace VoidArchitect::Collections
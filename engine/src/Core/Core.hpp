@@ -71,4 +71,11 @@
 #define VA_ENGINE_ASSERT(x, ...)
 #endif
 
+// Empty members take no space. MSVC accepts the standard attribute but ignores it.
+#if defined(_MSC_VER)
+#define VA_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define VA_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 #define BIT(x) (1 << x)
@@ -0,0 +1,131 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "Hash.hpp"
+
+#include <bit>
+#include <cstring>
+
+namespace VoidArchitect
+{
+    namespace
+    {
+        constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ull;
+        constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ull;
+        constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ull;
+        constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ull;
+
+        /// @brief Little-endian reads, the hash of a file must not depend on the machine
+        uint64_t Read64(const uint8_t* data)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            if constexpr (std::endian::native == std::endian::big)
+            {
+                value = 0;
+                for (int i = 7; i >= 0; --i) value = value << 8 | data[i];
+            }
+            return value;
+        }
+
+        uint32_t Read32(const uint8_t* data)
+        {
+            uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            if constexpr (std::endian::native == std::endian::big)
+            {
+                value = 0;
+                for (int i = 3; i >= 0; --i) value = value << 8 | data[i];
+            }
+            return value;
+        }
+
+        uint64_t Round(uint64_t accumulator, const uint64_t lane)
+        {
+            accumulator += lane * PRIME64_2;
+            accumulator = std::rotl(accumulator, 31);
+            return accumulator * PRIME64_1;
+        }
+
+        uint64_t MergeRound(uint64_t accumulator, const uint64_t value)
+        {
+            accumulator ^= Round(0, value);
+            return accumulator * PRIME64_1 + PRIME64_4;
+        }
+
+        uint64_t Avalanche(uint64_t hash)
+        {
+            hash ^= hash >> 33;
+            hash *= PRIME64_2;
+            hash ^= hash >> 29;
+            hash *= PRIME64_3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+    } // namespace
+
+    uint64_t XXHash64::Hash(const std::span<const uint8_t> bytes, const uint64_t seed)
+    {
+        const uint8_t* data = bytes.data();
+        const uint8_t* const end = data + bytes.size();
+        uint64_t hash;
+
+        if (bytes.size() >= 32)
+        {
+            // Four independent lanes of 8 bytes per stripe, they keep the multipliers busy
+            uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+            uint64_t v2 = seed + PRIME64_2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - PRIME64_1;
+
+            const uint8_t* const limit = end - 32;
+            do
+            {
+                v1 = Round(v1, Read64(data));
+                v2 = Round(v2, Read64(data + 8));
+                v3 = Round(v3, Read64(data + 16));
+                v4 = Round(v4, Read64(data + 24));
+                data += 32;
+            }
+            while (data <= limit);
+
+            hash = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+            hash = MergeRound(hash, v1);
+            hash = MergeRound(hash, v2);
+            hash = MergeRound(hash, v3);
+            hash = MergeRound(hash, v4);
+        }
+        else
+        {
+            hash = seed + PRIME64_5;
+        }
+
+        hash += static_cast<uint64_t>(bytes.size());
+
+        // Remaining bytes, 8, 4 then 1 at a time
+        for (; data + 8 <= end; data += 8)
+        {
+            hash ^= Round(0, Read64(data));
+            hash = std::rotl(hash, 27) * PRIME64_1 + PRIME64_4;
+        }
+        if (data + 4 <= end)
+        {
+            hash ^= static_cast<uint64_t>(Read32(data)) * PRIME64_1;
+            hash = std::rotl(hash, 23) * PRIME64_2 + PRIME64_3;
+            data += 4;
+        }
+        for (; data < end; ++data)
+        {
+            hash ^= static_cast<uint64_t>(*data) * PRIME64_5;
+            hash = std::rotl(hash, 11) * PRIME64_1;
+        }
+
+        return Avalanche(hash);
+    }
+
+    uint64_t XXHash64::Hash(const std::string_view text, const uint64_t seed)
+    {
+        return Hash({reinterpret_cast<const uint8_t*>(text.data()), text.size()}, seed);
+    }
+} // namespace VoidArchitect
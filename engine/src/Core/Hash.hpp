@@ -0,0 +1,38 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+namespace VoidArchitect
+{
+    /// @brief 64-bit xxHash (XXH64) of a byte range
+    ///
+    /// Non-cryptographic, hashes several GB/s and gives the same value as the reference
+    /// implementation on every platform, so the result can be stored on disk and compared on
+    /// another run. Used to detect changed content, not to identify it securely.
+    ///
+    /// Usage example:
+    /// @code
+    /// const auto hash = XXHash64::Hash(file->GetBytes());
+    /// @endcode
+    class XXHash64
+    {
+    public:
+        /// @brief Hash a byte range
+        /// @param bytes Bytes to hash
+        /// @param seed Seed of the hash, different seeds give unrelated hashes
+        /// @return The XXH64 of the bytes
+        static uint64_t Hash(std::span<const uint8_t> bytes, uint64_t seed = 0);
+
+        /// @brief Hash the object representation of a trivially copyable value
+        template <typename T>
+            requires std::is_trivially_copyable_v<T>
+        static uint64_t HashValue(const T& value, const uint64_t seed = 0)
+        {
+            return Hash({reinterpret_cast<const uint8_t*>(&value), sizeof(T)}, seed);
+        }
+
+        /// @brief Hash the characters of a string
+        static uint64_t Hash(std::string_view text, uint64_t seed = 0);
+    };
+} // namespace VoidArchitect
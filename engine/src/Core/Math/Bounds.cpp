@@ -0,0 +1,207 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "Bounds.hpp"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define VA_BOUNDS_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VA_BOUNDS_NEON 1
+#endif
+
+namespace VoidArchitect::Math
+{
+    namespace
+    {
+        const float* PointAt(const float* positions, const size_t index, const size_t stride)
+        {
+            return reinterpret_cast<const float*>(
+                reinterpret_cast<const uint8_t*>(positions) + index * stride);
+        }
+
+        /// @brief Min/max corners of a non-empty set of points
+        void ComputeMinMax(
+            const float* positions,
+            const size_t count,
+            const size_t stride,
+            float outMin[3],
+            float outMax[3])
+        {
+            // Every SIMD load reads a fourth float past z. It belongs to the next point (or
+            // vertex attribute) except for the last point when the array is packed, so the
+            // vector loop stops one point early and the last point goes through the scalar
+            // path.
+            size_t i = 0;
+#if defined(VA_BOUNDS_SSE2)
+            __m128 min0 = _mm_set_ps(0.0f, positions[2], positions[1], positions[0]);
+            __m128 max0 = min0;
+            __m128 min1 = min0;
+            __m128 max1 = min0;
+            for (; i + 2 < count; i += 2)
+            {
+                const __m128 p0 = _mm_loadu_ps(PointAt(positions, i, stride));
+                const __m128 p1 = _mm_loadu_ps(PointAt(positions, i + 1, stride));
+                min0 = _mm_min_ps(min0, p0);
+                max0 = _mm_max_ps(max0, p0);
+                min1 = _mm_min_ps(min1, p1);
+                max1 = _mm_max_ps(max1, p1);
+            }
+
+            alignas(16) float minLanes[4];
+            alignas(16) float maxLanes[4];
+            _mm_store_ps(minLanes, _mm_min_ps(min0, min1));
+            _mm_store_ps(maxLanes, _mm_max_ps(max0, max1));
+#elif defined(VA_BOUNDS_NEON)
+            const float first[4] = {positions[0], positions[1], positions[2], 0.0f};
+            float32x4_t min0 = vld1q_f32(first);
+            float32x4_t max0 = min0;
+            float32x4_t min1 = min0;
+            float32x4_t max1 = min0;
+            for (; i + 2 < count; i += 2)
+            {
+                const float32x4_t p0 = vld1q_f32(PointAt(positions, i, stride));
+                const float32x4_t p1 = vld1q_f32(PointAt(positions, i + 1, stride));
+                min0 = vminq_f32(min0, p0);
+                max0 = vmaxq_f32(max0, p0);
+                min1 = vminq_f32(min1, p1);
+                max1 = vmaxq_f32(max1, p1);
+            }
+
+            float minLanes[4];
+            float maxLanes[4];
+            vst1q_f32(minLanes, vminq_f32(min0, min1));
+            vst1q_f32(maxLanes, vmaxq_f32(max0, max1));
+#else
+            const float minLanes[3] = {positions[0], positions[1], positions[2]};
+            const float maxLanes[3] = {positions[0], positions[1], positions[2]};
+#endif
+
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                outMin[axis] = minLanes[axis];
+                outMax[axis] = maxLanes[axis];
+            }
+
+            for (; i < count; ++i)
+            {
+                const auto* point = PointAt(positions, i, stride);
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    outMin[axis] = std::min(outMin[axis], point[axis]);
+                    outMax[axis] = std::max(outMax[axis], point[axis]);
+                }
+            }
+        }
+
+        /// @brief Largest squared distance between a center and the points
+        float ComputeMaxDistanceSq(
+            const float* positions,
+            const size_t count,
+            const size_t stride,
+            const float center[3])
+        {
+            float maxDistanceSq = 0.0f;
+            size_t i = 0;
+#if defined(VA_BOUNDS_SSE2)
+            const __m128 c = _mm_set_ps(0.0f, center[2], center[1], center[0]);
+            const __m128 xyzMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+            __m128 best = _mm_setzero_ps();
+            for (; i + 1 < count; ++i)
+            {
+                const __m128 d = _mm_and_ps(
+                    _mm_sub_ps(_mm_loadu_ps(PointAt(positions, i, stride)), c),
+                    xyzMask);
+                const __m128 d2 = _mm_mul_ps(d, d);
+                const __m128 sum = _mm_add_ps(d2, _mm_movehl_ps(d2, d2));
+                best = _mm_max_ss(best, _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+            }
+            maxDistanceSq = _mm_cvtss_f32(best);
+#elif defined(VA_BOUNDS_NEON)
+            const float lanes[4] = {center[0], center[1], center[2], 0.0f};
+            const float32x4_t c = vld1q_f32(lanes);
+            float32x4_t best = vdupq_n_f32(0.0f);
+            for (; i + 1 < count; ++i)
+            {
+                float32x4_t d = vsubq_f32(vld1q_f32(PointAt(positions, i, stride)), c);
+                d = vsetq_lane_f32(0.0f, d, 3);
+                best = vmaxq_f32(best, vdupq_n_f32(vaddvq_f32(vmulq_f32(d, d))));
+            }
+            maxDistanceSq = vgetq_lane_f32(best, 0);
+#endif
+
+            for (; i < count; ++i)
+            {
+                const auto* point = PointAt(positions, i, stride);
+                const float dx = point[0] - center[0];
+                const float dy = point[1] - center[1];
+                const float dz = point[2] - center[2];
+                maxDistanceSq = std::max(maxDistanceSq, dx * dx + dy * dy + dz * dz);
+            }
+
+            return maxDistanceSq;
+        }
+    } // namespace
+
+    Bounds Bounds::FromPoints(const float* positions, const size_t count, const size_t stride)
+    {
+        Bounds bounds;
+        if (positions == nullptr || count == 0) return bounds;
+
+        float min[3];
+        float max[3];
+        ComputeMinMax(positions, count, stride, min, max);
+
+        const float center[3] = {
+            (min[0] + max[0]) * 0.5f,
+            (min[1] + max[1]) * 0.5f,
+            (min[2] + max[2]) * 0.5f
+        };
+
+        bounds.min = Vec3(min[0], min[1], min[2]);
+        bounds.max = Vec3(max[0], max[1], max[2]);
+        bounds.center = Vec3(center[0], center[1], center[2]);
+        bounds.radius = std::sqrt(ComputeMaxDistanceSq(positions, count, stride, center));
+        return bounds;
+    }
+
+    Bounds Bounds::Merge(const Bounds& a, const Bounds& b)
+    {
+        if (!a.IsValid()) return b;
+        if (!b.IsValid()) return a;
+
+        Bounds merged;
+        merged.min = Vec3(
+            std::min(a.min.X(), b.min.X()),
+            std::min(a.min.Y(), b.min.Y()),
+            std::min(a.min.Z(), b.min.Z()));
+        merged.max = Vec3(
+            std::max(a.max.X(), b.max.X()),
+            std::max(a.max.Y(), b.max.Y()),
+            std::max(a.max.Z(), b.max.Z()));
+
+        // Sphere enclosing both spheres, or the larger one if it already contains the other
+        const Vec3 offset = b.center - a.center;
+        const float distance = std::sqrt(Vec3::Dot(offset, offset));
+        if (distance + b.radius <= a.radius)
+        {
+            merged.center = a.center;
+            merged.radius = a.radius;
+        }
+        else if (distance + a.radius <= b.radius)
+        {
+            merged.center = b.center;
+            merged.radius = b.radius;
+        }
+        else
+        {
+            merged.radius = (distance + a.radius + b.radius) * 0.5f;
+            merged.center = a.center + offset * ((merged.radius - a.radius) / distance);
+        }
+
+        return merged;
+    }
+} // namespace VoidArchitect::Math
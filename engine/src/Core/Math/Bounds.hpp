@@ -0,0 +1,54 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "Vec3.hpp"
+
+namespace VoidArchitect::Math
+{
+    /// @brief Axis-aligned bounding box and bounding sphere of a set of points
+    ///
+    /// Both volumes are kept together because culling usually tests the cheap sphere first
+    /// and only falls back to the tighter box when the sphere intersects. The sphere is
+    /// centered on the box and its radius reaches the farthest point, which is not the
+    /// minimal sphere but is exact, stable and fast to compute.
+    ///
+    /// A default-constructed Bounds is empty (IsValid() returns false) and acts as the
+    /// identity for Merge().
+    struct Bounds
+    {
+        Vec3 min = Vec3(
+            std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::max()); ///< Box minimum corner
+        Vec3 max = Vec3(
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::lowest()); ///< Box maximum corner
+        Vec3 center; ///< Sphere center
+        float radius = 0.0f; ///< Sphere radius
+
+        /// @brief Check that the bounds contain at least one point
+        [[nodiscard]] bool IsValid() const
+        {
+            return min.X() <= max.X() && min.Y() <= max.Y() && min.Z() <= max.Z();
+        }
+
+        /// @brief Half size of the box along each axis
+        [[nodiscard]] Vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+        /// @brief Compute the bounds of a strided array of points
+        /// @param positions Pointer to the x component of the first point, y and z follow it
+        /// @param count Number of points
+        /// @param stride Distance in bytes between two consecutive points (12 if packed)
+        /// @return Bounds of the points, empty if count is 0
+        ///
+        /// Runs a SIMD min/max kernel (SSE2 or NEON when available) over the points, then a
+        /// second SIMD pass for the sphere radius.
+        static Bounds FromPoints(const float* positions, size_t count, size_t stride);
+
+        /// @brief Smallest bounds enclosing two bounds
+        /// @return Union of both boxes and the sphere enclosing both spheres
+        static Bounds Merge(const Bounds& a, const Bounds& b);
+    };
+} // namespace VoidArchitect::Math
@@ -0,0 +1,51 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "Frustum.hpp"
+
+#include "Mat4.hpp"
+
+#include <cmath>
+
+namespace VoidArchitect::Math
+{
+    namespace
+    {
+        Vec4 NormalizePlane(const Vec4& plane)
+        {
+            const float length = std::sqrt(
+                plane.X() * plane.X() + plane.Y() * plane.Y() + plane.Z() * plane.Z());
+            return length > 0.0f ? plane / length : plane;
+        }
+    } // namespace
+
+    Frustum Frustum::FromMatrix(const Mat4& matrix)
+    {
+        // Row i of the matrix is column i of its transpose
+        const auto transposed = Mat4::Transpose(matrix);
+        const Vec4 row0 = transposed * Vec4(1.0f, 0.0f, 0.0f, 0.0f);
+        const Vec4 row1 = transposed * Vec4(0.0f, 1.0f, 0.0f, 0.0f);
+        const Vec4 row2 = transposed * Vec4(0.0f, 0.0f, 1.0f, 0.0f);
+        const Vec4 row3 = transposed * Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+        Frustum frustum;
+        frustum.planes[Left] = NormalizePlane(row3 + row0);
+        frustum.planes[Right] = NormalizePlane(row3 - row0);
+        frustum.planes[Bottom] = NormalizePlane(row3 + row1);
+        frustum.planes[Top] = NormalizePlane(row3 - row1);
+        frustum.planes[Near] = NormalizePlane(row2); // 0 <= z, not -w <= z
+        frustum.planes[Far] = NormalizePlane(row3 - row2);
+        return frustum;
+    }
+
+    bool Frustum::IntersectsSphere(const Vec3& center, const float radius) const
+    {
+        for (const auto& plane : planes)
+        {
+            const float distance = plane.X() * center.X() + plane.Y() * center.Y() +
+                plane.Z() * center.Z() + plane.W();
+            if (distance < -radius) return false;
+        }
+        return true;
+    }
+} // namespace VoidArchitect::Math
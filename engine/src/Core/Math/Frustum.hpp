@@ -0,0 +1,45 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "Vec3.hpp"
+#include "Vec4.hpp"
+
+namespace VoidArchitect::Math
+{
+    class Mat4;
+
+    /// @brief Six clipping planes of a view volume
+    ///
+    /// Each plane is stored as (normal.x, normal.y, normal.z, d) with a unit normal pointing
+    /// inside the volume, so that a point p is inside the plane when dot(normal, p) + d >= 0.
+    ///
+    /// Planes are expressed in the space of the matrix they are extracted from: passing
+    /// projection * view gives world-space planes, projection * view * model gives planes in
+    /// the object space of that model, which lets object-space bounds be tested directly.
+    struct Frustum
+    {
+        enum Plane : uint32_t
+        {
+            Left = 0,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            Count
+        };
+
+        std::array<Vec4, Plane::Count> planes; ///< Normalized planes, normals point inside
+
+        /// @brief Extract the planes of a projection matrix (Gribb and Hartmann)
+        /// @param matrix Projection matrix with a [0, 1] depth range, as built by
+        ///        Mat4::Perspective() and Mat4::Orthographic(), optionally combined with a view
+        ///        and a model matrix
+        static Frustum FromMatrix(const Mat4& matrix);
+
+        /// @brief Conservative sphere test
+        /// @return false only if the sphere lies entirely outside one of the planes
+        [[nodiscard]] bool IntersectsSphere(const Vec3& center, float radius) const;
+    };
+} // namespace VoidArchitect::Math
@@ -0,0 +1,152 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "MemoryTracker.hpp"
+
+#include "Core/Logger.hpp"
+
+namespace VoidArchitect::Memory
+{
+    const char* MemoryTagToString(const MemoryTag tag)
+    {
+        switch (tag)
+        {
+            case MemoryTag::Unknown:
+                return "Unknown";
+            case MemoryTag::Jobs:
+                return "Jobs";
+            case MemoryTag::Mesh:
+                return "Mesh";
+            case MemoryTag::Texture:
+                return "Texture";
+            case MemoryTag::Render:
+                return "Render";
+            case MemoryTag::Loader:
+                return "Loader";
+            default:
+                return "Invalid";
+        }
+    }
+
+    void MemoryTracker::RecordAllocation(const MemoryTag tag, const size_t size)
+    {
+        auto& counters = m_Tags[static_cast<size_t>(tag)];
+        counters.currentAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        const auto current = counters.currentBytes.fetch_add(size, std::memory_order_relaxed) +
+            size;
+        auto peak = counters.peakBytes.load(std::memory_order_relaxed);
+        while (current > peak && !counters.peakBytes.compare_exchange_weak(
+            peak,
+            current,
+            std::memory_order_relaxed))
+        {
+        }
+
+        const auto budget = counters.budgetBytes.load(std::memory_order_relaxed);
+        if (budget != 0 && current > budget &&
+            !counters.budgetWarned.exchange(true, std::memory_order_relaxed))
+        {
+            VA_ENGINE_WARN(
+                "[MemoryTracker] {} is over its budget: {} KiB used, {} KiB budgeted.",
+                MemoryTagToString(tag),
+                current / 1024,
+                budget / 1024);
+        }
+    }
+
+    void MemoryTracker::RecordDeallocation(const MemoryTag tag, const size_t size)
+    {
+        auto& counters = m_Tags[static_cast<size_t>(tag)];
+        counters.currentAllocations.fetch_sub(1, std::memory_order_relaxed);
+        const auto current = counters.currentBytes.fetch_sub(size, std::memory_order_relaxed) -
+            size;
+
+        // Re-arm the warning once the tag is back under its budget.
+        const auto budget = counters.budgetBytes.load(std::memory_order_relaxed);
+        if (budget != 0 && current <= budget)
+        {
+            counters.budgetWarned.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void MemoryTracker::SetBudget(const MemoryTag tag, const size_t budgetBytes)
+    {
+        auto& counters = m_Tags[static_cast<size_t>(tag)];
+        counters.budgetBytes.store(budgetBytes, std::memory_order_relaxed);
+        counters.budgetWarned.store(false, std::memory_order_relaxed);
+    }
+
+    size_t MemoryTracker::GetBudget(const MemoryTag tag) const
+    {
+        return m_Tags[static_cast<size_t>(tag)].budgetBytes.load(std::memory_order_relaxed);
+    }
+
+    MemoryTagStats MemoryTracker::GetStats(const MemoryTag tag) const
+    {
+        const auto& counters = m_Tags[static_cast<size_t>(tag)];
+
+        MemoryTagStats stats;
+        stats.currentBytes = counters.currentBytes.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.currentAllocations = counters.currentAllocations.load(std::memory_order_relaxed);
+        stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+        stats.budgetBytes = counters.budgetBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    MemorySnapshot MemoryTracker::GetSnapshot() const
+    {
+        MemorySnapshot snapshot;
+        for (size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+        {
+            snapshot.tags[i] = GetStats(static_cast<MemoryTag>(i));
+            snapshot.totalCurrentBytes += snapshot.tags[i].currentBytes;
+            snapshot.totalPeakBytes += snapshot.tags[i].peakBytes;
+        }
+        return snapshot;
+    }
+
+    void MemoryTracker::ResetPeaks()
+    {
+        for (auto& counters : m_Tags)
+        {
+            counters.peakBytes.store(
+                counters.currentBytes.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+    }
+
+    void MemoryTracker::LogSnapshot() const
+    {
+        const auto snapshot = GetSnapshot();
+        VA_ENGINE_INFO(
+            "[MemoryTracker] Memory usage: {} KiB (peak {} KiB).",
+            snapshot.totalCurrentBytes / 1024,
+            snapshot.totalPeakBytes / 1024);
+
+        for (size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+        {
+            const auto& stats = snapshot.tags[i];
+            if (stats.totalAllocations == 0) continue;
+
+            VA_ENGINE_INFO(
+                "[MemoryTracker] - {:<8}: {} KiB in {} allocs (peak {} KiB, {} total allocs{}).",
+                MemoryTagToString(static_cast<MemoryTag>(i)),
+                stats.currentBytes / 1024,
+                stats.currentAllocations,
+                stats.peakBytes / 1024,
+                stats.totalAllocations,
+                stats.budgetBytes != 0
+                ? std::string(", budget ") + std::to_string(stats.budgetBytes / 1024) + " KiB"
+                : std::string());
+        }
+    }
+
+    MemoryTracker& GetMemoryTracker()
+    {
+        static MemoryTracker s_Tracker;
+        return s_Tracker;
+    }
+} // namespace VoidArchitect::Memory
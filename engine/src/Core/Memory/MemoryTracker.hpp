@@ -0,0 +1,249 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "Core/Core.hpp"
+
+namespace VoidArchitect::Memory
+{
+    /// @brief Engine subsystems memory usage is accounted against
+    enum class MemoryTag : uint8_t
+    {
+        Unknown = 0, ///< Allocation without a known owner
+        Jobs, ///< Job system storage and continuation lists
+        Mesh, ///< Mesh objects and CPU copies of mesh data
+        Texture, ///< Texture objects and upload staging copies
+        Render, ///< Pipelines, materials and other render states
+        Loader, ///< Loader definitions and decompression buffers
+
+        Count
+    };
+
+    /// @brief Number of memory tags
+    constexpr size_t MEMORY_TAG_COUNT = static_cast<size_t>(MemoryTag::Count);
+
+    /// @brief Whether the engine was built with memory tracking (VA_ENABLE_MEMORY_TRACKING)
+#ifdef VA_ENABLE_MEMORY_TRACKING
+    constexpr bool MEMORY_TRACKING_ENABLED = true;
+#else
+    constexpr bool MEMORY_TRACKING_ENABLED = false;
+#endif
+
+    /// @brief Get the display name of a memory tag
+    const char* MemoryTagToString(MemoryTag tag);
+
+    /// @brief Memory usage of a single tag
+    struct MemoryTagStats
+    {
+        size_t currentBytes = 0; ///< Bytes currently allocated
+        size_t peakBytes = 0; ///< Highest number of bytes allocated at once
+        size_t currentAllocations = 0; ///< Allocations currently alive
+        size_t totalAllocations = 0; ///< Total number of allocations recorded
+        size_t budgetBytes = 0; ///< Soft budget in bytes, 0 when unbudgeted
+
+        [[nodiscard]] bool IsOverBudget() const
+        {
+            return budgetBytes != 0 && currentBytes > budgetBytes;
+        }
+    };
+
+    /// @brief Point-in-time copy of the memory usage of every tag
+    struct MemorySnapshot
+    {
+        std::array<MemoryTagStats, MEMORY_TAG_COUNT> tags{};
+        size_t totalCurrentBytes = 0; ///< Sum of the current bytes of every tag
+        size_t totalPeakBytes = 0; ///< Sum of the peak bytes of every tag
+
+        [[nodiscard]] const MemoryTagStats& operator[](const MemoryTag tag) const
+        {
+            return tags[static_cast<size_t>(tag)];
+        }
+    };
+
+    /// @brief Thread-safe per-subsystem memory accounting with soft budgets
+    ///
+    /// MemoryTracker keeps, for every MemoryTag, the current and peak number of bytes and
+    /// the number of allocations attributed to that tag. Each tag can be given a soft
+    /// budget: crossing it logs a warning once, the warning is re-armed when the usage
+    /// drops back under the budget. Budgets never fail an allocation.
+    ///
+    /// The tracker only counts what it is told about. Engine code reports its allocations
+    /// through TrackAllocation()/TrackDeallocation() or a TrackedMemory member, both of
+    /// which compile to nothing unless VA_ENABLE_MEMORY_TRACKING is defined (Debug builds,
+    /// or the VOID_ARCHITECT_MEMORY_TRACKING CMake option).
+    ///
+    /// Usage example:
+    /// @code
+    /// Memory::GetMemoryTracker().SetBudget(Memory::MemoryTag::Texture, 512 * 1024 * 1024);
+    /// // ...
+    /// const auto snapshot = Memory::GetMemoryTracker().GetSnapshot();
+    /// VA_ENGINE_INFO("Textures: {} bytes", snapshot[Memory::MemoryTag::Texture].currentBytes);
+    /// @endcode
+    class MemoryTracker
+    {
+    public:
+        MemoryTracker() = default;
+        ~MemoryTracker() = default;
+
+        MemoryTracker(const MemoryTracker&) = delete;
+        MemoryTracker& operator=(const MemoryTracker&) = delete;
+        MemoryTracker(MemoryTracker&&) = delete;
+        MemoryTracker& operator=(MemoryTracker&&) = delete;
+
+        // === Recording ===
+
+        /// @brief Record `size` bytes allocated on behalf of `tag`
+        void RecordAllocation(MemoryTag tag, size_t size);
+
+        /// @brief Record `size` bytes released on behalf of `tag`
+        void RecordDeallocation(MemoryTag tag, size_t size);
+
+        // === Budgets ===
+
+        /// @brief Set the soft budget of a tag
+        /// @param tag Tag to configure
+        /// @param budgetBytes Budget in bytes, 0 removes the budget
+        void SetBudget(MemoryTag tag, size_t budgetBytes);
+
+        /// @brief Get the soft budget of a tag, 0 when unbudgeted
+        size_t GetBudget(MemoryTag tag) const;
+
+        // === Statistics ===
+
+        /// @brief Get the usage of a single tag
+        MemoryTagStats GetStats(MemoryTag tag) const;
+
+        /// @brief Get the usage of every tag at once
+        MemorySnapshot GetSnapshot() const;
+
+        /// @brief Reset the peak of every tag to its current usage
+        void ResetPeaks();
+
+        /// @brief Log the usage of every tag that recorded at least one allocation
+        void LogSnapshot() const;
+
+    private:
+        struct alignas(64) TagCounters
+        {
+            std::atomic<size_t> currentBytes{0};
+            std::atomic<size_t> peakBytes{0};
+            std::atomic<size_t> currentAllocations{0};
+            std::atomic<size_t> totalAllocations{0};
+            std::atomic<size_t> budgetBytes{0};
+            std::atomic<bool> budgetWarned{false};
+        };
+
+        std::array<TagCounters, MEMORY_TAG_COUNT> m_Tags;
+    };
+
+    /// @brief Get the engine-wide memory tracker
+    /// @return Reference to the process-wide tracker instance
+    MemoryTracker& GetMemoryTracker();
+
+    // === Tracking helpers ===
+
+    /// @brief Report an allocation to the engine tracker, no-op when tracking is disabled
+    inline void TrackAllocation([[maybe_unused]] const MemoryTag tag,
+                                [[maybe_unused]] const size_t size)
+    {
+#ifdef VA_ENABLE_MEMORY_TRACKING
+        GetMemoryTracker().RecordAllocation(tag, size);
+#endif
+    }
+
+    /// @brief Report a deallocation to the engine tracker, no-op when tracking is disabled
+    inline void TrackDeallocation([[maybe_unused]] const MemoryTag tag,
+                                  [[maybe_unused]] const size_t size)
+    {
+#ifdef VA_ENABLE_MEMORY_TRACKING
+        GetMemoryTracker().RecordDeallocation(tag, size);
+#endif
+    }
+
+    /// @brief RAII accounting of a memory footprint owned by an object
+    ///
+    /// Holds a byte count attributed to TAG for as long as it lives. Copies account for
+    /// their own footprint, moves transfer it. Meant to be embedded next to the storage it
+    /// describes and updated whenever that storage changes size.
+    /// When tracking is disabled the class is empty and every member is a no-op.
+    ///
+    /// @tparam TAG Tag the footprint is attributed to
+    ///
+    /// Usage example:
+    /// @code
+    /// VAArray<uint8_t> m_Data;
+    /// VA_NO_UNIQUE_ADDRESS Memory::TrackedMemory<Memory::MemoryTag::Loader> m_TrackedMemory;
+    /// // ...
+    /// m_TrackedMemory.Update(m_Data.size());
+    /// @endcode
+    template <MemoryTag TAG>
+    class TrackedMemory
+    {
+    public:
+        TrackedMemory() = default;
+
+#ifdef VA_ENABLE_MEMORY_TRACKING
+        explicit TrackedMemory(const size_t bytes)
+            : m_Bytes(bytes)
+        {
+            if (m_Bytes != 0) TrackAllocation(TAG, m_Bytes);
+        }
+
+        ~TrackedMemory() { Update(0); }
+
+        TrackedMemory(const TrackedMemory& other)
+            : TrackedMemory(other.m_Bytes)
+        {
+        }
+
+        TrackedMemory& operator=(const TrackedMemory& other)
+        {
+            Update(other.m_Bytes);
+            return *this;
+        }
+
+        TrackedMemory(TrackedMemory&& other) noexcept
+            : m_Bytes(std::exchange(other.m_Bytes, 0))
+        {
+        }
+
+        TrackedMemory& operator=(TrackedMemory&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Update(0);
+                m_Bytes = std::exchange(other.m_Bytes, 0);
+            }
+            return *this;
+        }
+
+        /// @brief Replace the tracked footprint
+        void Update(const size_t bytes)
+        {
+            if (bytes == m_Bytes) return;
+            if (m_Bytes != 0) TrackDeallocation(TAG, m_Bytes);
+            if (bytes != 0) TrackAllocation(TAG, bytes);
+            m_Bytes = bytes;
+        }
+
+        [[nodiscard]] size_t GetBytes() const { return m_Bytes; }
+
+    private:
+        size_t m_Bytes = 0;
+#else
+        explicit TrackedMemory(size_t)
+        {
+        }
+
+        void Update(size_t)
+        {
+        }
+
+        [[nodiscard]] size_t GetBytes() const { return 0; }
+#endif
+    };
+} // namespace VoidArchitect::Memory
@@ -0,0 +1,315 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "PoolAllocator.hpp"
+
+#include "Core/Logger.hpp"
+
+namespace VoidArchitect::Memory
+{
+    PoolAllocator::~PoolAllocator()
+    {
+        for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+        {
+            auto& pool = m_Pools[i];
+            const auto live = pool.allocations.load() - pool.deallocations.load();
+            if (live != 0)
+            {
+                VA_ENGINE_WARN(
+                    "[PoolAllocator] Pool {} ({} bytes) destroyed with {} live blocks.",
+                    i,
+                    SIZE_CLASSES[i],
+                    live);
+            }
+
+            for (auto* chunk : pool.chunks)
+            {
+                ::operator delete(chunk, std::align_val_t{POOL_ALIGNMENT});
+            }
+            pool.chunks.clear();
+            pool.freeList = nullptr;
+        }
+    }
+
+    void* PoolAllocator::Allocate(const size_t size, const size_t alignment, const MemoryTag tag)
+    {
+        const auto poolIndex = GetSizeClassIndex(size);
+        if (poolIndex == LARGE_POOL_INDEX || alignment > POOL_ALIGNMENT)
+        {
+            return AllocateLarge(size, alignment, tag);
+        }
+
+        auto& pool = m_Pools[poolIndex];
+        FreeBlock* block = nullptr;
+
+        auto& cache = GetThreadCache();
+        if (cache.owner == this)
+        {
+            if (cache.heads[poolIndex])
+            {
+                pool.threadCacheHits.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                RefillThreadCache(cache, poolIndex);
+            }
+
+            block = cache.heads[poolIndex];
+            cache.heads[poolIndex] = block->next;
+            --cache.counts[poolIndex];
+        }
+        else
+        {
+            // Only the global allocator owns thread caches, other instances always go through
+            // the central free list.
+            std::lock_guard lock(pool.mutex);
+            if (!pool.freeList) GrowPool(pool, poolIndex);
+            block = pool.freeList;
+            pool.freeList = block->next;
+        }
+
+        RecordAllocation(pool);
+        TrackAllocation(tag, SIZE_CLASSES[poolIndex]);
+
+        auto* header = reinterpret_cast<BlockHeader*>(block);
+        header->poolIndex = static_cast<uint16_t>(poolIndex);
+        header->tag = tag;
+        header->offset = BLOCK_HEADER_SIZE;
+        return reinterpret_cast<std::byte*>(header) + BLOCK_HEADER_SIZE;
+    }
+
+    void PoolAllocator::Deallocate(void* ptr)
+    {
+        if (!ptr) return;
+
+        auto* header = reinterpret_cast<BlockHeader*>(static_cast<std::byte*>(ptr) -
+            BLOCK_HEADER_SIZE);
+        const auto poolIndex = header->poolIndex;
+        if (poolIndex == LARGE_POOL_INDEX)
+        {
+            DeallocateLarge(header);
+            return;
+        }
+
+        VA_ENGINE_ASSERT(poolIndex < SIZE_CLASS_COUNT, "Corrupted pool block header.");
+
+        auto& pool = m_Pools[poolIndex];
+        pool.deallocations.fetch_add(1, std::memory_order_relaxed);
+        TrackDeallocation(header->tag, SIZE_CLASSES[poolIndex]);
+
+        auto* block = reinterpret_cast<FreeBlock*>(header);
+        auto& cache = GetThreadCache();
+        if (cache.owner == this)
+        {
+            block->next = cache.heads[poolIndex];
+            cache.heads[poolIndex] = block;
+            if (++cache.counts[poolIndex] > THREAD_CACHE_CAPACITY)
+            {
+                DrainThreadCache(cache, poolIndex, THREAD_CACHE_BATCH);
+            }
+            return;
+        }
+
+        std::lock_guard lock(pool.mutex);
+        block->next = pool.freeList;
+        pool.freeList = block;
+    }
+
+    void PoolAllocator::FlushThreadCache()
+    {
+        auto& cache = GetThreadCache();
+        if (cache.owner != this) return;
+
+        for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+        {
+            DrainThreadCache(cache, i, cache.counts[i]);
+        }
+    }
+
+    PoolStats PoolAllocator::GetStats(const size_t poolIndex) const
+    {
+        PoolStats stats;
+        if (poolIndex > LARGE_POOL_INDEX) return stats;
+
+        const auto& pool = m_Pools[poolIndex];
+        stats.blockSize = poolIndex < SIZE_CLASS_COUNT ? SIZE_CLASSES[poolIndex] : 0;
+        stats.allocations = pool.allocations.load(std::memory_order_relaxed);
+        stats.deallocations = pool.deallocations.load(std::memory_order_relaxed);
+        stats.liveBlocks = stats.allocations >= stats.deallocations
+            ? stats.allocations - stats.deallocations
+            : 0;
+        stats.peakLiveBlocks = pool.peakLiveBlocks.load(std::memory_order_relaxed);
+        stats.reservedBytes = pool.reservedBytes.load(std::memory_order_relaxed);
+        stats.threadCacheHits = pool.threadCacheHits.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::array<PoolStats, PoolAllocator::SIZE_CLASS_COUNT + 1> PoolAllocator::GetAllStats() const
+    {
+        std::array<PoolStats, SIZE_CLASS_COUNT + 1> stats;
+        for (size_t i = 0; i <= LARGE_POOL_INDEX; ++i)
+        {
+            stats[i] = GetStats(i);
+        }
+        return stats;
+    }
+
+    void PoolAllocator::LogStats() const
+    {
+        VA_ENGINE_INFO("[PoolAllocator] Pool statistics:");
+        for (size_t i = 0; i <= LARGE_POOL_INDEX; ++i)
+        {
+            const auto stats = GetStats(i);
+            if (stats.allocations == 0) continue;
+
+            VA_ENGINE_INFO(
+                "[PoolAllocator] - {:>5} : {} live (peak {}), {} allocs, {} cache hits, {} KiB "
+                "reserved.",
+                i == LARGE_POOL_INDEX ? std::string("large") : std::to_string(stats.blockSize),
+                stats.liveBlocks,
+                stats.peakLiveBlocks,
+                stats.allocations,
+                stats.threadCacheHits,
+                stats.reservedBytes / 1024);
+        }
+    }
+
+    PoolAllocator::ThreadCache::~ThreadCache()
+    {
+        if (!owner) return;
+
+        for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+        {
+            owner->DrainThreadCache(*this, i, counts[i]);
+        }
+    }
+
+    PoolAllocator::ThreadCache& PoolAllocator::GetThreadCache()
+    {
+        thread_local ThreadCache s_Cache{{}, {}, &GetPoolAllocator()};
+        return s_Cache;
+    }
+
+    void PoolAllocator::RefillThreadCache(ThreadCache& cache, const size_t poolIndex)
+    {
+        auto& pool = m_Pools[poolIndex];
+        std::lock_guard lock(pool.mutex);
+
+        for (size_t i = 0; i < THREAD_CACHE_BATCH; ++i)
+        {
+            if (!pool.freeList) GrowPool(pool, poolIndex);
+
+            auto* block = pool.freeList;
+            pool.freeList = block->next;
+            block->next = cache.heads[poolIndex];
+            cache.heads[poolIndex] = block;
+        }
+        cache.counts[poolIndex] += THREAD_CACHE_BATCH;
+    }
+
+    void PoolAllocator::DrainThreadCache(
+        ThreadCache& cache,
+        const size_t poolIndex,
+        const size_t count)
+    {
+        if (count == 0) return;
+
+        // Detach the blocks from the cache before taking the lock.
+        auto* first = cache.heads[poolIndex];
+        auto* last = first;
+        for (size_t i = 1; i < count; ++i)
+        {
+            last = last->next;
+        }
+        cache.heads[poolIndex] = last->next;
+        cache.counts[poolIndex] -= count;
+
+        auto& pool = m_Pools[poolIndex];
+        std::lock_guard lock(pool.mutex);
+        last->next = pool.freeList;
+        pool.freeList = first;
+    }
+
+    void PoolAllocator::GrowPool(Pool& pool, const size_t poolIndex)
+    {
+        const auto stride = SIZE_CLASSES[poolIndex] + BLOCK_HEADER_SIZE;
+        const auto blockCount = std::max<size_t>(CHUNK_SIZE / stride, 1);
+        const auto chunkSize = blockCount * stride;
+
+        auto* chunk = static_cast<std::byte*>(
+            ::operator new(chunkSize, std::align_val_t{POOL_ALIGNMENT}));
+        pool.chunks.push_back(chunk);
+        pool.reservedBytes.fetch_add(chunkSize, std::memory_order_relaxed);
+
+        // Thread the new blocks in address order in front of the existing free list.
+        for (size_t i = blockCount; i-- > 0;)
+        {
+            auto* block = reinterpret_cast<FreeBlock*>(chunk + i * stride);
+            block->next = pool.freeList;
+            pool.freeList = block;
+        }
+    }
+
+    void* PoolAllocator::AllocateLarge(
+        const size_t size,
+        const size_t alignment,
+        const MemoryTag tag)
+    {
+        // Keep the user pointer aligned while leaving room for the header in front of it.
+        const auto offset = std::max(alignment, BLOCK_HEADER_SIZE);
+        const auto align = offset;
+        auto* base = static_cast<std::byte*>(
+            ::operator new(size + offset, std::align_val_t{align}));
+
+        auto* header = reinterpret_cast<BlockHeader*>(base + offset - BLOCK_HEADER_SIZE);
+        header->poolIndex = static_cast<uint16_t>(LARGE_POOL_INDEX);
+        header->tag = tag;
+        header->offset = static_cast<uint32_t>(offset);
+        header->size = size;
+
+        auto& pool = m_Pools[LARGE_POOL_INDEX];
+        pool.reservedBytes.fetch_add(size + offset, std::memory_order_relaxed);
+        RecordAllocation(pool);
+        TrackAllocation(tag, size);
+
+        return base + offset;
+    }
+
+    void PoolAllocator::DeallocateLarge(BlockHeader* header)
+    {
+        auto* user = reinterpret_cast<std::byte*>(header) + BLOCK_HEADER_SIZE;
+        auto* base = user - header->offset;
+        // The offset is max(alignment, BLOCK_HEADER_SIZE), which is also the alignment used
+        // for the system allocation.
+        const auto align = static_cast<size_t>(header->offset);
+
+        auto& pool = m_Pools[LARGE_POOL_INDEX];
+        pool.deallocations.fetch_add(1, std::memory_order_relaxed);
+        pool.reservedBytes.fetch_sub(header->size + header->offset, std::memory_order_relaxed);
+        TrackDeallocation(header->tag, header->size);
+
+        ::operator delete(base, std::align_val_t{align});
+    }
+
+    void PoolAllocator::RecordAllocation(Pool& pool)
+    {
+        const auto allocations = pool.allocations.fetch_add(1, std::memory_order_relaxed) + 1;
+        const auto deallocations = pool.deallocations.load(std::memory_order_relaxed);
+        if (allocations < deallocations) return;
+
+        const auto live = allocations - deallocations;
+        auto peak = pool.peakLiveBlocks.load(std::memory_order_relaxed);
+        while (live > peak && !pool.peakLiveBlocks.compare_exchange_weak(
+            peak,
+            live,
+            std::memory_order_relaxed))
+        {
+        }
+    }
+
+    PoolAllocator& GetPoolAllocator()
+    {
+        static PoolAllocator s_Allocator;
+        return s_Allocator;
+    }
+} // namespace VoidArchitect::Memory
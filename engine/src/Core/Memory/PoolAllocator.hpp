@@ -0,0 +1,278 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include "MemoryTracker.hpp"
+
+namespace VoidArchitect::Memory
+{
+    /// @brief Statistics snapshot of a single size-class pool
+    struct PoolStats
+    {
+        size_t blockSize = 0; ///< Usable size of a block in this pool (0 for the large pool)
+        size_t allocations = 0; ///< Total number of allocations served
+        size_t deallocations = 0; ///< Total number of blocks returned
+        size_t liveBlocks = 0; ///< Blocks currently handed out
+        size_t peakLiveBlocks = 0; ///< Highest number of blocks handed out at once
+        size_t reservedBytes = 0; ///< Bytes reserved from the system for this pool
+        size_t threadCacheHits = 0; ///< Allocations served from a thread-local cache
+    };
+
+    /// @brief Thread-safe size-class pool allocator with per-thread free-list caches
+    ///
+    /// PoolAllocator serves small, frequently created engine objects (meshes, textures,
+    /// render states, materials, loader definitions) from a fixed set of size classes.
+    /// Each size class owns a central free list carved from 64 KiB chunks, protected by a
+    /// mutex. Every thread keeps a small free-list cache per size class so that the common
+    /// allocate/release path never touches the central lock.
+    ///
+    /// Key features:
+    /// - Size classes from 32 to 4096 bytes, larger requests fall back to the system heap
+    /// - Lock-free fast path through a thread-local cache, refilled/drained in batches
+    /// - Blocks may be released from any thread, they join the releasing thread's cache
+    /// - Per-pool statistics (live blocks, peak, reserved bytes, cache hits)
+    /// - Every block is attributed to a MemoryTag and reported to the MemoryTracker
+    ///
+    /// Every block is preceded by a 16-byte header recording its size class, which is what
+    /// allows Deallocate() to take a bare pointer.
+    ///
+    /// @note Use the global instance returned by GetPoolAllocator() through the typed helpers
+    /// PoolNew/PoolDelete/PoolPtr rather than calling Allocate/Deallocate directly.
+    ///
+    /// Usage example:
+    /// @code
+    /// Memory::PoolPtr<Resources::IMesh> mesh(
+    ///     Memory::PoolNew<VulkanMesh, Memory::MemoryTag::Mesh>(...));
+    /// // ... mesh is returned to its pool when the PoolPtr goes out of scope.
+    /// @endcode
+    class PoolAllocator
+    {
+    public:
+        /// @brief Number of size classes managed by the allocator
+        static constexpr size_t SIZE_CLASS_COUNT = 8;
+
+        /// @brief Usable block size of each size class
+        static constexpr std::array<size_t, SIZE_CLASS_COUNT> SIZE_CLASSES = {
+            32,
+            64,
+            128,
+            256,
+            512,
+            1024,
+            2048,
+            4096
+        };
+
+        /// @brief Size of the chunks requested from the system heap to refill a pool
+        static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+        /// @brief Maximum number of blocks a thread caches per size class before draining
+        static constexpr size_t THREAD_CACHE_CAPACITY = 64;
+
+        /// @brief Number of blocks moved between a thread cache and the central pool at once
+        static constexpr size_t THREAD_CACHE_BATCH = 32;
+
+        /// @brief Size of the header placed before every block
+        static constexpr size_t BLOCK_HEADER_SIZE = 16;
+
+        /// @brief Largest alignment served by the size-class pools
+        static constexpr size_t POOL_ALIGNMENT = 16;
+
+        /// @brief Index used in statistics for allocations served by the system heap
+        static constexpr size_t LARGE_POOL_INDEX = SIZE_CLASS_COUNT;
+
+        PoolAllocator() = default;
+        ~PoolAllocator();
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+        PoolAllocator(PoolAllocator&&) = delete;
+        PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+        // === Allocation / Deallocation ===
+
+        /// @brief Allocate a block of at least `size` bytes
+        /// @param size Requested size in bytes
+        /// @param alignment Requested alignment (power of two)
+        /// @param tag Subsystem the block is accounted against in the MemoryTracker
+        /// @return Pointer to the block, never nullptr (throws std::bad_alloc on exhaustion)
+        ///
+        /// Requests larger than the biggest size class, or with an alignment stricter than
+        /// POOL_ALIGNMENT, are forwarded to the system heap and tracked in the large pool.
+        void* Allocate(
+            size_t size,
+            size_t alignment = alignof(std::max_align_t),
+            MemoryTag tag = MemoryTag::Unknown);
+
+        /// @brief Return a block previously obtained from Allocate()
+        /// @param ptr Block pointer, nullptr is ignored
+        void Deallocate(void* ptr);
+
+        /// @brief Move every block cached by the calling thread back to the central pools
+        ///
+        /// Called automatically when a thread exits. Can be called manually by long-lived
+        /// threads after a burst of allocations to give memory back to other threads.
+        void FlushThreadCache();
+
+        // === Statistics ===
+
+        /// @brief Get the statistics of one pool
+        /// @param poolIndex Size-class index, or LARGE_POOL_INDEX for heap fallbacks
+        /// @return Snapshot of the pool statistics
+        PoolStats GetStats(size_t poolIndex) const;
+
+        /// @brief Get the statistics of all pools, the large pool being the last entry
+        /// @return Array of SIZE_CLASS_COUNT + 1 snapshots
+        std::array<PoolStats, SIZE_CLASS_COUNT + 1> GetAllStats() const;
+
+        /// @brief Log the statistics of all pools that served at least one allocation
+        void LogStats() const;
+
+        /// @brief Find the size class able to hold `size` bytes
+        /// @param size Requested size in bytes
+        /// @return Size-class index, or LARGE_POOL_INDEX if no class is big enough
+        static constexpr size_t GetSizeClassIndex(const size_t size)
+        {
+            for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+            {
+                if (size <= SIZE_CLASSES[i]) return i;
+            }
+            return LARGE_POOL_INDEX;
+        }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct alignas(POOL_ALIGNMENT) BlockHeader
+        {
+            uint16_t poolIndex; ///< Size class of the block, LARGE_POOL_INDEX for heap blocks
+            MemoryTag tag; ///< Subsystem the block is accounted against
+            uint8_t reserved;
+            uint32_t offset; ///< Distance between the system allocation and the user pointer
+            uint64_t size; ///< Requested size, only tracked for heap blocks
+        };
+
+        static_assert(sizeof(BlockHeader) == BLOCK_HEADER_SIZE);
+        static_assert(BLOCK_HEADER_SIZE == POOL_ALIGNMENT);
+
+        /// @brief Central state of one size class
+        struct alignas(64) Pool
+        {
+            std::mutex mutex;
+            FreeBlock* freeList = nullptr;
+            VAArray<void*> chunks;
+
+            std::atomic<size_t> allocations{0};
+            std::atomic<size_t> deallocations{0};
+            std::atomic<size_t> peakLiveBlocks{0};
+            std::atomic<size_t> reservedBytes{0};
+            std::atomic<size_t> threadCacheHits{0};
+        };
+
+        /// @brief Per-thread cache of free blocks for every size class
+        struct ThreadCache
+        {
+            std::array<FreeBlock*, SIZE_CLASS_COUNT> heads{};
+            std::array<size_t, SIZE_CLASS_COUNT> counts{};
+            PoolAllocator* owner = nullptr;
+
+            ~ThreadCache();
+        };
+
+        static ThreadCache& GetThreadCache();
+
+        /// @brief Move up to THREAD_CACHE_BATCH blocks from the central pool to the cache
+        void RefillThreadCache(ThreadCache& cache, size_t poolIndex);
+
+        /// @brief Move `count` blocks from the cache back to the central pool
+        void DrainThreadCache(ThreadCache& cache, size_t poolIndex, size_t count);
+
+        /// @brief Carve a new chunk into blocks. Pool mutex must be held.
+        void GrowPool(Pool& pool, size_t poolIndex);
+
+        void* AllocateLarge(size_t size, size_t alignment, MemoryTag tag);
+        void DeallocateLarge(BlockHeader* header);
+
+        void RecordAllocation(Pool& pool);
+
+        std::array<Pool, SIZE_CLASS_COUNT + 1> m_Pools;
+    };
+
+    /// @brief Get the engine-wide pool allocator
+    /// @return Reference to the process-wide allocator instance
+    PoolAllocator& GetPoolAllocator();
+
+    // === Typed helpers ===
+
+    /// @brief Construct a T in a block of the engine pool allocator
+    /// @tparam T Type to construct
+    /// @tparam TAG Subsystem the object is accounted against in the MemoryTracker
+    /// @param args Arguments forwarded to T's constructor
+    /// @return Pointer to the new object, to be released with PoolDelete()
+    template <typename T, MemoryTag TAG = MemoryTag::Unknown, typename... Args>
+    T* PoolNew(Args&&... args)
+    {
+        void* memory = GetPoolAllocator().Allocate(sizeof(T), alignof(T), TAG);
+        try
+        {
+            return new(memory) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            GetPoolAllocator().Deallocate(memory);
+            throw;
+        }
+    }
+
+    /// @brief Destroy an object created with PoolNew() and return its block
+    /// @param ptr Object to destroy, may point to a base class of the allocated type
+    ///
+    /// For polymorphic types the block address is recovered from the most-derived object,
+    /// so it is safe to release a derived object through a base pointer as long as the
+    /// base has a virtual destructor.
+    template <typename T>
+    void PoolDelete(T* ptr)
+    {
+        if (!ptr) return;
+
+        void* block;
+        if constexpr (std::is_polymorphic_v<T>)
+        {
+            block = dynamic_cast<void*>(ptr);
+        }
+        else
+        {
+            block = ptr;
+        }
+
+        ptr->~T();
+        GetPoolAllocator().Deallocate(block);
+    }
+
+    /// @brief Deleter returning objects to the engine pool allocator
+    template <typename T>
+    struct PoolDeleter
+    {
+        PoolDeleter() noexcept = default;
+
+        template <typename U>
+            requires std::is_convertible_v<U*, T*>
+        PoolDeleter(const PoolDeleter<U>&) noexcept
+        {
+        }
+
+        void operator()(T* ptr) const { PoolDelete(ptr); }
+    };
+
+    /// @brief Owning pointer to an object created with PoolNew()
+    template <typename T>
+    using PoolPtr = std::unique_ptr<T, PoolDeleter<T>>;
+} // namespace VoidArchitect::Memory
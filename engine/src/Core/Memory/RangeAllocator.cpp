@@ -0,0 +1,106 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "RangeAllocator.hpp"
+
+#include "Core/Core.hpp"
+#include "Core/Logger.hpp"
+
+namespace VoidArchitect::Memory
+{
+    RangeAllocator::RangeAllocator(const uint32_t capacity)
+    {
+        Grow(capacity);
+    }
+
+    uint32_t RangeAllocator::Allocate(const uint32_t count)
+    {
+        VA_ENGINE_ASSERT(count > 0, "Cannot allocate an empty range.");
+
+        auto best = m_FreeBlocks.end();
+        for (auto it = m_FreeBlocks.begin(); it != m_FreeBlocks.end(); ++it)
+        {
+            if (it->count < count) continue;
+            if (best == m_FreeBlocks.end() || it->count < best->count) best = it;
+            if (best->count == count) break;
+        }
+        if (best == m_FreeBlocks.end()) return INVALID_OFFSET;
+
+        const auto offset = best->offset;
+        if (best->count == count)
+        {
+            m_FreeBlocks.erase(best);
+        }
+        else
+        {
+            best->offset += count;
+            best->count -= count;
+        }
+
+        m_Used += count;
+        return offset;
+    }
+
+    void RangeAllocator::Free(const uint32_t offset, const uint32_t count)
+    {
+        VA_ENGINE_ASSERT(
+            count > 0 && offset + count <= m_Capacity,
+            "Released range is out of bounds.");
+
+        // First free block after the range, its predecessor is the one before the range
+        const auto next = std::ranges::upper_bound(m_FreeBlocks, offset, {}, &Block::offset);
+        const bool mergePrevious = next != m_FreeBlocks.begin() &&
+            std::prev(next)->offset + std::prev(next)->count == offset;
+        const bool mergeNext = next != m_FreeBlocks.end() && offset + count == next->offset;
+
+        VA_ENGINE_ASSERT(
+            next == m_FreeBlocks.end() || offset + count <= next->offset,
+            "Released range overlaps a free block.");
+
+        if (mergePrevious && mergeNext)
+        {
+            std::prev(next)->count += count + next->count;
+            m_FreeBlocks.erase(next);
+        }
+        else if (mergePrevious)
+        {
+            std::prev(next)->count += count;
+        }
+        else if (mergeNext)
+        {
+            next->offset = offset;
+            next->count += count;
+        }
+        else
+        {
+            m_FreeBlocks.insert(next, {offset, count});
+        }
+
+        m_Used -= count;
+    }
+
+    void RangeAllocator::Grow(const uint32_t capacity)
+    {
+        VA_ENGINE_ASSERT(capacity >= m_Capacity, "A range allocator cannot shrink.");
+        if (capacity == m_Capacity) return;
+
+        const auto added = capacity - m_Capacity;
+        if (!m_FreeBlocks.empty() &&
+            m_FreeBlocks.back().offset + m_FreeBlocks.back().count == m_Capacity)
+        {
+            m_FreeBlocks.back().count += added;
+        }
+        else
+        {
+            m_FreeBlocks.push_back({m_Capacity, added});
+        }
+        m_Capacity = capacity;
+    }
+
+    uint32_t RangeAllocator::GetLargestFreeBlock() const
+    {
+        uint32_t largest = 0;
+        for (const auto& block : m_FreeBlocks) largest = std::max(largest, block.count);
+        return largest;
+    }
+} // namespace VoidArchitect::Memory
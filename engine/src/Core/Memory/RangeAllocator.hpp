@@ -0,0 +1,79 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <limits>
+
+namespace VoidArchitect::Memory
+{
+    /// @brief Sub-allocator of element ranges within a larger block it does not own
+    ///
+    /// RangeAllocator hands out [offset, offset + count) ranges of a fixed capacity, e.g.
+    /// vertices or indices in a shared GPU buffer. It keeps a free list of blocks sorted by
+    /// offset: allocation picks the smallest block that fits (best fit) and splits it,
+    /// release merges the range back with its free neighbours, so fragmentation only
+    /// comes from live ranges.
+    ///
+    /// Key features:
+    /// - Offsets and counts in elements, the caller owns the storage and its stride
+    /// - Best-fit allocation and immediate coalescing on release
+    /// - Grow() extends the capacity in place, e.g. after the storage was reallocated
+    ///
+    /// @note Operations are linear in the number of free blocks, which stays small for the
+    ///       few thousand ranges of a geometry pool. Not thread-safe.
+    ///
+    /// Usage example:
+    /// @code
+    /// RangeAllocator allocator(1024);
+    /// const auto offset = allocator.Allocate(100);
+    /// if (offset == RangeAllocator::INVALID_OFFSET)
+    /// {
+    ///     allocator.Grow(2048);
+    /// }
+    /// allocator.Free(offset, 100);
+    /// @endcode
+    class RangeAllocator
+    {
+    public:
+        /// @brief Returned by Allocate() when no free block is large enough
+        static constexpr uint32_t INVALID_OFFSET = std::numeric_limits<uint32_t>::max();
+
+        explicit RangeAllocator(uint32_t capacity = 0);
+
+        /// @brief Allocate a range
+        /// @param count Number of elements, must not be 0
+        /// @return Offset of the range, or INVALID_OFFSET if no free block is large enough
+        uint32_t Allocate(uint32_t count);
+
+        /// @brief Release a range returned by Allocate()
+        /// @param offset Offset returned by Allocate()
+        /// @param count Count given to Allocate()
+        void Free(uint32_t offset, uint32_t count);
+
+        /// @brief Extend the capacity, the new elements are free
+        /// @param capacity New capacity, not lower than the current one
+        void Grow(uint32_t capacity);
+
+        [[nodiscard]] uint32_t GetCapacity() const { return m_Capacity; }
+
+        /// @brief Number of allocated elements
+        [[nodiscard]] uint32_t GetUsed() const { return m_Used; }
+
+        /// @brief Largest range Allocate() can currently return
+        [[nodiscard]] uint32_t GetLargestFreeBlock() const;
+
+        [[nodiscard]] size_t GetFreeBlockCount() const { return m_FreeBlocks.size(); }
+
+    private:
+        struct Block
+        {
+            uint32_t offset;
+            uint32_t count;
+        };
+
+        VAArray<Block> m_FreeBlocks;
+        uint32_t m_Capacity = 0;
+        uint32_t m_Used = 0;
+    };
+} // namespace VoidArchitect::Memory
@@ -0,0 +1,325 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "AssetPack.hpp"
+
+#include <lz4.h>
+#include <lz4hc.h>
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+
+#include "Core/Hash.hpp"
+#include "Core/Logger.hpp"
+
+namespace VoidArchitect::Platform
+{
+    namespace
+    {
+        uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        /// @brief Stored bytes of an entry, compressed only if it pays off
+        AssetPackCompression CompressEntry(
+            const std::span<const uint8_t> bytes,
+            const AssetPackBuildOptions& options,
+            VAArray<uint8_t>& compressed)
+        {
+            if (options.compressionLevel <= 0 || bytes.empty() ||
+                bytes.size() > LZ4_MAX_INPUT_SIZE)
+            {
+                return AssetPackCompression::None;
+            }
+
+            const auto sourceSize = static_cast<int>(bytes.size());
+            compressed.resize(LZ4_compressBound(sourceSize));
+            const auto* source = reinterpret_cast<const char*>(bytes.data());
+            auto* destination = reinterpret_cast<char*>(compressed.data());
+            const auto capacity = static_cast<int>(compressed.size());
+
+            const int compressedSize = options.compressionLevel >= LZ4HC_CLEVEL_MIN
+                ? LZ4_compress_HC(source, destination, sourceSize, capacity,
+                                  options.compressionLevel)
+                : LZ4_compress_default(source, destination, sourceSize, capacity);
+            if (compressedSize <= 0) return AssetPackCompression::None;
+
+            const auto saved = 1.0f - static_cast<float>(compressedSize) /
+                static_cast<float>(sourceSize);
+            if (saved < options.minCompressionRatio) return AssetPackCompression::None;
+
+            compressed.resize(compressedSize);
+            return AssetPackCompression::LZ4;
+        }
+    } // namespace
+
+    AssetPackBuildResult AssetPack::Build(
+        const std::string& directory,
+        const std::string& packPath,
+        const AssetPackBuildOptions& options)
+    {
+        AssetPackBuildResult result;
+        if (options.alignment == 0 || (options.alignment & (options.alignment - 1)) != 0)
+        {
+            VA_ENGINE_ERROR("[AssetPack] Alignment {} is not a power of two.", options.alignment);
+            return result;
+        }
+
+        std::error_code error;
+        if (!std::filesystem::is_directory(directory, error))
+        {
+            VA_ENGINE_ERROR("[AssetPack] '{}' is not a directory.", directory);
+            return result;
+        }
+
+        // Every regular file, by name so that the files of a directory are stored together
+        struct PackedFile
+        {
+            std::filesystem::path path;
+            std::string name;
+            AssetPackEntry entry{};
+        };
+        VAArray<PackedFile> files;
+        const auto packFile = std::filesystem::weakly_canonical(packPath, error);
+        for (const auto& item : std::filesystem::recursive_directory_iterator(directory, error))
+        {
+            if (!item.is_regular_file()) continue;
+
+            const auto& path = item.path();
+            const auto extension = path.extension().string();
+            if (extension == ASSET_PACK_EXTENSION ||
+                std::ranges::find(options.excludedExtensions, extension) !=
+                options.excludedExtensions.end() ||
+                std::filesystem::weakly_canonical(path, error) == packFile)
+            {
+                continue;
+            }
+
+            files.push_back({path, path.lexically_relative(directory).generic_string()});
+        }
+        if (error)
+        {
+            VA_ENGINE_ERROR("[AssetPack] Failed to list '{}': {}", directory, error.message());
+            return result;
+        }
+        std::ranges::sort(files, {}, &PackedFile::name);
+
+        // The table of contents and the names come first, their size is known up front
+        VAArray<uint8_t> stringTable;
+        for (auto& file : files)
+        {
+            file.entry.nameHash = HashName(file.name);
+            file.entry.nameOffset = static_cast<uint32_t>(stringTable.size());
+            file.entry.alignmentLog2 = static_cast<uint8_t>(std::countr_zero(options.alignment));
+            stringTable.insert(stringTable.end(), file.name.begin(), file.name.end());
+            stringTable.push_back('\0');
+        }
+
+        const auto tocSize = files.size() * sizeof(AssetPackEntry);
+        const auto dataOffset = AlignUp(
+            sizeof(AssetPackHeader) + tocSize + stringTable.size(),
+            options.alignment);
+
+        const auto temporaryPath = packPath + ".tmp";
+        std::ofstream pack(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!pack.is_open())
+        {
+            VA_ENGINE_ERROR("[AssetPack] Failed to create '{}'.", temporaryPath);
+            return result;
+        }
+
+        // Data of every entry, one file in memory at a time
+        static constexpr uint8_t PADDING[256] = {};
+        uint64_t offset = dataOffset;
+        pack.seekp(static_cast<std::streamoff>(dataOffset));
+        VAArray<uint8_t> compressed;
+        for (auto& file : files)
+        {
+            const auto source = MappedFile::Open(file.path.string());
+            if (!source)
+            {
+                VA_ENGINE_ERROR("[AssetPack] Failed to read '{}'.", file.path.string());
+                pack.close();
+                std::filesystem::remove(temporaryPath, error);
+                return result;
+            }
+            const auto bytes = source->GetBytes();
+
+            file.entry.compression = CompressEntry(bytes, options, compressed);
+            const auto stored = file.entry.compression == AssetPackCompression::None
+                ? bytes
+                : std::span<const uint8_t>(compressed);
+
+            const auto aligned = AlignUp(offset, options.alignment);
+            for (auto padding = aligned - offset; padding > 0;)
+            {
+                const auto count = std::min<uint64_t>(padding, sizeof(PADDING));
+                pack.write(reinterpret_cast<const char*>(PADDING), count);
+                padding -= count;
+            }
+
+            file.entry.offset = aligned;
+            file.entry.size = stored.size();
+            file.entry.uncompressedSize = bytes.size();
+            pack.write(reinterpret_cast<const char*>(stored.data()), stored.size());
+            offset = aligned + stored.size();
+
+            result.uncompressedSize += bytes.size();
+            if (file.entry.compression != AssetPackCompression::None) ++result.compressedCount;
+        }
+
+        // Sorted by hash for the binary search of Find()
+        VAArray<AssetPackEntry> entries;
+        entries.reserve(files.size());
+        for (const auto& file : files) entries.push_back(file.entry);
+        std::ranges::sort(entries, {}, &AssetPackEntry::nameHash);
+        for (size_t i = 1; i < entries.size(); ++i)
+        {
+            if (entries[i].nameHash == entries[i - 1].nameHash)
+            {
+                VA_ENGINE_ERROR("[AssetPack] Two names of '{}' share a hash.", directory);
+                pack.close();
+                std::filesystem::remove(temporaryPath, error);
+                return result;
+            }
+        }
+
+        AssetPackHeader header{};
+        std::memcpy(header.magic, ASSET_PACK_MAGIC, sizeof(header.magic));
+        header.version = ASSET_PACK_VERSION;
+        header.entryCount = static_cast<uint32_t>(entries.size());
+        header.stringTableSize = static_cast<uint32_t>(stringTable.size());
+        header.dataOffset = dataOffset;
+        VAArray<uint8_t> toc(tocSize + stringTable.size());
+        std::memcpy(toc.data(), entries.data(), tocSize);
+        std::memcpy(toc.data() + tocSize, stringTable.data(), stringTable.size());
+        header.checksum = XXHash64::Hash(toc);
+
+        pack.seekp(0);
+        pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        pack.write(reinterpret_cast<const char*>(toc.data()), toc.size());
+        pack.close();
+        if (pack.fail())
+        {
+            VA_ENGINE_ERROR("[AssetPack] Failed to write '{}'.", temporaryPath);
+            std::filesystem::remove(temporaryPath, error);
+            return result;
+        }
+
+        // Replace the pack at once, a running game keeps its mapping of the previous one
+        std::filesystem::rename(temporaryPath, packPath, error);
+        if (error)
+        {
+            VA_ENGINE_ERROR("[AssetPack] Failed to replace '{}': {}", packPath, error.message());
+            std::filesystem::remove(temporaryPath, error);
+            return result;
+        }
+
+        result.success = true;
+        result.entryCount = header.entryCount;
+        result.packSize = offset;
+        return result;
+    }
+
+    std::shared_ptr<AssetPack> AssetPack::Open(const std::string& packPath)
+    {
+        auto file = MappedFile::Open(packPath, MappedFile::Mode::MapRandom);
+        if (!file || file->GetSize() < sizeof(AssetPackHeader))
+        {
+            VA_ENGINE_WARN("[AssetPack] Cannot read pack '{}'.", packPath);
+            return nullptr;
+        }
+
+        const auto bytes = file->GetBytes();
+        AssetPackHeader header{};
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (std::memcmp(header.magic, ASSET_PACK_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != ASSET_PACK_VERSION)
+        {
+            VA_ENGINE_WARN("[AssetPack] Unsupported pack '{}'.", packPath);
+            return nullptr;
+        }
+
+        const auto tocSize = static_cast<uint64_t>(header.entryCount) * sizeof(AssetPackEntry);
+        if (sizeof(header) + tocSize + header.stringTableSize > bytes.size() ||
+            XXHash64::Hash(bytes.subspan(sizeof(header), tocSize + header.stringTableSize)) !=
+            header.checksum)
+        {
+            VA_ENGINE_WARN("[AssetPack] Corrupted pack '{}'.", packPath);
+            return nullptr;
+        }
+
+        // The constructor is private, std::make_shared cannot reach it
+        std::shared_ptr<AssetPack> pack(new AssetPack());
+        pack->m_Path = packPath;
+        pack->m_Entries = {
+            reinterpret_cast<const AssetPackEntry*>(bytes.data() + sizeof(header)),
+            header.entryCount
+        };
+        pack->m_StringTable = bytes.subspan(sizeof(header) + tocSize, header.stringTableSize);
+        pack->m_File = std::move(file);
+        return pack;
+    }
+
+    const AssetPackEntry* AssetPack::Find(const std::string_view name) const
+    {
+        const auto hash = HashName(name);
+        auto it = std::ranges::lower_bound(m_Entries, hash, {}, &AssetPackEntry::nameHash);
+        for (; it != m_Entries.end() && it->nameHash == hash; ++it)
+        {
+            if (GetName(*it) == name) return &*it;
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<MappedFile> AssetPack::OpenFile(const std::string_view name) const
+    {
+        const auto* entry = Find(name);
+        if (!entry) return nullptr;
+
+        const auto bytes = m_File->GetBytes();
+        if (entry->offset > bytes.size() || entry->size > bytes.size() - entry->offset)
+        {
+            VA_ENGINE_ERROR("[AssetPack] Entry '{}' lies outside of '{}'.", name, m_Path);
+            return nullptr;
+        }
+        const auto stored = bytes.subspan(entry->offset, entry->size);
+
+        switch (entry->compression)
+        {
+            case AssetPackCompression::None:
+                return MappedFile::View(stored, shared_from_this());
+            case AssetPackCompression::LZ4:
+            {
+                VAArray<uint8_t> buffer(entry->uncompressedSize);
+                const int size = LZ4_decompress_safe(
+                    reinterpret_cast<const char*>(stored.data()),
+                    reinterpret_cast<char*>(buffer.data()),
+                    static_cast<int>(stored.size()),
+                    static_cast<int>(buffer.size()));
+                if (size < 0 || static_cast<uint64_t>(size) != entry->uncompressedSize) break;
+                return MappedFile::FromBuffer(std::move(buffer));
+            }
+        }
+
+        VA_ENGINE_ERROR("[AssetPack] Failed to read entry '{}' of '{}'.", name, m_Path);
+        return nullptr;
+    }
+
+    std::string_view AssetPack::GetName(const AssetPackEntry& entry) const
+    {
+        if (entry.nameOffset >= m_StringTable.size()) return {};
+
+        const auto* begin = reinterpret_cast<const char*>(m_StringTable.data() + entry.nameOffset);
+        const auto* end = static_cast<const char*>(
+            std::memchr(begin, '\0', m_StringTable.size() - entry.nameOffset));
+        return end ? std::string_view(begin, end - begin) : std::string_view();
+    }
+
+    uint64_t AssetPack::HashName(const std::string_view name)
+    {
+        return XXHash64::Hash(name);
+    }
+} // namespace VoidArchitect::Platform
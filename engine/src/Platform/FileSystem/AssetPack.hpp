@@ -0,0 +1,130 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include "MappedFile.hpp"
+
+namespace VoidArchitect::Platform
+{
+    // === File format ===
+    //
+    // A pack starts with its header, followed by the table of contents sorted by name hash and
+    // the string table of the names, then the data of every entry at its alignment. Names are
+    // paths relative to the packed directory, with '/' separators.
+    //
+    // Version history:
+    // - 1: initial format
+
+    static constexpr uint8_t ASSET_PACK_MAGIC[4] = {'V', 'A', 'P', '\0'};
+    static constexpr uint32_t ASSET_PACK_VERSION = 1;
+    static constexpr auto ASSET_PACK_EXTENSION = ".vapack";
+
+    enum class AssetPackCompression : uint8_t
+    {
+        None = 0,
+        LZ4 = 1
+    };
+
+    // Pack header - 32 bytes
+    struct AssetPackHeader
+    {
+        uint8_t magic[4]; // ASSET_PACK_MAGIC
+        uint32_t version; // ASSET_PACK_VERSION
+        uint32_t entryCount;
+        uint32_t stringTableSize;
+        uint64_t dataOffset; // Start of the entry data, after the string table
+        uint64_t checksum; // XXH64 of the table of contents and the string table
+    };
+
+    // Table of contents entry - 40 bytes
+    struct AssetPackEntry
+    {
+        uint64_t nameHash; // XXH64 of the name, the sort key
+        uint64_t offset; // From the start of the pack, a multiple of the alignment
+        uint64_t size; // Stored size, compressed or not
+        uint64_t uncompressedSize;
+        uint32_t nameOffset; // Offset in the string table
+        AssetPackCompression compression;
+        uint8_t alignmentLog2; // Entries are aligned to 1 << alignmentLog2 bytes
+        uint16_t reserved;
+    };
+
+    static_assert(sizeof(AssetPackHeader) == 32, "AssetPackHeader must be exactly 32 bytes");
+    static_assert(sizeof(AssetPackEntry) == 40, "AssetPackEntry must be exactly 40 bytes");
+
+    /// @brief How AssetPack::Build() stores the entries
+    struct AssetPackBuildOptions
+    {
+        int compressionLevel = 0; ///< 0 stores every entry, 1-2 LZ4, 3-12 LZ4-HC
+        float minCompressionRatio = 0.1f; ///< Entries saving less are stored as they are
+        uint32_t alignment = 16; ///< Power of two, VAM files are read in place at 16
+        VAArray<std::string> excludedExtensions; ///< Such as ".hlsl", with the dot
+    };
+
+    /// @brief Statistics of a pack written by AssetPack::Build()
+    struct AssetPackBuildResult
+    {
+        bool success = false;
+        uint32_t entryCount = 0;
+        uint32_t compressedCount = 0;
+        uint64_t uncompressedSize = 0; ///< Bytes of every packed file
+        uint64_t packSize = 0; ///< Bytes of the pack file
+    };
+
+    /// @brief Read-only archive of the files of a directory, found by name in a sorted table
+    ///
+    /// The pack is mapped once, opening an entry is a binary search in the table of contents
+    /// and does not touch the file system. Entries stored as they are are viewed in place from
+    /// the mapping, compressed ones are decompressed into a buffer of their own. Either way, the
+    /// returned file keeps the pack alive.
+    ///
+    /// Packs are usually mounted in the VirtualFileSystem rather than used directly.
+    ///
+    /// Usage example:
+    /// @code
+    /// AssetPack::Build("assets/", "assets.vapack");
+    /// const auto pack = AssetPack::Open("assets.vapack");
+    /// if (const auto file = pack->OpenFile("materials/DefaultUI.yaml")) Parse(file->GetBytes());
+    /// @endcode
+    class AssetPack : public std::enable_shared_from_this<AssetPack>
+    {
+    public:
+        /// @brief Pack every file under a directory, recursively
+        /// @param directory Directory to pack, the entries are named relative to it
+        /// @param packPath Pack file to write, skipped if it lies in the directory
+        /// @param options Compression, alignment and filtering of the entries
+        static AssetPackBuildResult Build(
+            const std::string& directory,
+            const std::string& packPath,
+            const AssetPackBuildOptions& options = {});
+
+        /// @brief Map a pack and check its table of contents
+        /// @return The pack, nullptr if it is missing or invalid
+        static std::shared_ptr<AssetPack> Open(const std::string& packPath);
+
+        /// @brief Entry of a name, nullptr if the pack does not contain it
+        [[nodiscard]] const AssetPackEntry* Find(std::string_view name) const;
+
+        /// @brief Bytes of an entry, viewed in place or decompressed
+        /// @return The file, nullptr if the pack does not contain it or it is corrupted
+        [[nodiscard]] std::shared_ptr<MappedFile> OpenFile(std::string_view name) const;
+
+        [[nodiscard]] std::span<const AssetPackEntry> GetEntries() const { return m_Entries; }
+
+        [[nodiscard]] std::string_view GetName(const AssetPackEntry& entry) const;
+
+        [[nodiscard]] const std::string& GetPath() const { return m_Path; }
+
+        /// @brief Hash of an entry name, normalized to '/' separators by the caller
+        static uint64_t HashName(std::string_view name);
+
+    private:
+        AssetPack() = default;
+
+        std::string m_Path;
+        std::shared_ptr<MappedFile> m_File;
+        std::span<const AssetPackEntry> m_Entries;
+        std::span<const uint8_t> m_StringTable;
+    };
+} // namespace VoidArchitect::Platform
@@ -0,0 +1,916 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "AsyncFileIO.hpp"
+
+#include <cstring>
+#include <deque>
+#include <future>
+
+#include "Core/Core.hpp"
+#include "Core/Logger.hpp"
+#include "Core/Memory/MemoryTracker.hpp"
+#include "Platform/Threading/ThreadFactory.hpp"
+#include "Systems/Jobs/JobSystem.hpp"
+#include "VirtualFileSystem.hpp"
+
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+#include <Windows.h>
+#elif defined(VOID_ARCH_PLATFORM_LINUX) || defined(VOID_ARCH_PLATFORM_MACOS)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef VOID_ARCH_PLATFORM_LINUX
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace VoidArchitect::Platform
+{
+    namespace
+    {
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+        using NativeFile = HANDLE;
+        const NativeFile INVALID_NATIVE_FILE = INVALID_HANDLE_VALUE;
+#else
+        using NativeFile = int;
+        constexpr NativeFile INVALID_NATIVE_FILE = -1;
+#endif
+
+        uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        uint64_t AlignDown(const uint64_t value, const uint64_t alignment)
+        {
+            return value & ~(alignment - 1);
+        }
+
+        /// @brief Open a file to read it, direct I/O bypasses the page cache where allowed
+        /// @param direct Whether to use direct I/O, cleared if the file system refuses it
+        NativeFile OpenNative(const std::string& path, bool& direct, uint64_t& size)
+        {
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+            const auto file = CreateFileA(
+                path.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_FLAG_SEQUENTIAL_SCAN | (direct ? FILE_FLAG_NO_BUFFERING : 0),
+                nullptr);
+            if (file == INVALID_HANDLE_VALUE) return file;
+
+            LARGE_INTEGER fileSize{};
+            if (!GetFileSizeEx(file, &fileSize))
+            {
+                CloseHandle(file);
+                return INVALID_NATIVE_FILE;
+            }
+            size = static_cast<uint64_t>(fileSize.QuadPart);
+            return file;
+#elif defined(VOID_ARCH_PLATFORM_LINUX) || defined(VOID_ARCH_PLATFORM_MACOS)
+            int flags = O_RDONLY | O_CLOEXEC;
+#ifdef O_DIRECT
+            if (direct) flags |= O_DIRECT;
+#endif
+            int file = open(path.c_str(), flags);
+
+            // Some file systems, such as tmpfs, refuse direct I/O
+            if (file < 0 && direct && errno == EINVAL)
+            {
+                direct = false;
+                file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            }
+            if (file < 0) return INVALID_NATIVE_FILE;
+#ifdef F_NOCACHE
+            if (direct) fcntl(file, F_NOCACHE, 1);
+#endif
+
+            struct stat status{};
+            if (fstat(file, &status) != 0 || !S_ISREG(status.st_mode))
+            {
+                close(file);
+                return INVALID_NATIVE_FILE;
+            }
+            size = static_cast<uint64_t>(status.st_size);
+            return file;
+#else
+            return INVALID_NATIVE_FILE;
+#endif
+        }
+
+        /// @brief Blocking read at an offset, the bytes read or -errno
+        int64_t ReadNative(const NativeFile file, const uint64_t offset, std::span<uint8_t> bytes)
+        {
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD read = 0;
+            if (!ReadFile(file, bytes.data(), static_cast<DWORD>(bytes.size()), &read, &overlapped))
+            {
+                const auto error = GetLastError();
+                return error == ERROR_HANDLE_EOF ? 0 : -static_cast<int64_t>(error);
+            }
+            return read;
+#elif defined(VOID_ARCH_PLATFORM_LINUX) || defined(VOID_ARCH_PLATFORM_MACOS)
+            while (true)
+            {
+                const auto read = pread(
+                    file,
+                    bytes.data(),
+                    bytes.size(),
+                    static_cast<off_t>(offset));
+                if (read >= 0) return read;
+                if (errno != EINTR) return -errno;
+            }
+#else
+            return -1;
+#endif
+        }
+
+        void CloseNative(const NativeFile file)
+        {
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+            CloseHandle(file);
+#elif defined(VOID_ARCH_PLATFORM_LINUX) || defined(VOID_ARCH_PLATFORM_MACOS)
+            close(file);
+#endif
+        }
+    } // namespace
+
+    // === Internals ===
+
+    struct AsyncReadSegment
+    {
+        AsyncRead* read = nullptr;
+        uint64_t offset = 0; ///< From the start of the file, also the offset in the buffer
+        uint32_t length = 0; ///< A multiple of the alignment, may reach past the end of the file
+#ifdef VOID_ARCH_PLATFORM_LINUX
+        iovec vector{}; ///< Read by the kernel until the segment completes
+#endif
+    };
+
+    struct AsyncRead
+    {
+        std::string path;
+        AsyncFileIO::ReadCallback onComplete;
+        Jobs::SyncPointHandle done = Jobs::InvalidSyncPointHandle;
+
+        NativeFile file = INVALID_NATIVE_FILE;
+        uint64_t size = 0;
+        bool direct = false; ///< Opened for direct I/O, every transfer must stay aligned
+        std::shared_ptr<uint8_t> buffer;
+        VAArray<AsyncReadSegment> segments;
+        std::atomic<uint32_t> remaining{0}; ///< Segments not read yet
+        std::atomic<bool> failed{false};
+    };
+
+    /// @brief Aligned buffers recycled by size class, powers of two from 64 KiB to 64 MiB
+    ///
+    /// Files of similar sizes are read over and over while a level streams in, their buffers
+    /// are reused instead of being allocated and faulted in again. Larger files get a buffer of
+    /// their own. A buffer released after its pool is gone is simply freed.
+    class IOBufferPool : public std::enable_shared_from_this<IOBufferPool>
+    {
+    public:
+        ~IOBufferPool()
+        {
+            for (size_t i = 0; i < CLASS_COUNT; ++i)
+            {
+                for (auto* buffer : m_Free[i]) Free(buffer, GetClassSize(i));
+            }
+        }
+
+        std::shared_ptr<uint8_t> Acquire(const size_t size)
+        {
+            auto sizeClass = CLASS_COUNT;
+            for (size_t i = 0; i < CLASS_COUNT; ++i)
+            {
+                if (size <= GetClassSize(i))
+                {
+                    sizeClass = i;
+                    break;
+                }
+            }
+            const auto capacity = sizeClass < CLASS_COUNT
+                ? GetClassSize(sizeClass)
+                : AlignUp(size, AsyncFileIO::BUFFER_ALIGNMENT);
+
+            uint8_t* buffer = nullptr;
+            if (sizeClass < CLASS_COUNT)
+            {
+                std::lock_guard lock(m_Mutex);
+                if (!m_Free[sizeClass].empty())
+                {
+                    buffer = m_Free[sizeClass].back();
+                    m_Free[sizeClass].pop_back();
+                }
+            }
+            if (!buffer) buffer = Allocate(capacity);
+
+            return std::shared_ptr<uint8_t>(
+                buffer,
+                [pool = weak_from_this(), sizeClass, capacity](uint8_t* released)
+                {
+                    if (const auto owner = pool.lock())
+                    {
+                        owner->Release(released, sizeClass, capacity);
+                    }
+                    else
+                    {
+                        Free(released, capacity);
+                    }
+                });
+        }
+
+    private:
+        static constexpr size_t CLASS_COUNT = 11;
+        static constexpr size_t MIN_CLASS_SIZE = 64 * 1024;
+        static constexpr size_t MAX_FREE_PER_CLASS = 4;
+
+        static size_t GetClassSize(const size_t sizeClass) { return MIN_CLASS_SIZE << sizeClass; }
+
+        static uint8_t* Allocate(const size_t capacity)
+        {
+            Memory::TrackAllocation(Memory::MemoryTag::Loader, capacity);
+            return static_cast<uint8_t*>(
+                ::operator new(capacity, std::align_val_t{AsyncFileIO::BUFFER_ALIGNMENT}));
+        }
+
+        static void Free(uint8_t* buffer, const size_t capacity)
+        {
+            ::operator delete(buffer, std::align_val_t{AsyncFileIO::BUFFER_ALIGNMENT});
+            Memory::TrackDeallocation(Memory::MemoryTag::Loader, capacity);
+        }
+
+        void Release(uint8_t* buffer, const size_t sizeClass, const size_t capacity)
+        {
+            if (sizeClass < CLASS_COUNT)
+            {
+                std::lock_guard lock(m_Mutex);
+                if (m_Free[sizeClass].size() < MAX_FREE_PER_CLASS)
+                {
+                    m_Free[sizeClass].push_back(buffer);
+                    return;
+                }
+            }
+            Free(buffer, capacity);
+        }
+
+        std::mutex m_Mutex;
+        VAArray<uint8_t*> m_Free[CLASS_COUNT];
+    };
+
+    /// @brief Backend reading segments in any order, completing them on its own threads
+    class AsyncReadQueue
+    {
+    public:
+        explicit AsyncReadQueue(AsyncFileIO& owner)
+            : m_Owner(owner)
+        {
+        }
+
+        virtual ~AsyncReadQueue() = default;
+
+        virtual void Submit(std::span<AsyncReadSegment* const> segments) = 0;
+
+        [[nodiscard]] virtual AsyncFileIO::BackendType GetType() const = 0;
+
+    protected:
+        void Complete(AsyncReadSegment& segment, const int64_t result) const
+        {
+            m_Owner.CompleteSegment(segment, result);
+        }
+
+    private:
+        AsyncFileIO& m_Owner;
+    };
+
+    namespace
+    {
+        /// @brief Threads blocking on one segment each, wherever io_uring is not available
+        class ThreadPoolReadQueue final : public AsyncReadQueue
+        {
+        public:
+            ThreadPoolReadQueue(AsyncFileIO& owner, const uint32_t threadCount)
+                : AsyncReadQueue(owner)
+            {
+                for (uint32_t i = 0; i < std::max(threadCount, 1u); ++i)
+                {
+                    auto thread = ThreadFactory::CreateThread();
+                    const auto name = "AsyncFileIO_" + std::to_string(i);
+                    if (!thread || !thread->Start([this] { Run(); }, name))
+                    {
+                        Stop();
+                        throw std::runtime_error("Failed to start thread " + name);
+                    }
+                    m_Threads.push_back(std::move(thread));
+                }
+            }
+
+            ~ThreadPoolReadQueue() override { Stop(); }
+
+            void Submit(const std::span<AsyncReadSegment* const> segments) override
+            {
+                {
+                    std::lock_guard lock(m_Mutex);
+                    m_Segments.insert(m_Segments.end(), segments.begin(), segments.end());
+                }
+                m_Wake.notify_all();
+            }
+
+            [[nodiscard]] AsyncFileIO::BackendType GetType() const override
+            {
+                return AsyncFileIO::BackendType::ThreadPool;
+            }
+
+        private:
+            void Run()
+            {
+                while (true)
+                {
+                    AsyncReadSegment* segment;
+                    {
+                        std::unique_lock lock(m_Mutex);
+                        m_Wake.wait(lock, [this] { return m_Stopping || !m_Segments.empty(); });
+                        if (m_Segments.empty()) return;
+
+                        segment = m_Segments.front();
+                        m_Segments.pop_front();
+                    }
+
+                    const auto& read = *segment->read;
+                    Complete(
+                        *segment,
+                        ReadNative(
+                            read.file,
+                            segment->offset,
+                            {read.buffer.get() + segment->offset, segment->length}));
+                }
+            }
+
+            void Stop()
+            {
+                {
+                    std::lock_guard lock(m_Mutex);
+                    m_Stopping = true;
+                }
+                m_Wake.notify_all();
+                for (const auto& thread : m_Threads) thread->Join();
+                m_Threads.clear();
+            }
+
+            std::mutex m_Mutex;
+            std::condition_variable m_Wake;
+            std::deque<AsyncReadSegment*> m_Segments;
+            bool m_Stopping = false;
+            VAArray<std::unique_ptr<IThread>> m_Threads;
+        };
+
+#ifdef VOID_ARCH_PLATFORM_LINUX
+        /// @brief Segments queued to the kernel through io_uring, reaped by a single thread
+        ///
+        /// The rings are set up with the raw system calls, the engine does not depend on
+        /// liburing for the handful of operations it needs. Reads use IORING_OP_READV, available
+        /// since Linux 5.1. No more segments than the submission queue holds are in flight, so
+        /// the completion queue, twice as large, never overflows.
+        class IoUringReadQueue final : public AsyncReadQueue
+        {
+        public:
+            /// @brief Set up the ring, nullptr if the kernel does not offer io_uring
+            static std::unique_ptr<IoUringReadQueue> Create(
+                AsyncFileIO& owner,
+                const uint32_t queueDepth)
+            {
+                std::unique_ptr<IoUringReadQueue> queue(new IoUringReadQueue(owner));
+                if (!queue->Setup(queueDepth)) return nullptr;
+
+                queue->m_Thread = ThreadFactory::CreateThread();
+                if (!queue->m_Thread || !queue->m_Thread->Start(
+                    [raw = queue.get()] { raw->Run(); },
+                    "AsyncFileIO_Ring"))
+                {
+                    queue->m_Thread.reset();
+                    return nullptr;
+                }
+                return queue;
+            }
+
+            ~IoUringReadQueue() override
+            {
+                if (m_Thread)
+                {
+                    // The reads are done, a no-op wakes the thread up for it to stop
+                    {
+                        std::lock_guard lock(m_Mutex);
+                        m_Pending.push_back(nullptr);
+                        SubmitPending();
+                    }
+                    m_Thread->Join();
+                }
+
+                if (m_Entries) munmap(m_Entries, m_EntriesSize);
+                if (m_CompletionRing && m_CompletionRing != m_SubmissionRing)
+                {
+                    munmap(m_CompletionRing, m_CompletionRingSize);
+                }
+                if (m_SubmissionRing) munmap(m_SubmissionRing, m_SubmissionRingSize);
+                if (m_Ring >= 0) close(m_Ring);
+            }
+
+            void Submit(const std::span<AsyncReadSegment* const> segments) override
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Pending.insert(m_Pending.end(), segments.begin(), segments.end());
+                SubmitPending();
+            }
+
+            [[nodiscard]] AsyncFileIO::BackendType GetType() const override
+            {
+                return AsyncFileIO::BackendType::IoUring;
+            }
+
+        private:
+            explicit IoUringReadQueue(AsyncFileIO& owner)
+                : AsyncReadQueue(owner)
+            {
+            }
+
+            bool Setup(const uint32_t queueDepth)
+            {
+                io_uring_params params{};
+                m_Ring = static_cast<int>(syscall(__NR_io_uring_setup, queueDepth, &params));
+                if (m_Ring < 0) return false;
+
+                m_SubmissionRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+                m_CompletionRingSize =
+                    params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+                const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+                if (singleMap)
+                {
+                    m_SubmissionRingSize = std::max(m_SubmissionRingSize, m_CompletionRingSize);
+                    m_CompletionRingSize = m_SubmissionRingSize;
+                }
+
+                const auto map = [this](const size_t size, const off_t offset) -> void*
+                {
+                    auto* view = mmap(
+                        nullptr,
+                        size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE,
+                        m_Ring,
+                        offset);
+                    return view == MAP_FAILED ? nullptr : view;
+                };
+                m_SubmissionRing = map(m_SubmissionRingSize, IORING_OFF_SQ_RING);
+                m_CompletionRing = singleMap
+                    ? m_SubmissionRing
+                    : map(m_CompletionRingSize, IORING_OFF_CQ_RING);
+                m_EntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+                m_Entries = static_cast<io_uring_sqe*>(map(m_EntriesSize, IORING_OFF_SQES));
+                if (!m_SubmissionRing || !m_CompletionRing || !m_Entries) return false;
+
+                auto* submission = static_cast<uint8_t*>(m_SubmissionRing);
+                m_SubmissionHead = reinterpret_cast<uint32_t*>(submission + params.sq_off.head);
+                m_SubmissionTail = reinterpret_cast<uint32_t*>(submission + params.sq_off.tail);
+                m_SubmissionMask = *reinterpret_cast<uint32_t*>(
+                    submission + params.sq_off.ring_mask);
+                m_SubmissionArray = reinterpret_cast<uint32_t*>(submission + params.sq_off.array);
+                m_Capacity = params.sq_entries;
+
+                auto* completion = static_cast<uint8_t*>(m_CompletionRing);
+                m_CompletionHead = reinterpret_cast<uint32_t*>(completion + params.cq_off.head);
+                m_CompletionTail = reinterpret_cast<uint32_t*>(completion + params.cq_off.tail);
+                m_CompletionMask = *reinterpret_cast<uint32_t*>(
+                    completion + params.cq_off.ring_mask);
+                m_Completions = reinterpret_cast<io_uring_cqe*>(completion + params.cq_off.cqes);
+                return true;
+            }
+
+            /// @brief Fill the submission queue from the pending segments, m_Mutex held
+            void SubmitPending()
+            {
+                auto tail = *m_SubmissionTail;
+                while (!m_Pending.empty() && m_InRing < m_Capacity)
+                {
+                    auto* segment = m_Pending.front();
+                    m_Pending.pop_front();
+
+                    const auto index = tail & m_SubmissionMask;
+                    auto& entry = m_Entries[index];
+                    std::memset(&entry, 0, sizeof(entry));
+                    if (segment)
+                    {
+                        const auto& read = *segment->read;
+                        segment->vector.iov_base = read.buffer.get() + segment->offset;
+                        segment->vector.iov_len = segment->length;
+                        entry.opcode = IORING_OP_READV;
+                        entry.fd = read.file;
+                        entry.addr = reinterpret_cast<uint64_t>(&segment->vector);
+                        entry.len = 1;
+                        entry.off = segment->offset;
+                    }
+                    else
+                    {
+                        entry.opcode = IORING_OP_NOP;
+                    }
+                    entry.user_data = reinterpret_cast<uint64_t>(segment);
+                    m_SubmissionArray[index] = index;
+
+                    ++tail;
+                    ++m_InRing;
+                }
+                std::atomic_ref(*m_SubmissionTail).store(tail, std::memory_order_release);
+
+                // Everything the kernel did not consume yet, including entries of a
+                // submission it stopped short of
+                const auto head = std::atomic_ref(*m_SubmissionHead).load(
+                    std::memory_order_acquire);
+                if (tail == head) return;
+                if (syscall(__NR_io_uring_enter, m_Ring, tail - head, 0, 0, nullptr, 0) < 0 &&
+                    errno != EAGAIN && errno != EBUSY && errno != EINTR)
+                {
+                    VA_ENGINE_ERROR(
+                        "[AsyncFileIO] Failed to submit reads: {}",
+                        std::strerror(errno));
+                }
+            }
+
+            void Run()
+            {
+                VAArray<std::pair<AsyncReadSegment*, int32_t>> completed;
+                bool stopping = false;
+                while (!stopping)
+                {
+                    if (syscall(
+                            __NR_io_uring_enter,
+                            m_Ring,
+                            0,
+                            1,
+                            IORING_ENTER_GETEVENTS,
+                            nullptr,
+                            0) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                    {
+                        VA_ENGINE_CRITICAL(
+                            "[AsyncFileIO] Failed to wait for reads: {}",
+                            std::strerror(errno));
+                        return;
+                    }
+
+                    completed.clear();
+                    auto head = *m_CompletionHead;
+                    const auto tail = std::atomic_ref(*m_CompletionTail).load(
+                        std::memory_order_acquire);
+                    for (; head != tail; ++head)
+                    {
+                        const auto& entry = m_Completions[head & m_CompletionMask];
+                        completed.emplace_back(
+                            reinterpret_cast<AsyncReadSegment*>(entry.user_data),
+                            entry.res);
+                    }
+                    std::atomic_ref(*m_CompletionHead).store(head, std::memory_order_release);
+
+                    // Room was made in the ring for the segments waiting for it
+                    {
+                        std::lock_guard lock(m_Mutex);
+                        m_InRing -= static_cast<uint32_t>(completed.size());
+                        SubmitPending();
+                    }
+
+                    for (const auto& [segment, result] : completed)
+                    {
+                        if (segment) Complete(*segment, result);
+                        else stopping = true;
+                    }
+                }
+            }
+
+            int m_Ring = -1;
+            void* m_SubmissionRing = nullptr;
+            void* m_CompletionRing = nullptr;
+            size_t m_SubmissionRingSize = 0;
+            size_t m_CompletionRingSize = 0;
+            io_uring_sqe* m_Entries = nullptr;
+            size_t m_EntriesSize = 0;
+
+            uint32_t* m_SubmissionHead = nullptr;
+            uint32_t* m_SubmissionTail = nullptr;
+            uint32_t* m_SubmissionArray = nullptr;
+            uint32_t m_SubmissionMask = 0;
+            uint32_t m_Capacity = 0;
+
+            uint32_t* m_CompletionHead = nullptr;
+            uint32_t* m_CompletionTail = nullptr;
+            uint32_t m_CompletionMask = 0;
+            io_uring_cqe* m_Completions = nullptr;
+
+            std::mutex m_Mutex;
+            std::deque<AsyncReadSegment*> m_Pending; ///< nullptr asks the thread to stop
+            uint32_t m_InRing = 0;
+            std::unique_ptr<IThread> m_Thread;
+        };
+#endif
+    } // namespace
+
+    // === AsyncFileIO ===
+
+    double AsyncFileIOStats::GetThroughput() const
+    {
+        if (busySeconds <= 0.0) return 0.0;
+        return static_cast<double>(bytesRead) / (1024.0 * 1024.0) / busySeconds;
+    }
+
+    AsyncFileIO::AsyncFileIO(const AsyncFileIOConfig& config)
+        : m_Config(config),
+          m_Buffers(std::make_shared<IOBufferPool>())
+    {
+        // Direct I/O transfers whole sectors, every segment starts on an aligned offset
+        m_Config.queueDepth = std::max(m_Config.queueDepth, 1u);
+        m_Config.segmentSize = static_cast<uint32_t>(
+            AlignUp(std::max<uint64_t>(m_Config.segmentSize, 1), BUFFER_ALIGNMENT));
+
+#ifdef VOID_ARCH_PLATFORM_LINUX
+        if (m_Config.useIoUring)
+        {
+            m_Queue = IoUringReadQueue::Create(*this, m_Config.queueDepth);
+            if (!m_Queue)
+            {
+                VA_ENGINE_INFO("[AsyncFileIO] io_uring is not available, reading on threads.");
+            }
+        }
+#endif
+        if (!m_Queue)
+        {
+            m_Queue = std::make_unique<ThreadPoolReadQueue>(*this, m_Config.threadCount);
+        }
+
+        VA_ENGINE_INFO(
+            "[AsyncFileIO] Reading files through {}, in segments of {} KiB.",
+            GetBackendType() == BackendType::IoUring ? "io_uring" : "a thread pool",
+            m_Config.segmentSize / 1024);
+    }
+
+    AsyncFileIO::~AsyncFileIO()
+    {
+        {
+            std::unique_lock lock(m_ReadsMutex);
+            m_ReadsDone.wait(lock, [this] { return m_ReadsInFlight == 0; });
+        }
+        m_Queue.reset();
+
+        if (const auto stats = GetStats(); stats.fileCount > 0)
+        {
+            VA_ENGINE_INFO(
+                "[AsyncFileIO] Read {} files ({} failed), {:.2f} MiB at {:.1f} MiB/s, "
+                "up to {} segments in flight.",
+                stats.fileCount,
+                stats.failedCount,
+                static_cast<double>(stats.bytesRead) / (1024.0 * 1024.0),
+                stats.GetThroughput(),
+                stats.maxQueueDepth);
+        }
+    }
+
+    Jobs::SyncPointHandle AsyncFileIO::ReadBatch(const std::span<ReadRequest> requests)
+    {
+        const auto done = Jobs::g_JobSystem && !requests.empty()
+            ? Jobs::g_JobSystem->CreateSyncPoint(
+                static_cast<uint32_t>(requests.size()),
+                "AsyncFileRead")
+            : Jobs::InvalidSyncPointHandle;
+
+        // Every segment of the batch is handed to the backend at once
+        VAArray<AsyncReadSegment*> segments;
+        for (auto& request : requests)
+        {
+            auto read = std::make_unique<AsyncRead>();
+            read->path = request.path;
+            read->onComplete = std::move(request.onComplete);
+            read->done = done;
+
+            // Packed files are mapped already
+            if (VirtualFileSystem::IsPacked(read->path))
+            {
+                auto file = VirtualFileSystem::Open(read->path);
+                FinishRead(std::move(read), std::move(file));
+                continue;
+            }
+
+            if (!StartRead(*read, segments))
+            {
+                VA_ENGINE_WARN("[AsyncFileIO] Failed to open '{}'.", read->path);
+                {
+                    std::lock_guard lock(m_StatsMutex);
+                    ++m_Stats.fileCount;
+                    ++m_Stats.failedCount;
+                }
+                FinishRead(std::move(read), nullptr);
+                continue;
+            }
+            if (read->segments.empty())
+            {
+                CloseNative(read->file);
+                FinishRead(std::move(read), MappedFile::FromBuffer({}));
+                continue;
+            }
+
+            // Owned by its segments until the last one completes
+            {
+                std::lock_guard lock(m_ReadsMutex);
+                ++m_ReadsInFlight;
+            }
+            read.release();
+        }
+        if (segments.empty()) return done;
+
+        {
+            std::lock_guard lock(m_StatsMutex);
+            if (m_Stats.queueDepth == 0) m_BusySince = std::chrono::steady_clock::now();
+            m_Stats.queueDepth += static_cast<uint32_t>(segments.size());
+            m_Stats.maxQueueDepth = std::max(m_Stats.maxQueueDepth, m_Stats.queueDepth);
+        }
+        m_Queue->Submit(segments);
+        return done;
+    }
+
+    std::shared_ptr<MappedFile> AsyncFileIO::Read(const std::string& path)
+    {
+        // The callback owns the promise, it may still run once this frame stopped waiting
+        auto promise = std::make_shared<std::promise<std::shared_ptr<MappedFile>>>();
+        auto future = promise->get_future();
+        ReadRequest request{
+            path,
+            [promise](std::shared_ptr<MappedFile> result)
+            {
+                promise->set_value(std::move(result));
+            }
+        };
+
+        // A worker runs other jobs until the file is read. Without a job system or a sync point
+        // there is nothing else to run, the caller sleeps on the read.
+        if (const auto done = ReadBatch({&request, 1}); done.IsValid())
+        {
+            Jobs::g_JobSystem->WaitFor(done);
+        }
+        return future.get();
+    }
+
+    AsyncFileIO::BackendType AsyncFileIO::GetBackendType() const
+    {
+        return m_Queue->GetType();
+    }
+
+    AsyncFileIOStats AsyncFileIO::GetStats() const
+    {
+        std::lock_guard lock(m_StatsMutex);
+        auto stats = m_Stats;
+        if (stats.queueDepth > 0)
+        {
+            stats.busySeconds += std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - m_BusySince).count();
+        }
+        return stats;
+    }
+
+    bool AsyncFileIO::StartRead(AsyncRead& read, VAArray<AsyncReadSegment*>& segments) const
+    {
+        // Opening stays blocking, it costs a metadata lookup rather than a transfer
+        uint64_t size = 0;
+        read.direct = m_Config.directThreshold > 0;
+        read.file = OpenNative(read.path, read.direct, size);
+        if (read.file == INVALID_NATIVE_FILE) return false;
+
+        // Small files are read through the page cache, only large ones would thrash it
+        if (read.direct && size < m_Config.directThreshold)
+        {
+            CloseNative(read.file);
+            read.direct = false;
+            read.file = OpenNative(read.path, read.direct, size);
+            if (read.file == INVALID_NATIVE_FILE) return false;
+        }
+
+        read.size = size;
+        if (size == 0) return true;
+
+        const auto capacity = AlignUp(size, BUFFER_ALIGNMENT);
+        read.buffer = m_Buffers->Acquire(capacity);
+
+        const auto count = (capacity + m_Config.segmentSize - 1) / m_Config.segmentSize;
+        read.segments.resize(count);
+        read.remaining.store(static_cast<uint32_t>(count), std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto& segment = read.segments[i];
+            segment.read = &read;
+            segment.offset = i * m_Config.segmentSize;
+            segment.length = static_cast<uint32_t>(
+                std::min<uint64_t>(m_Config.segmentSize, capacity - segment.offset));
+            segments.push_back(&segment);
+        }
+        return true;
+    }
+
+    void AsyncFileIO::CompleteSegment(AsyncReadSegment& segment, const int64_t result)
+    {
+        auto& read = *segment.read;
+
+        // Reads may stop short of what was asked, the rest is queued again. Direct transfers
+        // must start on an aligned offset, the rest then reads the unaligned tail again.
+        if (result > 0 && result < segment.length && segment.offset + result < read.size)
+        {
+            const auto consumed = read.direct
+                ? AlignDown(static_cast<uint64_t>(result), BUFFER_ALIGNMENT)
+                : static_cast<uint64_t>(result);
+            if (consumed > 0)
+            {
+                segment.offset += consumed;
+                segment.length -= static_cast<uint32_t>(consumed);
+                AsyncReadSegment* rest = &segment;
+                m_Queue->Submit({&rest, 1});
+                return;
+            }
+        }
+
+        // Stopping before the end without a whole block read means the file shrank since it
+        // was opened
+        const bool truncated = result >= 0 && result < segment.length &&
+            segment.offset + static_cast<uint64_t>(result) < read.size;
+        if (result < 0 || truncated)
+        {
+            if (!read.failed.exchange(true))
+            {
+                VA_ENGINE_ERROR(
+                    "[AsyncFileIO] Failed to read '{}': {}",
+                    read.path,
+                    result < 0 ? std::strerror(static_cast<int>(-result)) : "truncated");
+            }
+        }
+
+        // Once a segment is counted, the last one may complete and free the read meanwhile
+        const auto bytes = result > 0 ? std::min<uint64_t>(result, read.size - segment.offset) : 0;
+        const bool last = read.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        {
+            std::lock_guard lock(m_StatsMutex);
+            m_Stats.bytesRead += bytes;
+            if (--m_Stats.queueDepth == 0)
+            {
+                m_Stats.busySeconds += std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - m_BusySince).count();
+            }
+            if (last)
+            {
+                ++m_Stats.fileCount;
+                if (read.failed.load(std::memory_order_relaxed)) ++m_Stats.failedCount;
+            }
+        }
+        if (!last) return;
+
+        // Last segment of the file
+        std::unique_ptr<AsyncRead> owned(&read);
+        CloseNative(read.file);
+        auto file = read.failed
+            ? nullptr
+            : MappedFile::View({read.buffer.get(), read.size}, read.buffer);
+        FinishRead(std::move(owned), std::move(file));
+
+        // Notified under the lock, the destructor may run as soon as it is released
+        std::lock_guard lock(m_ReadsMutex);
+        --m_ReadsInFlight;
+        m_ReadsDone.notify_all();
+    }
+
+    void AsyncFileIO::FinishRead(
+        std::unique_ptr<AsyncRead> read,
+        std::shared_ptr<MappedFile> file)
+    {
+        if (read->done.IsValid() && Jobs::g_JobSystem)
+        {
+            const auto job = Jobs::g_JobSystem->Submit(
+                [callback = read->onComplete, file]() -> Jobs::JobResult
+                {
+                    callback(file);
+                    return Jobs::JobResult::Success();
+                },
+                read->done,
+                Jobs::JobPriority::High,
+                "AsyncFileRead");
+            if (job.IsValid()) return;
+
+            // Refused under backpressure, run it here and count it done ourselves
+            read->onComplete(std::move(file));
+            Jobs::g_JobSystem->Signal(read->done, Jobs::JobResult::Success());
+            return;
+        }
+
+        read->onComplete(std::move(file));
+    }
+} // namespace VoidArchitect::Platform
@@ -0,0 +1,132 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+#include "MappedFile.hpp"
+#include "Systems/Jobs/JobTypes.hpp"
+
+namespace VoidArchitect::Platform
+{
+    // Internals of AsyncFileIO, defined in AsyncFileIO.cpp
+    class AsyncReadQueue;
+    class IOBufferPool;
+    struct AsyncRead;
+    struct AsyncReadSegment;
+
+    /// @brief How AsyncFileIO reads
+    struct AsyncFileIOConfig
+    {
+        uint32_t queueDepth = 64; ///< Segments handed to the OS at once
+        uint32_t threadCount = 4; ///< Threads of the fallback backend, each blocks on a segment
+        uint32_t segmentSize = 1024 * 1024; ///< Files are read in segments read in parallel
+        uint64_t directThreshold = 0; ///< Files this large bypass the page cache, 0 for none
+        bool useIoUring = true; ///< false forces the thread pool, to compare the backends
+    };
+
+    /// @brief Reads done by an AsyncFileIO since it started
+    struct AsyncFileIOStats
+    {
+        uint64_t fileCount = 0; ///< Files read from the disk, failed or not
+        uint64_t failedCount = 0;
+        uint64_t bytesRead = 0;
+        uint32_t queueDepth = 0; ///< Segments in flight right now
+        uint32_t maxQueueDepth = 0;
+        double busySeconds = 0.0; ///< Time with at least one segment in flight
+
+        /// @brief MiB/s while the service was busy
+        [[nodiscard]] double GetThroughput() const;
+    };
+
+    /// @brief Reads whole files without blocking the job workers that need them
+    ///
+    /// Reads are queued to the OS in segments, through io_uring on Linux and a pool of threads
+    /// blocking on them elsewhere or where io_uring is not available. Each file lands in an
+    /// aligned buffer taken from a pool, then its callback is submitted to the job system. A
+    /// worker waiting for a batch runs other jobs meanwhile, rather than sleeping on the disk as
+    /// it does on a blocking read or on the page faults of a mapping.
+    ///
+    /// Files of a mounted asset pack are already mapped, they complete right away.
+    ///
+    /// Usage example:
+    /// @code
+    /// AsyncFileIO::ReadRequest requests[] = {
+    ///     {"assets/textures/wall.png", [](auto file) { Decode(file); }},
+    ///     {"assets/textures/floor.png", [](auto file) { Decode(file); }}};
+    /// Jobs::g_JobSystem->WaitFor(g_AsyncFileIO->ReadBatch(requests));
+    /// @endcode
+    class AsyncFileIO
+    {
+    public:
+        /// @brief Called with the bytes of a file, nullptr if it cannot be read
+        using ReadCallback = std::function<void(std::shared_ptr<MappedFile> file)>;
+
+        struct ReadRequest
+        {
+            std::string path;
+            ReadCallback onComplete;
+        };
+
+        enum class BackendType : uint8_t
+        {
+            IoUring,
+            ThreadPool
+        };
+
+        explicit AsyncFileIO(const AsyncFileIOConfig& config = {});
+
+        /// @brief Wait for the reads in flight, their callbacks may still be pending as jobs
+        ~AsyncFileIO();
+
+        AsyncFileIO(const AsyncFileIO&) = delete;
+        AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+
+        /// @brief Queue the reads of several files at once
+        /// @param requests Files to read, their callbacks are moved from
+        /// @return Sync point signaled once every callback ran. Without a job system, or when
+        ///         the sync point cannot be created, callbacks run on the I/O threads and the
+        ///         handle is invalid. A callback the scheduler refuses runs on the I/O thread too.
+        Jobs::SyncPointHandle ReadBatch(std::span<ReadRequest> requests);
+
+        /// @brief Read a single file, running other jobs until it is read
+        /// @return The file, nullptr if it cannot be read
+        std::shared_ptr<MappedFile> Read(const std::string& path);
+
+        [[nodiscard]] BackendType GetBackendType() const;
+
+        [[nodiscard]] AsyncFileIOStats GetStats() const;
+
+        /// @brief Buffers are aligned for direct I/O, which needs sector aligned transfers
+        static constexpr size_t BUFFER_ALIGNMENT = 4096;
+
+    private:
+        friend class AsyncReadQueue;
+
+        /// @brief Open a file and split it in segments, false if it cannot be opened
+        bool StartRead(AsyncRead& read, VAArray<AsyncReadSegment*>& segments) const;
+
+        /// @brief Called by the backends with the bytes read for a segment, or -errno
+        void CompleteSegment(AsyncReadSegment& segment, int64_t result);
+
+        /// @brief Hand a file to its callback, through the job system if any
+        void FinishRead(std::unique_ptr<AsyncRead> read, std::shared_ptr<MappedFile> file);
+
+        AsyncFileIOConfig m_Config;
+        std::shared_ptr<IOBufferPool> m_Buffers;
+        std::unique_ptr<AsyncReadQueue> m_Queue;
+
+        // Reads started and not finished, the destructor waits for them
+        std::mutex m_ReadsMutex;
+        std::condition_variable m_ReadsDone;
+        uint32_t m_ReadsInFlight = 0;
+
+        mutable std::mutex m_StatsMutex;
+        AsyncFileIOStats m_Stats;
+        std::chrono::steady_clock::time_point m_BusySince;
+    };
+
+    inline std::unique_ptr<AsyncFileIO> g_AsyncFileIO;
+} // namespace VoidArchitect::Platform
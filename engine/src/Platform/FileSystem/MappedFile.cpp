@@ -0,0 +1,154 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "MappedFile.hpp"
+
+#include "Core/Core.hpp"
+#include "Core/Logger.hpp"
+
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+#include <Windows.h>
+#elif defined(VOID_ARCH_PLATFORM_LINUX) || defined(VOID_ARCH_PLATFORM_MACOS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace VoidArchitect::Platform
+{
+    std::shared_ptr<MappedFile> MappedFile::Open(const std::string& path, const Mode mode)
+    {
+        // The constructor is private, std::make_shared cannot reach it
+        std::shared_ptr<MappedFile> file(new MappedFile());
+        if (mode != Mode::Read && file->Map(path, mode == Mode::Map)) return file;
+        if (file->Read(path)) return file;
+
+        return nullptr;
+    }
+
+    std::shared_ptr<MappedFile> MappedFile::View(
+        const std::span<const uint8_t> bytes,
+        std::shared_ptr<const void> owner)
+    {
+        std::shared_ptr<MappedFile> file(new MappedFile());
+        file->m_Data = bytes.data();
+        file->m_Size = bytes.size();
+        file->m_Owner = std::move(owner);
+        return file;
+    }
+
+    std::shared_ptr<MappedFile> MappedFile::FromBuffer(VAArray<uint8_t> buffer)
+    {
+        std::shared_ptr<MappedFile> file(new MappedFile());
+        file->m_Buffer = std::move(buffer);
+        file->m_Data = file->m_Buffer.data();
+        file->m_Size = file->m_Buffer.size();
+        return file;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (!m_Mapped) return;
+
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+        UnmapViewOfFile(m_Data);
+#elif defined(VOID_ARCH_PLATFORM_LINUX) || defined(VOID_ARCH_PLATFORM_MACOS)
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+    }
+
+    bool MappedFile::Map(const std::string& path, const bool readAhead)
+    {
+#ifdef VOID_ARCH_PLATFORM_WINDOWS
+        const auto fileHandle = CreateFileA(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | (readAhead ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS),
+            nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart == 0)
+        {
+            // Empty files cannot be mapped, reading them is free
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        // The view keeps the mapping alive, neither handle is needed past this point
+        const auto mapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(fileHandle);
+        if (!mapping) return false;
+
+        const auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view) return false;
+
+        m_Data = static_cast<const uint8_t*>(view);
+        m_Size = static_cast<size_t>(size.QuadPart);
+#elif defined(VOID_ARCH_PLATFORM_LINUX) || defined(VOID_ARCH_PLATFORM_MACOS)
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) return false;
+
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0 || status.st_size == 0)
+        {
+            close(descriptor);
+            return false;
+        }
+
+        // The mapping keeps its own reference to the file
+        const auto size = static_cast<size_t>(status.st_size);
+        auto* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+        if (view == MAP_FAILED) return false;
+
+        // Files are parsed front to back right away, let the OS read ahead. Archives are read
+        // an entry at a time, reading them ahead would load every entry at startup.
+        if (readAhead)
+        {
+            posix_madvise(view, size, POSIX_MADV_SEQUENTIAL);
+            posix_madvise(view, size, POSIX_MADV_WILLNEED);
+        }
+        else
+        {
+            posix_madvise(view, size, POSIX_MADV_RANDOM);
+        }
+
+        m_Data = static_cast<const uint8_t*>(view);
+        m_Size = size;
+#else
+        return false;
+#endif
+        m_Mapped = true;
+        return true;
+    }
+
+    bool MappedFile::Read(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+        {
+            VA_ENGINE_ERROR("[MappedFile] Failed to open file for reading: {}", path);
+            return false;
+        }
+
+        m_Buffer.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(
+            reinterpret_cast<char*>(m_Buffer.data()),
+            static_cast<std::streamsize>(m_Buffer.size())))
+        {
+            VA_ENGINE_ERROR("[MappedFile] Failed to read file: {}", path);
+            return false;
+        }
+
+        m_Data = m_Buffer.data();
+        m_Size = m_Buffer.size();
+        return true;
+    }
+} // namespace VoidArchitect::Platform
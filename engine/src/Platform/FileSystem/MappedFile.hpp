@@ -0,0 +1,80 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+namespace VoidArchitect::Platform
+{
+    /// @brief Read-only view of a whole file
+    ///
+    /// In Map mode the file is mapped in the address space: pages are read by the OS on first
+    /// access and shared with its page cache, opening copies nothing and parsers read the
+    /// sections in place. Read mode loads the file into an owned buffer instead, it is the
+    /// fallback where a file cannot be mapped and the reference the mapping is measured against.
+    /// Callers see the same bytes either way.
+    ///
+    /// Files are shared: anything viewing the bytes keeps the file alive with a copy of the
+    /// pointer returned by Open(). A file may also be a view into a larger one, such as an entry
+    /// of an AssetPack, keeping that one alive instead.
+    ///
+    /// Usage example:
+    /// @code
+    /// const auto file = MappedFile::Open("cache/sponza.vam");
+    /// if (file) Parse(file->GetBytes());
+    /// @endcode
+    class MappedFile
+    {
+    public:
+        enum class Mode : uint8_t
+        {
+            Map, ///< Map the file, read into a buffer if mapping fails
+            Read, ///< Always read the file into a buffer
+            MapRandom ///< Map the file without reading ahead, for archives read piece by piece
+        };
+
+        /// @brief Open a file for reading
+        /// @param path Path of the file
+        /// @param mode How the bytes are made available
+        /// @return The opened file, nullptr if it cannot be opened
+        static std::shared_ptr<MappedFile> Open(const std::string& path, Mode mode = Mode::Map);
+
+        /// @brief View bytes that belong to another object
+        /// @param bytes Bytes of the file
+        /// @param owner Keeps the bytes alive as long as the view
+        static std::shared_ptr<MappedFile> View(
+            std::span<const uint8_t> bytes,
+            std::shared_ptr<const void> owner);
+
+        /// @brief Take ownership of bytes already read or decompressed
+        static std::shared_ptr<MappedFile> FromBuffer(VAArray<uint8_t> buffer);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /// @brief Every byte of the file, valid as long as the file is alive
+        [[nodiscard]] std::span<const uint8_t> GetBytes() const { return {m_Data, m_Size}; }
+
+        [[nodiscard]] size_t GetSize() const { return m_Size; }
+
+        /// @brief Whether the bytes are mapped rather than read into a buffer, false for views
+        [[nodiscard]] bool IsMapped() const { return m_Mapped; }
+
+    private:
+        MappedFile() = default;
+
+        /// @brief Map the file, false if the platform or the file does not allow it
+        /// @param readAhead Ask the OS to read the whole file ahead of the first accesses
+        bool Map(const std::string& path, bool readAhead);
+
+        /// @brief Read the whole file into m_Buffer
+        bool Read(const std::string& path);
+
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+        bool m_Mapped = false;
+        VAArray<uint8_t> m_Buffer; ///< Content of the file in Read mode
+        std::shared_ptr<const void> m_Owner; ///< Owner of the bytes of a view
+    };
+} // namespace VoidArchitect::Platform
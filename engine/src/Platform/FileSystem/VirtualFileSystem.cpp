@@ -0,0 +1,115 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "VirtualFileSystem.hpp"
+
+#include <filesystem>
+
+#include "Core/Logger.hpp"
+
+namespace VoidArchitect::Platform
+{
+    std::mutex VirtualFileSystem::s_MountsMutex;
+    VAArray<VirtualFileSystem::MountPoint> VirtualFileSystem::s_Mounts;
+
+    bool VirtualFileSystem::Mount(const std::string& packPath, const std::string& directory)
+    {
+        auto pack = AssetPack::Open(packPath);
+        if (!pack) return false;
+
+        auto mountPoint = Normalize(directory);
+        if (!mountPoint.empty() && mountPoint.back() != '/') mountPoint += '/';
+
+        VA_ENGINE_INFO(
+            "[VirtualFileSystem] Mounted '{}' on '{}', {} files.",
+            packPath,
+            mountPoint,
+            pack->GetEntries().size());
+
+        std::lock_guard lock(s_MountsMutex);
+        s_Mounts.push_back({std::move(mountPoint), std::move(pack)});
+        return true;
+    }
+
+    bool VirtualFileSystem::MountIfPresent(const std::string& directory)
+    {
+        auto packPath = Normalize(directory);
+        while (!packPath.empty() && packPath.back() == '/') packPath.pop_back();
+        packPath += ASSET_PACK_EXTENSION;
+
+        if (!std::filesystem::exists(packPath)) return false;
+        return Mount(packPath, directory);
+    }
+
+    void VirtualFileSystem::Unmount(const std::string& directory)
+    {
+        auto mountPoint = Normalize(directory);
+        if (!mountPoint.empty() && mountPoint.back() != '/') mountPoint += '/';
+
+        // Files already opened keep their pack alive
+        std::lock_guard lock(s_MountsMutex);
+        std::erase_if(
+            s_Mounts,
+            [&](const MountPoint& mount) { return mount.directory == mountPoint; });
+    }
+
+    void VirtualFileSystem::UnmountAll()
+    {
+        std::lock_guard lock(s_MountsMutex);
+        s_Mounts.clear();
+    }
+
+    std::shared_ptr<MappedFile> VirtualFileSystem::Open(
+        const std::string& path,
+        const MappedFile::Mode mode)
+    {
+        if (const auto [pack, name] = Resolve(path); pack) return pack->OpenFile(name);
+        return MappedFile::Open(path, mode);
+    }
+
+    bool VirtualFileSystem::IsPacked(const std::string& path)
+    {
+        return Resolve(path).first != nullptr;
+    }
+
+    bool VirtualFileSystem::Exists(const std::string& path)
+    {
+        if (IsPacked(path)) return true;
+
+        std::error_code error;
+        return std::filesystem::is_regular_file(path, error);
+    }
+
+    std::optional<std::string> VirtualFileSystem::ReadText(const std::string& path)
+    {
+        if (!Exists(path)) return std::nullopt;
+
+        const auto file = Open(path, MappedFile::Mode::Read);
+        if (!file) return std::nullopt;
+
+        const auto bytes = file->GetBytes();
+        return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    std::pair<std::shared_ptr<AssetPack>, std::string> VirtualFileSystem::Resolve(
+        const std::string& path)
+    {
+        std::lock_guard lock(s_MountsMutex);
+        if (s_Mounts.empty()) return {};
+
+        const auto normalized = Normalize(path);
+        for (auto it = s_Mounts.rbegin(); it != s_Mounts.rend(); ++it)
+        {
+            if (!normalized.starts_with(it->directory)) continue;
+
+            auto name = normalized.substr(it->directory.size());
+            if (it->pack->Find(name)) return {it->pack, std::move(name)};
+        }
+        return {};
+    }
+
+    std::string VirtualFileSystem::Normalize(const std::string& path)
+    {
+        return std::filesystem::path(path).lexically_normal().generic_string();
+    }
+} // namespace VoidArchitect::Platform
@@ -0,0 +1,75 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <mutex>
+
+#include "AssetPack.hpp"
+
+namespace VoidArchitect::Platform
+{
+    /// @brief Files read from the mounted asset packs, or from the disk when no pack has them
+    ///
+    /// A pack mounted on a directory stands for every file under it: a path inside the
+    /// directory is looked up in the pack's table of contents, without a single file system
+    /// call. Paths no mounted pack contains are read from the disk as they are, so development
+    /// builds without packs see the loose files.
+    ///
+    /// Paths are compared lexically once normalized, a pack mounted on "assets/" serves
+    /// "assets/meshes/../textures/wall.png" as its entry "textures/wall.png".
+    ///
+    /// Usage example:
+    /// @code
+    /// VirtualFileSystem::MountIfPresent("assets/"); // Mounts assets.vapack if it exists
+    /// const auto file = VirtualFileSystem::Open("assets/materials/DefaultUI.yaml");
+    /// @endcode
+    class VirtualFileSystem
+    {
+    public:
+        /// @brief Serve the files under a directory from a pack, the last mount wins
+        /// @return false if the pack cannot be opened
+        static bool Mount(const std::string& packPath, const std::string& directory);
+
+        /// @brief Mount the pack named after a directory, "assets/" for "assets.vapack"
+        /// @return false if there is no such pack or it cannot be opened
+        static bool MountIfPresent(const std::string& directory);
+
+        /// @brief Stop serving a directory from its packs
+        static void Unmount(const std::string& directory);
+
+        static void UnmountAll();
+
+        /// @brief Bytes of a file, from a mounted pack or the disk
+        /// @param path Path of the file, as it would be opened from the disk
+        /// @param mode How a loose file is read, packed files are always mapped
+        /// @return The file, nullptr if it exists nowhere
+        static std::shared_ptr<MappedFile> Open(
+            const std::string& path,
+            MappedFile::Mode mode = MappedFile::Mode::Map);
+
+        /// @brief Whether a mounted pack serves a file, which Open() then reads without I/O
+        static bool IsPacked(const std::string& path);
+
+        /// @brief Whether a file exists in a mounted pack or on the disk
+        static bool Exists(const std::string& path);
+
+        /// @brief Content of a text file, such as YAML, empty if it exists nowhere
+        static std::optional<std::string> ReadText(const std::string& path);
+
+    private:
+        struct MountPoint
+        {
+            std::string directory; ///< Normalized, ends with '/'
+            std::shared_ptr<AssetPack> pack;
+        };
+
+        /// @brief Pack entry of a path, pack is nullptr if no mounted pack contains it
+        static std::pair<std::shared_ptr<AssetPack>, std::string> Resolve(const std::string& path);
+
+        static std::string Normalize(const std::string& path);
+
+        static std::mutex s_MountsMutex;
+        static VAArray<MountPoint> s_Mounts;
+    };
+} // namespace VoidArchitect::Platform
@@ -50,6 +50,14 @@ namespace VoidArchitect::Platform
         Vulkan, // Vulkan implementation of RHI.
     };
 
+    /// @brief Host to GPU buffer traffic of one frame
+    struct GPUUploadStats
+    {
+        uint64_t bytes = 0; ///< Bytes copied from the staging memory
+        uint32_t copies = 0; ///< Copy regions recorded
+        uint32_t submissions = 0; ///< Upload batches submitted to the queue
+    };
+
     class IRenderingHardware
     {
     public:
@@ -62,6 +70,9 @@ namespace VoidArchitect::Platform
         virtual bool BeginFrame(float deltaTime) = 0;
         virtual bool EndFrame(float deltaTime) = 0;
 
+        /// @brief Buffer uploads of the last completed frame, e.g. deforming meshes
+        [[nodiscard]] virtual GPUUploadStats GetLastFrameUploadStats() const = 0;
+
         virtual void BeginRenderPass(
             RenderPassHandle passHandle,
             const VAArray<Resources::RenderTargetHandle>& targetHandles) = 0;
@@ -86,6 +97,8 @@ namespace VoidArchitect::Platform
         ///////////////////////////////////////////////////////////////////////
         //// Resources ////////////////////////////////////////////////////////
         ///////////////////////////////////////////////////////////////////////
+        // NOTE Textures, render states, materials and meshes are allocated from the engine
+        //  pool allocator, release them with Memory::PoolDelete (or hold them in a PoolPtr).
         virtual Resources::Texture2D* CreateTexture2D(
             const std::string& name,
             uint32_t width,
@@ -110,7 +123,8 @@ namespace VoidArchitect::Platform
         virtual Resources::IMesh* CreateMesh(
             const std::string& name,
             const std::shared_ptr<Resources::MeshData>& data,
-            const VAArray<Resources::SubMeshDescriptor>& submeshes) = 0;
+            const VAArray<Resources::SubMeshDescriptor>& submeshes,
+            Renderer::VertexFormat vertexFormat) = 0;
 
         virtual Resources::RenderTargetHandle CreateRenderTarget(
             const Renderer::RenderTargetConfig& config) = 0;
@@ -186,7 +186,7 @@ namespace VoidArchitect::Platform
         const MaterialHandle MaterialHandle,
         const RenderStateHandle stateHandle)
     {
-        const auto& materialConfig = g_MaterialSystem->GetTemplateFor(MaterialHandle);
+        const auto materialConfig = g_MaterialSystem->GetTemplateFor(MaterialHandle);
         const auto& stateConfig = g_RenderStateSystem->GetConfigFor(stateHandle);
 
         if (materialConfig.resourceBindings.size() != stateConfig.expectedBindings.size())
@@ -210,7 +210,7 @@ namespace VoidArchitect::Platform
     VkDescriptorSetLayout VulkanBindingGroupManager::GetHandleFor(
         const MaterialHandle materialHandle)
     {
-        const auto& materialConfig = g_MaterialSystem->GetTemplateFor(materialHandle);
+        const auto materialConfig = g_MaterialSystem->GetTemplateFor(materialHandle);
         const size_t hash = materialConfig.GetBindingsHash();
 
         auto it = m_SetLayoutCache.find(hash);
@@ -262,7 +262,7 @@ namespace VoidArchitect::Platform
         VkDescriptorSet set,
         MaterialHandle materialHandle)
     {
-        const auto& materialConfig = g_MaterialSystem->GetTemplateFor(materialHandle);
+        const auto materialConfig = g_MaterialSystem->GetTemplateFor(materialHandle);
         auto* vkMat = dynamic_cast<VulkanMaterial*>(g_MaterialSystem->GetPointerFor(
             materialHandle));
 
@@ -247,6 +247,20 @@ namespace VoidArchitect::Platform
         fence.Wait();
     }
 
+    VulkanVertexBuffer::VulkanVertexBuffer(
+        const std::unique_ptr<VulkanDevice>& device,
+        VkAllocationCallbacks* allocator,
+        const uint64_t byteSize)
+        : VulkanBuffer(
+            device,
+            allocator,
+            byteSize,
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+    {
+    }
+
     void VulkanVertexBuffer::Bind(IRenderingHardware& rhi)
     {
         auto& vkRhi = dynamic_cast<VulkanRHI&>(rhi);
@@ -268,17 +282,69 @@ namespace VoidArchitect::Platform
         const std::unique_ptr<VulkanDevice>& device,
         VkAllocationCallbacks* allocator,
         const VAArray<uint32_t>& data,
-        bool bindOnCreate)
+        const bool bindOnCreate)
+        : VulkanIndexBuffer(
+            device,
+            allocator,
+            data,
+            Resources::MeshData::FitsShortIndices(data)
+            ? VK_INDEX_TYPE_UINT16
+            : VK_INDEX_TYPE_UINT32,
+            bindOnCreate)
+    {
+    }
+
+    VulkanIndexBuffer::VulkanIndexBuffer(
+        const std::unique_ptr<VulkanDevice>& device,
+        VkAllocationCallbacks* allocator,
+        const VAArray<uint32_t>& data,
+        const VkIndexType indexType,
+        const bool bindOnCreate)
         : VulkanBuffer(
             device,
             allocator,
-            data.size() * sizeof(uint32_t),
+            data.size() * GetIndexSize(indexType),
             VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
             VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-            bindOnCreate)
+            bindOnCreate),
+          m_IndexType(indexType),
+          m_IndexCount(static_cast<uint32_t>(data.size()))
     {
-        const auto staging = VulkanStagingBuffer(device, allocator, data);
+        // Staging buffers are typed, narrow the indices first when they are uploaded as 16-bit
+        if (m_IndexType == VK_INDEX_TYPE_UINT16)
+        {
+            UploadIndices(device, VAArray<uint16_t>(data.begin(), data.end()));
+        }
+        else
+        {
+            UploadIndices(device, data);
+        }
+    }
+
+    VulkanIndexBuffer::VulkanIndexBuffer(
+        const std::unique_ptr<VulkanDevice>& device,
+        VkAllocationCallbacks* allocator,
+        const uint32_t capacity,
+        const VkIndexType indexType)
+        : VulkanBuffer(
+            device,
+            allocator,
+            capacity * GetIndexSize(indexType),
+            VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+          m_IndexType(indexType),
+          m_IndexCount(0)
+    {
+    }
+
+    template <typename T>
+    void VulkanIndexBuffer::UploadIndices(
+        const std::unique_ptr<VulkanDevice>& device,
+        const VAArray<T>& indices)
+    {
+        const auto staging = VulkanStagingBuffer(device, m_Allocator, indices);
         auto fence = VulkanFence(m_Device, m_Allocator);
         staging.CopyTo(
             device->GetGraphicsCommandPool(),
@@ -300,7 +366,7 @@ namespace VoidArchitect::Platform
         //     vkRhi.GetCurrentCommandBuffer().GetHandle(),
         //     m_Buffer,
         //     0,
-        //     VK_INDEX_TYPE_UINT32);
+        //     m_IndexType);
     }
 
     void VulkanIndexBuffer::Unbind()
@@ -132,10 +132,18 @@ namespace VoidArchitect::Platform
             const VAArray<Resources::MeshVertex>& data,
             bool bindOnCreate = true);
 
+        /// @brief Uninitialized buffer, filled through the staging ring
+        /// @param byteSize Capacity of the buffer in bytes
+        VulkanVertexBuffer(
+            const std::unique_ptr<VulkanDevice>& device,
+            VkAllocationCallbacks* allocator,
+            uint64_t byteSize);
+
         void Bind(IRenderingHardware& rhi) override;
         void Unbind() override;
     };
 
+    /// @brief Device-local index buffer, stored as 16-bit indices whenever they all fit
     class VulkanIndexBuffer : public VulkanBuffer
     {
     public:
@@ -145,7 +153,49 @@ namespace VoidArchitect::Platform
             const VAArray<uint32_t>& data,
             bool bindOnCreate = true);
 
+        /// @brief Uninitialized buffer, filled through the staging ring
+        /// @param capacity Number of indices the buffer can hold
+        /// @param indexType VK_INDEX_TYPE_UINT16 or VK_INDEX_TYPE_UINT32
+        VulkanIndexBuffer(
+            const std::unique_ptr<VulkanDevice>& device,
+            VkAllocationCallbacks* allocator,
+            uint32_t capacity,
+            VkIndexType indexType);
+
         void Bind(IRenderingHardware& rhi) override;
         void Unbind() override;
+
+        /// @brief VK_INDEX_TYPE_UINT16 or VK_INDEX_TYPE_UINT32, to pass to vkCmdBindIndexBuffer
+        [[nodiscard]] VkIndexType GetIndexType() const { return m_IndexType; }
+        [[nodiscard]] uint32_t GetIndexCount() const { return m_IndexCount; }
+
+        /// @brief Number of indices the buffer can hold, at least GetIndexCount()
+        [[nodiscard]] uint32_t GetCapacity() const
+        {
+            return static_cast<uint32_t>(m_Size / GetIndexSize(m_IndexType));
+        }
+
+        /// @brief Number of valid indices, after they were uploaded through the staging ring
+        void SetIndexCount(const uint32_t count) { m_IndexCount = count; }
+
+        /// @brief Byte size of an index of the given type
+        static uint64_t GetIndexSize(const VkIndexType indexType)
+        {
+            return indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+        }
+
+    private:
+        VulkanIndexBuffer(
+            const std::unique_ptr<VulkanDevice>& device,
+            VkAllocationCallbacks* allocator,
+            const VAArray<uint32_t>& data,
+            VkIndexType indexType,
+            bool bindOnCreate);
+
+        template <typename T>
+        void UploadIndices(const std::unique_ptr<VulkanDevice>& device, const VAArray<T>& indices);
+
+        VkIndexType m_IndexType;
+        uint32_t m_IndexCount;
     };
 } // namespace VoidArchitect::Platform
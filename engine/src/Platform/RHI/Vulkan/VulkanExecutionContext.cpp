@@ -136,6 +136,11 @@ namespace VoidArchitect::Platform
         cmdBuf.Reset();
         cmdBuf.Begin();
 
+        // Nothing is bound in a new command buffer
+        m_BoundVertexBuffer = VK_NULL_HANDLE;
+        m_BoundAttributeBuffer = VK_NULL_HANDLE;
+        m_BoundIndexBuffer = VK_NULL_HANDLE;
+
         const VkViewport viewport = {
             .x = 0.0f,
             .y = static_cast<float>(m_CurrentHeight),
@@ -323,14 +328,34 @@ namespace VoidArchitect::Platform
             // Mesh is still loading or failed to load - skip binding
             return false;
         }
-        const auto* vkVertices = dynamic_cast<VulkanVertexBuffer*>(vkMesh->GetVertexBuffer());
+        const auto* vkPositions = dynamic_cast<VulkanVertexBuffer*>(vkMesh->GetVertexBuffer());
+        const auto* vkAttributes = dynamic_cast<VulkanVertexBuffer*>(
+            vkMesh->GetAttributeBuffer());
         const auto* vkIndices = dynamic_cast<VulkanIndexBuffer*>(vkMesh->GetIndexBuffer());
 
-        const VkDeviceSize offsets = {0};
-        const auto vertBuf = vkVertices->GetHandle();
-        vkCmdBindVertexBuffers(cmdBuf.GetHandle(), 0, 1, &vertBuf, &offsets);
-        vkCmdBindIndexBuffer(cmdBuf.GetHandle(), vkIndices->GetHandle(), 0, VK_INDEX_TYPE_UINT32);
+        // Meshes share the geometry pool buffers, only a change of format rebinds them.
+        // Depth-only pipelines have no input binding for the attribute stream and only
+        // fetch the positions.
+        const VkBuffer vertexBuffers[] = {vkPositions->GetHandle(), vkAttributes->GetHandle()};
+        if (vertexBuffers[0] != m_BoundVertexBuffer || vertexBuffers[1] != m_BoundAttributeBuffer)
+        {
+            constexpr VkDeviceSize offsets[] = {0, 0};
+            vkCmdBindVertexBuffers(cmdBuf.GetHandle(), 0, 2, vertexBuffers, offsets);
+            m_BoundVertexBuffer = vertexBuffers[0];
+            m_BoundAttributeBuffer = vertexBuffers[1];
+        }
+        if (vkIndices->GetHandle() != m_BoundIndexBuffer)
+        {
+            vkCmdBindIndexBuffer(
+                cmdBuf.GetHandle(),
+                vkIndices->GetHandle(),
+                0,
+                vkIndices->GetIndexType());
+            m_BoundIndexBuffer = vkIndices->GetHandle();
+        }
 
+        m_BoundBaseVertex = vkMesh->GetBaseVertex();
+        m_BoundFirstIndex = vkMesh->GetFirstIndex();
         return true;
     }
 
@@ -359,12 +384,13 @@ namespace VoidArchitect::Platform
         const auto& cmdBuf = GetCurrentCommandBuffer();
         VA_ENGINE_ASSERT(cmdBuf.GetHandle() != VK_NULL_HANDLE, "No current command buffer");
 
+        // Offsets are relative to the bound mesh, which is a range of the shared buffers
         vkCmdDrawIndexed(
             cmdBuf.GetHandle(),
             indexCount,
             instanceCount,
-            indexOffset,
-            vertexOffset,
+            m_BoundFirstIndex + indexOffset,
+            static_cast<int32_t>(m_BoundBaseVertex + vertexOffset),
             firstInstance);
     }
 
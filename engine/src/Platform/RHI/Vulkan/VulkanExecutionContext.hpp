@@ -129,6 +129,13 @@ namespace VoidArchitect::Platform
         VAArray<VulkanCommandBuffer> m_GraphicsCommandBuffers;
         VkPipelineLayout m_LastBoundPipelineLayout = VK_NULL_HANDLE;
 
+        // Geometry pool buffers bound in the current command buffer, and the bound mesh range
+        VkBuffer m_BoundVertexBuffer = VK_NULL_HANDLE;
+        VkBuffer m_BoundAttributeBuffer = VK_NULL_HANDLE;
+        VkBuffer m_BoundIndexBuffer = VK_NULL_HANDLE;
+        uint32_t m_BoundBaseVertex = 0;
+        uint32_t m_BoundFirstIndex = 0;
+
         VkDescriptorPool m_GlobalDescriptorPool;
         VkDescriptorSetLayout m_GlobalDescriptorSetLayout;
         VkDescriptorSet* m_GlobalDescriptorSets;
@@ -0,0 +1,171 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "VulkanGeometryPool.hpp"
+
+#include "Core/Logger.hpp"
+#include "Resources/VertexStreams.hpp"
+#include "VulkanStagingRing.hpp"
+
+namespace VoidArchitect::Platform
+{
+    namespace
+    {
+        /// @brief First capacity of an arena, in elements: 256K vertices or 1M indices
+        constexpr uint32_t INITIAL_VERTEX_CAPACITY = 256 * 1024;
+        constexpr uint32_t INITIAL_INDEX_CAPACITY = 1024 * 1024;
+    } // namespace
+
+    VulkanGeometryArena::VulkanGeometryArena(
+        const std::unique_ptr<VulkanDevice>& device,
+        VkAllocationCallbacks* allocator,
+        std::string name,
+        VAArray<uint64_t> strides,
+        const std::optional<VkIndexType> indexType)
+        : m_Device(device),
+          m_Allocator(allocator),
+          m_Name(std::move(name)),
+          m_Strides(std::move(strides)),
+          m_IndexType(indexType),
+          m_Buffers(m_Strides.size())
+    {
+        VA_ENGINE_ASSERT(
+            !m_Strides.empty() && (!m_IndexType || m_Strides.size() == 1),
+            "An index arena has a single stream.");
+    }
+
+    uint32_t VulkanGeometryArena::Allocate(const uint32_t count)
+    {
+        auto offset = m_Ranges.Allocate(count);
+        if (offset == Memory::RangeAllocator::INVALID_OFFSET)
+        {
+            Grow(count);
+            offset = m_Ranges.Allocate(count);
+        }
+
+        VA_ENGINE_ASSERT(
+            offset != Memory::RangeAllocator::INVALID_OFFSET,
+            "Geometry arena failed to grow.");
+        return offset;
+    }
+
+    void VulkanGeometryArena::Free(const uint32_t offset, const uint32_t count)
+    {
+        m_PendingFrees.push_back({offset, count});
+    }
+
+    void VulkanGeometryArena::EndFrame()
+    {
+        for (const auto& [offset, count] : m_PendingFrees) m_Ranges.Free(offset, count);
+        m_PendingFrees.clear();
+
+        for (auto& buffer : m_RetiredBuffers) g_VkStagingRing->Retire(std::move(buffer));
+        m_RetiredBuffers.clear();
+    }
+
+    void VulkanGeometryArena::Grow(const uint32_t count)
+    {
+        const auto oldCapacity = m_Ranges.GetCapacity();
+        const auto minimum = static_cast<uint64_t>(oldCapacity) + count;
+        uint64_t capacity = oldCapacity > 0
+            ? 2ull * oldCapacity
+            : (m_IndexType ? INITIAL_INDEX_CAPACITY : INITIAL_VERTEX_CAPACITY);
+        while (capacity < minimum) capacity *= 2;
+        capacity = std::min<uint64_t>(capacity, Memory::RangeAllocator::INVALID_OFFSET);
+
+        uint64_t elementSize = 0;
+        for (uint32_t stream = 0; stream < m_Strides.size(); ++stream)
+        {
+            auto buffer = CreateBuffer(stream, static_cast<uint32_t>(capacity));
+            auto& current = m_Buffers[stream];
+            if (current)
+            {
+                // Every offset stays valid, the content moves as a whole
+                g_VkStagingRing->CopyBuffer(
+                    current->GetHandle(),
+                    0,
+                    buffer->GetHandle(),
+                    0,
+                    oldCapacity * m_Strides[stream]);
+
+                // The frame being recorded may already reference the old buffer
+                m_RetiredBuffers.push_back(std::move(current));
+            }
+            current = std::move(buffer);
+            elementSize += m_Strides[stream];
+        }
+        m_Ranges.Grow(static_cast<uint32_t>(capacity));
+
+        VA_ENGINE_TRACE(
+            "[VulkanGeometryArena] Arena '{}' grown from {} to {} elements ({} KiB).",
+            m_Name,
+            oldCapacity,
+            capacity,
+            capacity * elementSize / 1024);
+    }
+
+    std::unique_ptr<VulkanBuffer> VulkanGeometryArena::CreateBuffer(
+        const uint32_t stream,
+        const uint32_t capacity) const
+    {
+        if (m_IndexType.has_value())
+        {
+            return std::make_unique<VulkanIndexBuffer>(
+                m_Device,
+                m_Allocator,
+                capacity,
+                m_IndexType.value());
+        }
+        return std::make_unique<VulkanVertexBuffer>(
+            m_Device,
+            m_Allocator,
+            capacity * m_Strides[stream]);
+    }
+
+    VulkanGeometryPool::VulkanGeometryPool(
+        const std::unique_ptr<VulkanDevice>& device,
+        VkAllocationCallbacks* allocator)
+        : m_Device(device),
+          m_Allocator(allocator)
+    {
+        m_ShortIndexArena = std::make_unique<VulkanGeometryArena>(
+            device,
+            allocator,
+            "Indices16",
+            VAArray<uint64_t>{sizeof(uint16_t)},
+            VK_INDEX_TYPE_UINT16);
+        m_IndexArena = std::make_unique<VulkanGeometryArena>(
+            device,
+            allocator,
+            "Indices32",
+            VAArray<uint64_t>{sizeof(uint32_t)},
+            VK_INDEX_TYPE_UINT32);
+    }
+
+    VulkanGeometryArena& VulkanGeometryPool::GetVertexArena(const uint64_t attributeStride)
+    {
+        auto& arena = m_VertexArenas[attributeStride];
+        if (!arena)
+        {
+            arena = std::make_unique<VulkanGeometryArena>(
+                m_Device,
+                m_Allocator,
+                "Vertices" + std::to_string(attributeStride),
+                VAArray<uint64_t>{sizeof(Resources::VertexPosition), attributeStride},
+                std::nullopt);
+        }
+        return *arena;
+    }
+
+    VulkanGeometryArena& VulkanGeometryPool::GetIndexArena(const VkIndexType indexType)
+    {
+        return indexType == VK_INDEX_TYPE_UINT16 ? *m_ShortIndexArena : *m_IndexArena;
+    }
+
+    void VulkanGeometryPool::EndFrame()
+    {
+        for (auto& [stride, arena] : m_VertexArenas) arena->EndFrame();
+        m_ShortIndexArena->EndFrame();
+        m_IndexArena->EndFrame();
+    }
+} // namespace VoidArchitect::Platform
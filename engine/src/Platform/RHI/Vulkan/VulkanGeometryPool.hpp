@@ -0,0 +1,143 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include <optional>
+
+#include "Core/Memory/RangeAllocator.hpp"
+#include "VulkanBuffer.hpp"
+
+namespace VoidArchitect::Platform
+{
+    /// @brief Shared device-local buffers, sub-allocated in elements of a fixed stride
+    ///
+    /// An arena holds one buffer per stream, e.g. the positions and the other attributes of
+    /// the vertices. Every stream has the same capacity and a range is the same element
+    /// range in each of them, so a single vertex offset addresses all streams.
+    ///
+    /// The buffers double their capacity when an allocation does not fit, copying their
+    /// content on the GPU through the staging ring: offsets handed out earlier stay valid,
+    /// only the VkBuffers change.
+    ///
+    /// Released ranges and replaced buffers are only recycled at EndFrame(), once the frame
+    /// that may still reference them has been submitted: the next upload batch is ordered
+    /// after that frame.
+    class VulkanGeometryArena
+    {
+    public:
+        /// @param name Name used in the logs
+        /// @param strides Byte size of an element of each stream
+        /// @param indexType Index type of an index arena, empty for a vertex arena
+        VulkanGeometryArena(
+            const std::unique_ptr<VulkanDevice>& device,
+            VkAllocationCallbacks* allocator,
+            std::string name,
+            VAArray<uint64_t> strides,
+            std::optional<VkIndexType> indexType);
+
+        /// @brief Allocate a range, growing the buffer if needed
+        /// @param count Number of elements, must not be 0
+        /// @return Offset of the range in elements
+        uint32_t Allocate(uint32_t count);
+
+        /// @brief Release a range at the end of the frame
+        void Free(uint32_t offset, uint32_t count);
+
+        /// @brief Recycle the ranges and buffers released during the frame
+        void EndFrame();
+
+        /// @brief Current buffer of a stream, null until the first allocation
+        [[nodiscard]] VulkanBuffer* GetBuffer(const uint32_t stream = 0) const
+        {
+            return m_Buffers[stream].get();
+        }
+
+        [[nodiscard]] uint64_t GetStride(const uint32_t stream = 0) const
+        {
+            return m_Strides[stream];
+        }
+
+        [[nodiscard]] uint32_t GetStreamCount() const
+        {
+            return static_cast<uint32_t>(m_Strides.size());
+        }
+
+        [[nodiscard]] uint32_t GetCapacity() const { return m_Ranges.GetCapacity(); }
+        [[nodiscard]] uint32_t GetUsed() const { return m_Ranges.GetUsed(); }
+
+    private:
+        struct PendingFree
+        {
+            uint32_t offset;
+            uint32_t count;
+        };
+
+        /// @brief Replace the buffer with a larger one able to hold count more elements
+        void Grow(uint32_t count);
+
+        [[nodiscard]] std::unique_ptr<VulkanBuffer> CreateBuffer(
+            uint32_t stream,
+            uint32_t capacity) const;
+
+        const std::unique_ptr<VulkanDevice>& m_Device;
+        VkAllocationCallbacks* m_Allocator;
+
+        std::string m_Name;
+        VAArray<uint64_t> m_Strides;
+        std::optional<VkIndexType> m_IndexType;
+
+        VAArray<std::unique_ptr<VulkanBuffer>> m_Buffers;
+        Memory::RangeAllocator m_Ranges;
+
+        VAArray<PendingFree> m_PendingFrees;
+        VAArray<std::unique_ptr<VulkanBuffer>> m_RetiredBuffers;
+    };
+
+    /// @brief Shared geometry buffers of every mesh
+    ///
+    /// Meshes do not own GPU buffers, they are ranges of one vertex arena per vertex format
+    /// and one index arena per index type. Drawing meshes of the same formats one after the
+    /// other only binds the geometry once, the draws select their mesh with their first
+    /// index and vertex offset. Indirect and multi-draw rendering build on the same layout.
+    ///
+    /// Vertex arenas have two streams, see Resources::VertexStreams: POSITION_STREAM holds
+    /// the positions of every format, ATTRIBUTE_STREAM the other attributes.
+    ///
+    /// Usage example:
+    /// @code
+    /// auto& vertices = g_VkGeometryPool->GetVertexArena(sizeof(Resources::VertexAttributes));
+    /// const auto baseVertex = vertices.Allocate(vertexCount);
+    /// // Upload each stream at baseVertex * vertices.GetStride(stream) in its buffer
+    /// vertices.Free(baseVertex, vertexCount);
+    /// @endcode
+    class VulkanGeometryPool
+    {
+    public:
+        static constexpr uint32_t POSITION_STREAM = 0;
+        static constexpr uint32_t ATTRIBUTE_STREAM = 1;
+
+        VulkanGeometryPool(
+            const std::unique_ptr<VulkanDevice>& device,
+            VkAllocationCallbacks* allocator);
+
+        /// @brief Arena of the vertices whose attribute stream has the given byte size,
+        ///        created on first use
+        VulkanGeometryArena& GetVertexArena(uint64_t attributeStride);
+
+        /// @brief Arena of the indices of the given type
+        VulkanGeometryArena& GetIndexArena(VkIndexType indexType);
+
+        /// @brief Recycle what was released during the frame, after its submission
+        void EndFrame();
+
+    private:
+        const std::unique_ptr<VulkanDevice>& m_Device;
+        VkAllocationCallbacks* m_Allocator;
+
+        VAHashMap<uint64_t, std::unique_ptr<VulkanGeometryArena>> m_VertexArenas;
+        std::unique_ptr<VulkanGeometryArena> m_ShortIndexArena;
+        std::unique_ptr<VulkanGeometryArena> m_IndexArena;
+    };
+
+    inline std::unique_ptr<VulkanGeometryPool> g_VkGeometryPool;
+} // namespace VoidArchitect::Platform
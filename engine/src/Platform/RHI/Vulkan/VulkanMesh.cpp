@@ -3,26 +3,65 @@
 //
 #include "VulkanMesh.hpp"
 
+#include "VulkanGeometryPool.hpp"
 #include "VulkanRhi.hpp"
+#include "VulkanStagingRing.hpp"
 #include "Resources/MeshData.hpp"
 #include "Resources/SubMesh.hpp"
+#include "Resources/VertexStreams.hpp"
 
 namespace VoidArchitect::Platform
 {
+    namespace
+    {
+        /// @brief Stage bytes already laid out like a stream of an arena
+        /// @param arena Arena receiving the bytes
+        /// @param stream Stream of the arena
+        /// @param firstElement Element of the stream the bytes start at
+        /// @param bytes Whole elements of the stream
+        void StageStream(
+            VulkanGeometryArena& arena,
+            const uint32_t stream,
+            const uint32_t firstElement,
+            const std::span<const uint8_t> bytes)
+        {
+            const auto stride = arena.GetStride(stream);
+            const auto buffer = arena.GetBuffer(stream)->GetHandle();
+            const auto chunkSize = g_VkStagingRing->GetMaxStageSize() / stride * stride;
+            for (uint64_t first = 0; first < bytes.size(); first += chunkSize)
+            {
+                const auto size = std::min<uint64_t>(chunkSize, bytes.size() - first);
+                auto* staging = g_VkStagingRing->Stage(buffer, firstElement * stride + first, size);
+                std::memcpy(staging, bytes.data() + first, size);
+            }
+        }
+    } // namespace
+
     VulkanMesh::VulkanMesh(
         const std::unique_ptr<VulkanDevice>& device,
         VkAllocationCallbacks* allocator,
         const std::string& name,
         const std::shared_ptr<Resources::MeshData>& data,
-        const VAArray<Resources::SubMeshDescriptor>& submeshes)
-        : IMesh(name, data, submeshes),
+        const VAArray<Resources::SubMeshDescriptor>& submeshes,
+        const Renderer::VertexFormat vertexFormat)
+        : IMesh(name, data, submeshes, vertexFormat),
           m_Device(device),
-          m_Allocator(allocator)
+          m_Allocator(allocator),
+          m_VertexArena(&g_VkGeometryPool->GetVertexArena(GetAttributeStride())),
+          m_IndexArena(&g_VkGeometryPool->GetIndexArena(m_IndexType))
     {
         InitiliazeFromData();
         m_LastKnownGeneration = m_Data->GetGeneration();
     }
 
+    VulkanMesh::~VulkanMesh()
+    {
+        if (!g_VkGeometryPool) return;
+
+        if (m_VertexCapacity > 0) m_VertexArena->Free(m_VertexOffset, m_VertexCapacity);
+        if (m_IndexCapacity > 0) m_IndexArena->Free(m_IndexOffset, m_IndexCapacity);
+    }
+
     void VulkanMesh::UpdateSubmeshMaterial(const uint32_t index, MaterialHandle newMaterial)
     {
         VA_ENGINE_ASSERT(index < m_Submeshes.size(), "SubMesh index is out of bounds.");
@@ -56,48 +95,277 @@ namespace VoidArchitect::Platform
         const uint32_t currentGeneration = m_Data->GetGeneration();
         if (m_LastKnownGeneration == currentGeneration) return;
 
+        const auto dirtyVertices = m_Data->GetDirtyVertices().GetTotalCount();
+        const auto dirtyIndices = m_Data->GetDirtyIndices().GetTotalCount();
         VA_ENGINE_TRACE(
-            "[VulkanMesh] Mesh '{}' data changed (generation {} -> {}), updating GPU buffers.",
+            "[VulkanMesh] Mesh '{}' data changed (generation {} -> {}), uploading {} vertices and {} indices.",
             m_Name,
             m_LastKnownGeneration,
-            currentGeneration);
+            currentGeneration,
+            dirtyVertices,
+            dirtyIndices);
 
-        RecreateBuffers();
+        SyncVertices();
+        SyncIndices();
+        m_Data->ClearDirtyRanges();
         m_LastKnownGeneration = currentGeneration;
     }
 
-    void VulkanMesh::RecreateBuffers()
+    void VulkanMesh::InitiliazeFromData()
     {
-        m_VertexBuffer = std::make_unique<VulkanVertexBuffer>(
-            m_Device,
-            m_Allocator,
-            m_Data->vertices);
+        VA_ENGINE_ASSERT(m_Data && !m_Data->IsEmpty(), "Invalid mesh data provided");
+
+        // Without GPU ranges, everything is uploaded: the ranges recorded so far are moot
+        m_Data->ClearDirtyRanges();
+        const auto* packed = m_Data->GetPackedGeometry();
+        if (packed && CanUploadPacked(*packed))
+        {
+            UploadPacked(*packed);
+        }
+        else
+        {
+            SyncVertices();
+            SyncIndices();
+        }
 
-        m_IndexBuffer = std::make_unique<VulkanIndexBuffer>(m_Device, m_Allocator, m_Data->indices);
+        // Later changes go through the dirty ranges, the streams are not needed anymore
+        m_Data->ReleasePackedGeometry();
 
         VA_ENGINE_TRACE(
-            "[VulkanMesh] GPU buffers recreated for mesh '{}' with {} submeshes (vertices: {}, indices: {}).",
+            "[VulkanMesh] GPU ranges initialized for mesh '{}' with {} submeshes (vertices: {} at {}, indices: {} at {}, {}-bit).",
             m_Name,
             m_Submeshes.size(),
-            m_Data->vertices.size(),
-            m_Data->indices.size());
+            m_VertexCount,
+            m_VertexOffset,
+            m_IndexCount,
+            m_IndexOffset,
+            m_IndexType == VK_INDEX_TYPE_UINT16 ? 16 : 32);
     }
 
-    void VulkanMesh::InitiliazeFromData()
+    bool VulkanMesh::CanUploadPacked(const Resources::PackedGeometry& geometry) const
     {
-        VA_ENGINE_ASSERT(m_Data && !m_Data->IsEmpty(), "Invalid mesh data provided");
+        const auto vertexCount = m_Data->vertices.size();
+        const auto indexSize = geometry.shortIndices ? sizeof(uint16_t) : sizeof(uint32_t);
+        return geometry.compactAttributes ==
+            (m_VertexFormat == Renderer::VertexFormat::PositionNormalUVTangentCompact) &&
+            geometry.positions.size() == vertexCount * sizeof(Resources::VertexPosition) &&
+            geometry.attributes.size() == vertexCount * GetAttributeStride() &&
+            geometry.indices.size() == m_Data->indices.size() * indexSize;
+    }
 
-        m_VertexBuffer = std::make_unique<VulkanVertexBuffer>(
-            m_Device,
-            m_Allocator,
-            m_Data->vertices);
-        m_IndexBuffer = std::make_unique<VulkanIndexBuffer>(m_Device, m_Allocator, m_Data->indices);
+    void VulkanMesh::UploadPacked(const Resources::PackedGeometry& geometry)
+    {
+        const auto vertexCount = static_cast<uint32_t>(m_Data->vertices.size());
+        const auto indexCount = static_cast<uint32_t>(m_Data->indices.size());
 
-        VA_ENGINE_TRACE(
-            "[VulkanMesh] GPU buffers initialized for mesh '{}' with {} submeshes (vertices: {}, indices: {}).",
-            m_Name,
-            m_Submeshes.size(),
-            m_Data->vertices.size(),
-            m_Data->indices.size());
+        // The bake already chose the index type, with the same rule as SyncIndices()
+        m_IndexType = geometry.shortIndices ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+        m_IndexArena = &g_VkGeometryPool->GetIndexArena(m_IndexType);
+
+        m_VertexOffset = m_VertexArena->Allocate(vertexCount);
+        m_VertexCapacity = vertexCount;
+        m_IndexOffset = m_IndexArena->Allocate(indexCount);
+        m_IndexCapacity = indexCount;
+
+        // Allocating may grow the arenas, their buffers are only looked up past this point
+        StageStream(
+            *m_VertexArena,
+            VulkanGeometryPool::POSITION_STREAM,
+            m_VertexOffset,
+            geometry.positions);
+        StageStream(
+            *m_VertexArena,
+            VulkanGeometryPool::ATTRIBUTE_STREAM,
+            m_VertexOffset,
+            geometry.attributes);
+        StageStream(*m_IndexArena, 0, m_IndexOffset, geometry.indices);
+
+        m_VertexCount = vertexCount;
+        m_IndexCount = indexCount;
+    }
+
+    void VulkanMesh::SyncVertices()
+    {
+        const auto vertexCount = static_cast<uint32_t>(m_Data->vertices.size());
+
+        // Vertices past the previous upload are new, whether they were recorded or not
+        auto ranges = m_Data->GetDirtyVertices();
+        if (vertexCount > m_VertexCount) ranges.Add(m_VertexCount, vertexCount - m_VertexCount);
+        ranges.Truncate(vertexCount);
+
+        if (vertexCount > m_VertexCapacity)
+        {
+            // Doubling keeps the number of moves of a growing mesh logarithmic
+            const auto capacity = std::max(vertexCount, 2 * m_VertexCapacity);
+            const auto offset = m_VertexArena->Allocate(capacity);
+            if (m_VertexCapacity > 0)
+            {
+                const auto keptCount = std::min(m_VertexCount, vertexCount);
+                const auto streamCount = keptCount > 0 ? m_VertexArena->GetStreamCount() : 0;
+                for (uint32_t stream = 0; stream < streamCount; ++stream)
+                {
+                    const auto stride = m_VertexArena->GetStride(stream);
+                    const auto buffer = m_VertexArena->GetBuffer(stream)->GetHandle();
+                    g_VkStagingRing->CopyBuffer(
+                        buffer,
+                        m_VertexOffset * stride,
+                        buffer,
+                        offset * stride,
+                        keptCount * stride);
+                }
+                m_VertexArena->Free(m_VertexOffset, m_VertexCapacity);
+            }
+            m_VertexOffset = offset;
+            m_VertexCapacity = capacity;
+        }
+
+        for (const auto& range : ranges.GetRanges()) UploadVertices(range);
+        m_VertexCount = vertexCount;
+    }
+
+    void VulkanMesh::SyncIndices()
+    {
+        const auto& indices = m_Data->indices;
+        const auto indexCount = static_cast<uint32_t>(indices.size());
+
+        auto ranges = m_Data->GetDirtyIndices();
+        if (indexCount > m_IndexCount) ranges.Add(m_IndexCount, indexCount - m_IndexCount);
+        ranges.Truncate(indexCount);
+
+        // Only the modified indices need checking, the others already fit their arena
+        const bool widened = m_IndexType == VK_INDEX_TYPE_UINT16 && !std::ranges::all_of(
+            ranges.GetRanges(),
+            [&](const Resources::DirtyRange& range)
+            {
+                return Resources::MeshData::FitsShortIndices(
+                    std::span(indices).subspan(range.offset, range.count));
+            });
+
+        if (widened)
+        {
+            // A new index type cannot reuse the old content
+            if (m_IndexCapacity > 0) m_IndexArena->Free(m_IndexOffset, m_IndexCapacity);
+            m_IndexType = VK_INDEX_TYPE_UINT32;
+            m_IndexArena = &g_VkGeometryPool->GetIndexArena(m_IndexType);
+            m_IndexCapacity = 0;
+            m_IndexCount = 0;
+            ranges.Clear();
+            ranges.Add(0, indexCount);
+        }
+
+        const auto stride = m_IndexArena->GetStride();
+        if (indexCount > m_IndexCapacity)
+        {
+            const auto capacity = std::max(indexCount, 2 * m_IndexCapacity);
+            const auto offset = m_IndexArena->Allocate(capacity);
+            if (m_IndexCapacity > 0)
+            {
+                const auto keptCount = std::min(m_IndexCount, indexCount);
+                if (keptCount > 0)
+                {
+                    const auto buffer = m_IndexArena->GetBuffer()->GetHandle();
+                    g_VkStagingRing->CopyBuffer(
+                        buffer,
+                        m_IndexOffset * stride,
+                        buffer,
+                        offset * stride,
+                        keptCount * stride);
+                }
+                m_IndexArena->Free(m_IndexOffset, m_IndexCapacity);
+            }
+            m_IndexOffset = offset;
+            m_IndexCapacity = capacity;
+        }
+
+        for (const auto& range : ranges.GetRanges()) UploadIndices(range);
+        m_IndexCount = indexCount;
+    }
+
+    void VulkanMesh::UploadVertices(const Resources::DirtyRange& range) const
+    {
+        constexpr auto POSITION_STREAM = VulkanGeometryPool::POSITION_STREAM;
+        constexpr auto ATTRIBUTE_STREAM = VulkanGeometryPool::ATTRIBUTE_STREAM;
+        const auto positionStride = m_VertexArena->GetStride(POSITION_STREAM);
+        const auto attributeStride = m_VertexArena->GetStride(ATTRIBUTE_STREAM);
+        const auto positionBuffer = m_VertexArena->GetBuffer(POSITION_STREAM)->GetHandle();
+        const auto attributeBuffer = m_VertexArena->GetBuffer(ATTRIBUTE_STREAM)->GetHandle();
+        const auto chunkSize = static_cast<uint32_t>(
+            g_VkStagingRing->GetMaxStageSize() / std::max(positionStride, attributeStride));
+
+        for (auto first = range.offset; first < range.GetEnd();)
+        {
+            const auto count = std::min(chunkSize, range.GetEnd() - first);
+            const auto vertex = m_VertexOffset + first;
+            const auto source = std::span(m_Data->vertices).subspan(first, count);
+
+            // Staging may flush the pending batch, each stream is filled before the next
+            auto* positions = g_VkStagingRing->Stage(
+                positionBuffer,
+                vertex * positionStride,
+                count * positionStride);
+            Resources::VertexStreams::ExtractPositions(
+                source,
+                std::span(static_cast<Resources::VertexPosition*>(positions), count));
+
+            auto* attributes = g_VkStagingRing->Stage(
+                attributeBuffer,
+                vertex * attributeStride,
+                count * attributeStride);
+            if (m_VertexFormat == Renderer::VertexFormat::PositionNormalUVTangentCompact)
+            {
+                Resources::VertexStreams::ExtractCompactAttributes(
+                    source,
+                    std::span(static_cast<Resources::CompactVertexAttributes*>(attributes), count));
+            }
+            else
+            {
+                Resources::VertexStreams::ExtractAttributes(
+                    source,
+                    std::span(static_cast<Resources::VertexAttributes*>(attributes), count));
+            }
+            first += count;
+        }
+    }
+
+    void VulkanMesh::UploadIndices(const Resources::DirtyRange& range) const
+    {
+        const auto stride = m_IndexArena->GetStride();
+        const auto buffer = m_IndexArena->GetBuffer()->GetHandle();
+        const auto chunkSize = static_cast<uint32_t>(g_VkStagingRing->GetMaxStageSize() / stride);
+        for (auto first = range.offset; first < range.GetEnd();)
+        {
+            const auto count = std::min(chunkSize, range.GetEnd() - first);
+            auto* staging = g_VkStagingRing->Stage(
+                buffer,
+                (m_IndexOffset + first) * stride,
+                count * stride);
+
+            const auto source = std::span(m_Data->indices).subspan(first, count);
+            if (m_IndexType == VK_INDEX_TYPE_UINT16)
+            {
+                std::ranges::transform(
+                    source,
+                    static_cast<uint16_t*>(staging),
+                    [](const uint32_t index) { return static_cast<uint16_t>(index); });
+            }
+            else
+            {
+                std::memcpy(staging, source.data(), source.size_bytes());
+            }
+            first += count;
+        }
+    }
+
+    uint64_t VulkanMesh::GetAttributeStride() const
+    {
+        if (m_VertexFormat == Renderer::VertexFormat::PositionNormalUVTangentCompact)
+        {
+            return sizeof(Resources::CompactVertexAttributes);
+        }
+
+        VA_ENGINE_ASSERT(
+            m_VertexFormat == Renderer::VertexFormat::PositionNormalUVTangent,
+            "Unsupported mesh vertex format.");
+        return sizeof(Resources::VertexAttributes);
     }
 }
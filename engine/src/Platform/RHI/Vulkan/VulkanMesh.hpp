@@ -2,8 +2,11 @@
 // Created by Michael Desmedt on 31/05/2025.
 //
 #pragma once
+#include "Resources/DirtyRanges.hpp"
+#include "Resources/MeshData.hpp"
 #include "Resources/Mesh.hpp"
 #include "VulkanBuffer.hpp"
+#include "VulkanGeometryPool.hpp"
 
 namespace VoidArchitect
 {
@@ -17,25 +20,48 @@ namespace VoidArchitect
                 VkAllocationCallbacks* allocator,
                 const std::string& name,
                 const std::shared_ptr<Resources::MeshData>& data,
-                const VAArray<Resources::SubMeshDescriptor>& submeshes);
-            ~VulkanMesh() override = default;
+                const VAArray<Resources::SubMeshDescriptor>& submeshes,
+                Renderer::VertexFormat vertexFormat);
+            ~VulkanMesh() override;
 
             void UpdateSubmeshMaterial(
                 uint32_t index,
                 Resources::MaterialHandle newMaterial) override;
 
+            /// @brief Shared position stream of the geometry pool holding this mesh, the only
+            ///        vertex buffer of depth-only passes
             IBuffer* GetVertexBuffer() override
             {
                 UpdateGPUBuffersIfNeeded();
-                return m_VertexBuffer.get();
+                return m_VertexArena->GetBuffer(VulkanGeometryPool::POSITION_STREAM);
             };
 
+            /// @brief Shared attribute stream of the geometry pool holding this mesh, every
+            ///        vertex attribute past the position
+            IBuffer* GetAttributeBuffer()
+            {
+                UpdateGPUBuffersIfNeeded();
+                return m_VertexArena->GetBuffer(VulkanGeometryPool::ATTRIBUTE_STREAM);
+            };
+
+            /// @brief Shared index buffer of the geometry pool holding this mesh
             IBuffer* GetIndexBuffer() override
             {
                 UpdateGPUBuffersIfNeeded();
-                return m_IndexBuffer.get();
+                return m_IndexArena->GetBuffer();
             };
-            uint32_t GetIndicesCount() const override { return m_IndexBuffer->GetCount(); }
+            uint32_t GetIndicesCount() const override { return m_IndexCount; }
+
+            /// @brief First vertex of the mesh in the shared vertex buffer, added to the
+            ///        vertex offset of its draws
+            [[nodiscard]] uint32_t GetBaseVertex() const { return m_VertexOffset; }
+
+            /// @brief First index of the mesh in the shared index buffer, added to the first
+            ///        index of its draws
+            [[nodiscard]] uint32_t GetFirstIndex() const { return m_IndexOffset; }
+
+            /// @brief VK_INDEX_TYPE_UINT16 or VK_INDEX_TYPE_UINT32
+            [[nodiscard]] VkIndexType GetIndexType() const { return m_IndexType; }
 
             [[nodiscard]] const Resources::SubMeshDescriptor&
             GetSubMesh(uint32_t index) const override;
@@ -54,14 +80,49 @@ namespace VoidArchitect
             mutable uint32_t m_LastKnownGeneration = 0;
 
             void UpdateGPUBuffersIfNeeded();
-            void RecreateBuffers();
             void InitiliazeFromData();
 
+            /// @brief Bring the vertex range up to date with the dirty vertices of the data
+            /// @note The range only grows, doubling its capacity, and keeps its content when
+            ///       it moves.
+            void SyncVertices();
+
+            /// @brief Bring the index range up to date with the dirty indices of the data
+            /// @note 16-bit indices move to the 32-bit arena once an index no longer fits,
+            ///       they never go back.
+            void SyncIndices();
+
+            /// @brief Whether streams attached to the data match this mesh format and can be
+            ///        staged as they are
+            [[nodiscard]] bool CanUploadPacked(const Resources::PackedGeometry& geometry) const;
+
+            /// @brief Allocate exact ranges and stage the attached streams without converting
+            ///        them, instead of SyncVertices() and SyncIndices()
+            void UploadPacked(const Resources::PackedGeometry& geometry);
+
+            /// @brief Stage a range of vertices in both streams, quantizing the attributes if
+            ///        the format is compact
+            void UploadVertices(const Resources::DirtyRange& range) const;
+
+            /// @brief Stage a range of indices, narrowing them if the buffer is 16-bit
+            void UploadIndices(const Resources::DirtyRange& range) const;
+
+            /// @brief Byte size of the attributes of a vertex on the GPU, in m_VertexFormat
+            [[nodiscard]] uint64_t GetAttributeStride() const;
+
             const std::unique_ptr<VulkanDevice>& m_Device;
             VkAllocationCallbacks* m_Allocator;
 
-            std::unique_ptr<VulkanBuffer> m_VertexBuffer;
-            std::unique_ptr<VulkanBuffer> m_IndexBuffer;
+            VulkanGeometryArena* m_VertexArena = nullptr;
+            uint32_t m_VertexOffset = 0;
+            uint32_t m_VertexCapacity = 0;
+            uint32_t m_VertexCount = 0;
+
+            VkIndexType m_IndexType = VK_INDEX_TYPE_UINT16;
+            VulkanGeometryArena* m_IndexArena = nullptr;
+            uint32_t m_IndexOffset = 0;
+            uint32_t m_IndexCapacity = 0;
+            uint32_t m_IndexCount = 0;
         };
     } // namespace Platform
 } // namespace VoidArchitect
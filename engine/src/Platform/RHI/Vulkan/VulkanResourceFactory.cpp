@@ -4,6 +4,7 @@
 #include "VulkanResourceFactory.hpp"
 
 #include "Core/Logger.hpp"
+#include "Core/Memory/PoolAllocator.hpp"
 #include "Systems/ShaderSystem.hpp"
 #include "VulkanExecutionContext.hpp"
 #include "VulkanMaterial.hpp"
@@ -30,6 +31,12 @@ namespace VoidArchitect::Platform
                     case Renderer::AttributeFormat::Float32:
                         vulkanFormat = VK_FORMAT_R32_SFLOAT;
                         break;
+                    case Renderer::AttributeFormat::Float16:
+                        vulkanFormat = VK_FORMAT_R16_SFLOAT;
+                        break;
+                    case Renderer::AttributeFormat::SNorm16:
+                        vulkanFormat = VK_FORMAT_R16_SNORM;
+                        break;
                 }
             }
             break;
@@ -41,6 +48,12 @@ namespace VoidArchitect::Platform
                     case Renderer::AttributeFormat::Float32:
                         vulkanFormat = VK_FORMAT_R32G32_SFLOAT;
                         break;
+                    case Renderer::AttributeFormat::Float16:
+                        vulkanFormat = VK_FORMAT_R16G16_SFLOAT;
+                        break;
+                    case Renderer::AttributeFormat::SNorm16:
+                        vulkanFormat = VK_FORMAT_R16G16_SNORM;
+                        break;
                 }
             }
             break;
@@ -52,6 +65,12 @@ namespace VoidArchitect::Platform
                     case Renderer::AttributeFormat::Float32:
                         vulkanFormat = VK_FORMAT_R32G32B32_SFLOAT;
                         break;
+                    case Renderer::AttributeFormat::Float16:
+                        vulkanFormat = VK_FORMAT_R16G16B16_SFLOAT;
+                        break;
+                    case Renderer::AttributeFormat::SNorm16:
+                        vulkanFormat = VK_FORMAT_R16G16B16_SNORM;
+                        break;
                 }
             }
             break;
@@ -63,6 +82,12 @@ namespace VoidArchitect::Platform
                     case Renderer::AttributeFormat::Float32:
                         vulkanFormat = VK_FORMAT_R32G32B32A32_SFLOAT;
                         break;
+                    case Renderer::AttributeFormat::Float16:
+                        vulkanFormat = VK_FORMAT_R16G16B16A16_SFLOAT;
+                        break;
+                    case Renderer::AttributeFormat::SNorm16:
+                        vulkanFormat = VK_FORMAT_R16G16B16A16_SNORM;
+                        break;
                 }
             }
             break;
@@ -84,6 +109,10 @@ namespace VoidArchitect::Platform
             case Renderer::AttributeFormat::Float32:
                 size = sizeof(float);
                 break;
+            case Renderer::AttributeFormat::Float16:
+            case Renderer::AttributeFormat::SNorm16:
+                size = sizeof(uint16_t);
+                break;
 
             default:
                 break;
@@ -127,7 +156,7 @@ namespace VoidArchitect::Platform
         const bool hasTransparency,
         const VAArray<uint8_t>& data) const
     {
-        return new VulkanTexture2D(
+        return Memory::PoolNew<VulkanTexture2D, Memory::MemoryTag::Texture>(
             m_Device,
             m_Allocator,
             name,
@@ -195,11 +224,12 @@ namespace VoidArchitect::Platform
         multisamplingInfo.sampleShadingEnable = VK_FALSE;
 
         // === 2. Construct the Vertex Input State ===
-        auto [bindingDesc, attributeDescs] = GetVertexInputDesc(config);
+        auto [bindingDescs, attributeDescs] = GetVertexInputDesc(config);
         VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertexInputInfo.vertexBindingDescriptionCount = 1;
-        vertexInputInfo.pVertexBindingDescriptions = &bindingDesc;
+        vertexInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(bindingDescs.
+            size());
+        vertexInputInfo.pVertexBindingDescriptions = bindingDescs.data();
         vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescs.
             size());
         vertexInputInfo.pVertexAttributeDescriptions = attributeDescs.data();
@@ -277,7 +307,12 @@ namespace VoidArchitect::Platform
                 pipelineCreateInfo, m_Allocator, &pipeline));
 
         // === 5. Return the Pipeline ===
-        return new VulkanPipeline(config.name, m_Device, m_Allocator, pipeline, pipelineLayout);
+        return Memory::PoolNew<VulkanPipeline, Memory::MemoryTag::Render>(
+            config.name,
+            m_Device,
+            m_Allocator,
+            pipeline,
+            pipelineLayout);
     }
 
     VkPipelineRasterizationStateCreateInfo VulkanResourceFactory::CreateRasterizerState(
@@ -340,39 +375,49 @@ namespace VoidArchitect::Platform
         return retVlt;
     }
 
-    std::pair<VkVertexInputBindingDescription, std::vector<VkVertexInputAttributeDescription>>
+    std::pair<VAArray<VkVertexInputBindingDescription>, std::vector<
+        VkVertexInputAttributeDescription>>
     VulkanResourceFactory::GetVertexInputDesc(const RenderStateConfig& stateConfig) const
     {
-        uint32_t offset = 0;
+        // Meshes store their positions and their other attributes in separate streams, see
+        // VulkanGeometryPool. Depth-only states only have a position and a single binding.
+        uint32_t strides[2] = {0, 0};
         VAArray<VkVertexInputAttributeDescription> attributeDescs;
         for (uint32_t i = 0; i < stateConfig.vertexAttributes.size(); i++)
         {
             const auto& [type, format] = stateConfig.vertexAttributes[i];
+            const uint32_t binding = i == 0 ? 0 : 1;
             VkVertexInputAttributeDescription attribute{};
             attribute.location = i;
-            attribute.binding = 0;
+            attribute.binding = binding;
             attribute.format = TranslateEngineAttributeFormatToVulkan(type, format);
-            attribute.offset = offset;
+            attribute.offset = strides[binding];
 
             attributeDescs.push_back(attribute);
-            offset += GetEngineAttributeSize(type, format);
+            strides[binding] += GetEngineAttributeSize(type, format);
         }
-        const uint32_t stride = offset;
 
-        // --- Vertex input binding ---
-        auto bindingDescription = VkVertexInputBindingDescription{};
-        bindingDescription.binding = 0;
-        bindingDescription.stride = stride;
-        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        // --- Vertex input bindings ---
+        VAArray<VkVertexInputBindingDescription> bindingDescs;
+        for (uint32_t binding = 0; binding < 2; binding++)
+        {
+            if (strides[binding] == 0) continue;
 
-        return std::pair(bindingDescription, attributeDescs);
+            auto bindingDescription = VkVertexInputBindingDescription{};
+            bindingDescription.binding = binding;
+            bindingDescription.stride = strides[binding];
+            bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+            bindingDescs.push_back(bindingDescription);
+        }
+
+        return std::pair(bindingDescs, attributeDescs);
     }
 
     Resources::IMaterial* VulkanResourceFactory::CreateMaterial(
         const std::string& name,
         const MaterialTemplate& templ) const
     {
-        return new VulkanMaterial(name, templ);
+        return Memory::PoolNew<VulkanMaterial, Memory::MemoryTag::Render>(name, templ);
     }
 
     Resources::IShader* VulkanResourceFactory::CreateShader(
@@ -386,9 +431,16 @@ namespace VoidArchitect::Platform
     Resources::IMesh* VulkanResourceFactory::CreateMesh(
         const std::string& name,
         const std::shared_ptr<Resources::MeshData>& data,
-        const VAArray<Resources::SubMeshDescriptor>& submeshes) const
+        const VAArray<Resources::SubMeshDescriptor>& submeshes,
+        const Renderer::VertexFormat vertexFormat) const
     {
-        return new VulkanMesh(m_Device, m_Allocator, name, data, submeshes);
+        return Memory::PoolNew<VulkanMesh, Memory::MemoryTag::Mesh>(
+            m_Device,
+            m_Allocator,
+            name,
+            data,
+            submeshes,
+            vertexFormat);
     }
 
     Resources::IRenderTarget* VulkanResourceFactory::CreateRenderTarget(
@@ -66,7 +66,8 @@ namespace VoidArchitect
             Resources::IMesh* CreateMesh(
                 const std::string& name,
                 const std::shared_ptr<Resources::MeshData>& data,
-                const VAArray<Resources::SubMeshDescriptor>& submeshes) const;
+                const VAArray<Resources::SubMeshDescriptor>& submeshes,
+                Renderer::VertexFormat vertexFormat) const;
 
             Resources::IRenderTarget* CreateRenderTarget(
                 const Renderer::RenderTargetConfig& config) const;
@@ -88,7 +89,9 @@ namespace VoidArchitect
                 const RenderStateConfig& stateConfig) const;
             std::pair<VkPipelineColorBlendStateCreateInfo, VkPipelineColorBlendAttachmentState>
             CreateColorBlendState(const RenderStateConfig& stateConfig) const;
-            std::pair<VkVertexInputBindingDescription, std::vector<
+            /// @brief Vertex input of the split geometry streams: the first attribute, the
+            ///        position, reads binding 0, the others read binding 1
+            std::pair<VAArray<VkVertexInputBindingDescription>, std::vector<
                           VkVertexInputAttributeDescription>> GetVertexInputDesc(
                 const RenderStateConfig& stateConfig) const;
 
@@ -11,8 +11,10 @@
 #include "VulkanBindingGroupManager.hpp"
 #include "VulkanDevice.hpp"
 #include "VulkanExecutionContext.hpp"
+#include "VulkanGeometryPool.hpp"
 #include "VulkanRenderTargetSystem.hpp"
 #include "VulkanResourceFactory.hpp"
+#include "VulkanStagingRing.hpp"
 
 namespace VoidArchitect::Platform
 {
@@ -25,6 +27,8 @@ namespace VoidArchitect::Platform
         m_Allocator = nullptr;
 
         CreateDevice();
+        CreateStagingRing();
+        CreateGeometryPool();
         CreateResourceFactory();
         g_VkRenderTargetSystem = std::make_unique<VulkanRenderTargetSystem>(g_VkResourceFactory);
 
@@ -40,6 +44,9 @@ namespace VoidArchitect::Platform
         g_VkExecutionContext = nullptr;
         g_VkRenderTargetSystem = nullptr;
         g_VkResourceFactory = nullptr;
+        // The ring submits its pending copies into the pool buffers before going away
+        g_VkStagingRing = nullptr;
+        g_VkGeometryPool = nullptr;
 
         m_Device = nullptr;
         VA_ENGINE_INFO("[VulkanRHI] Device destroyed.");
@@ -79,6 +86,18 @@ namespace VoidArchitect::Platform
         VA_ENGINE_INFO("[VulkanRHI] Resource factory created.");
     }
 
+    void VulkanRHI::CreateStagingRing()
+    {
+        g_VkStagingRing = std::make_unique<VulkanStagingRing>(m_Device, m_Allocator);
+        VA_ENGINE_INFO("[VulkanRHI] Staging ring created.");
+    }
+
+    void VulkanRHI::CreateGeometryPool()
+    {
+        g_VkGeometryPool = std::make_unique<VulkanGeometryPool>(m_Device, m_Allocator);
+        VA_ENGINE_INFO("[VulkanRHI] Geometry pool created.");
+    }
+
     void VulkanRHI::CreateBindingGroupsManager()
     {
         g_VkBindingGroupManager = std::make_unique<
@@ -103,7 +122,17 @@ namespace VoidArchitect::Platform
 
     bool VulkanRHI::EndFrame(const float deltaTime)
     {
-        return g_VkExecutionContext->EndFrame(deltaTime);
+        // Uploads recorded with the frame must reach the queue before it
+        g_VkStagingRing->Flush();
+        const auto result = g_VkExecutionContext->EndFrame(deltaTime);
+        g_VkGeometryPool->EndFrame();
+        g_VkStagingRing->EndFrame();
+        return result;
+    }
+
+    GPUUploadStats VulkanRHI::GetLastFrameUploadStats() const
+    {
+        return g_VkStagingRing->GetLastFrameStats();
     }
 
     void VulkanRHI::BeginRenderPass(
@@ -205,9 +234,10 @@ namespace VoidArchitect::Platform
     Resources::IMesh* VulkanRHI::CreateMesh(
         const std::string& name,
         const std::shared_ptr<Resources::MeshData>& data,
-        const VAArray<Resources::SubMeshDescriptor>& submeshes)
+        const VAArray<Resources::SubMeshDescriptor>& submeshes,
+        const Renderer::VertexFormat vertexFormat)
     {
-        return g_VkResourceFactory->CreateMesh(name, data, submeshes);
+        return g_VkResourceFactory->CreateMesh(name, data, submeshes, vertexFormat);
     }
 
     Resources::RenderTargetHandle VulkanRHI::CreateRenderTarget(
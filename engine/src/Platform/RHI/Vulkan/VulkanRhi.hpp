@@ -32,6 +32,7 @@ namespace VoidArchitect::Platform
 
         bool BeginFrame(float deltaTime) override;
         bool EndFrame(float deltaTime) override;
+        [[nodiscard]] GPUUploadStats GetLastFrameUploadStats() const override;
 
         void BeginRenderPass(
             RenderPassHandle passHandle,
@@ -78,7 +79,8 @@ namespace VoidArchitect::Platform
         Resources::IMesh* CreateMesh(
             const std::string& name,
             const std::shared_ptr<Resources::MeshData>& data,
-            const VAArray<Resources::SubMeshDescriptor>& submeshes) override;
+            const VAArray<Resources::SubMeshDescriptor>& submeshes,
+            Renderer::VertexFormat vertexFormat) override;
 
         Resources::RenderTargetHandle CreateRenderTarget(
             const Renderer::RenderTargetConfig& config) override;
@@ -99,6 +101,8 @@ namespace VoidArchitect::Platform
         void CreateDevice();
         void CreateExecutionContext(uint32_t width, uint32_t height);
         void CreateResourceFactory();
+        void CreateStagingRing();
+        void CreateGeometryPool();
         void CreateBindingGroupsManager();
 
         std::unique_ptr<Window>& m_Window;
@@ -0,0 +1,243 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "VulkanStagingRing.hpp"
+
+#include "Core/Logger.hpp"
+#include "VulkanDevice.hpp"
+#include "VulkanFence.hpp"
+#include "VulkanUtils.hpp"
+
+namespace VoidArchitect::Platform
+{
+    namespace
+    {
+        /// @brief Staged copies start on this boundary, enough for any vertex or index type
+        constexpr uint64_t STAGING_ALIGNMENT = 16;
+
+        /// @brief Stages reading or writing vertex and index buffers
+        constexpr VkPipelineStageFlags VERTEX_STAGES = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+        constexpr VkAccessFlags VERTEX_ACCESS =
+            VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+
+        void RecordBarrier(
+            const VkCommandBuffer commandBuffer,
+            const VkPipelineStageFlags sourceStages,
+            const VkAccessFlags sourceAccess,
+            const VkPipelineStageFlags destStages,
+            const VkAccessFlags destAccess)
+        {
+            auto barrier = VkMemoryBarrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.srcAccessMask = sourceAccess;
+            barrier.dstAccessMask = destAccess;
+            vkCmdPipelineBarrier(
+                commandBuffer,
+                sourceStages,
+                destStages,
+                0,
+                1,
+                &barrier,
+                0,
+                nullptr,
+                0,
+                nullptr);
+        }
+    } // namespace
+
+    VulkanStagingRing::VulkanStagingRing(
+        const std::unique_ptr<VulkanDevice>& device,
+        VkAllocationCallbacks* allocator,
+        const uint64_t capacity)
+        : m_Device(device),
+          m_Allocator(allocator),
+          m_Capacity(capacity)
+    {
+        m_Buffer = std::make_unique<VulkanBuffer>(
+            device,
+            allocator,
+            m_Capacity,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        // Coherent memory stays mapped for the lifetime of the ring
+        m_Mapped = static_cast<uint8_t*>(m_Buffer->LockMemory(0, m_Capacity, 0));
+
+        VA_ENGINE_TRACE("[VulkanStagingRing] Created with {} KiB.", m_Capacity / 1024);
+    }
+
+    VulkanStagingRing::~VulkanStagingRing()
+    {
+        Flush();
+        while (!m_InFlight.empty()) Reclaim(true);
+
+        m_Buffer->UnlockMemory();
+    }
+
+    void* VulkanStagingRing::Stage(
+        const VkBuffer dest,
+        const uint64_t destOffset,
+        const uint64_t size)
+    {
+        VA_ENGINE_ASSERT(size <= GetMaxStageSize(), "Staged upload is larger than the ring.");
+
+        const auto offset = Allocate(size);
+        auto& batch = GetPendingBatch();
+
+        VkBufferCopy region{};
+        region.srcOffset = offset;
+        region.dstOffset = destOffset;
+        region.size = size;
+        vkCmdCopyBuffer(batch.commandBuffer.GetHandle(), m_Buffer->GetHandle(), dest, 1, &region);
+
+        m_FrameStats.bytes += size;
+        m_FrameStats.copies++;
+        return m_Mapped + offset;
+    }
+
+    void VulkanStagingRing::CopyBuffer(
+        const VkBuffer source,
+        const uint64_t sourceOffset,
+        const VkBuffer dest,
+        const uint64_t destOffset,
+        const uint64_t size)
+    {
+        const auto commandBuffer = GetPendingBatch().commandBuffer.GetHandle();
+
+        // The source may have been written by the uploads recorded so far
+        RecordBarrier(
+            commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+
+        VkBufferCopy region{};
+        region.srcOffset = sourceOffset;
+        region.dstOffset = destOffset;
+        region.size = size;
+        vkCmdCopyBuffer(commandBuffer, source, dest, 1, &region);
+
+        // Copies recorded afterwards may read or overwrite part of this one
+        RecordBarrier(
+            commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+    }
+
+    void VulkanStagingRing::Retire(std::unique_ptr<VulkanBuffer> buffer)
+    {
+        GetPendingBatch().retired.push_back(std::move(buffer));
+    }
+
+    void VulkanStagingRing::Flush()
+    {
+        if (!m_Pending.has_value()) return;
+
+        auto& batch = m_Pending.value();
+        RecordBarrier(
+            batch.commandBuffer.GetHandle(),
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VERTEX_STAGES,
+            VERTEX_ACCESS);
+        batch.commandBuffer.End();
+
+        const auto handle = batch.commandBuffer.GetHandle();
+        auto submitInfo = VkSubmitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &handle;
+        VA_VULKAN_CHECK_RESULT_WARN(
+            vkQueueSubmit(
+                m_Device->GetGraphicsQueueHandle(),
+                1,
+                &submitInfo,
+                batch.fence->GetHandle()));
+        batch.commandBuffer.SetState(CommandBufferState::Submitted);
+
+        m_InFlight.push_back(std::move(batch));
+        m_Pending.reset();
+        m_FrameStats.submissions++;
+    }
+
+    void VulkanStagingRing::EndFrame()
+    {
+        m_LastFrameStats = m_FrameStats;
+        m_FrameStats = {};
+
+        // Release what the GPU is done with without blocking the frame
+        Reclaim(false);
+    }
+
+    uint64_t VulkanStagingRing::Allocate(const uint64_t size)
+    {
+        const auto alignedSize = (size + STAGING_ALIGNMENT - 1) & ~(STAGING_ALIGNMENT - 1);
+        while (true)
+        {
+            // An empty ring starts over, no space is lost at its end
+            if (m_Used == 0) m_Head = 0;
+
+            // Allocations never wrap, the end of the ring is skipped instead
+            const auto skipped = m_Head + alignedSize > m_Capacity ? m_Capacity - m_Head : 0;
+            if (m_Used + skipped + alignedSize <= m_Capacity)
+            {
+                const auto offset = skipped > 0 ? 0 : m_Head;
+                m_Head = offset + alignedSize;
+                m_Used += skipped + alignedSize;
+                GetPendingBatch().ringBytes += skipped + alignedSize;
+                return offset;
+            }
+
+            // Submit what is staged so far and wait for the GPU to release older batches
+            Flush();
+            Reclaim(true);
+        }
+    }
+
+    VulkanStagingRing::Batch& VulkanStagingRing::GetPendingBatch()
+    {
+        if (m_Pending.has_value()) return m_Pending.value();
+
+        auto& batch = m_Pending.emplace();
+        VulkanCommandBuffer::SingleUseBegin(
+            m_Device,
+            m_Device->GetGraphicsCommandPool(),
+            batch.commandBuffer);
+        batch.fence = std::make_unique<VulkanFence>(m_Device, m_Allocator);
+
+        // Copies must not overwrite what the frames submitted earlier are still reading, nor
+        // race with the copies of the previous batch
+        RecordBarrier(
+            batch.commandBuffer.GetHandle(),
+            VERTEX_STAGES | VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_ACCESS_TRANSFER_WRITE_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_ACCESS_TRANSFER_WRITE_BIT);
+        return batch;
+    }
+
+    void VulkanStagingRing::Reclaim(const bool wait)
+    {
+        while (!m_InFlight.empty())
+        {
+            auto& batch = m_InFlight.front();
+            const auto status = vkGetFenceStatus(
+                m_Device->GetLogicalDeviceHandle(),
+                batch.fence->GetHandle());
+            if (status != VK_SUCCESS)
+            {
+                if (!wait) return;
+                batch.fence->Wait();
+            }
+
+            m_Used -= batch.ringBytes;
+            m_InFlight.pop_front();
+
+            // Waiting callers only need the oldest batch
+            if (wait) return;
+        }
+    }
+} // namespace VoidArchitect::Platform
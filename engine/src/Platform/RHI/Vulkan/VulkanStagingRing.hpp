@@ -0,0 +1,123 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include <deque>
+#include <optional>
+
+#include "Platform/RHI/IRenderingHardware.hpp"
+#include "VulkanBuffer.hpp"
+#include "VulkanCommandBuffer.hpp"
+
+namespace VoidArchitect::Platform
+{
+    class VulkanFence;
+
+    /// @brief Persistent host-visible staging memory shared by every buffer upload
+    ///
+    /// Uploads are written straight into a persistently mapped ring buffer and recorded as
+    /// copies into a batch command buffer. A batch is submitted by Flush(), once per frame
+    /// before the frame command buffer, with a fence instead of waiting for the queue to go
+    /// idle. The ring space of a batch is reclaimed once its fence is signaled.
+    ///
+    /// Every batch starts with a barrier behind the vertex input of the work submitted
+    /// before it, so a copy never overwrites data a previous frame is still reading, and
+    /// ends with a barrier making its writes visible to the vertex input of the work
+    /// submitted after it.
+    ///
+    /// When the ring is full, the pending batch is submitted and the oldest batches are
+    /// waited on until enough space is released.
+    ///
+    /// Usage example:
+    /// @code
+    /// auto* staging = g_VkStagingRing->Stage(buffer->GetHandle(), offset, size);
+    /// std::memcpy(staging, data, size);
+    /// // ...
+    /// g_VkStagingRing->Flush(); // Before submitting the frame
+    /// @endcode
+    ///
+    /// @note Not thread-safe, uploads happen on the main thread with the frame recording.
+    class VulkanStagingRing
+    {
+    public:
+        /// @brief Default size of the ring
+        static constexpr uint64_t DEFAULT_CAPACITY = 16ull * 1024 * 1024;
+
+        VulkanStagingRing(
+            const std::unique_ptr<VulkanDevice>& device,
+            VkAllocationCallbacks* allocator,
+            uint64_t capacity = DEFAULT_CAPACITY);
+        ~VulkanStagingRing();
+
+        VulkanStagingRing(const VulkanStagingRing&) = delete;
+        VulkanStagingRing& operator=(const VulkanStagingRing&) = delete;
+
+        /// @brief Reserve staging memory for a copy into a buffer
+        /// @param dest Buffer receiving the data when the batch executes
+        /// @param destOffset Byte offset in dest
+        /// @param size Byte size of the copy, at most GetMaxStageSize()
+        /// @return Mapped memory to fill before the next Flush()
+        void* Stage(VkBuffer dest, uint64_t destOffset, uint64_t size);
+
+        /// @brief Record a device-side copy between two buffers, or two disjoint ranges of one
+        /// @note Ordered after the copies recorded before it and before the ones recorded after.
+        void CopyBuffer(
+            VkBuffer source,
+            uint64_t sourceOffset,
+            VkBuffer dest,
+            uint64_t destOffset,
+            uint64_t size);
+
+        /// @brief Keep a replaced buffer alive until the pending copies and the frames
+        ///        submitted before them are done with it
+        void Retire(std::unique_ptr<VulkanBuffer> buffer);
+
+        /// @brief Submit the pending copies, if any
+        void Flush();
+
+        /// @brief Close the upload statistics of the frame
+        void EndFrame();
+
+        /// @brief Largest size Stage() accepts, larger uploads must be split
+        [[nodiscard]] uint64_t GetMaxStageSize() const { return m_Capacity / 4; }
+
+        /// @brief Uploads of the last completed frame
+        [[nodiscard]] const GPUUploadStats& GetLastFrameStats() const { return m_LastFrameStats; }
+
+    private:
+        struct Batch
+        {
+            VulkanCommandBuffer commandBuffer;
+            std::unique_ptr<VulkanFence> fence;
+            uint64_t ringBytes = 0;
+            VAArray<std::unique_ptr<VulkanBuffer>> retired;
+        };
+
+        /// @brief Make room for an allocation, flushing and waiting as needed
+        /// @return Offset of the allocation in the ring
+        uint64_t Allocate(uint64_t size);
+
+        /// @brief Open the pending batch if it is not already
+        Batch& GetPendingBatch();
+
+        /// @brief Release the submitted batches that completed, or wait for the oldest one
+        void Reclaim(bool wait);
+
+        const std::unique_ptr<VulkanDevice>& m_Device;
+        VkAllocationCallbacks* m_Allocator;
+
+        std::unique_ptr<VulkanBuffer> m_Buffer;
+        uint8_t* m_Mapped = nullptr;
+        uint64_t m_Capacity;
+        uint64_t m_Head = 0;
+        uint64_t m_Used = 0;
+
+        std::optional<Batch> m_Pending;
+        std::deque<Batch> m_InFlight;
+
+        GPUUploadStats m_FrameStats;
+        GPUUploadStats m_LastFrameStats;
+    };
+
+    inline std::unique_ptr<VulkanStagingRing> g_VkStagingRing;
+} // namespace VoidArchitect::Platform
@@ -7,6 +7,7 @@
 #include "VulkanCommandBuffer.hpp"
 #include "VulkanDevice.hpp"
 #include "VulkanUtils.hpp"
+#include "Core/Memory/MemoryTracker.hpp"
 
 namespace VoidArchitect::Platform
 {
@@ -31,6 +32,7 @@ namespace VoidArchitect::Platform
 
         // Create the staging buffer and image.
         auto staging = VulkanStagingBuffer(device, m_Allocator, data);
+        const Memory::TrackedMemory<Memory::MemoryTag::Texture> trackedStaging(data.size());
         m_Image = VulkanImage(
             device,
             m_Allocator,
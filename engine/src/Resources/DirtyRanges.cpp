@@ -0,0 +1,78 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "DirtyRanges.hpp"
+
+#include <limits>
+
+namespace VoidArchitect::Resources
+{
+    void DirtyRangeSet::Add(const uint32_t offset, const uint32_t count)
+    {
+        if (count == 0) return;
+
+        // First range ending at or after the new one, every range before it stays untouched
+        auto first = std::ranges::lower_bound(
+            m_Ranges,
+            offset,
+            {},
+            [](const DirtyRange& range) { return range.GetEnd(); });
+
+        // Absorb every range touching [offset, offset + count)
+        DirtyRange merged{offset, count};
+        auto last = first;
+        while (last != m_Ranges.end() && last->offset <= merged.GetEnd())
+        {
+            const auto end = std::max(merged.GetEnd(), last->GetEnd());
+            merged.offset = std::min(merged.offset, last->offset);
+            merged.count = end - merged.offset;
+            ++last;
+        }
+
+        if (first == last)
+        {
+            m_Ranges.insert(first, merged);
+        }
+        else
+        {
+            *first = merged;
+            m_Ranges.erase(first + 1, last);
+        }
+
+        if (m_Ranges.size() > MAX_RANGES) MergeClosest();
+    }
+
+    void DirtyRangeSet::Truncate(const uint32_t size)
+    {
+        while (!m_Ranges.empty() && m_Ranges.back().offset >= size) m_Ranges.pop_back();
+        if (!m_Ranges.empty() && m_Ranges.back().GetEnd() > size)
+        {
+            m_Ranges.back().count = size - m_Ranges.back().offset;
+        }
+    }
+
+    uint64_t DirtyRangeSet::GetTotalCount() const
+    {
+        uint64_t total = 0;
+        for (const auto& range : m_Ranges) total += range.count;
+        return total;
+    }
+
+    void DirtyRangeSet::MergeClosest()
+    {
+        size_t closest = 0;
+        auto smallestGap = std::numeric_limits<uint32_t>::max();
+        for (size_t i = 0; i + 1 < m_Ranges.size(); ++i)
+        {
+            const auto gap = m_Ranges[i + 1].offset - m_Ranges[i].GetEnd();
+            if (gap < smallestGap)
+            {
+                smallestGap = gap;
+                closest = i;
+            }
+        }
+
+        m_Ranges[closest].count = m_Ranges[closest + 1].GetEnd() - m_Ranges[closest].offset;
+        m_Ranges.erase(m_Ranges.begin() + static_cast<std::ptrdiff_t>(closest) + 1);
+    }
+} // namespace VoidArchitect::Resources
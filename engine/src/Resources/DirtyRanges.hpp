@@ -0,0 +1,66 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Half-open range [offset, offset + count) of array elements
+    struct DirtyRange
+    {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+
+        [[nodiscard]] uint32_t GetEnd() const { return offset + count; }
+    };
+
+    /// @brief Sorted set of disjoint element ranges modified since the last upload
+    ///
+    /// Ranges are counted in elements rather than in bytes: the GPU copy of an array does not
+    /// necessarily use the CPU stride (compact vertices, 16-bit indices), the backend converts
+    /// them with its own element size.
+    ///
+    /// Overlapping and adjacent ranges are merged as they are added. Past MAX_RANGES, the two
+    /// ranges separated by the smallest gap are merged as well: a few slightly larger copies
+    /// are cheaper than a long list of tiny ones.
+    ///
+    /// Usage example:
+    /// @code
+    /// DirtyRangeSet dirty;
+    /// dirty.Add(10, 4);
+    /// dirty.Add(14, 2); // Merged into [10, 16)
+    /// for (const auto& range : dirty.GetRanges()) Upload(range.offset, range.count);
+    /// dirty.Clear();
+    /// @endcode
+    class DirtyRangeSet
+    {
+    public:
+        /// @brief Ranges kept before the closest ones are merged
+        static constexpr size_t MAX_RANGES = 32;
+
+        /// @brief Mark elements as modified
+        /// @param offset First modified element
+        /// @param count Number of modified elements, nothing happens if 0
+        void Add(uint32_t offset, uint32_t count);
+
+        /// @brief Drop every range that reaches past the end of a shrunk array
+        /// @param size New element count of the array
+        void Truncate(uint32_t size);
+
+        void Clear() { m_Ranges.clear(); }
+
+        /// @brief Ranges sorted by offset, neither overlapping nor adjacent
+        [[nodiscard]] const VAArray<DirtyRange>& GetRanges() const { return m_Ranges; }
+
+        /// @brief Number of elements covered by the ranges
+        [[nodiscard]] uint64_t GetTotalCount() const;
+
+        [[nodiscard]] bool IsEmpty() const { return m_Ranges.empty(); }
+
+    private:
+        /// @brief Merge the two neighbours separated by the smallest gap
+        void MergeClosest();
+
+        VAArray<DirtyRange> m_Ranges;
+    };
+} // namespace VoidArchitect::Resources
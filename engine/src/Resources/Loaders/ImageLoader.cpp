@@ -7,6 +7,9 @@
 #include <stb_image.h>
 
 #include "Core/Logger.hpp"
+#include "Core/Memory/PoolAllocator.hpp"
+#include "Platform/FileSystem/AsyncFileIO.hpp"
+#include "Platform/FileSystem/VirtualFileSystem.hpp"
 
 namespace VoidArchitect::Resources::Loaders
 {
@@ -21,7 +24,8 @@ namespace VoidArchitect::Resources::Loaders
           m_Width(width),
           m_Height(height),
           m_BPP(bpp),
-          m_HasTransparency(hasTransparency)
+          m_HasTransparency(hasTransparency),
+          m_TrackedMemory(m_Data.size())
     {
     }
 
@@ -34,26 +38,40 @@ namespace VoidArchitect::Resources::Loaders
     std::shared_ptr<IResourceDefinition> ImageLoader::Load(const std::string& name)
     {
         static const std::string extensions[] = {".png", ".tga"};
+        std::shared_ptr<Platform::MappedFile> file;
         std::stringstream ss;
         for (const auto& extension : extensions)
         {
             ss.str("");
             ss << m_BaseAssetPath << name << extension;
             VA_ENGINE_TRACE("Trygin to load image at path: {}", ss.str());
-            if (std::filesystem::exists(ss.str()))
+            if (Platform::VirtualFileSystem::Exists(ss.str()))
             {
+                // The image may be an entry of an asset pack, it is decoded from memory. Loose
+                // files are read without blocking the worker while the AsyncFileIO runs.
+                file = Platform::g_AsyncFileIO
+                    ? Platform::g_AsyncFileIO->Read(ss.str())
+                    : Platform::VirtualFileSystem::Open(ss.str());
                 break;
             }
         }
 
         int32_t width, height, channels;
-        const auto rawData = stbi_load(ss.str().c_str(), &width, &height, &channels, 4);
+        const auto rawData = file
+            ? stbi_load_from_memory(
+                file->GetBytes().data(),
+                static_cast<int>(file->GetSize()),
+                &width,
+                &height,
+                &channels,
+                4)
+            : nullptr;
         if (rawData == nullptr)
         {
             VA_ENGINE_WARN(
                 "[RenderCommand] Failed to load texture '{}', with error {}.",
                 name,
-                stbi_failure_reason());
+                file ? stbi_failure_reason() : "file not found");
             return {};
         }
         auto data = VAArray<uint8_t>(width * height * 4);
@@ -71,12 +89,19 @@ namespace VoidArchitect::Resources::Loaders
             }
         }
 
-        auto imageDefinition = new ImageDataDefinition(
+        // NOTE The constructor is private, so we can't go through Memory::PoolNew here.
+        auto* memory = Memory::GetPoolAllocator().Allocate(
+            sizeof(ImageDataDefinition),
+            alignof(ImageDataDefinition),
+            Memory::MemoryTag::Loader);
+        auto* imageDefinition = new(memory) ImageDataDefinition(
             std::move(data),
             width,
             height,
             4,
             hasTransparency);
-        return ImageDataDefinitionPtr(imageDefinition);
+        return ImageDataDefinitionPtr(
+            imageDefinition,
+            Memory::PoolDeleter<ImageDataDefinition>());
     }
 } // namespace VoidArchitect::Resources::Loaders
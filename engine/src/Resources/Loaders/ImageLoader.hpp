@@ -2,6 +2,7 @@
 // Created by Michael Desmedt on 01/06/2025.
 //
 #pragma once
+#include "Core/Memory/MemoryTracker.hpp"
 #include "Loader.hpp"
 #include "ResourceDefinition.hpp"
 
@@ -33,6 +34,7 @@ namespace VoidArchitect::Resources::Loaders
         VAArray<uint8_t> m_Data;
         int m_Width, m_Height, m_BPP;
         bool m_HasTransparency;
+        VA_NO_UNIQUE_ADDRESS Memory::TrackedMemory<Memory::MemoryTag::Loader> m_TrackedMemory;
     };
 
     using ImageDataDefinitionPtr = std::shared_ptr<ImageDataDefinition>;
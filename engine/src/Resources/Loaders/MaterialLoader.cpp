@@ -4,6 +4,7 @@
 #include "MaterialLoader.hpp"
 
 #include "Core/Logger.hpp"
+#include "Platform/FileSystem/VirtualFileSystem.hpp"
 
 #include <yaml-cpp/yaml.h>
 
@@ -28,8 +29,9 @@ namespace VoidArchitect::Resources::Loaders
         // parse it, and then create the material using the CreateMaterial method.
         const std::string materialPath = m_BaseAssetPath + name + ".yaml";
 
-        // Check that the YAML file exists
-        if (!std::filesystem::exists(materialPath))
+        // Check that the YAML file exists, in an asset pack or on the disk
+        const auto materialText = Platform::VirtualFileSystem::ReadText(materialPath);
+        if (!materialText)
         {
             VA_ENGINE_WARN("[MaterialSystem] Material file '{}' does not exist.", materialPath);
             return nullptr;
@@ -37,7 +39,7 @@ namespace VoidArchitect::Resources::Loaders
 
         try
         {
-            auto configFile = YAML::LoadFile(materialPath);
+            auto configFile = YAML::Load(*materialText);
             MaterialTemplate config;
 
             if (configFile["material"])
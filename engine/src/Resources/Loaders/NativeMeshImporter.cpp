@@ -0,0 +1,1880 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "NativeMeshImporter.hpp"
+
+#include "Core/Collections/HashMap.hpp"
+#include "Core/Hash.hpp"
+#include "Core/Logger.hpp"
+#include "Core/Math/Mat4.hpp"
+#include "Core/Math/Quat.hpp"
+#include "Platform/FileSystem/MappedFile.hpp"
+#include "Resources/MeshNormals.hpp"
+#include "Systems/Jobs/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <optional>
+
+namespace VoidArchitect::Resources::Loaders
+{
+    namespace
+    {
+        constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+        /// @brief Deepest node hierarchy walked, deeper ones are taken for a cycle
+        constexpr uint32_t MAX_NODE_DEPTH = 256;
+
+        // =========================================================================================
+        // JSON
+        // =========================================================================================
+
+        /// @brief Read-only JSON tree, every value is a node of a single array
+        ///
+        /// Strings are views of the parsed text, which must outlive the document. The children
+        /// of an array or an object are contiguous in m_Children, keys and values interleaved
+        /// for objects, so lookups never allocate.
+        class JsonDocument
+        {
+        public:
+            enum class Type : uint8_t
+            {
+                Null,
+                Bool,
+                Number,
+                String,
+                Array,
+                Object
+            };
+
+            struct Node
+            {
+                Type type = Type::Null;
+                bool flag = false; ///< Value of a Bool, whether a String has escape sequences
+                uint32_t first = 0; ///< First child in m_Children
+                uint32_t count = 0; ///< Elements of an Array, members of an Object
+                double number = 0.0;
+                std::string_view text; ///< Characters of a String, without the quotes
+            };
+
+            bool Parse(const std::string_view text)
+            {
+                m_Text = text;
+                m_Position = 0;
+                m_Nodes.clear();
+                m_Children.clear();
+                m_Scratch.clear();
+                if (ParseValue(0) == INVALID_INDEX) return false;
+
+                SkipSpaces();
+                return m_Position == m_Text.size();
+            }
+
+            [[nodiscard]] const Node& GetNode(const uint32_t node) const { return m_Nodes[node]; }
+            [[nodiscard]] uint32_t GetChild(const uint32_t i) const { return m_Children[i]; }
+
+        private:
+            static constexpr uint32_t MAX_DEPTH = 128;
+
+            char Peek() const { return m_Position < m_Text.size() ? m_Text[m_Position] : '\0'; }
+
+            void SkipSpaces()
+            {
+                while (m_Position < m_Text.size())
+                {
+                    const char c = m_Text[m_Position];
+                    if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
+                    ++m_Position;
+                }
+            }
+
+            uint32_t ParseValue(const uint32_t depth)
+            {
+                SkipSpaces();
+                if (m_Position >= m_Text.size() || depth > MAX_DEPTH) return INVALID_INDEX;
+
+                const auto index = static_cast<uint32_t>(m_Nodes.size());
+                m_Nodes.emplace_back();
+                switch (m_Text[m_Position])
+                {
+                    case '{':
+                        return ParseContainer(index, depth, true);
+                    case '[':
+                        return ParseContainer(index, depth, false);
+                    case '"':
+                    {
+                        std::string_view text;
+                        bool escaped = false;
+                        if (!ParseString(text, escaped)) return INVALID_INDEX;
+                        m_Nodes[index].type = Type::String;
+                        m_Nodes[index].text = text;
+                        m_Nodes[index].flag = escaped;
+                        return index;
+                    }
+                    case 't':
+                        m_Nodes[index].type = Type::Bool;
+                        m_Nodes[index].flag = true;
+                        return ParseLiteral("true") ? index : INVALID_INDEX;
+                    case 'f':
+                        m_Nodes[index].type = Type::Bool;
+                        return ParseLiteral("false") ? index : INVALID_INDEX;
+                    case 'n':
+                        return ParseLiteral("null") ? index : INVALID_INDEX;
+                    default:
+                        return ParseNumber(index) ? index : INVALID_INDEX;
+                }
+            }
+
+            uint32_t ParseContainer(const uint32_t index, const uint32_t depth, const bool object)
+            {
+                const char close = object ? '}' : ']';
+                const auto scratchStart = m_Scratch.size();
+                ++m_Position;
+                SkipSpaces();
+                if (Peek() == close)
+                {
+                    ++m_Position;
+                }
+                else
+                {
+                    while (true)
+                    {
+                        if (object)
+                        {
+                            SkipSpaces();
+                            if (Peek() != '"') return INVALID_INDEX;
+                            const auto key = ParseValue(depth + 1);
+                            if (key == INVALID_INDEX) return INVALID_INDEX;
+                            m_Scratch.push_back(key);
+
+                            SkipSpaces();
+                            if (Peek() != ':') return INVALID_INDEX;
+                            ++m_Position;
+                        }
+
+                        const auto value = ParseValue(depth + 1);
+                        if (value == INVALID_INDEX) return INVALID_INDEX;
+                        m_Scratch.push_back(value);
+
+                        SkipSpaces();
+                        const char next = Peek();
+                        ++m_Position;
+                        if (next == close) break;
+                        if (next != ',') return INVALID_INDEX;
+                    }
+                }
+
+                // Children were parsed depth first, they become contiguous once complete
+                auto& node = m_Nodes[index];
+                node.type = object ? Type::Object : Type::Array;
+                node.first = static_cast<uint32_t>(m_Children.size());
+                node.count = static_cast<uint32_t>(m_Scratch.size() - scratchStart) /
+                    (object ? 2 : 1);
+                m_Children.insert(
+                    m_Children.end(),
+                    m_Scratch.begin() + static_cast<ptrdiff_t>(scratchStart),
+                    m_Scratch.end());
+                m_Scratch.resize(scratchStart);
+                return index;
+            }
+
+            bool ParseString(std::string_view& outText, bool& outEscaped)
+            {
+                const auto start = ++m_Position;
+                while (m_Position < m_Text.size())
+                {
+                    const char c = m_Text[m_Position];
+                    if (c == '"')
+                    {
+                        outText = m_Text.substr(start, m_Position - start);
+                        ++m_Position;
+                        return true;
+                    }
+                    if (c == '\\')
+                    {
+                        outEscaped = true;
+                        m_Position += 2;
+                    }
+                    else if (static_cast<uint8_t>(c) < 0x20)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        ++m_Position;
+                    }
+                }
+                return false;
+            }
+
+            bool ParseLiteral(const std::string_view literal)
+            {
+                if (m_Text.substr(m_Position, literal.size()) != literal) return false;
+                m_Position += literal.size();
+                return true;
+            }
+
+            bool ParseNumber(const uint32_t index)
+            {
+                const auto start = m_Position;
+                while (m_Position < m_Text.size())
+                {
+                    const char c = m_Text[m_Position];
+                    if ((c < '0' || c > '9') && c != '-' && c != '+' && c != '.' && c != 'e' &&
+                        c != 'E')
+                    {
+                        break;
+                    }
+                    ++m_Position;
+                }
+
+                const char* first = m_Text.data() + start;
+                const char* last = m_Text.data() + m_Position;
+                auto& node = m_Nodes[index];
+                const auto [end, error] = std::from_chars(first, last, node.number);
+                node.type = Type::Number;
+                return first != last && error == std::errc() && end == last;
+            }
+
+            std::string_view m_Text;
+            size_t m_Position = 0;
+            VAArray<Node> m_Nodes;
+            VAArray<uint32_t> m_Children;
+            VAArray<uint32_t> m_Scratch; ///< Children of the containers being parsed
+        };
+
+        /// @brief Handle on a value of a JsonDocument, invalid when a lookup fails so that
+        ///        lookups can be chained, e.g. root["meshes"][0]["primitives"]
+        class JsonValue
+        {
+        public:
+            JsonValue() = default;
+
+            JsonValue(const JsonDocument* document, const uint32_t node)
+                : m_Document(document),
+                  m_Node(node)
+            {
+            }
+
+            [[nodiscard]] bool IsValid() const { return m_Document != nullptr; }
+            [[nodiscard]] bool IsNumber() const { return Is(JsonDocument::Type::Number); }
+            [[nodiscard]] bool IsString() const { return Is(JsonDocument::Type::String); }
+            [[nodiscard]] bool IsArray() const { return Is(JsonDocument::Type::Array); }
+            [[nodiscard]] bool IsObject() const { return Is(JsonDocument::Type::Object); }
+
+            /// @brief Elements of an array or members of an object, 0 for other values
+            [[nodiscard]] uint32_t Size() const
+            {
+                return IsArray() || IsObject() ? GetNode().count : 0;
+            }
+
+            JsonValue operator[](const size_t index) const
+            {
+                if (!IsArray() || index >= GetNode().count) return {};
+                return {m_Document, m_Document->GetChild(GetNode().first + index)};
+            }
+
+            /// @brief Member of an object, keys are compared as written in the file
+            JsonValue operator[](const std::string_view key) const
+            {
+                if (!IsObject()) return {};
+
+                const auto& node = GetNode();
+                for (uint32_t i = 0; i < node.count; ++i)
+                {
+                    const auto keyNode = m_Document->GetChild(node.first + 2 * i);
+                    if (m_Document->GetNode(keyNode).text == key)
+                    {
+                        return {m_Document, m_Document->GetChild(node.first + 2 * i + 1)};
+                    }
+                }
+                return {};
+            }
+
+            [[nodiscard]] double AsNumber(const double fallback = 0.0) const
+            {
+                return IsNumber() ? GetNode().number : fallback;
+            }
+
+            /// @brief Value as an integer, fallback if it is not an integer T can hold
+            template <typename T>
+            [[nodiscard]] T AsInteger(const T fallback) const
+            {
+                if (!IsNumber()) return fallback;
+
+                const auto number = GetNode().number;
+                if (number < static_cast<double>(std::numeric_limits<T>::min()) ||
+                    number > static_cast<double>(std::numeric_limits<T>::max()) ||
+                    number != std::floor(number))
+                {
+                    return fallback;
+                }
+                return static_cast<T>(number);
+            }
+
+            [[nodiscard]] bool AsBool(const bool fallback) const
+            {
+                return Is(JsonDocument::Type::Bool) ? GetNode().flag : fallback;
+            }
+
+            /// @brief Characters of a string with its escape sequences decoded, empty for
+            ///        other values
+            [[nodiscard]] std::string AsString() const
+            {
+                if (!IsString()) return {};
+
+                const auto& node = GetNode();
+                if (!node.flag) return std::string(node.text);
+
+                std::string result;
+                result.reserve(node.text.size());
+                const auto text = node.text;
+                for (size_t i = 0; i < text.size(); ++i)
+                {
+                    if (text[i] != '\\' || i + 1 >= text.size())
+                    {
+                        result += text[i];
+                        continue;
+                    }
+
+                    switch (const char escape = text[++i])
+                    {
+                        case 'b':
+                            result += '\b';
+                            break;
+                        case 'f':
+                            result += '\f';
+                            break;
+                        case 'n':
+                            result += '\n';
+                            break;
+                        case 'r':
+                            result += '\r';
+                            break;
+                        case 't':
+                            result += '\t';
+                            break;
+                        case 'u':
+                        {
+                            uint32_t codePoint = 0;
+                            if (!ReadHex(text, i + 1, codePoint)) return result;
+                            i += 4;
+
+                            // A high surrogate followed by a low one is a single code point
+                            uint32_t low = 0;
+                            if (codePoint >= 0xD800 && codePoint < 0xDC00 &&
+                                text.substr(i + 1, 2) == "\\u" && ReadHex(text, i + 3, low) &&
+                                low >= 0xDC00 && low < 0xE000)
+                            {
+                                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) +
+                                    (low - 0xDC00);
+                                i += 6;
+                            }
+                            AppendUtf8(codePoint, result);
+                            break;
+                        }
+                        default:
+                            result += escape;
+                            break;
+                    }
+                }
+                return result;
+            }
+
+        private:
+            [[nodiscard]] const JsonDocument::Node& GetNode() const
+            {
+                return m_Document->GetNode(m_Node);
+            }
+
+            [[nodiscard]] bool Is(const JsonDocument::Type type) const
+            {
+                return IsValid() && GetNode().type == type;
+            }
+
+            static bool ReadHex(const std::string_view text, const size_t start, uint32_t& out)
+            {
+                if (start + 4 > text.size()) return false;
+
+                const auto* first = text.data() + start;
+                const auto [end, error] = std::from_chars(first, first + 4, out, 16);
+                return error == std::errc() && end == first + 4;
+            }
+
+            static void AppendUtf8(const uint32_t codePoint, std::string& out)
+            {
+                if (codePoint < 0x80)
+                {
+                    out += static_cast<char>(codePoint);
+                }
+                else if (codePoint < 0x800)
+                {
+                    out += static_cast<char>(0xC0 | (codePoint >> 6));
+                    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+                else if (codePoint < 0x10000)
+                {
+                    out += static_cast<char>(0xE0 | (codePoint >> 12));
+                    out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+                else
+                {
+                    out += static_cast<char>(0xF0 | (codePoint >> 18));
+                    out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                    out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            }
+
+            const JsonDocument* m_Document = nullptr;
+            uint32_t m_Node = 0;
+        };
+
+        // =========================================================================================
+        // Shared helpers
+        // =========================================================================================
+
+        /// @brief Geometry of a glTF primitive or an OBJ group, indices local to its vertices
+        struct DecodedGeometry
+        {
+            VAArray<MeshVertex> vertices;
+            VAArray<uint32_t> indices;
+        };
+
+        /// @brief Open addressing table of the unique vertices seen so far
+        ///
+        /// Slots keep 32 bits of the hash, enough to place them again when the table grows
+        /// and to skip most comparisons. The table is kept at most half full.
+        class WeldTable
+        {
+        public:
+            /// @param expectedEntries Unique entries expected, the table grows past them
+            explicit WeldTable(const size_t expectedEntries)
+            {
+                size_t capacity = 16;
+                while (capacity < expectedEntries * 2) capacity *= 2;
+                m_Slots.resize(capacity);
+            }
+
+            /// @brief Index of the entry equal to a new one, inserting it if there is none
+            /// @param hash Hash of the new entry
+            /// @param newIndex Index the new entry gets if it is unique
+            /// @param equal equal(index) tells whether an entry equals the new one
+            /// @return The index of the equal entry, newIndex if it was inserted
+            template <typename Equal>
+            uint32_t FindOrInsert(const uint64_t hash, const uint32_t newIndex, Equal&& equal)
+            {
+                const auto shortHash = static_cast<uint32_t>(hash ^ (hash >> 32));
+                const auto mask = m_Slots.size() - 1;
+                for (size_t slot = shortHash & mask;; slot = (slot + 1) & mask)
+                {
+                    auto& entry = m_Slots[slot];
+                    if (entry.index == INVALID_INDEX)
+                    {
+                        entry = {newIndex, shortHash};
+                        if (++m_Count * 2 > m_Slots.size()) Grow();
+                        return newIndex;
+                    }
+                    if (entry.hash == shortHash && equal(entry.index)) return entry.index;
+                }
+            }
+
+        private:
+            struct Slot
+            {
+                uint32_t index = INVALID_INDEX;
+                uint32_t hash = 0;
+            };
+
+            void Grow()
+            {
+                auto slots = std::move(m_Slots);
+                m_Slots.assign(slots.size() * 2, {});
+                const auto mask = m_Slots.size() - 1;
+                for (const auto& entry : slots)
+                {
+                    if (entry.index == INVALID_INDEX) continue;
+
+                    auto slot = entry.hash & mask;
+                    while (m_Slots[slot].index != INVALID_INDEX) slot = (slot + 1) & mask;
+                    m_Slots[slot] = entry;
+                }
+            }
+
+            VAArray<Slot> m_Slots;
+            size_t m_Count = 0;
+        };
+
+        /// @brief Texture name of an image path, its file stem like on the assimp path
+        std::string TextureName(std::string path)
+        {
+            std::ranges::replace(path, '\\', '/');
+            return std::filesystem::path(path).stem().string();
+        }
+
+        std::string ToLower(std::string text)
+        {
+            std::ranges::transform(
+                text,
+                text.begin(),
+                [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return text;
+        }
+
+        // =========================================================================================
+        // glTF 2.0
+        // =========================================================================================
+
+        constexpr uint32_t GLB_MAGIC = 0x46546C67; ///< "glTF"
+        constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A; ///< "JSON"
+        constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942; ///< "BIN\0"
+
+        constexpr uint32_t GLTF_BYTE = 5120;
+        constexpr uint32_t GLTF_UNSIGNED_BYTE = 5121;
+        constexpr uint32_t GLTF_SHORT = 5122;
+        constexpr uint32_t GLTF_UNSIGNED_SHORT = 5123;
+        constexpr uint32_t GLTF_UNSIGNED_INT = 5125;
+        constexpr uint32_t GLTF_FLOAT = 5126;
+
+        constexpr uint32_t GLTF_TRIANGLES = 4;
+        constexpr uint32_t GLTF_TRIANGLE_STRIP = 5;
+        constexpr uint32_t GLTF_TRIANGLE_FAN = 6;
+
+        /// @brief A parsed glTF file and the buffers it references
+        struct GltfFile
+        {
+            std::shared_ptr<Platform::MappedFile> file; ///< Holds the bytes of the JSON
+            JsonDocument json;
+            JsonValue root;
+            std::filesystem::path directory; ///< Where relative URIs are resolved
+            VAArray<std::shared_ptr<Platform::MappedFile>> buffers;
+        };
+
+        template <typename T>
+        T ReadUnaligned(const uint8_t* data)
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        bool DecodeBase64(const std::string_view text, VAArray<uint8_t>& out)
+        {
+            const auto decode = [](const char c) -> int32_t
+            {
+                if (c >= 'A' && c <= 'Z') return c - 'A';
+                if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+                if (c >= '0' && c <= '9') return c - '0' + 52;
+                if (c == '+') return 62;
+                if (c == '/') return 63;
+                return -1;
+            };
+
+            out.clear();
+            out.reserve(text.size() / 4 * 3);
+            uint32_t bits = 0;
+            uint32_t bitCount = 0;
+            for (const char c : text)
+            {
+                if (c == '=') break;
+
+                const auto value = decode(c);
+                if (value < 0) return false;
+
+                bits = (bits << 6) | static_cast<uint32_t>(value);
+                bitCount += 6;
+                if (bitCount >= 8)
+                {
+                    bitCount -= 8;
+                    out.push_back(static_cast<uint8_t>(bits >> bitCount));
+                }
+            }
+            return true;
+        }
+
+        /// @brief Decode the %XX sequences of a relative URI
+        std::string DecodeUri(const std::string_view uri)
+        {
+            std::string result;
+            result.reserve(uri.size());
+            for (size_t i = 0; i < uri.size(); ++i)
+            {
+                uint8_t byte = 0;
+                if (uri[i] == '%' && i + 2 < uri.size() &&
+                    std::from_chars(uri.data() + i + 1, uri.data() + i + 3, byte, 16).ptr ==
+                    uri.data() + i + 3)
+                {
+                    result += static_cast<char>(byte);
+                    i += 2;
+                }
+                else
+                {
+                    result += uri[i];
+                }
+            }
+            return result;
+        }
+
+        /// @brief Bytes of a buffer: a data URI, a file next to the glTF or the GLB chunk
+        std::shared_ptr<Platform::MappedFile> LoadGltfBuffer(
+            const GltfFile& gltf,
+            const JsonValue& buffer,
+            const std::span<const uint8_t> glbChunk,
+            const bool firstBuffer)
+        {
+            const auto uri = buffer["uri"].AsString();
+            if (uri.empty())
+            {
+                if (!firstBuffer || glbChunk.empty()) return nullptr;
+                return Platform::MappedFile::View(glbChunk, gltf.file);
+            }
+
+            if (uri.starts_with("data:"))
+            {
+                const auto comma = uri.find(',');
+                if (comma == std::string::npos ||
+                    std::string_view(uri).substr(0, comma).find(";base64") == std::string::npos)
+                {
+                    return nullptr;
+                }
+
+                VAArray<uint8_t> bytes;
+                if (!DecodeBase64(std::string_view(uri).substr(comma + 1), bytes)) return nullptr;
+                return Platform::MappedFile::FromBuffer(std::move(bytes));
+            }
+
+            return Platform::MappedFile::Open((gltf.directory / DecodeUri(uri)).string());
+        }
+
+        bool LoadGltf(const std::string& path, GltfFile& gltf)
+        {
+            gltf.file = Platform::MappedFile::Open(path);
+            if (!gltf.file) return false;
+
+            gltf.directory = std::filesystem::path(path).parent_path();
+            const auto bytes = gltf.file->GetBytes();
+            auto json = std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            std::span<const uint8_t> binChunk;
+
+            if (bytes.size() >= 12 && ReadUnaligned<uint32_t>(bytes.data()) == GLB_MAGIC)
+            {
+                if (ReadUnaligned<uint32_t>(bytes.data() + 4) != 2) return false;
+
+                // The JSON chunk comes first, the optional BIN chunk second
+                json = {};
+                for (size_t offset = 12; offset + 8 <= bytes.size();)
+                {
+                    const auto length = ReadUnaligned<uint32_t>(bytes.data() + offset);
+                    const auto type = ReadUnaligned<uint32_t>(bytes.data() + offset + 4);
+                    const auto data = offset + 8;
+                    if (length > bytes.size() - data) return false;
+
+                    if (type == GLB_CHUNK_JSON && json.empty())
+                    {
+                        json = std::string_view(
+                            reinterpret_cast<const char*>(bytes.data() + data),
+                            length);
+                    }
+                    else if (type == GLB_CHUNK_BIN && binChunk.empty())
+                    {
+                        binChunk = bytes.subspan(data, length);
+                    }
+                    offset = data + ((static_cast<size_t>(length) + 3) & ~size_t{3});
+                }
+                if (json.empty()) return false;
+            }
+
+            if (!gltf.json.Parse(json))
+            {
+                VA_ENGINE_WARN("[MeshImporter] '{}' is not valid JSON.", path);
+                return false;
+            }
+            gltf.root = JsonValue(&gltf.json, 0);
+
+            // Draco, meshopt and the like change how the buffers are read
+            if (gltf.root["extensionsRequired"].Size() > 0)
+            {
+                VA_ENGINE_TRACE("[MeshImporter] '{}' requires glTF extensions.", path);
+                return false;
+            }
+
+            const auto buffers = gltf.root["buffers"];
+            gltf.buffers.resize(buffers.Size());
+            for (uint32_t i = 0; i < buffers.Size(); ++i)
+            {
+                gltf.buffers[i] = LoadGltfBuffer(gltf, buffers[i], binChunk, i == 0);
+                const auto byteLength = buffers[i]["byteLength"].AsInteger<uint64_t>(0);
+                if (!gltf.buffers[i] || gltf.buffers[i]->GetSize() < byteLength)
+                {
+                    VA_ENGINE_WARN("[MeshImporter] Failed to read buffer {} of '{}'.", i, path);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Typed view of an accessor, every element bounds-checked on creation
+        struct GltfAccessor
+        {
+            const uint8_t* data = nullptr;
+            uint32_t count = 0;
+            uint32_t stride = 0;
+            uint32_t componentType = 0;
+            uint32_t components = 0;
+            bool normalized = false;
+
+            /// @brief Components of an element as floats, normalized integers mapped to
+            ///        [0, 1] or [-1, 1]
+            void ReadFloats(const uint32_t index, float* out) const
+            {
+                const auto* element = data + static_cast<size_t>(index) * stride;
+                if (componentType == GLTF_FLOAT)
+                {
+                    std::memcpy(out, element, components * sizeof(float));
+                    return;
+                }
+
+                for (uint32_t c = 0; c < components; ++c)
+                {
+                    float value = 0.0f;
+                    float range = 1.0f;
+                    switch (componentType)
+                    {
+                        case GLTF_BYTE:
+                            value = static_cast<int8_t>(element[c]);
+                            range = 127.0f;
+                            break;
+                        case GLTF_UNSIGNED_BYTE:
+                            value = element[c];
+                            range = 255.0f;
+                            break;
+                        case GLTF_SHORT:
+                            value = ReadUnaligned<int16_t>(element + 2 * c);
+                            range = 32767.0f;
+                            break;
+                        case GLTF_UNSIGNED_SHORT:
+                            value = ReadUnaligned<uint16_t>(element + 2 * c);
+                            range = 65535.0f;
+                            break;
+                        default:
+                            value = static_cast<float>(ReadUnaligned<uint32_t>(element + 4 * c));
+                            break;
+                    }
+                    out[c] = normalized ? std::max(value / range, -1.0f) : value;
+                }
+            }
+
+            [[nodiscard]] uint32_t ReadIndex(const uint32_t index) const
+            {
+                const auto* element = data + static_cast<size_t>(index) * stride;
+                switch (componentType)
+                {
+                    case GLTF_UNSIGNED_BYTE:
+                        return *element;
+                    case GLTF_UNSIGNED_SHORT:
+                        return ReadUnaligned<uint16_t>(element);
+                    default:
+                        return ReadUnaligned<uint32_t>(element);
+                }
+            }
+        };
+
+        uint32_t ComponentSize(const uint32_t componentType)
+        {
+            switch (componentType)
+            {
+                case GLTF_BYTE:
+                case GLTF_UNSIGNED_BYTE:
+                    return 1;
+                case GLTF_SHORT:
+                case GLTF_UNSIGNED_SHORT:
+                    return 2;
+                case GLTF_UNSIGNED_INT:
+                case GLTF_FLOAT:
+                    return 4;
+                default:
+                    return 0;
+            }
+        }
+
+        uint32_t ComponentCount(const std::string& type)
+        {
+            if (type == "SCALAR") return 1;
+            if (type == "VEC2") return 2;
+            if (type == "VEC3") return 3;
+            if (type == "VEC4") return 4;
+            return 0;
+        }
+
+        /// @brief View an accessor of the file
+        /// @param gltf The file
+        /// @param index Index of the accessor, as found in a primitive
+        /// @param components Number of components the caller reads
+        /// @param out Receives the view
+        /// @return false if the accessor is missing, sparse, of another type or out of bounds
+        bool ReadAccessor(
+            const GltfFile& gltf,
+            const JsonValue& index,
+            const uint32_t components,
+            GltfAccessor& out)
+        {
+            const auto accessor = gltf.root["accessors"][index.AsInteger<uint32_t>(INVALID_INDEX)];
+            if (!accessor.IsObject() || accessor["sparse"].IsValid()) return false;
+
+            const auto view = gltf.root["bufferViews"][
+                accessor["bufferView"].AsInteger<uint32_t>(INVALID_INDEX)];
+            const auto buffer = view["buffer"].AsInteger<uint32_t>(INVALID_INDEX);
+            if (!view.IsObject() || buffer >= gltf.buffers.size()) return false;
+
+            out.componentType = accessor["componentType"].AsInteger<uint32_t>(0);
+            out.components = ComponentCount(accessor["type"].AsString());
+            out.count = accessor["count"].AsInteger<uint32_t>(0);
+            out.normalized = accessor["normalized"].AsBool(false);
+            const uint64_t elementSize = ComponentSize(out.componentType) * out.components;
+            if (elementSize == 0 || out.components != components) return false;
+
+            const auto bytes = gltf.buffers[buffer]->GetBytes();
+            const uint64_t viewOffset = view["byteOffset"].AsInteger<uint32_t>(0);
+            const uint64_t viewLength = view["byteLength"].AsInteger<uint32_t>(0);
+            const uint64_t offset = accessor["byteOffset"].AsInteger<uint32_t>(0);
+            const uint64_t stride = view["byteStride"].AsInteger<uint32_t>(
+                static_cast<uint32_t>(elementSize));
+            if (stride < elementSize || viewOffset + viewLength > bytes.size()) return false;
+            if (out.count > 0 && offset + stride * (out.count - 1) + elementSize > viewLength)
+            {
+                return false;
+            }
+
+            out.data = bytes.data() + viewOffset + offset;
+            out.stride = static_cast<uint32_t>(stride);
+            return true;
+        }
+
+        /// @brief Triangle list of a primitive, in indices of its accessors
+        bool ReadTriangles(
+            const GltfFile& gltf,
+            const JsonValue& primitive,
+            const uint32_t vertexCount,
+            VAArray<uint32_t>& outTriangles)
+        {
+            VAArray<uint32_t> source;
+            if (primitive["indices"].IsValid())
+            {
+                GltfAccessor indices;
+                if (!ReadAccessor(gltf, primitive["indices"], 1, indices) ||
+                    indices.componentType == GLTF_BYTE || indices.componentType == GLTF_SHORT ||
+                    indices.componentType == GLTF_FLOAT)
+                {
+                    return false;
+                }
+
+                source.resize(indices.count);
+                for (uint32_t i = 0; i < indices.count; ++i)
+                {
+                    source[i] = indices.ReadIndex(i);
+                    if (source[i] >= vertexCount) return false;
+                }
+            }
+            else
+            {
+                source.resize(vertexCount);
+                for (uint32_t i = 0; i < vertexCount; ++i) source[i] = i;
+            }
+
+            const auto count = static_cast<uint32_t>(source.size());
+            switch (primitive["mode"].AsInteger<uint32_t>(GLTF_TRIANGLES))
+            {
+                case GLTF_TRIANGLES:
+                    source.resize(count - count % 3);
+                    outTriangles = std::move(source);
+                    return true;
+                case GLTF_TRIANGLE_STRIP:
+                    // Every other triangle is flipped to keep the winding of the first
+                    for (uint32_t i = 0; i + 2 < count; ++i)
+                    {
+                        const bool odd = i % 2 == 1;
+                        outTriangles.push_back(source[odd ? i + 1 : i]);
+                        outTriangles.push_back(source[odd ? i : i + 1]);
+                        outTriangles.push_back(source[i + 2]);
+                    }
+                    return true;
+                case GLTF_TRIANGLE_FAN:
+                    for (uint32_t i = 1; i + 1 < count; ++i)
+                    {
+                        outTriangles.push_back(source[0]);
+                        outTriangles.push_back(source[i]);
+                        outTriangles.push_back(source[i + 1]);
+                    }
+                    return true;
+                default:
+                    // Points and lines, which the triangle renderer does not draw
+                    return true;
+            }
+        }
+
+        /// @brief Read a primitive into welded vertices, then generate what the file lacks
+        /// @return false if the primitive is malformed, a primitive without triangles is
+        ///         decoded as empty geometry
+        bool DecodePrimitive(
+            const GltfFile& gltf,
+            const JsonValue& primitive,
+            DecodedGeometry& out)
+        {
+            const auto attributes = primitive["attributes"];
+            GltfAccessor positions;
+            if (!ReadAccessor(gltf, attributes["POSITION"], 3, positions)) return false;
+
+            GltfAccessor normals;
+            GltfAccessor uvs;
+            const bool hasNormals = attributes["NORMAL"].IsValid();
+            const bool hasUVs = attributes["TEXCOORD_0"].IsValid();
+            if ((hasNormals && (!ReadAccessor(gltf, attributes["NORMAL"], 3, normals) ||
+                    normals.count != positions.count)) ||
+                (hasUVs && (!ReadAccessor(gltf, attributes["TEXCOORD_0"], 2, uvs) ||
+                    uvs.count != positions.count)))
+            {
+                return false;
+            }
+
+            VAArray<uint32_t> triangles;
+            if (!ReadTriangles(gltf, primitive, positions.count, triangles)) return false;
+            if (triangles.empty()) return true;
+
+            // Every source vertex is built once, then welded with the identical ones
+            VAArray<uint32_t> remap(positions.count, INVALID_INDEX);
+            WeldTable table(positions.count);
+            out.vertices.reserve(std::min<size_t>(triangles.size(), positions.count));
+            for (auto& index : triangles)
+            {
+                auto& welded = remap[index];
+                if (welded == INVALID_INDEX)
+                {
+                    float position[3];
+                    float normal[3] = {};
+                    float uv[2] = {};
+                    positions.ReadFloats(index, position);
+                    if (hasNormals) normals.ReadFloats(index, normal);
+                    if (hasUVs) uvs.ReadFloats(index, uv);
+
+                    // The assimp importer flips V, the engine textures expect it that way
+                    MeshVertex vertex;
+                    vertex.Position = {position[0], position[1], position[2]};
+                    vertex.Normal = {normal[0], normal[1], normal[2]};
+                    vertex.UV0 = {uv[0], 1.0f - uv[1]};
+                    vertex.Tangent = {0.0f, 0.0f, 0.0f, 0.0f};
+
+                    const auto newIndex = static_cast<uint32_t>(out.vertices.size());
+                    welded = table.FindOrInsert(
+                        XXHash64::HashValue(vertex),
+                        newIndex,
+                        [&](const uint32_t other)
+                        {
+                            return std::memcmp(&out.vertices[other], &vertex, sizeof(vertex)) == 0;
+                        });
+                    if (welded == newIndex) out.vertices.push_back(vertex);
+                }
+                index = welded;
+            }
+            out.indices = std::move(triangles);
+
+            if (!hasNormals) MeshNormals::GenerateNormals(out.vertices, out.indices);
+            if (hasUVs) MeshNormals::GenerateTangents(out.vertices, out.indices);
+            return true;
+        }
+
+        /// @brief A mesh placed in the scene by a node
+        struct GltfPlacement
+        {
+            uint32_t mesh;
+            Math::Mat4 transform;
+            std::string name;
+        };
+
+        Math::Mat4 GltfNodeTransform(const JsonValue& node)
+        {
+            const auto matrix = node["matrix"];
+            if (matrix.Size() == 16)
+            {
+                float m[16];
+                for (uint32_t i = 0; i < 16; ++i) m[i] = static_cast<float>(matrix[i].AsNumber());
+
+                // Both are column-major
+                return {
+                    m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7],
+                    m[8], m[9], m[10], m[11], m[12], m[13], m[14], m[15]
+                };
+            }
+
+            const auto component = [](
+                const JsonValue& array,
+                const uint32_t i,
+                const float fallback)
+            {
+                return static_cast<float>(array[i].AsNumber(fallback));
+            };
+            const auto t = node["translation"];
+            const auto r = node["rotation"];
+            const auto s = node["scale"];
+            return Math::Mat4::FromTRS(
+                {component(t, 0, 0.0f), component(t, 1, 0.0f), component(t, 2, 0.0f)},
+                {
+                    component(r, 0, 0.0f),
+                    component(r, 1, 0.0f),
+                    component(r, 2, 0.0f),
+                    component(r, 3, 1.0f)
+                },
+                {component(s, 0, 1.0f), component(s, 1, 1.0f), component(s, 2, 1.0f)});
+        }
+
+        /// @brief Walk a node and its children in order, collecting the meshes they place
+        bool CollectGltfNode(
+            const JsonValue& nodes,
+            const uint32_t nodeIndex,
+            const Math::Mat4& parentTransform,
+            const uint32_t meshCount,
+            const uint32_t depth,
+            VAArray<GltfPlacement>& placements)
+        {
+            const auto node = nodes[nodeIndex];
+            if (!node.IsObject() || depth > MAX_NODE_DEPTH) return false;
+
+            const auto transform = parentTransform * GltfNodeTransform(node);
+            if (node["mesh"].IsValid())
+            {
+                const auto mesh = node["mesh"].AsInteger<uint32_t>(INVALID_INDEX);
+                if (mesh >= meshCount) return false;
+                placements.push_back({mesh, transform, node["name"].AsString()});
+            }
+
+            const auto children = node["children"];
+            for (uint32_t i = 0; i < children.Size(); ++i)
+            {
+                const auto child = children[i].AsInteger<uint32_t>(INVALID_INDEX);
+                if (!CollectGltfNode(nodes, child, transform, meshCount, depth + 1, placements))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Meshes placed by the nodes of the default scene, or of every root node
+        ///        when the file has no scene
+        bool CollectGltfScene(
+            const JsonValue& root,
+            const Math::Mat4& rootTransform,
+            VAArray<GltfPlacement>& placements)
+        {
+            const auto nodes = root["nodes"];
+            const auto meshCount = root["meshes"].Size();
+
+            VAArray<uint32_t> roots;
+            const auto scenes = root["scenes"];
+            if (scenes.Size() > 0)
+            {
+                const auto scene = scenes[root["scene"].AsInteger<uint32_t>(0)]["nodes"];
+                for (uint32_t i = 0; i < scene.Size(); ++i)
+                {
+                    roots.push_back(scene[i].AsInteger<uint32_t>(INVALID_INDEX));
+                }
+            }
+            else
+            {
+                VAArray<uint8_t> isChild(nodes.Size(), 0);
+                for (uint32_t i = 0; i < nodes.Size(); ++i)
+                {
+                    const auto children = nodes[i]["children"];
+                    for (uint32_t c = 0; c < children.Size(); ++c)
+                    {
+                        const auto child = children[c].AsInteger<uint32_t>(INVALID_INDEX);
+                        if (child < isChild.size()) isChild[child] = 1;
+                    }
+                }
+                for (uint32_t i = 0; i < nodes.Size(); ++i)
+                {
+                    if (!isChild[i]) roots.push_back(i);
+                }
+            }
+
+            for (const auto node : roots)
+            {
+                if (!CollectGltfNode(nodes, node, rootTransform, meshCount, 0, placements))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Texture name of a textureInfo, the stem of its image URI or the image name
+        std::string GltfTextureName(const JsonValue& root, const JsonValue& textureInfo)
+        {
+            const auto texture = root["textures"][
+                textureInfo["index"].AsInteger<uint32_t>(INVALID_INDEX)];
+            const auto image = root["images"][texture["source"].AsInteger<uint32_t>(INVALID_INDEX)];
+            const auto uri = image["uri"].AsString();
+            if (!uri.empty() && !uri.starts_with("data:")) return TextureName(DecodeUri(uri));
+            return image["name"].AsString();
+        }
+
+        void ReadGltfMaterials(const JsonValue& root, VAArray<ImportedMaterial>& outMaterials)
+        {
+            const auto materials = root["materials"];
+            outMaterials.resize(materials.Size());
+            for (uint32_t i = 0; i < materials.Size(); ++i)
+            {
+                const auto material = materials[i];
+                const auto pbr = material["pbrMetallicRoughness"];
+                const auto color = pbr["baseColorFactor"];
+                auto& imported = outMaterials[i];
+                imported.name = material["name"].AsString();
+                if (color.Size() == 4)
+                {
+                    imported.diffuseColor = Math::Vec4(
+                        static_cast<float>(color[0].AsNumber()),
+                        static_cast<float>(color[1].AsNumber()),
+                        static_cast<float>(color[2].AsNumber()),
+                        1.0f);
+                }
+                imported.diffuseTexture = GltfTextureName(root, pbr["baseColorTexture"]);
+                imported.normalTexture = GltfTextureName(root, material["normalTexture"]);
+            }
+        }
+
+        /// @brief Transform a direction, normalized unless it is zero
+        Math::Vec3 TransformDirection(const Math::Mat4& transform, const Math::Vec3& direction)
+        {
+            const auto transformed = transform * Math::Vec4(direction, 0.0f);
+            Math::Vec3 result(transformed.X(), transformed.Y(), transformed.Z());
+            if (!result.IsZero()) result.Normalize();
+            return result;
+        }
+
+        /// @brief A decoded primitive placed by a node, and where its data lands
+        struct GltfInstance
+        {
+            const DecodedGeometry* geometry = nullptr;
+            const GltfPlacement* placement = nullptr;
+            float mirror = 1.0f; ///< -1 when the transform mirrors, flipping the handedness
+            uint32_t vertexOffset = 0;
+            uint32_t indexOffset = 0;
+        };
+
+        /// @brief Vertex range of an instance, the first range also copies its indices
+        struct GltfTask
+        {
+            uint32_t instance;
+            uint32_t firstVertex;
+            uint32_t endVertex;
+        };
+
+        bool ImportGltf(const std::string& path, const float scale, ImportedMesh& outMesh)
+        {
+            GltfFile gltf;
+            if (!LoadGltf(path, gltf)) return false;
+
+            const auto meshes = gltf.root["meshes"];
+            VAArray<GltfPlacement> placements;
+            if (!CollectGltfScene(gltf.root, Math::Mat4::Scale(scale, scale, scale), placements))
+            {
+                VA_ENGINE_WARN("[MeshImporter] Invalid node hierarchy in '{}'.", path);
+                return false;
+            }
+
+            // Every primitive of a placed mesh is decoded once, whatever its placements
+            struct PrimitiveRef
+            {
+                uint32_t mesh;
+                uint32_t primitive;
+            };
+
+            VAArray<uint32_t> firstPrimitive(meshes.Size() + 1, 0);
+            for (uint32_t i = 0; i < meshes.Size(); ++i)
+            {
+                firstPrimitive[i + 1] = firstPrimitive[i] + meshes[i]["primitives"].Size();
+            }
+
+            VAArray<uint8_t> placed(meshes.Size(), 0);
+            for (const auto& placement : placements) placed[placement.mesh] = 1;
+
+            VAArray<PrimitiveRef> decodeList;
+            for (uint32_t mesh = 0; mesh < meshes.Size(); ++mesh)
+            {
+                if (!placed[mesh]) continue;
+                for (uint32_t p = 0; p < firstPrimitive[mesh + 1] - firstPrimitive[mesh]; ++p)
+                {
+                    decodeList.push_back({mesh, p});
+                }
+            }
+
+            VAArray<DecodedGeometry> primitives(firstPrimitive.back());
+            std::atomic<bool> decoded{true};
+            Jobs::ParallelFor(
+                decodeList.size(),
+                [&](const size_t i)
+                {
+                    const auto [mesh, p] = decodeList[i];
+                    const auto primitive = meshes[mesh]["primitives"][p];
+                    if (!DecodePrimitive(gltf, primitive, primitives[firstPrimitive[mesh] + p]))
+                    {
+                        decoded.store(false, std::memory_order_relaxed);
+                    }
+                },
+                "DecodeGltfPrimitive");
+            if (!decoded)
+            {
+                VA_ENGINE_WARN("[MeshImporter] Unsupported or invalid accessors in '{}'.", path);
+                return false;
+            }
+
+            ReadGltfMaterials(gltf.root, outMesh.materials);
+
+            // Lay out every placed primitive, then transform them into place in parallel
+            VAArray<GltfInstance> instances;
+            VAArray<GltfTask> tasks;
+            uint32_t vertexCount = 0;
+            uint32_t indexCount = 0;
+            for (const auto& placement : placements)
+            {
+                const auto axis = [&](const float x, const float y, const float z)
+                {
+                    const auto v = placement.transform * Math::Vec4(x, y, z, 0.0f);
+                    return Math::Vec3(v.X(), v.Y(), v.Z());
+                };
+                const auto determinant = Math::Vec3::Dot(
+                    Math::Vec3::Cross(axis(1.0f, 0.0f, 0.0f), axis(0.0f, 1.0f, 0.0f)),
+                    axis(0.0f, 0.0f, 1.0f));
+
+                const auto primitiveCount = meshes[placement.mesh]["primitives"].Size();
+                for (uint32_t p = 0; p < primitiveCount; ++p)
+                {
+                    const auto& geometry = primitives[firstPrimitive[placement.mesh] + p];
+                    const auto primitive = meshes[placement.mesh]["primitives"][p];
+                    if (geometry.indices.empty())
+                    {
+                        VA_ENGINE_TRACE(
+                            "[MeshImporter] Skipping empty primitive {} in node '{}'.",
+                            p,
+                            placement.name);
+                        continue;
+                    }
+
+                    const auto geometryVertices = static_cast<uint32_t>(geometry.vertices.size());
+                    const auto geometryIndices = static_cast<uint32_t>(geometry.indices.size());
+                    const auto instance = static_cast<uint32_t>(instances.size());
+                    instances.push_back({
+                        &geometry,
+                        &placement,
+                        determinant < 0.0f ? -1.0f : 1.0f,
+                        vertexCount,
+                        indexCount
+                    });
+                    for (uint32_t first = 0; first < geometryVertices;
+                         first += NativeMeshImporter::VERTICES_PER_JOB)
+                    {
+                        tasks.push_back({
+                            instance,
+                            first,
+                            std::min(geometryVertices, first + NativeMeshImporter::VERTICES_PER_JOB)
+                        });
+                    }
+
+                    auto name = placement.name.empty() ? std::string("Mesh") : placement.name;
+                    if (firstPrimitive.back() != 1) name += "_" + std::to_string(p);
+
+                    auto& submesh = outMesh.submeshes.emplace_back();
+                    submesh.name = std::move(name);
+                    submesh.material = primitive["material"].AsInteger<int32_t>(-1);
+                    if (submesh.material >= static_cast<int32_t>(outMesh.materials.size()))
+                    {
+                        submesh.material = -1;
+                    }
+                    submesh.indexOffset = indexCount;
+                    submesh.indexCount = geometryIndices;
+                    submesh.vertexOffset = vertexCount;
+                    submesh.vertexCount = geometryVertices;
+
+                    vertexCount += geometryVertices;
+                    indexCount += geometryIndices;
+                }
+            }
+
+            outMesh.vertices.resize(vertexCount);
+            outMesh.indices.resize(indexCount);
+            Jobs::ParallelFor(
+                tasks.size(),
+                [&](const size_t t)
+                {
+                    const auto& task = tasks[t];
+                    const auto& instance = instances[task.instance];
+                    const auto& transform = instance.placement->transform;
+                    const auto* source = instance.geometry->vertices.data();
+                    auto* target = outMesh.vertices.data() + instance.vertexOffset;
+                    for (uint32_t i = task.firstVertex; i < task.endVertex; ++i)
+                    {
+                        auto vertex = source[i];
+                        const auto position = transform * Math::Vec4(vertex.Position, 1.0f);
+                        const auto tangent = TransformDirection(
+                            transform,
+                            {vertex.Tangent.X(), vertex.Tangent.Y(), vertex.Tangent.Z()});
+                        vertex.Position = {position.X(), position.Y(), position.Z()};
+                        vertex.Normal = TransformDirection(transform, vertex.Normal);
+                        vertex.Tangent = Math::Vec4(tangent, vertex.Tangent.W() * instance.mirror);
+                        target[i] = vertex;
+                    }
+
+                    if (task.firstVertex == 0)
+                    {
+                        std::ranges::copy(
+                            instance.geometry->indices,
+                            outMesh.indices.begin() + instance.indexOffset);
+                    }
+                },
+                "TransformGltfInstance");
+            return true;
+        }
+
+        // =========================================================================================
+        // OBJ
+        // =========================================================================================
+
+        /// @brief A face corner, indices of its position, UV and normal, -1 when absent
+        struct ObjCorner
+        {
+            int32_t position;
+            int32_t uv;
+            int32_t normal;
+
+            bool operator==(const ObjCorner&) const = default;
+        };
+
+        /// @brief Triangles of an object drawn with a single material
+        struct ObjGroup
+        {
+            std::string object;
+            int32_t material = -1;
+            VAArray<ObjCorner> corners; ///< Three per triangle
+        };
+
+        /// @brief Bytes of OBJ text parsed by a single job, cut on line boundaries
+        constexpr size_t OBJ_BYTES_PER_JOB = 1024 * 1024;
+
+        /// @brief Consecutive faces of a chunk, with the object and material set before them
+        ///        in the chunk, unset when inherited from the previous chunks
+        struct ObjRun
+        {
+            std::optional<std::string> object;
+            std::optional<std::string> material;
+            VAArray<ObjCorner> corners;
+        };
+
+        /// @brief Lines of an OBJ file parsed by a single job
+        struct ObjChunk
+        {
+            std::string_view text;
+            uint32_t positionCount = 0; ///< v, vt and vn statements of the chunk
+            uint32_t uvCount = 0;
+            uint32_t normalCount = 0;
+            VAArray<ObjRun> runs;
+            VAArray<std::string> libraries; ///< mtllib statements, in order
+            bool valid = true;
+        };
+
+        struct ObjAttributes
+        {
+            VAArray<Math::Vec3> positions;
+            VAArray<Math::Vec2> uvs;
+            VAArray<Math::Vec3> normals;
+        };
+
+        std::string_view Trim(std::string_view text)
+        {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+            {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t' ||
+                text.back() == '\r'))
+            {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        /// @brief Split the next whitespace-separated token off a line
+        std::string_view NextToken(std::string_view& line)
+        {
+            size_t start = 0;
+            while (start < line.size() && (line[start] == ' ' || line[start] == '\t')) ++start;
+            size_t end = start;
+            while (end < line.size() && line[end] != ' ' && line[end] != '\t' && line[end] != '\r')
+            {
+                ++end;
+            }
+
+            const auto token = line.substr(start, end - start);
+            line.remove_prefix(end);
+            return token;
+        }
+
+        /// @brief Parse the next count numbers of a line, advancing past them
+        bool ParseFloats(std::string_view& line, float* out, const uint32_t count)
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const auto token = NextToken(line);
+                const auto [end, error] = std::from_chars(
+                    token.data(),
+                    token.data() + token.size(),
+                    out[i]);
+                if (token.empty() || error != std::errc()) return false;
+            }
+            return true;
+        }
+
+        /// @brief Turn a 1-based or negative (relative) OBJ index into a 0-based one
+        bool ResolveObjIndex(const std::string_view token, const size_t count, int32_t& out)
+        {
+            int32_t value = 0;
+            const auto [end, error] = std::from_chars(
+                token.data(),
+                token.data() + token.size(),
+                value);
+            if (error != std::errc() || end != token.data() + token.size()) return false;
+
+            const auto resolved = value < 0 ? static_cast<int64_t>(count) + value : value - 1;
+            if (value == 0 || resolved < 0 || resolved >= static_cast<int64_t>(count)) return false;
+            out = static_cast<int32_t>(resolved);
+            return true;
+        }
+
+        std::string_view AsText(const std::span<const uint8_t> bytes)
+        {
+            return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+        }
+
+        /// @brief Visit every line of a text, without the line break
+        template <typename Visitor>
+        void ForEachLine(std::string_view text, Visitor&& visitor)
+        {
+            while (!text.empty())
+            {
+                const auto end = text.find('\n');
+                visitor(text.substr(0, end));
+                text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+            }
+        }
+
+        /// @brief Read the materials of an MTL file, the same keys as the assimp importer:
+        ///        bump maps are height maps there, only `norm` gives a normal map
+        void ReadMtl(
+            const std::string& path,
+            VAArray<ImportedMaterial>& materials,
+            VAHashMap<std::string, int32_t>& materialIndices)
+        {
+            const auto file = Platform::MappedFile::Open(path);
+            if (!file)
+            {
+                VA_ENGINE_WARN("[MeshImporter] Failed to open material library '{}'.", path);
+                return;
+            }
+
+            ImportedMaterial* current = nullptr;
+            ForEachLine(
+                AsText(file->GetBytes()),
+                [&](std::string_view line)
+                {
+                    const auto keyword = NextToken(line);
+                    auto rest = Trim(line);
+                    if (keyword == "newmtl")
+                    {
+                        const auto [it, inserted] = materialIndices.try_emplace(
+                            std::string(rest),
+                            static_cast<int32_t>(materials.size()));
+                        if (inserted) materials.emplace_back().name = rest;
+                        current = &materials[it->second];
+                        return;
+                    }
+                    if (!current) return;
+
+                    // Texture options come first, the path is the last token
+                    const auto texture = [&]
+                    {
+                        const auto space = rest.find_last_of(" \t");
+                        return TextureName(std::string(
+                            space == std::string_view::npos ? rest : rest.substr(space + 1)));
+                    };
+                    if (keyword == "Kd")
+                    {
+                        float color[3];
+                        if (ParseFloats(rest, color, 3))
+                        {
+                            current->diffuseColor = Math::Vec4(color[0], color[1], color[2], 1.0f);
+                        }
+                    }
+                    else if (keyword == "map_Kd")
+                    {
+                        current->diffuseTexture = texture();
+                    }
+                    else if (keyword == "map_Ks")
+                    {
+                        current->specularTexture = texture();
+                    }
+                    else if (keyword == "norm")
+                    {
+                        current->normalTexture = texture();
+                    }
+                });
+        }
+
+        /// @brief Weld the corners of a group into vertices, then generate what the file lacks
+        void BuildObjGroup(
+            const ObjGroup& group,
+            const ObjAttributes& attributes,
+            const float scale,
+            DecodedGeometry& out)
+        {
+            // Smooth meshes share each vertex between about six triangles
+            WeldTable table(group.corners.size() / 6);
+            VAArray<ObjCorner> unique;
+            bool hasUVs = false;
+            bool missingNormals = false;
+            out.indices.resize(group.corners.size());
+            for (size_t i = 0; i < group.corners.size(); ++i)
+            {
+                const auto& corner = group.corners[i];
+                const auto newIndex = static_cast<uint32_t>(unique.size());
+                const auto index = table.FindOrInsert(
+                    XXHash64::HashValue(corner),
+                    newIndex,
+                    [&](const uint32_t other) { return unique[other] == corner; });
+                out.indices[i] = index;
+                if (index != newIndex) continue;
+
+                unique.push_back(corner);
+                auto& vertex = out.vertices.emplace_back();
+                vertex.Position = attributes.positions[corner.position] * scale;
+                vertex.Normal = corner.normal >= 0
+                    ? attributes.normals[corner.normal]
+                    : Math::Vec3::Zero();
+                vertex.UV0 = corner.uv >= 0 ? attributes.uvs[corner.uv] : Math::Vec2(0.0f, 0.0f);
+                vertex.Tangent = {0.0f, 0.0f, 0.0f, 0.0f};
+                hasUVs = hasUVs || corner.uv >= 0;
+                missingNormals = missingNormals || corner.normal < 0;
+            }
+
+            if (missingNormals) MeshNormals::GenerateNormals(out.vertices, out.indices);
+            if (hasUVs) MeshNormals::GenerateTangents(out.vertices, out.indices);
+        }
+
+        void CountObjChunk(ObjChunk& chunk)
+        {
+            ForEachLine(
+                chunk.text,
+                [&](std::string_view line)
+                {
+                    const auto keyword = NextToken(line);
+                    if (keyword == "v") ++chunk.positionCount;
+                    else if (keyword == "vt") ++chunk.uvCount;
+                    else if (keyword == "vn") ++chunk.normalCount;
+                });
+        }
+
+        /// @brief Parse the statements of a chunk
+        /// @param chunk The chunk, counted by CountObjChunk()
+        /// @param firstPosition Positions, UVs and normals of the previous chunks, where the
+        ///        ones of this chunk are written and how its relative indices are resolved
+        /// @param firstUV See firstPosition
+        /// @param firstNormal See firstPosition
+        /// @param attributes Every position, UV and normal of the file
+        void ParseObjChunk(
+            ObjChunk& chunk,
+            uint32_t firstPosition,
+            uint32_t firstUV,
+            uint32_t firstNormal,
+            ObjAttributes& attributes)
+        {
+            auto position = firstPosition;
+            auto uv = firstUV;
+            auto normal = firstNormal;
+            auto* run = &chunk.runs.emplace_back();
+            VAArray<ObjCorner> polygon;
+
+            // Object and material changes start a new run once the current one has faces
+            const auto nextRun = [&]() -> ObjRun&
+            {
+                if (!run->corners.empty())
+                {
+                    auto object = run->object;
+                    auto material = run->material;
+                    run = &chunk.runs.emplace_back();
+                    run->object = std::move(object);
+                    run->material = std::move(material);
+                }
+                return *run;
+            };
+
+            ForEachLine(
+                chunk.text,
+                [&](std::string_view line)
+                {
+                    if (!chunk.valid) return;
+
+                    const auto keyword = NextToken(line);
+                    if (keyword == "v")
+                    {
+                        float v[3] = {};
+                        chunk.valid = ParseFloats(line, v, 3);
+                        attributes.positions[position++] = {v[0], v[1], v[2]};
+                    }
+                    else if (keyword == "vt")
+                    {
+                        // V is optional, and so is the W that follows it
+                        float v[2] = {};
+                        chunk.valid = ParseFloats(line, v, 1);
+                        ParseFloats(line, v + 1, 1);
+                        attributes.uvs[uv++] = {v[0], v[1]};
+                    }
+                    else if (keyword == "vn")
+                    {
+                        float v[3] = {};
+                        chunk.valid = ParseFloats(line, v, 3);
+                        attributes.normals[normal++] = {v[0], v[1], v[2]};
+                    }
+                    else if (keyword == "f")
+                    {
+                        polygon.clear();
+                        for (auto token = NextToken(line); !token.empty(); token = NextToken(line))
+                        {
+                            // v, v/vt, v//vn or v/vt/vn
+                            ObjCorner corner{-1, -1, -1};
+                            const auto slash = token.find('/');
+                            const auto secondSlash = slash == std::string_view::npos
+                                ? std::string_view::npos
+                                : token.find('/', slash + 1);
+                            const auto uvToken = slash == std::string_view::npos
+                                ? std::string_view()
+                                : token.substr(slash + 1, secondSlash - slash - 1);
+                            const auto normalToken = secondSlash == std::string_view::npos
+                                ? std::string_view()
+                                : token.substr(secondSlash + 1);
+                            const auto positionToken = token.substr(0, slash);
+                            chunk.valid = chunk.valid &&
+                                ResolveObjIndex(positionToken, position, corner.position) &&
+                                (uvToken.empty() || ResolveObjIndex(uvToken, uv, corner.uv)) &&
+                                (normalToken.empty() ||
+                                    ResolveObjIndex(normalToken, normal, corner.normal));
+                            polygon.push_back(corner);
+                        }
+
+                        for (size_t i = 1; i + 1 < polygon.size(); ++i)
+                        {
+                            run->corners.push_back(polygon[0]);
+                            run->corners.push_back(polygon[i]);
+                            run->corners.push_back(polygon[i + 1]);
+                        }
+                    }
+                    else if (keyword == "o" || keyword == "g")
+                    {
+                        nextRun().object = std::string(Trim(line));
+                    }
+                    else if (keyword == "usemtl")
+                    {
+                        nextRun().material = std::string(Trim(line));
+                    }
+                    else if (keyword == "mtllib")
+                    {
+                        chunk.libraries.emplace_back(Trim(line));
+                    }
+                });
+        }
+
+        /// @brief Split a text in chunks of about OBJ_BYTES_PER_JOB bytes, on line boundaries
+        VAArray<ObjChunk> SplitObjText(std::string_view text)
+        {
+            VAArray<ObjChunk> chunks;
+            while (!text.empty())
+            {
+                auto end = text.size();
+                if (end > OBJ_BYTES_PER_JOB)
+                {
+                    end = text.find('\n', OBJ_BYTES_PER_JOB);
+                    end = end == std::string_view::npos ? text.size() : end + 1;
+                }
+                chunks.emplace_back().text = text.substr(0, end);
+                text.remove_prefix(end);
+            }
+            return chunks;
+        }
+
+        /// @brief Import an OBJ file
+        ///
+        /// The text is parsed in parallel chunks: a first pass counts the positions, UVs and
+        /// normals of every chunk, so that the second one writes them in place and resolves
+        /// relative indices. Object and material changes are then replayed in file order to
+        /// gather the faces in groups.
+        bool ImportObj(const std::string& path, const float scale, ImportedMesh& outMesh)
+        {
+            const auto file = Platform::MappedFile::Open(path);
+            if (!file) return false;
+
+            auto chunks = SplitObjText(AsText(file->GetBytes()));
+            Jobs::ParallelFor(
+                chunks.size(),
+                [&](const size_t i) { CountObjChunk(chunks[i]); },
+                "CountObj");
+
+            VAArray<uint32_t> firstElements(chunks.size() * 3);
+            ObjAttributes attributes;
+            uint32_t positionCount = 0;
+            uint32_t uvCount = 0;
+            uint32_t normalCount = 0;
+            for (size_t i = 0; i < chunks.size(); ++i)
+            {
+                firstElements[3 * i] = positionCount;
+                firstElements[3 * i + 1] = uvCount;
+                firstElements[3 * i + 2] = normalCount;
+                positionCount += chunks[i].positionCount;
+                uvCount += chunks[i].uvCount;
+                normalCount += chunks[i].normalCount;
+            }
+            attributes.positions.resize(positionCount);
+            attributes.uvs.resize(uvCount);
+            attributes.normals.resize(normalCount);
+
+            Jobs::ParallelFor(
+                chunks.size(),
+                [&](const size_t i)
+                {
+                    ParseObjChunk(
+                        chunks[i],
+                        firstElements[3 * i],
+                        firstElements[3 * i + 1],
+                        firstElements[3 * i + 2],
+                        attributes);
+                },
+                "ParseObj");
+
+            if (std::ranges::any_of(chunks, [](const ObjChunk& chunk) { return !chunk.valid; }))
+            {
+                VA_ENGINE_WARN("[MeshImporter] Invalid statement in '{}'.", path);
+                return false;
+            }
+
+            // Libraries first, usemtl may name a material of a library declared after it
+            const auto directory = std::filesystem::path(path).parent_path();
+            VAHashMap<std::string, int32_t> materialIndices;
+            for (const auto& chunk : chunks)
+            {
+                for (const auto& library : chunk.libraries)
+                {
+                    ReadMtl((directory / library).string(), outMesh.materials, materialIndices);
+                }
+            }
+
+            // Faces go to the group of the current object and material, created on first use
+            VAArray<ObjGroup> groups;
+            std::string object;
+            int32_t material = -1;
+            ObjGroup* group = nullptr;
+            for (auto& chunk : chunks)
+            {
+                for (auto& run : chunk.runs)
+                {
+                    if (run.object) object = *run.object;
+                    if (run.material)
+                    {
+                        const auto it = materialIndices.find(*run.material);
+                        material = it != materialIndices.end() ? it->second : -1;
+                    }
+                    if (run.corners.empty()) continue;
+
+                    if (!group || group->object != object || group->material != material)
+                    {
+                        const auto existing = std::ranges::find_if(
+                            groups,
+                            [&](const ObjGroup& g)
+                            {
+                                return g.object == object && g.material == material;
+                            });
+                        group = existing != groups.end() ? &*existing : &groups.emplace_back();
+                        group->object = object;
+                        group->material = material;
+                    }
+
+                    if (group->corners.empty())
+                    {
+                        group->corners = std::move(run.corners);
+                    }
+                    else
+                    {
+                        group->corners.insert(
+                            group->corners.end(),
+                            run.corners.begin(),
+                            run.corners.end());
+                    }
+                }
+            }
+
+            VAArray<DecodedGeometry> geometries(groups.size());
+            Jobs::ParallelFor(
+                groups.size(),
+                [&](const size_t i) { BuildObjGroup(groups[i], attributes, scale, geometries[i]); },
+                "BuildObjGroup");
+
+            VAHashMap<std::string, uint32_t> objectGroups;
+            for (size_t i = 0; i < groups.size(); ++i)
+            {
+                const auto& geometry = geometries[i];
+                const auto groupInObject = objectGroups[groups[i].object]++;
+
+                auto& submesh = outMesh.submeshes.emplace_back();
+                submesh.name = groups[i].object.empty() ? std::string("Mesh") : groups[i].object;
+                if (groups.size() != 1) submesh.name += "_" + std::to_string(groupInObject);
+                submesh.material = groups[i].material;
+                submesh.indexOffset = static_cast<uint32_t>(outMesh.indices.size());
+                submesh.indexCount = static_cast<uint32_t>(geometry.indices.size());
+                submesh.vertexOffset = static_cast<uint32_t>(outMesh.vertices.size());
+                submesh.vertexCount = static_cast<uint32_t>(geometry.vertices.size());
+
+                outMesh.vertices.insert(
+                    outMesh.vertices.end(),
+                    geometry.vertices.begin(),
+                    geometry.vertices.end());
+                outMesh.indices.insert(
+                    outMesh.indices.end(),
+                    geometry.indices.begin(),
+                    geometry.indices.end());
+            }
+            return true;
+        }
+    } // namespace
+
+    bool NativeMeshImporter::CanImport(const std::string& path)
+    {
+        const auto extension = ToLower(std::filesystem::path(path).extension().string());
+        return extension == ".gltf" || extension == ".glb" || extension == ".obj";
+    }
+
+    bool NativeMeshImporter::Import(
+        const std::string& path,
+        const float scale,
+        ImportedMesh& outMesh)
+    {
+        outMesh = {};
+        const auto extension = ToLower(std::filesystem::path(path).extension().string());
+        const bool imported = extension == ".obj"
+            ? ImportObj(path, scale, outMesh)
+            : CanImport(path) && ImportGltf(path, scale, outMesh);
+        if (!imported) outMesh = {};
+        return imported;
+    }
+} // namespace VoidArchitect::Resources::Loaders
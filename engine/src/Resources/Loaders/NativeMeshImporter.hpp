@@ -0,0 +1,76 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include "Resources/MeshData.hpp"
+
+namespace VoidArchitect::Resources::Loaders
+{
+    /// @brief Material of an imported mesh, RawMeshLoader turns it into a MaterialTemplate
+    struct ImportedMaterial
+    {
+        std::string name; ///< Empty if the file does not name it
+        Math::Vec4 diffuseColor = Math::Vec4::One();
+        std::string diffuseTexture; ///< Texture names, the file stems of the images
+        std::string specularTexture;
+        std::string normalTexture;
+    };
+
+    struct ImportedSubMesh
+    {
+        std::string name;
+        int32_t material = -1; ///< Index in ImportedMesh::materials, -1 for the default one
+        uint32_t indexOffset = 0;
+        uint32_t indexCount = 0;
+        uint32_t vertexOffset = 0;
+        uint32_t vertexCount = 0;
+    };
+
+    /// @brief A whole scene flattened in a single vertex and index array
+    struct ImportedMesh
+    {
+        VAArray<MeshVertex> vertices;
+        VAArray<uint32_t> indices; ///< Relative to the first vertex of their submesh
+        VAArray<ImportedSubMesh> submeshes;
+        VAArray<ImportedMaterial> materials;
+    };
+
+    /// @brief Reads glTF 2.0 (.gltf, .glb) and OBJ files without assimp
+    ///
+    /// Files and the glTF buffers they reference are mapped, accessors are read straight into
+    /// MeshVertex and index arrays. Vertices equal in every attribute are welded through a
+    /// hash table, OBJ face corners by their position/UV/normal indices. Missing normals and
+    /// every tangent come from MeshNormals, the tangent handedness is then the glTF one.
+    ///
+    /// As on the assimp path, every mesh placed by a node is a submesh with the node
+    /// transform applied, named after the node. A glTF mesh used by several nodes is decoded
+    /// once, every primitive in parallel, then each placement is transformed in parallel.
+    ///
+    /// glTF files requiring an extension (Draco, meshopt...) or using sparse accessors are
+    /// not read, RawMeshLoader falls back to assimp for them. Specular maps are only read
+    /// from OBJ materials.
+    ///
+    /// Usage example:
+    /// @code
+    /// ImportedMesh mesh;
+    /// if (NativeMeshImporter::Import("assets/meshes/sponza.gltf", 0.01f, mesh))
+    ///     Upload(mesh.vertices, mesh.indices);
+    /// @endcode
+    class NativeMeshImporter
+    {
+    public:
+        /// @brief Whether a file has an extension the importer reads
+        static bool CanImport(const std::string& path);
+
+        /// @brief Import every mesh of a file
+        /// @param path Path of the file
+        /// @param scale Uniform scale of the whole scene, like the global scale of assimp
+        /// @param outMesh Receives the geometry and the materials
+        /// @return false if the file cannot be read or uses a feature the importer lacks
+        static bool Import(const std::string& path, float scale, ImportedMesh& outMesh);
+
+        /// @brief Vertices transformed by a single job
+        static constexpr uint32_t VERTICES_PER_JOB = 16384;
+    };
+} // namespace VoidArchitect::Resources::Loaders
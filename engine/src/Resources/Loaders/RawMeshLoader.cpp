@@ -7,11 +7,21 @@
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
+#include "NativeMeshImporter.hpp"
 #include "Core/Logger.hpp"
 #include "Core/Math/Constants.hpp"
 #include "Core/Math/Math.hpp"
 #include "Resources/MeshData.hpp"
 #include "Systems/MaterialSystem.hpp"
+#include "Systems/Jobs/ParallelFor.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define VA_MESH_IMPORT_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VA_MESH_IMPORT_NEON 1
+#endif
 
 namespace VoidArchitect::Resources::Loaders
 {
@@ -68,21 +78,6 @@ namespace VoidArchitect::Resources::Loaders
         return baseName + "_" + std::to_string(meshIndex);
     }
 
-    Resources::TextureUse MapAssimpTextureType(const aiTextureType type)
-    {
-        switch (type)
-        {
-            case aiTextureType_DIFFUSE:
-                return Resources::TextureUse::Diffuse;
-            case aiTextureType_SPECULAR:
-                return Resources::TextureUse::Specular;
-            case aiTextureType_NORMALS:
-                return Resources::TextureUse::Normal;
-            default:
-                return Resources::TextureUse::Diffuse;
-        }
-    }
-
     std::string ExtractTextureName(const std::string& texturePath)
     {
         if (texturePath.empty())
@@ -96,73 +91,99 @@ namespace VoidArchitect::Resources::Loaders
 
     std::string CreateMaterialName(
         const std::string& meshName,
-        const aiMaterial* material,
+        const std::string& materialName,
         const uint32_t materialIndex)
     {
-        aiString matName;
-        if (material->Get(AI_MATKEY_NAME, matName) == AI_SUCCESS && matName.length > 0)
+        if (!materialName.empty())
         {
-            return meshName + "_" + std::string(matName.C_Str());
+            return meshName + "_" + materialName;
         }
 
         // Fallback to index-based naming
         return meshName + "_" + std::to_string(materialIndex);
     }
 
-    MaterialTemplate ImportAssimpMaterialTemplate(
-        const aiMaterial* material,
-        const std::string& materialName)
+    ImportedMaterial ReadAssimpMaterial(const aiMaterial* material)
     {
-        MaterialTemplate templateData;
-        templateData.name = materialName;
-        templateData.renderStateClass = "Opaque"; // Default for now
+        ImportedMaterial imported;
+
+        aiString matName;
+        if (material->Get(AI_MATKEY_NAME, matName) == AI_SUCCESS)
+        {
+            imported.name = matName.C_Str();
+        }
 
         // Import diffuse color
         aiColor3D diffuseColor;
         if (material->Get(AI_MATKEY_COLOR_DIFFUSE, diffuseColor) == AI_SUCCESS)
         {
-            templateData.diffuseColor = Math::Vec4(
+            imported.diffuseColor = Math::Vec4(
                 diffuseColor.r,
                 diffuseColor.g,
                 diffuseColor.b,
                 1.0f);
         }
-        else
-        {
-            templateData.diffuseColor = Math::Vec4::One();
-        }
 
         // Import textures - just extract names, let MaterialSystem handle the loading
-        auto importTexture = [&](aiTextureType assimpType, MaterialTemplate::TextureConfig& config)
+        auto importTexture = [&](aiTextureType assimpType, std::string& textureName)
         {
             if (material->GetTextureCount(assimpType) > 0)
             {
                 aiString texPath;
                 if (material->GetTexture(assimpType, 0, &texPath) == AI_SUCCESS)
                 {
-                    std::string texturePath(texPath.C_Str());
-                    std::string textureName = ExtractTextureName(texturePath);
-
-                    if (!textureName.empty())
-                    {
-                        config.use = MapAssimpTextureType(assimpType);
-                        config.name = textureName;
-
-                        VA_ENGINE_TRACE(
-                            "[MeshLoader] Material '{}' - Found {} texture: '{}'.",
-                            materialName,
-                            static_cast<int>(assimpType),
-                            textureName);
-                    }
+                    textureName = ExtractTextureName(texPath.C_Str());
                 }
             }
         };
 
         // Import all supported texture types
         // TODO: Add other texture types
-        importTexture(aiTextureType_DIFFUSE, templateData.diffuseTexture);
-        importTexture(aiTextureType_SPECULAR, templateData.specularTexture);
-        importTexture(aiTextureType_NORMALS, templateData.normalTexture);
+        importTexture(aiTextureType_DIFFUSE, imported.diffuseTexture);
+        importTexture(aiTextureType_SPECULAR, imported.specularTexture);
+        importTexture(aiTextureType_NORMALS, imported.normalTexture);
+
+        return imported;
+    }
+
+    MaterialTemplate CreateMaterialTemplate(
+        const ImportedMaterial& material,
+        const std::string& materialName)
+    {
+        MaterialTemplate templateData;
+        templateData.name = materialName;
+        templateData.renderStateClass = "Opaque"; // Default for now
+        templateData.diffuseColor = material.diffuseColor;
+
+        auto importTexture = [&](
+            const std::string& textureName,
+            const Resources::TextureUse use,
+            MaterialTemplate::TextureConfig& config)
+        {
+            if (textureName.empty()) return;
+
+            config.use = use;
+            config.name = textureName;
+
+            VA_ENGINE_TRACE(
+                "[MeshLoader] Material '{}' - Found {} texture: '{}'.",
+                materialName,
+                static_cast<int>(use),
+                textureName);
+        };
+
+        importTexture(
+            material.diffuseTexture,
+            Resources::TextureUse::Diffuse,
+            templateData.diffuseTexture);
+        importTexture(
+            material.specularTexture,
+            Resources::TextureUse::Specular,
+            templateData.specularTexture);
+        importTexture(
+            material.normalTexture,
+            Resources::TextureUse::Normal,
+            templateData.normalTexture);
 
         templateData.resourceBindings = {
             // MaterialUBO
@@ -180,6 +201,33 @@ namespace VoidArchitect::Resources::Loaders
         return templateData;
     }
 
+    MaterialHandle RegisterMaterial(
+        const ImportedMaterial& material,
+        const std::string& meshName,
+        const uint32_t materialIndex)
+    {
+        // Create a unique material name
+        auto materialName = CreateMaterialName(meshName, material.name, materialIndex);
+        auto matTemplate = CreateMaterialTemplate(material, materialName);
+
+        // Register the material template in MaterialSystem
+        auto materialHandle = g_MaterialSystem->RegisterTemplate(materialName, matTemplate);
+        if (materialHandle == InvalidMaterialHandle)
+        {
+            VA_ENGINE_ERROR(
+                "[MeshLoader] Failed to register material '{}', using default material.",
+                materialName);
+            return g_MaterialSystem->GetHandleForDefaultMaterial();
+        }
+
+        VA_ENGINE_TRACE(
+            "[MeshLoader] Successfully imported and registered material '{}' with handle {}.",
+            materialName,
+            materialHandle);
+
+        return materialHandle;
+    }
+
     MaterialHandle ImportAssimpMaterial(
         const aiMesh* mesh,
         const aiScene* scene,
@@ -206,206 +254,338 @@ namespace VoidArchitect::Resources::Loaders
             return g_MaterialSystem->GetHandleForDefaultMaterial();
         }
 
-        // Create a unique material name
-        auto materialName = CreateMaterialName(meshName, assimpMaterial, mesh->mMaterialIndex);
-
-        // Create MaterialTemplate from assimp
-        auto matTemplate = ImportAssimpMaterialTemplate(assimpMaterial, materialName);
-
-        // Register the material template in MaterialSystem
-        auto materialHandle = g_MaterialSystem->RegisterTemplate(materialName, matTemplate);
-        if (materialHandle == InvalidMaterialHandle)
-        {
-            VA_ENGINE_ERROR(
-                "[MeshLoader] Failed to register material '{}', using default material.",
-                materialName);
-            return g_MaterialSystem->GetHandleForDefaultMaterial();
-        }
-
-        // Ensure the loading.
-        // materialHandle = g_MaterialSystem->GetHandleFor(materialName);
-
-        VA_ENGINE_TRACE(
-            "[MeshLoader] Successfully imported and registered material '{}' with handle {}.",
-            materialName,
-            materialHandle);
-
-        return materialHandle;
+        return RegisterMaterial(
+            ReadAssimpMaterial(assimpMaterial),
+            meshName,
+            mesh->mMaterialIndex);
     }
 
-    MeshVertex ProcessVertex(const aiMesh* mesh, uint32_t vertexIndex, const Math::Mat4& transform)
+    namespace
     {
-        const auto vertex = mesh->mVertices[vertexIndex];
-        const auto normal = mesh->mNormals[vertexIndex];
-        const auto UV0 = mesh->mTextureCoords[0][vertexIndex];
-        const auto tan = mesh->mTangents[vertexIndex];
-        const auto bitan = mesh->mBitangents[vertexIndex];
-
-        MeshVertex v;
+        /// @brief Vertices transformed by one job, big meshes are split across several
+        constexpr uint32_t VERTICES_PER_JOB = 16384;
 
-        // Transform position
-        auto pos = transform * Math::Vec4(vertex.x, vertex.y, vertex.z, 1.0f);
-        v.Position = {pos.X(), pos.Y(), pos.Z()};
+        /// @brief Vertices transformed per batch, the scratch lives on the stack
+        constexpr uint32_t TRANSFORM_BATCH_SIZE = 256;
 
-        // Transform normal
-        if (mesh->HasNormals())
+        /// @brief A mesh placed in the scene by a node, and where its data lands
+        struct MeshInstance
         {
-            auto norm = transform * Math::Vec4(normal.x, normal.y, normal.z, 0.0f);
-            v.Normal = {norm.X(), norm.Y(), norm.Z()};
-            v.Normal.Normalize();
-        }
+            const aiMesh* mesh = nullptr;
+            float columns[4][4] = {}; ///< Node transform, column-major like Math::Mat4
+            uint32_t vertexOffset = 0;
+            uint32_t indexOffset = 0; ///< Position of its first index in the index array
+        };
 
-        // UV0 (no transformation needed)
-        if (mesh->HasTextureCoords(0))
+        /// @brief Vertex range of an instance, the first range also copies its indices
+        struct ImportTask
         {
-            v.UV0 = {UV0.x, UV0.y};
-        }
+            uint32_t instance;
+            uint32_t firstVertex;
+            uint32_t endVertex;
+        };
 
-        // Transform tangent
-        if (mesh->HasTangentsAndBitangents())
+        /// @brief Indices a mesh writes, a face may be a point or a line after triangulation
+        uint32_t CountIndices(const aiMesh* mesh)
         {
-            auto tangent4 = transform * Math::Vec4(tan.x, tan.y, tan.z, 0.0f);
-            auto transTangent = Math::Vec3(tangent4.X(), tangent4.Y(), tangent4.Z()).Normalized();
-
-            auto bitangent4 = transform * Math::Vec4(bitan.x, bitan.y, bitan.z, 0.0f);
-            auto transBitangent = Math::Vec3(
-                bitangent4.X(),
-                bitangent4.Y(),
-                bitangent4.Z()).Normalized();
-
-            // Calculate handedness: check if (normal x tangent) points in the same direction as bitangent
-            auto calculatedBitangent = Math::Vec3::Cross(transTangent, v.Normal);
-            auto handedness = (Math::Vec3::Dot(calculatedBitangent, transBitangent) >= 0.0f)
-                ? 1.0f
-                : -1.0f;
-
-            v.Tangent = Math::Vec4(transTangent, handedness);
-        }
+            if (mesh->mPrimitiveTypes == aiPrimitiveType_TRIANGLE) return mesh->mNumFaces * 3;
 
-        return v;
-    }
+            uint32_t count = 0;
+            for (uint32_t i = 0; i < mesh->mNumFaces; ++i)
+            {
+                count += mesh->mFaces[i].mNumIndices;
+            }
+            return count;
+        }
 
-    void ProcessFace(const aiFace& face, VAArray<uint32_t>& indices)
-    {
-        for (uint32_t i = 0; i < face.mNumIndices; ++i)
+        /// @brief columns * (x, y, z, w) for a batch of vectors
+        ///
+        /// The products are summed as (c0 * x + c1 * y) + (c2 * z + c3 * w), the order of
+        /// Math::Mat4 * Math::Vec4, so that the results are the same to the bit.
+        void TransformBatch(
+            const float columns[4][4],
+            const aiVector3D* source,
+            const uint32_t count,
+            const float w,
+            float (*out)[4])
         {
-            indices.push_back(face.mIndices[i]);
+#if defined(VA_MESH_IMPORT_SSE2)
+            const __m128 c0 = _mm_loadu_ps(columns[0]);
+            const __m128 c1 = _mm_loadu_ps(columns[1]);
+            const __m128 c2 = _mm_loadu_ps(columns[2]);
+            const __m128 cw = _mm_mul_ps(_mm_loadu_ps(columns[3]), _mm_set1_ps(w));
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const __m128 xy = _mm_add_ps(
+                    _mm_mul_ps(c0, _mm_set1_ps(source[i].x)),
+                    _mm_mul_ps(c1, _mm_set1_ps(source[i].y)));
+                const __m128 zw = _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(source[i].z)), cw);
+                _mm_storeu_ps(out[i], _mm_add_ps(xy, zw));
+            }
+#elif defined(VA_MESH_IMPORT_NEON)
+            const float32x4_t c0 = vld1q_f32(columns[0]);
+            const float32x4_t c1 = vld1q_f32(columns[1]);
+            const float32x4_t c2 = vld1q_f32(columns[2]);
+            const float32x4_t cw = vmulq_n_f32(vld1q_f32(columns[3]), w);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                // No fused multiply-add, it would round differently from Mat4 * Vec4
+                const float32x4_t xy = vaddq_f32(
+                    vmulq_n_f32(c0, source[i].x),
+                    vmulq_n_f32(c1, source[i].y));
+                const float32x4_t zw = vaddq_f32(vmulq_n_f32(c2, source[i].z), cw);
+                vst1q_f32(out[i], vaddq_f32(xy, zw));
+            }
+#else
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                for (uint32_t row = 0; row < 4; ++row)
+                {
+                    const float xy = columns[0][row] * source[i].x + columns[1][row] * source[i].y;
+                    const float zw = columns[2][row] * source[i].z + columns[3][row] * w;
+                    out[i][row] = xy + zw;
+                }
+            }
+#endif
         }
-    }
 
-    void ProcessMesh(
-        const aiMesh* mesh,
-        const aiNode* node,
-        uint32_t meshIndex,
-        const aiScene* scene,
-        const std::string& meshName,
-        VAArray<MeshVertex>& vertices,
-        VAArray<uint32_t>& indices,
-        VAArray<Resources::SubMeshDescriptor>& submeshes,
-        const Math::Mat4& nodeTransform,
-        uint32_t& globalVertexOffset,
-        uint32_t& globalIndexOffset)
-    {
-        // Skip empty meshes
-        if (mesh->mNumVertices == 0 || mesh->mNumFaces == 0)
+        /// @brief Transform the vertices [firstVertex, endVertex) of an instance in place
+        void FillVertices(
+            const MeshInstance& instance,
+            const uint32_t firstVertex,
+            const uint32_t endVertex,
+            MeshVertex* vertices)
         {
-            VA_ENGINE_TRACE(
-                "[MeshLoader] Skipping empty mesh '{}' in node '{}'.",
-                mesh->mName.C_Str(),
-                node->mName.C_Str());
+            const auto* mesh = instance.mesh;
+            const bool hasNormals = mesh->HasNormals();
+            const bool hasUV0 = mesh->HasTextureCoords(0);
+            const bool hasTangents = mesh->HasTangentsAndBitangents();
+
+            float positions[TRANSFORM_BATCH_SIZE][4];
+            float normals[TRANSFORM_BATCH_SIZE][4];
+            float tangents[TRANSFORM_BATCH_SIZE][4];
+            float bitangents[TRANSFORM_BATCH_SIZE][4];
+            for (uint32_t first = firstVertex; first < endVertex; first += TRANSFORM_BATCH_SIZE)
+            {
+                const auto count = std::min(TRANSFORM_BATCH_SIZE, endVertex - first);
+                TransformBatch(instance.columns, mesh->mVertices + first, count, 1.0f, positions);
+                if (hasNormals)
+                {
+                    TransformBatch(instance.columns, mesh->mNormals + first, count, 0.0f, normals);
+                }
+                if (hasTangents)
+                {
+                    TransformBatch(
+                        instance.columns,
+                        mesh->mTangents + first,
+                        count,
+                        0.0f,
+                        tangents);
+                    TransformBatch(
+                        instance.columns,
+                        mesh->mBitangents + first,
+                        count,
+                        0.0f,
+                        bitangents);
+                }
 
-            return;
-        }
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    auto& v = vertices[instance.vertexOffset + first + i];
+                    v.Position = {positions[i][0], positions[i][1], positions[i][2]};
+
+                    if (hasNormals)
+                    {
+                        v.Normal = {normals[i][0], normals[i][1], normals[i][2]};
+                        v.Normal.Normalize();
+                    }
 
-        auto submeshVertexOffset = globalVertexOffset;
-        auto submeshIndexOffset = globalIndexOffset;
+                    // UV0 (no transformation needed)
+                    if (hasUV0)
+                    {
+                        const auto& uv0 = mesh->mTextureCoords[0][first + i];
+                        v.UV0 = {uv0.x, uv0.y};
+                    }
 
-        LogSuspiciousTransforms(nodeTransform, node->mName.C_Str());
+                    if (hasTangents)
+                    {
+                        auto transTangent = Math::Vec3(
+                            tangents[i][0],
+                            tangents[i][1],
+                            tangents[i][2]).Normalized();
+                        auto transBitangent = Math::Vec3(
+                            bitangents[i][0],
+                            bitangents[i][1],
+                            bitangents[i][2]).Normalized();
+
+                        // Calculate handedness: check if (normal x tangent) points in the
+                        // same direction as bitangent
+                        auto calculatedBitangent = Math::Vec3::Cross(transTangent, v.Normal);
+                        auto alignment = Math::Vec3::Dot(calculatedBitangent, transBitangent);
+                        auto handedness = alignment >= 0.0f ? 1.0f : -1.0f;
+
+                        v.Tangent = Math::Vec4(transTangent, handedness);
+                    }
+                }
+            }
+        }
 
-        // Process vertices with transform
-        for (uint32_t i = 0; i < mesh->mNumVertices; ++i)
+        /// @brief Copy the face indices of an instance, relative to its first vertex
+        void FillIndices(const MeshInstance& instance, uint32_t* indices)
         {
-            auto v = ProcessVertex(mesh, i, nodeTransform);
-            vertices.push_back(v);
+            auto* out = indices + instance.indexOffset;
+            for (uint32_t i = 0; i < instance.mesh->mNumFaces; ++i)
+            {
+                const auto& face = instance.mesh->mFaces[i];
+                out = std::copy_n(face.mIndices, face.mNumIndices, out);
+            }
         }
 
-        // Process indices with offset
-        for (uint32_t i = 0; i < mesh->mNumFaces; ++i)
+        /// @brief Columns of an assimp matrix, whose rows are a1-a4, b1-b4...
+        void ToColumns(const aiMatrix4x4& matrix, float (&columns)[4][4])
         {
-            auto face = mesh->mFaces[i];
-            ProcessFace(face, indices);
+            for (uint32_t column = 0; column < 4; ++column)
+            {
+                for (uint32_t row = 0; row < 4; ++row)
+                {
+                    columns[column][row] = matrix[row][column];
+                }
+            }
         }
 
-        auto materialHandle = ImportAssimpMaterial(mesh, scene, meshName);
+        /// @brief Register the material and the submesh of a mesh placed by a node, its
+        ///        vertices and indices are copied once every instance is known
+        void CollectMeshInstance(
+            const aiMesh* mesh,
+            const aiNode* node,
+            uint32_t meshIndex,
+            const aiScene* scene,
+            const std::string& meshName,
+            const Math::Mat4& nodeTransform,
+            const float (&columns)[4][4],
+            VAArray<MeshInstance>& instances,
+            VAArray<Resources::SubMeshDescriptor>& submeshes,
+            uint32_t& globalVertexOffset,
+            uint32_t& globalIndexOffset,
+            uint32_t& indexCount)
+        {
+            // Skip empty meshes
+            if (mesh->mNumVertices == 0 || mesh->mNumFaces == 0)
+            {
+                VA_ENGINE_TRACE(
+                    "[MeshLoader] Skipping empty mesh '{}' in node '{}'.",
+                    mesh->mName.C_Str(),
+                    node->mName.C_Str());
 
-        // Create SubMeshDescriptor
-        auto submeshName = BuildSubMeshName(node, meshIndex, scene->mNumMeshes);
-        submeshes.emplace_back(
-            submeshName,
-            materialHandle,
-            submeshIndexOffset,
-            mesh->mNumFaces * 3,
-            submeshVertexOffset,
-            mesh->mNumVertices);
+                return;
+            }
 
-        // Update global offsets
-        globalVertexOffset += mesh->mNumVertices;
-        globalIndexOffset += mesh->mNumFaces * 3;
+            LogSuspiciousTransforms(nodeTransform, node->mName.C_Str());
+
+            // Vertices and indices are copied once every offset is known
+            auto& instance = instances.emplace_back();
+            instance.mesh = mesh;
+            instance.vertexOffset = globalVertexOffset;
+            instance.indexOffset = indexCount;
+            std::memcpy(instance.columns, columns, sizeof(instance.columns));
+            indexCount += CountIndices(mesh);
+
+            auto materialHandle = ImportAssimpMaterial(mesh, scene, meshName);
+
+            // Create SubMeshDescriptor
+            auto submeshName = BuildSubMeshName(node, meshIndex, scene->mNumMeshes);
+            submeshes.emplace_back(
+                submeshName,
+                materialHandle,
+                globalIndexOffset,
+                mesh->mNumFaces * 3,
+                globalVertexOffset,
+                mesh->mNumVertices);
 
-        VA_ENGINE_TRACE(
-            "[MeshLoader] Processed submesh '{}' with {} vertices and {} indices.",
-            submeshName,
-            mesh->mNumVertices,
-            mesh->mNumFaces * 3);
-    }
+            // Update global offsets
+            globalVertexOffset += mesh->mNumVertices;
+            globalIndexOffset += mesh->mNumFaces * 3;
 
-    void ProcessNode(
-        const aiNode* node,
-        const aiScene* scene,
-        const std::string& meshName,
-        VAArray<MeshVertex>& vertices,
-        VAArray<uint32_t>& indices,
-        VAArray<Resources::SubMeshDescriptor>& submeshes,
-        const aiMatrix4x4& parentTransform,
-        uint32_t& globalVertexOffset,
-        uint32_t& globalIndexOffset)
-    {
-        // Calculate cumulative transformation
-        auto nodeTransform = parentTransform * node->mTransformation;
-        auto transform = ConvertAssimpMatrix(nodeTransform);
+            VA_ENGINE_TRACE(
+                "[MeshLoader] Processed submesh '{}' with {} vertices and {} indices.",
+                submeshName,
+                mesh->mNumVertices,
+                mesh->mNumFaces * 3);
+        }
 
-        // Process all meshes in this node
-        for (uint32_t i = 0; i < node->mNumMeshes; ++i)
+        /// @brief Walk the node tree in order, giving every mesh instance its output ranges
+        void CollectNode(
+            const aiNode* node,
+            const aiScene* scene,
+            const std::string& meshName,
+            const aiMatrix4x4& parentTransform,
+            VAArray<MeshInstance>& instances,
+            VAArray<Resources::SubMeshDescriptor>& submeshes,
+            uint32_t& globalVertexOffset,
+            uint32_t& globalIndexOffset,
+            uint32_t& indexCount)
         {
-            auto mesh = scene->mMeshes[node->mMeshes[i]];
-            ProcessMesh(
-                mesh,
-                node,
-                i,
-                scene,
-                meshName,
-                vertices,
-                indices,
-                submeshes,
-                transform,
-                globalVertexOffset,
-                globalIndexOffset);
+            // Calculate cumulative transformation
+            auto nodeTransform = parentTransform * node->mTransformation;
+            auto transform = ConvertAssimpMatrix(nodeTransform);
+            float columns[4][4];
+            ToColumns(nodeTransform, columns);
+
+            // Collect all meshes in this node
+            for (uint32_t i = 0; i < node->mNumMeshes; ++i)
+            {
+                auto mesh = scene->mMeshes[node->mMeshes[i]];
+                CollectMeshInstance(
+                    mesh,
+                    node,
+                    i,
+                    scene,
+                    meshName,
+                    transform,
+                    columns,
+                    instances,
+                    submeshes,
+                    globalVertexOffset,
+                    globalIndexOffset,
+                    indexCount);
+            }
+
+            // Recursively collect children
+            for (uint32_t i = 0; i < node->mNumChildren; ++i)
+            {
+                auto child = node->mChildren[i];
+                CollectNode(
+                    child,
+                    scene,
+                    meshName,
+                    nodeTransform,
+                    instances,
+                    submeshes,
+                    globalVertexOffset,
+                    globalIndexOffset,
+                    indexCount);
+            }
         }
+    } // namespace
 
-        // Recursively process children
-        for (uint32_t i = 0; i < node->mNumChildren; ++i)
+    MeshDataDefinition::MeshDataDefinition(
+        VAArray<MeshVertex> vertices,
+        VAArray<uint32_t> indices)
+        : m_Vertices(std::move(vertices)),
+          m_Indices(std::move(indices))
+    {
+        RecalculateBounds();
+    }
+
+    void MeshDataDefinition::RecalculateBounds()
+    {
+        m_Bounds = MeshData::ComputeBounds(m_Vertices);
+        for (auto& submesh : m_Submeshes)
         {
-            auto child = node->mChildren[i];
-            ProcessNode(
-                child,
-                scene,
-                meshName,
-                vertices,
-                indices,
-                submeshes,
-                nodeTransform,
-                globalVertexOffset,
-                globalIndexOffset);
+            if (submesh.GetVertexEnd() > m_Vertices.size()) continue;
+
+            submesh.bounds = MeshData::ComputeBounds(
+                std::span(m_Vertices).subspan(submesh.vertexOffset, submesh.vertexCount));
         }
     }
 
@@ -416,9 +596,8 @@ namespace VoidArchitect::Resources::Loaders
 
     std::shared_ptr<IResourceDefinition> RawMeshLoader::Load(const std::string& name)
     {
-        static constexpr std::string extensions[] = {".gltf", ".fbx", ".obj"};
         std::stringstream ss;
-        for (const auto& extension : extensions)
+        for (const auto& extension : SOURCE_EXTENSIONS)
         {
             ss.str("");
             ss << m_BaseAssetPath << name << extension;
@@ -429,10 +608,80 @@ namespace VoidArchitect::Resources::Loaders
             }
         }
 
+        const auto path = ss.str();
+        if (m_Importer == MeshImporter::Native && NativeMeshImporter::CanImport(path))
+        {
+            if (auto meshData = LoadNative(name, path)) return meshData;
+
+            VA_ENGINE_WARN(
+                "[MeshLoader] Native importer cannot read mesh '{}', falling back to assimp.",
+                name);
+        }
+
+        return LoadWithAssimp(name, path);
+    }
+
+    MeshDataDefinitionPtr RawMeshLoader::LoadNative(
+        const std::string& name,
+        const std::string& path)
+    {
+        ImportedMesh imported;
+        if (!NativeMeshImporter::Import(path, .01f, imported)) return nullptr;
+
+        if (imported.submeshes.empty())
+        {
+            VA_ENGINE_WARN("[MeshLoader] Mesh '{}' has no meshes.", name);
+            return nullptr;
+        }
+
+        // Materials are registered on first use, like on the assimp path
+        VAArray<MaterialHandle> materials(imported.materials.size(), InvalidMaterialHandle);
+        const auto materialHandle = [&](const int32_t index)
+        {
+            if (index < 0) return g_MaterialSystem->GetHandleForDefaultMaterial();
+
+            auto& handle = materials[index];
+            if (handle == InvalidMaterialHandle)
+            {
+                handle = RegisterMaterial(imported.materials[index], name, index);
+            }
+            return handle;
+        };
+
+        auto meshData = std::make_shared<MeshDataDefinition>();
+        for (const auto& submesh : imported.submeshes)
+        {
+            meshData->m_Submeshes.emplace_back(
+                submesh.name,
+                materialHandle(submesh.material),
+                submesh.indexOffset,
+                submesh.indexCount,
+                submesh.vertexOffset,
+                submesh.vertexCount);
+        }
+        meshData->m_Vertices = std::move(imported.vertices);
+        meshData->m_Indices = std::move(imported.indices);
+        meshData->RecalculateBounds();
+
+        VA_ENGINE_TRACE(
+            "[MeshLoader] Loaded mesh '{}' natively with {} submeshes, {} total vertices, {} "
+            "total indices.",
+            name,
+            meshData->m_Submeshes.size(),
+            meshData->m_Vertices.size(),
+            meshData->m_Indices.size());
+
+        return meshData;
+    }
+
+    MeshDataDefinitionPtr RawMeshLoader::LoadWithAssimp(
+        const std::string& name,
+        const std::string& path)
+    {
         Assimp::Importer importer;
         importer.SetPropertyFloat(AI_CONFIG_GLOBAL_SCALE_FACTOR_KEY, .01f);
         const auto scene = importer.ReadFile(
-            ss.str(),
+            path,
             aiProcess_GlobalScale | aiProcess_CalcTangentSpace | aiProcess_Triangulate |
             aiProcess_JoinIdenticalVertices);
 
@@ -454,18 +703,51 @@ namespace VoidArchitect::Resources::Loaders
         auto meshData = new MeshDataDefinition();
         uint32_t globalVertexOffset = 0;
         uint32_t globalIndexOffset = 0;
+        uint32_t indexCount = 0;
         aiMatrix4x4 identityMatrix;
 
-        ProcessNode(
+        // First pass: materials, submeshes and the output ranges of every mesh instance
+        VAArray<MeshInstance> instances;
+        CollectNode(
             scene->mRootNode,
             scene,
             name,
-            meshData->m_Vertices,
-            meshData->m_Indices,
-            meshData->m_Submeshes,
             identityMatrix,
+            instances,
+            meshData->m_Submeshes,
             globalVertexOffset,
-            globalIndexOffset);
+            globalIndexOffset,
+            indexCount);
+
+        // Second pass: transform and copy every instance into its range, in parallel
+        VAArray<ImportTask> tasks;
+        for (uint32_t i = 0; i < instances.size(); ++i)
+        {
+            const auto vertexCount = instances[i].mesh->mNumVertices;
+            for (uint32_t first = 0; first < vertexCount; first += VERTICES_PER_JOB)
+            {
+                tasks.push_back({i, first, std::min(vertexCount, first + VERTICES_PER_JOB)});
+            }
+        }
+
+        meshData->m_Vertices.resize(globalVertexOffset);
+        meshData->m_Indices.resize(indexCount);
+        Jobs::ParallelFor(
+            tasks.size(),
+            [&](const size_t t)
+            {
+                const auto& task = tasks[t];
+                const auto& instance = instances[task.instance];
+                FillVertices(
+                    instance,
+                    task.firstVertex,
+                    task.endVertex,
+                    meshData->m_Vertices.data());
+                if (task.firstVertex == 0) FillIndices(instance, meshData->m_Indices.data());
+            },
+            "ImportMeshInstance");
+
+        meshData->RecalculateBounds();
 
         VA_ENGINE_TRACE(
             "[MeshLoader] Loaded mesh '{}' with {} submeshes, {} total vertices, {} total indices.",
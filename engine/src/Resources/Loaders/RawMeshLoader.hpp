@@ -15,6 +15,11 @@ namespace VoidArchitect::Resources::Loaders
         friend class VAMLoader;
 
     public:
+        MeshDataDefinition() = default;
+
+        /// @brief Definition of generated geometry, without submeshes nor materials
+        MeshDataDefinition(VAArray<MeshVertex> vertices, VAArray<uint32_t> indices);
+
         [[nodiscard]] const VAArray<MeshVertex>& GetVertices() const { return m_Vertices; }
         [[nodiscard]] const VAArray<uint32_t>& GetIndices() const { return m_Indices; }
 
@@ -23,14 +28,47 @@ namespace VoidArchitect::Resources::Loaders
             return m_Submeshes;
         }
 
+        /// @brief Bounds of every vertex of the mesh
+        [[nodiscard]] const Math::Bounds& GetBounds() const { return m_Bounds; }
+
+        /// @brief Compute the mesh bounds and the bounds of every submesh vertex range
+        void RecalculateBounds();
+
+        /// @brief Whether the vertices went through VertexQuantization, the mesh is then
+        ///        uploaded in the compact vertex format without further loss
+        [[nodiscard]] bool HasCompactVertices() const { return m_CompactVertices; }
+
+        /// @brief Meshlets of every submesh, empty if the mesh was not baked with them
+        [[nodiscard]] const VAArray<Meshlet>& GetMeshlets() const { return m_Meshlets; }
+
+        /// @brief Simplified levels of every submesh, empty if the mesh was not baked with them
+        [[nodiscard]] const VAArray<MeshLod>& GetLods() const { return m_Lods; }
+
+        /// @brief Vertices and indices in their GPU layout, straight from the baked file
+        /// @note Only set for meshes read from a VAM file with split vertex streams, the
+        ///       owner is null otherwise.
+        [[nodiscard]] const PackedGeometry& GetPackedGeometry() const { return m_PackedGeometry; }
+
     private:
         VAArray<MeshVertex> m_Vertices;
         VAArray<uint32_t> m_Indices;
         VAArray<Resources::SubMeshDescriptor> m_Submeshes;
+        VAArray<Meshlet> m_Meshlets;
+        VAArray<MeshLod> m_Lods;
+        Math::Bounds m_Bounds;
+        bool m_CompactVertices = false;
+        PackedGeometry m_PackedGeometry;
     };
 
     using MeshDataDefinitionPtr = std::shared_ptr<MeshDataDefinition>;
 
+    /// @brief Backend reading the source files of meshes
+    enum class MeshImporter : uint8_t
+    {
+        Assimp, ///< Every format assimp reads
+        Native ///< NativeMeshImporter for glTF and OBJ, assimp for the other formats
+    };
+
     class RawMeshLoader final : public ILoader
     {
     public:
@@ -38,6 +76,21 @@ namespace VoidArchitect::Resources::Loaders
         ~RawMeshLoader() override = default;
 
         std::shared_ptr<IResourceDefinition> Load(const std::string& name) override;
+
+        /// @brief Pick the backend, files the native importer cannot read still go through
+        ///        assimp
+        void SetImporter(const MeshImporter importer) { m_Importer = importer; }
+
+        MeshImporter GetImporter() const { return m_Importer; }
+
+        /// @brief Extensions of the source files, in the order Load() looks for them
+        static constexpr std::string_view SOURCE_EXTENSIONS[] = {".gltf", ".fbx", ".obj", ".glb"};
+
+    private:
+        MeshImporter m_Importer = MeshImporter::Assimp;
+
+        MeshDataDefinitionPtr LoadWithAssimp(const std::string& name, const std::string& path);
+        MeshDataDefinitionPtr LoadNative(const std::string& name, const std::string& path);
     };
 } // Loaders
 // Resources
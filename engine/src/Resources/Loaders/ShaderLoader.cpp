@@ -4,6 +4,7 @@
 #include "ShaderLoader.hpp"
 
 #include "Core/Logger.hpp"
+#include "Platform/FileSystem/VirtualFileSystem.hpp"
 
 #include <yaml-cpp/yaml.h>
 
@@ -21,20 +22,19 @@ namespace VoidArchitect::Resources::Loaders
     std::shared_ptr<IResourceDefinition> ShaderLoader::Load(const std::string& name)
     {
         const std::string shaderPath = m_BaseAssetPath + name + ".shader";
-        std::ifstream shaderFile(shaderPath, std::ios::ate | std::ios::binary);
+        const auto shaderFile = Platform::VirtualFileSystem::Exists(shaderPath)
+            ? Platform::VirtualFileSystem::Open(shaderPath, Platform::MappedFile::Mode::Read)
+            : nullptr;
 
-        if (!shaderFile.is_open())
+        if (!shaderFile)
         {
             VA_ENGINE_WARN("[ShaderLoader] Failed to load shader {}, at path {}", name, shaderPath);
             return nullptr;
         }
 
-        // Read the shader file into a buffer
-        const std::streamsize fileSize = shaderFile.tellg();
-        VAArray<uint8_t> buffer(fileSize);
-        shaderFile.seekg(0);
-        shaderFile.read(reinterpret_cast<std::istream::char_type*>(buffer.data()), fileSize);
-        shaderFile.close();
+        // Copy the shader code into a buffer
+        const auto code = shaderFile->GetBytes();
+        VAArray<uint8_t> buffer(code.begin(), code.end());
 
         // Parse shader metadata
         const auto config = ParseShaderMetadata(shaderPath);
@@ -53,8 +53,9 @@ namespace VoidArchitect::Resources::Loaders
             yamlPath.replace(yamlPath.find(".shader"), 7, ".yaml");
         }
 
-        // Check that the YAML file exists
-        if (!std::filesystem::exists(yamlPath))
+        // Check that the YAML file exists, in an asset pack or on the disk
+        const auto yamlText = Platform::VirtualFileSystem::ReadText(yamlPath);
+        if (!yamlText)
         {
             VA_ENGINE_WARN("[ShaderLoader] Shader metadata file '{}' does not exist.", yamlPath);
             return InferMetadataFromFilename(path);
@@ -63,7 +64,7 @@ namespace VoidArchitect::Resources::Loaders
         // Load and parse the YAML file
         try
         {
-            auto config = YAML::LoadFile(yamlPath);
+            auto config = YAML::Load(*yamlText);
             ShaderConfig metadata;
 
             if (config["shader"])
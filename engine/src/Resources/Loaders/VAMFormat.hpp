@@ -4,26 +4,101 @@
 #pragma once
 
 #include "Core/Core.hpp"
+#include "Core/Math/Bounds.hpp"
 #include "Core/Math/Vec2.hpp"
 #include "Core/Math/Vec3.hpp"
 #include "Core/Math/Vec4.hpp"
+#include "Resources/MeshLod.hpp"
+#include "Resources/Meshlet.hpp"
+#include "Resources/VertexStreams.hpp"
 
 namespace VoidArchitect::Resources::Loaders
 {
     // VAM = "Void Architect Mesh" - Custom binary mesh format
 
     // Current format version
-    static constexpr uint32_t VAM_VERSION = 1;
+    // - 1: initial format
+    // - 2: mesh bounds in the header, submesh bounds in the submesh descriptors
+    // - 3: vertices may be stored as CompactVertex (VAMFlags::CompactVertices)
+    // - 4: indices may be stored as uint16_t (VAMFlags::ShortIndices)
+    // - 5: meshlet section after the resource bindings
+    // - 6: LOD section after the meshlets, LOD indices at the end of the index section
+    // - 7: vertex section split in two streams, every position then every other attribute
+    // - 8: string table padded to VAM_SECTION_ALIGNMENT, the vertex section is aligned
+    // - 9: compressed sections split in independent chunks, see VAMChunkTable
+    // - 10: chunk table names its LZ4 dictionary, chunks name the filter of their section
+    static constexpr uint32_t VAM_VERSION = 10;
+    static constexpr uint32_t VAM_MIN_SUPPORTED_VERSION = 1;
     static constexpr uint8_t VAM_MAGIC[4] = {'V', 'A', 'M', '\0'};
 
+    // Alignment of the vertex section from version 8, in the file and in the decompressed data,
+    // so that a mapped file is read in place. The index section follows whole vertices and is
+    // aligned for its type as well.
+    static constexpr size_t VAM_SECTION_ALIGNMENT = 16;
+
+    // LZ4 dictionary of small files, written by VAMLoader::TrainDictionary() and registered by
+    // VAMLoader from the cache directory.
+    static constexpr auto VAM_DICTIONARY_FILE_NAME = "vam.dict";
+
+    // Cache manifest of the cache directory, see VAMCacheManifest
+    // Manifest versions:
+    // - 1: initial format
+    // - 2: header names the LZ4 dictionary of the cache
+    static constexpr auto VAM_MANIFEST_FILE_NAME = "vam.manifest";
+    static constexpr uint8_t VAM_MANIFEST_MAGIC[4] = {'V', 'A', 'C', '\0'};
+    static constexpr uint32_t VAM_MANIFEST_VERSION = 2;
+
+    // Size of the version 1 manifest header, which is a prefix of the current one
+    static constexpr size_t VAM_MANIFEST_HEADER_SIZE_V1 = 24;
+
+    // Size of the version 1 header, which is a prefix of the current one
+    static constexpr size_t VAM_HEADER_SIZE_V1 = 96;
+
+    // Sizes and offsets in the header are 32-bit, the header and every section must fit them
+    static constexpr uint64_t VAM_MAX_FILE_SIZE = std::numeric_limits<uint32_t>::max();
+
+    // Bounding volumes - 40 bytes
+    struct VAMBounds
+    {
+        float min[3]; // AABB minimum corner
+        float max[3]; // AABB maximum corner
+        float center[3]; // Bounding sphere center
+        float radius; // Bounding sphere radius
+
+        VAMBounds() = default;
+
+        explicit VAMBounds(const Math::Bounds& bounds)
+            : min{bounds.min.X(), bounds.min.Y(), bounds.min.Z()},
+              max{bounds.max.X(), bounds.max.Y(), bounds.max.Z()},
+              center{bounds.center.X(), bounds.center.Y(), bounds.center.Z()},
+              radius(bounds.radius)
+        {
+        }
+
+        [[nodiscard]] Math::Bounds ToBounds() const
+        {
+            Math::Bounds bounds;
+            bounds.min = Math::Vec3(min[0], min[1], min[2]);
+            bounds.max = Math::Vec3(max[0], max[1], max[2]);
+            bounds.center = Math::Vec3(center[0], center[1], center[2]);
+            bounds.radius = radius;
+            return bounds;
+        }
+    };
+
     enum class VAMFlags : uint32_t
     {
         None = 0,
-        Compressed = BIT(0), // LZ4 compression (not implemented)
-        // Reserved bits 1-31 for future features
+        // Sections after the header are LZ4 compressed. From version 9 on, the block starts
+        // with a VAMChunkTable and each chunk is compressed on its own. Version 10 adds the
+        // dictionary and the chunk filters.
+        Compressed = BIT(0),
+        CompactVertices = BIT(1), // Vertex section holds CompactVertex instead of VAMVertex
+        ShortIndices = BIT(2), // Index section holds uint16_t instead of uint32_t
+        // Reserved bits 3-31 for future features
     };
 
-    // Main header - 80 bytes, 16-bytes aligned
+    // Main header - 144 bytes, 16-bytes aligned
     struct alignas(16) VAMHeader
     {
         uint8_t magic[4]; // VAM\0
@@ -57,17 +132,68 @@ namespace VoidArchitect::Resources::Loaders
         uint32_t originalMaterialsSize;
         uint32_t originalBindingsSize;
 
+        // --- Version 2 ---
+        VAMBounds bounds; // Bounds of the whole mesh
+        uint32_t meshletCount; // Number of VAMMeshlet in the meshlet section (version 5)
+        uint32_t lodCount; // Number of VAMLod in the LOD section (version 6)
+
         // Validation helpers
         [[nodiscard]] bool IsValid() const
         {
-            return memcmp(magic, VAM_MAGIC, 4) == 0 && version == VAM_VERSION;
+            return memcmp(magic, VAM_MAGIC, 4) == 0 && version >= VAM_MIN_SUPPORTED_VERSION &&
+                version <= VAM_VERSION;
         }
 
+        [[nodiscard]] bool HasBounds() const { return version >= 2; }
+
+        // Earlier versions left meshletCount reserved
+        [[nodiscard]] uint32_t GetMeshletCount() const { return version >= 5 ? meshletCount : 0; }
+
+        // Earlier versions left lodCount reserved
+        [[nodiscard]] uint32_t GetLodCount() const { return version >= 6 ? lodCount : 0; }
+
+        // Size of the header in a file of this version
+        [[nodiscard]] size_t GetSize() const
+        {
+            return version >= 2 ? sizeof(VAMHeader) : VAM_HEADER_SIZE_V1;
+        }
+
+        // Size of one submesh descriptor in a file of this version
+        [[nodiscard]] size_t GetSubMeshDescriptorSize() const;
+
         [[nodiscard]] bool IsCompressed() const
         {
             return (flags & static_cast<uint32_t>(VAMFlags::Compressed)) != 0;
         }
 
+        [[nodiscard]] bool HasCompactVertices() const
+        {
+            return (flags & static_cast<uint32_t>(VAMFlags::CompactVertices)) != 0;
+        }
+
+        [[nodiscard]] bool HasShortIndices() const
+        {
+            return (flags & static_cast<uint32_t>(VAMFlags::ShortIndices)) != 0;
+        }
+
+        // Earlier versions interleave the vertices, see Resources::VertexStreams
+        [[nodiscard]] bool HasSplitVertexStreams() const { return version >= 7; }
+
+        // Earlier versions compress every section as a single LZ4 block
+        [[nodiscard]] bool HasCompressedChunks() const { return version >= 9; }
+
+        // Earlier versions use the shorter version 9 chunk table and chunks
+        [[nodiscard]] bool HasChunkFilters() const { return version >= 10; }
+
+        // Size of one vertex in the vertex section, all streams included
+        [[nodiscard]] size_t GetVertexSize() const;
+
+        // Size of one index in the index section
+        [[nodiscard]] size_t GetIndexSize() const
+        {
+            return HasShortIndices() ? sizeof(uint16_t) : sizeof(uint32_t);
+        }
+
         [[nodiscard]] float GetCompressionRatio() const
         {
             return static_cast<float>(compressionRatio) / 1000.0f;
@@ -102,8 +228,8 @@ namespace VoidArchitect::Resources::Loaders
         }
     };
 
-    // SubMesh descriptor - 32 bytes, aligned
-    struct alignas(16) VAMSubMeshDescriptor
+    // SubMesh descriptor of version 1 files - 32 bytes, aligned
+    struct alignas(16) VAMSubMeshDescriptorV1
     {
         uint32_t nameOffset; // Offset in the string table
         uint32_t materialIndex; // Index in the materials array (not handle !)
@@ -112,9 +238,32 @@ namespace VoidArchitect::Resources::Loaders
         uint32_t vertexOffset;
         uint32_t vertexCount;
         uint64_t reserved; // For future use
+    };
+
+    // SubMesh descriptor - 64 bytes, aligned
+    struct alignas(16) VAMSubMeshDescriptor
+    {
+        uint32_t nameOffset; // Offset in the string table
+        uint32_t materialIndex; // Index in the materials array (not handle !)
+        uint32_t indexOffset;
+        uint32_t indexCount;
+        uint32_t vertexOffset;
+        uint32_t vertexCount;
+        VAMBounds bounds; // Bounds of the submesh vertex range (version 2)
 
         VAMSubMeshDescriptor() = default;
 
+        explicit VAMSubMeshDescriptor(const VAMSubMeshDescriptorV1& v1)
+            : nameOffset(v1.nameOffset),
+              materialIndex(v1.materialIndex),
+              indexOffset(v1.indexOffset),
+              indexCount(v1.indexCount),
+              vertexOffset(v1.vertexOffset),
+              vertexCount(v1.vertexCount),
+              bounds(Math::Bounds{})
+        {
+        }
+
         VAMSubMeshDescriptor(
             const uint32_t nameOff,
             const uint32_t matIdx,
@@ -128,8 +277,73 @@ namespace VoidArchitect::Resources::Loaders
               indexCount(idxCnt),
               vertexOffset(vtxOff),
               vertexCount(vtxCnt),
-              reserved{}
+              bounds{}
+        {
+        }
+    };
+
+    // Meshlet - 48 bytes, matches engine Meshlet
+    struct VAMMeshlet
+    {
+        uint32_t indexOffset; // First index in the index section
+        uint32_t triangleCount;
+        uint32_t vertexCount;
+        uint32_t submeshIndex;
+        float center[3]; // Bounding sphere center
+        float radius; // Bounding sphere radius
+        float coneAxis[3]; // Normal cone axis
+        float coneCutoff; // Normal cone cutoff, 1 disables backface culling
+
+        VAMMeshlet() = default;
+
+        explicit VAMMeshlet(const Meshlet& meshlet)
+            : indexOffset(meshlet.indexOffset),
+              triangleCount(meshlet.triangleCount),
+              vertexCount(meshlet.vertexCount),
+              submeshIndex(meshlet.submeshIndex),
+              center{meshlet.center.X(), meshlet.center.Y(), meshlet.center.Z()},
+              radius(meshlet.radius),
+              coneAxis{meshlet.coneAxis.X(), meshlet.coneAxis.Y(), meshlet.coneAxis.Z()},
+              coneCutoff(meshlet.coneCutoff)
+        {
+        }
+
+        [[nodiscard]] Meshlet ToMeshlet() const
         {
+            Meshlet meshlet;
+            meshlet.indexOffset = indexOffset;
+            meshlet.triangleCount = triangleCount;
+            meshlet.vertexCount = vertexCount;
+            meshlet.submeshIndex = submeshIndex;
+            meshlet.center = Math::Vec3(center[0], center[1], center[2]);
+            meshlet.radius = radius;
+            meshlet.coneAxis = Math::Vec3(coneAxis[0], coneAxis[1], coneAxis[2]);
+            meshlet.coneCutoff = coneCutoff;
+            return meshlet;
+        }
+    };
+
+    // Simplified level of a submesh - 16 bytes, matches engine MeshLod
+    struct VAMLod
+    {
+        uint32_t submeshIndex;
+        uint32_t indexOffset; // First index in the index section
+        uint32_t indexCount;
+        float error; // Object-space error
+
+        VAMLod() = default;
+
+        explicit VAMLod(const MeshLod& lod)
+            : submeshIndex(lod.submeshIndex),
+              indexOffset(lod.indexOffset),
+              indexCount(lod.indexCount),
+              error(lod.error)
+        {
+        }
+
+        [[nodiscard]] MeshLod ToLod() const
+        {
+            return {indexOffset, indexCount, error, submeshIndex};
         }
     };
 
@@ -177,6 +391,73 @@ namespace VoidArchitect::Resources::Loaders
         }
     };
 
+    // Reversible transform of a chunk before compression. Lanes are the 2 or 4-byte values of
+    // the section, grouping the bytes of each lane by significance puts the slowly changing
+    // sign and exponent bytes of floats next to each other.
+    enum class VAMFilter : uint8_t
+    {
+        None = 0,
+        Shuffle = 1, // Byte 0 of every lane, then byte 1 of every lane, ...
+        Delta = 2, // Each lane minus the same lane of the previous element, then Shuffle
+    };
+
+    // Start of the compressed block of version 9 files, followed by chunkCount VAMChunk then
+    // by the compressed bytes of every chunk
+    struct VAMChunkTable
+    {
+        uint32_t chunkCount;
+        uint32_t chunkSize; // Largest uncompressed size of a chunk
+
+        // --- Version 10 ---
+        uint32_t dictionaryId; // LZ4 dictionary of every chunk, 0 for none
+        uint32_t reserved;
+    };
+
+    // Part of a section compressed on its own - 20 bytes. Chunks never straddle two sections,
+    // each one is decompressed straight to its place in the decompressed sections.
+    struct VAMChunk
+    {
+        uint32_t uncompressedOffset; // Offset in the decompressed sections
+        uint32_t uncompressedSize;
+        uint32_t compressedOffset; // Offset after the chunk table
+        uint32_t compressedSize; // Equal to uncompressedSize if the chunk is stored as is
+
+        // --- Version 10 ---
+        VAMFilter filter; // Always None for chunks stored as is
+        uint8_t laneSize; // Bytes per lane, 2 or 4
+        uint16_t elementSize; // Bytes per element, the Delta distance
+    };
+
+    // Sizes of the chunk table and of one chunk in version 9 files, prefixes of the current ones
+    static constexpr size_t VAM_CHUNK_TABLE_SIZE_V9 = 8;
+    static constexpr size_t VAM_CHUNK_SIZE_V9 = 16;
+
+    // Cache manifest header - 32 bytes, followed by the entries then the string table
+    struct VAMManifestHeader
+    {
+        uint8_t magic[4]; // VAM_MANIFEST_MAGIC
+        uint32_t version; // VAM_MANIFEST_VERSION
+        uint32_t entryCount;
+        uint32_t stringTableSize;
+        uint64_t checksum; // XXH64 of the entries and the string table
+        uint32_t dictionaryId; // VAM_DICTIONARY_FILE_NAME the entries were baked with, 0 for none
+        uint32_t reserved;
+    };
+
+    // Baked asset recorded by the cache manifest - 48 bytes. Paths are relative so that the
+    // cache survives moving the checkout.
+    struct VAMManifestEntry
+    {
+        uint32_t nameOffset; // Asset name, offset in the string table
+        uint32_t vamFileOffset; // VAM file, relative to the cache directory
+        uint32_t sourceOffset; // Source file, relative to the asset directory, may be empty
+        uint32_t reserved;
+        uint64_t sourceHash; // XXH64 of the source file
+        uint64_t settingsHash; // Hash of the bake settings, see VAMCacheManifest
+        uint64_t sourceSize; // Size and write time of the source when it was last hashed
+        int64_t sourceTime;
+    };
+
     // String table entry helper
     struct VAMStringEntry
     {
@@ -184,12 +465,62 @@ namespace VoidArchitect::Resources::Loaders
         std::string data;
     };
 
+    inline size_t VAMHeader::GetVertexSize() const
+    {
+        return HasCompactVertices() ? sizeof(CompactVertex) : sizeof(VAMVertex);
+    }
+
+    inline size_t VAMHeader::GetSubMeshDescriptorSize() const
+    {
+        return version >= 2 ? sizeof(VAMSubMeshDescriptor) : sizeof(VAMSubMeshDescriptorV1);
+    }
+
+    /// @brief Whether sections of these sizes fit the 32-bit sizes and offsets of a VAM file,
+    ///        once written after the header
+    inline bool FitsVAMFile(const std::span<const uint64_t> sectionSizes)
+    {
+        uint64_t fileSize = sizeof(VAMHeader);
+        for (const auto sectionSize : sectionSizes)
+        {
+            fileSize += sectionSize;
+            if (fileSize > VAM_MAX_FILE_SIZE) return false;
+        }
+        return true;
+    }
+
     // Memory layout verification
-    static_assert(sizeof(VAMHeader) == 96, "VAMHeader must be exactly 96 bytes");
+    static_assert(sizeof(VAMBounds) == 40, "VAMBounds must be exactly 40 bytes");
+    static_assert(sizeof(VAMHeader) == 144, "VAMHeader must be exactly 144 bytes");
+    static_assert(
+        sizeof(VAMHeader) % VAM_SECTION_ALIGNMENT == 0,
+        "Padding the string table must align the section after it");
+    static_assert(
+        offsetof(VAMHeader, bounds) == VAM_HEADER_SIZE_V1,
+        "Version 2 header fields must follow the version 1 header");
     static_assert(sizeof(VAMVertex) == 48, "VAMVertex must be exactly 48 bytes");
     static_assert(
-        sizeof(VAMSubMeshDescriptor) == 32,
-        "VAMSubMeshDescriptor must be exactly 32 bytes");
+        sizeof(VertexPosition) + sizeof(VertexAttributes) == sizeof(VAMVertex) &&
+        sizeof(VertexPosition) + sizeof(CompactVertexAttributes) == sizeof(CompactVertex),
+        "Split vertex streams must keep the size of the vertex section");
+    static_assert(sizeof(VAMMeshlet) == 48, "VAMMeshlet must be exactly 48 bytes");
+    static_assert(sizeof(VAMLod) == 16, "VAMLod must be exactly 16 bytes");
+    static_assert(sizeof(VAMChunkTable) == 16, "VAMChunkTable must be exactly 16 bytes");
+    static_assert(sizeof(VAMChunk) == 20, "VAMChunk must be exactly 20 bytes");
+    static_assert(sizeof(VAMManifestHeader) == 32, "VAMManifestHeader must be exactly 32 bytes");
+    static_assert(
+        offsetof(VAMManifestHeader, dictionaryId) == VAM_MANIFEST_HEADER_SIZE_V1,
+        "Version 2 manifest fields must follow the version 1 ones");
+    static_assert(sizeof(VAMManifestEntry) == 48, "VAMManifestEntry must be exactly 48 bytes");
+    static_assert(
+        offsetof(VAMChunkTable, dictionaryId) == VAM_CHUNK_TABLE_SIZE_V9 &&
+        offsetof(VAMChunk, filter) == VAM_CHUNK_SIZE_V9,
+        "Version 10 chunk fields must follow the version 9 ones");
+    static_assert(
+        sizeof(VAMSubMeshDescriptorV1) == 32,
+        "VAMSubMeshDescriptorV1 must be exactly 32 bytes");
+    static_assert(
+        sizeof(VAMSubMeshDescriptor) == 64,
+        "VAMSubMeshDescriptor must be exactly 64 bytes");
     static_assert(alignof(VAMHeader) == 16, "VAMHeader must be 16-byte aligned");
     static_assert(alignof(VAMVertex) == 16, "VAMVertex must be 16-byte aligned");
     static_assert(
@@ -0,0 +1,256 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "VamCacheManifest.hpp"
+
+#include "Core/Hash.hpp"
+#include "Core/Logger.hpp"
+#include "Platform/FileSystem/VirtualFileSystem.hpp"
+
+#include <cstring>
+#include <filesystem>
+
+namespace VoidArchitect::Resources::Loaders
+{
+    namespace
+    {
+        /// @brief String at offset in the string table, empty if the offset is out of bounds
+        std::string ReadString(const std::span<const uint8_t> stringTable, const uint32_t offset)
+        {
+            if (offset >= stringTable.size()) return {};
+
+            const auto* begin = reinterpret_cast<const char*>(stringTable.data() + offset);
+            const auto* end = static_cast<const char*>(
+                std::memchr(begin, '\0', stringTable.size() - offset));
+            return end ? std::string(begin, end) : std::string();
+        }
+
+        uint32_t WriteString(const std::string& str, VAArray<uint8_t>& stringTable)
+        {
+            const auto offset = static_cast<uint32_t>(stringTable.size());
+            stringTable.insert(stringTable.end(), str.begin(), str.end());
+            stringTable.push_back('\0');
+            return offset;
+        }
+    } // namespace
+
+    bool VAMCacheManifest::Load(const std::string& path)
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_Entries.clear();
+        m_DictionaryId = 0;
+
+        if (!Platform::VirtualFileSystem::Exists(path)) return false;
+
+        // Read rather than mapped, Save() must be able to replace a loose file right after
+        const auto file = Platform::VirtualFileSystem::Open(
+            path,
+            Platform::MappedFile::Mode::Read);
+        if (!file || file->GetSize() < VAM_MANIFEST_HEADER_SIZE_V1)
+        {
+            VA_ENGINE_WARN("[VAMCacheManifest] Cannot read manifest '{}'.", path);
+            return false;
+        }
+
+        // Version 1 headers are a prefix of the current one, without a dictionary
+        const auto bytes = file->GetBytes();
+        VAMManifestHeader header{};
+        std::memcpy(&header, bytes.data(), VAM_MANIFEST_HEADER_SIZE_V1);
+        const auto headerSize = header.version == 1
+            ? VAM_MANIFEST_HEADER_SIZE_V1
+            : sizeof(VAMManifestHeader);
+        if (std::memcmp(header.magic, VAM_MANIFEST_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version < 1 || header.version > VAM_MANIFEST_VERSION ||
+            bytes.size() < headerSize)
+        {
+            VA_ENGINE_WARN("[VAMCacheManifest] Unsupported manifest '{}'.", path);
+            return false;
+        }
+        std::memcpy(&header, bytes.data(), headerSize);
+
+        const auto body = bytes.subspan(headerSize);
+        const auto entriesSize = static_cast<uint64_t>(header.entryCount) *
+            sizeof(VAMManifestEntry);
+        if (body.size() != entriesSize + header.stringTableSize ||
+            XXHash64::Hash(body) != header.checksum)
+        {
+            VA_ENGINE_WARN("[VAMCacheManifest] Corrupted manifest '{}'.", path);
+            return false;
+        }
+
+        const auto stringTable = body.subspan(entriesSize);
+        m_Entries.reserve(header.entryCount);
+        for (uint32_t i = 0; i < header.entryCount; ++i)
+        {
+            VAMManifestEntry stored{};
+            std::memcpy(&stored, body.data() + i * sizeof(stored), sizeof(stored));
+
+            Entry entry;
+            entry.vamFile = ReadString(stringTable, stored.vamFileOffset);
+            entry.sourceFile = ReadString(stringTable, stored.sourceOffset);
+            entry.sourceHash = stored.sourceHash;
+            entry.settingsHash = stored.settingsHash;
+            entry.sourceSize = stored.sourceSize;
+            entry.sourceTime = stored.sourceTime;
+            m_Entries.insert_or_assign(ReadString(stringTable, stored.nameOffset), std::move(entry));
+        }
+        m_DictionaryId = header.dictionaryId;
+
+        return true;
+    }
+
+    bool VAMCacheManifest::Save(const std::string& path) const
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        VAArray<uint8_t> body(m_Entries.size() * sizeof(VAMManifestEntry));
+        VAArray<uint8_t> stringTable;
+        size_t index = 0;
+        for (const auto& [name, entry] : m_Entries)
+        {
+            VAMManifestEntry stored{};
+            stored.nameOffset = WriteString(name, stringTable);
+            stored.vamFileOffset = WriteString(entry.vamFile, stringTable);
+            stored.sourceOffset = WriteString(entry.sourceFile, stringTable);
+            stored.sourceHash = entry.sourceHash;
+            stored.settingsHash = entry.settingsHash;
+            stored.sourceSize = entry.sourceSize;
+            stored.sourceTime = entry.sourceTime;
+            std::memcpy(body.data() + index++ * sizeof(stored), &stored, sizeof(stored));
+        }
+        body.insert(body.end(), stringTable.begin(), stringTable.end());
+
+        VAMManifestHeader header{};
+        std::memcpy(header.magic, VAM_MANIFEST_MAGIC, sizeof(header.magic));
+        header.version = VAM_MANIFEST_VERSION;
+        header.entryCount = static_cast<uint32_t>(m_Entries.size());
+        header.stringTableSize = static_cast<uint32_t>(stringTable.size());
+        header.checksum = XXHash64::Hash(body);
+        header.dictionaryId = m_DictionaryId;
+
+        // Write a temporary file and rename it over the manifest, a reader sees either file
+        const auto temporaryPath = path + ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(body.data()), body.size());
+            file.close();
+            if (file.fail())
+            {
+                VA_ENGINE_WARN("[VAMCacheManifest] Failed to write '{}'.", temporaryPath);
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, path, error);
+        if (error)
+        {
+            VA_ENGINE_WARN("[VAMCacheManifest] Failed to replace '{}': {}", path, error.message());
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+        return true;
+    }
+
+    std::optional<VAMCacheManifest::Entry> VAMCacheManifest::Find(const std::string& name) const
+    {
+        std::scoped_lock lock(m_Mutex);
+        const auto it = m_Entries.find(name);
+        if (it == m_Entries.end()) return std::nullopt;
+        return it->second;
+    }
+
+    void VAMCacheManifest::Record(const std::string& name, Entry entry)
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_Entries.insert_or_assign(name, std::move(entry));
+    }
+
+    bool VAMCacheManifest::Remove(const std::string& name)
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Entries.erase(name) > 0;
+    }
+
+    size_t VAMCacheManifest::GetSize() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Entries.size();
+    }
+
+    uint32_t VAMCacheManifest::GetDictionaryId() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_DictionaryId;
+    }
+
+    void VAMCacheManifest::SetDictionaryId(const uint32_t dictionaryId)
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_DictionaryId = dictionaryId;
+    }
+
+    bool VAMCacheManifest::HashSource(const std::string& sourcePath, Entry& entry)
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(sourcePath, error);
+        if (error) return false;
+        const auto time = std::filesystem::last_write_time(sourcePath, error);
+        if (error) return false;
+
+        if (size == 0)
+        {
+            entry.sourceHash = XXHash64::Hash(std::span<const uint8_t>{});
+        }
+        else
+        {
+            const auto file = Platform::MappedFile::Open(sourcePath);
+            if (!file) return false;
+            entry.sourceHash = XXHash64::Hash(file->GetBytes());
+        }
+
+        entry.sourceSize = size;
+        entry.sourceTime = static_cast<int64_t>(time.time_since_epoch().count());
+        return true;
+    }
+
+    VAMCacheManifest::SourceState VAMCacheManifest::CheckSource(
+        const std::string& sourcePath,
+        Entry& entry)
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(sourcePath, error);
+        if (error) return SourceState::Missing;
+        const auto time = std::filesystem::last_write_time(sourcePath, error);
+        if (error) return SourceState::Missing;
+
+        if (size == entry.sourceSize &&
+            static_cast<int64_t>(time.time_since_epoch().count()) == entry.sourceTime)
+        {
+            return SourceState::Unchanged;
+        }
+
+        // A fresh checkout or a copy changes the time alone, only the content decides
+        const auto previousHash = entry.sourceHash;
+        if (!HashSource(sourcePath, entry)) return SourceState::Missing;
+        return entry.sourceHash == previousHash ? SourceState::Touched : SourceState::Modified;
+    }
+
+    uint64_t VAMCacheManifest::HashSettings(const VAMCompressionSettings& settings)
+    {
+        // Field by field, the padding of the structure is not initialized
+        auto hash = XXHash64::HashValue(VAM_VERSION);
+        hash = XXHash64::HashValue(settings.enableCompression, hash);
+        hash = XXHash64::HashValue(settings.minCompressionRatio, hash);
+        hash = XXHash64::HashValue(settings.minSizeThreshold, hash);
+        hash = XXHash64::HashValue(settings.compressionLevel, hash);
+        hash = XXHash64::HashValue(settings.chunkSize, hash);
+        hash = XXHash64::HashValue(settings.filterVertexStreams, hash);
+        hash = XXHash64::HashValue(settings.dictionaryId, hash);
+        hash = XXHash64::HashValue(settings.dictionaryMaxSize, hash);
+        hash = XXHash64::HashValue(settings.compactVertices, hash);
+        hash = XXHash64::HashValue(settings.compactVerticesMaxUV, hash);
+        return hash;
+    }
+} // namespace VoidArchitect::Resources::Loaders
@@ -0,0 +1,88 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <mutex>
+
+#include "VamCompression.hpp"
+
+namespace VoidArchitect::Resources::Loaders
+{
+    /// @brief Index of the VAM cache: which source and settings every baked file comes from
+    ///
+    /// Read once when the loader starts, then a cached asset is found with a single lookup by
+    /// name, without probing the source extensions. Entries remember the XXH64 of the source
+    /// content, so that a source which was only touched, or copied along with a checkout, does
+    /// not invalidate its VAM file: the content is hashed again only when its size or write
+    /// time changed. The settings hash invalidates every entry baked with other settings or an
+    /// older format.
+    ///
+    /// Entries can be found and recorded from several threads.
+    class VAMCacheManifest
+    {
+    public:
+        struct Entry
+        {
+            std::string vamFile; ///< Relative to the cache directory
+            std::string sourceFile; ///< Relative to the asset directory, empty if unknown
+            uint64_t sourceHash = 0;
+            uint64_t settingsHash = 0;
+            uint64_t sourceSize = 0;
+            int64_t sourceTime = 0;
+        };
+
+        /// @brief How much a cached entry is checked against its source
+        enum class Validation : uint8_t
+        {
+            Trust, ///< Never access the sources, an entry is valid if its settings match
+            CheckSources ///< Stat every source, hash it again if its size or time changed
+        };
+
+        /// @brief State of a source compared to its entry, see CheckSource()
+        enum class SourceState : uint8_t
+        {
+            Unchanged, ///< Same size and write time
+            Touched, ///< Size or time changed, same content, the entry is refreshed
+            Modified, ///< Different content
+            Missing ///< The source cannot be read, runtime-only builds ship without them
+        };
+
+        /// @brief Replace the entries with those of a manifest file
+        /// @return false if the file is missing or invalid, the manifest is then empty
+        bool Load(const std::string& path);
+
+        /// @brief Write the entries to a file, replaced at once so a crash cannot truncate it
+        bool Save(const std::string& path) const;
+
+        [[nodiscard]] std::optional<Entry> Find(const std::string& name) const;
+
+        /// @brief Add or replace the entry of an asset
+        void Record(const std::string& name, Entry entry);
+
+        /// @brief Remove the entry of an asset, true if it was present
+        bool Remove(const std::string& name);
+
+        [[nodiscard]] size_t GetSize() const;
+
+        /// @brief LZ4 dictionary the entries were baked with, 0 for none
+        [[nodiscard]] uint32_t GetDictionaryId() const;
+        void SetDictionaryId(uint32_t dictionaryId);
+
+        /// @brief Fill the hash, size and time of an entry from its source file
+        /// @return false if the source cannot be read
+        static bool HashSource(const std::string& sourcePath, Entry& entry);
+
+        /// @brief Compare a source file with its entry, hashing it only if its stat changed
+        /// @note The size and time of a Touched entry are updated, record it again.
+        static SourceState CheckSource(const std::string& sourcePath, Entry& entry);
+
+        /// @brief Hash every setting that changes the baked bytes, and the VAM version
+        static uint64_t HashSettings(const VAMCompressionSettings& settings);
+
+    private:
+        mutable std::mutex m_Mutex;
+        VAHashMap<std::string, Entry> m_Entries;
+        uint32_t m_DictionaryId = 0;
+    };
+} // namespace VoidArchitect::Resources::Loaders
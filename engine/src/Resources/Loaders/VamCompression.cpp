@@ -4,12 +4,231 @@
 #include "VamCompression.hpp"
 
 #include <lz4.h>
+#include <lz4hc.h>
+
+#include <atomic>
+#include <ranges>
 
 #include "Core/Logger.hpp"
+#include "Platform/FileSystem/VirtualFileSystem.hpp"
+#include "Systems/Jobs/ParallelFor.hpp"
+#include "VAMFormat.hpp"
 
 namespace VoidArchitect::Resources::Loaders
 {
+    namespace
+    {
+        /// @brief FNV-1a, names dictionaries and the byte runs they are trained on
+        uint64_t HashBytes(const std::span<const uint8_t> bytes)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (const auto byte : bytes)
+            {
+                hash ^= byte;
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        bool IsValidFilter(
+            const VAMFilter filter,
+            const uint8_t laneSize,
+            const uint16_t elementSize)
+        {
+            switch (filter)
+            {
+                case VAMFilter::None:
+                    return true;
+                case VAMFilter::Shuffle:
+                    return laneSize == 2 || laneSize == 4;
+                case VAMFilter::Delta:
+                    return (laneSize == 2 || laneSize == 4) && elementSize > 0 &&
+                        elementSize % laneSize == 0;
+            }
+            return false;
+        }
+
+        /// @brief Apply a Shuffle or Delta filter to a chunk, bytes past the last lane are kept
+        template <typename Lane>
+        void EncodeLanes(
+            const std::span<const uint8_t> chunk,
+            const VAMFilter filter,
+            const uint16_t elementSize,
+            const std::span<uint8_t> output)
+        {
+            constexpr size_t LANE_SIZE = sizeof(Lane);
+            const auto laneCount = chunk.size() / LANE_SIZE;
+            const auto distance = filter == VAMFilter::Delta ? elementSize / LANE_SIZE : 0;
+            for (size_t i = 0; i < laneCount; ++i)
+            {
+                Lane lane;
+                memcpy(&lane, chunk.data() + i * LANE_SIZE, LANE_SIZE);
+                if (distance > 0 && i >= distance)
+                {
+                    Lane previous;
+                    memcpy(&previous, chunk.data() + (i - distance) * LANE_SIZE, LANE_SIZE);
+                    lane = static_cast<Lane>(lane - previous);
+                }
+                for (size_t byte = 0; byte < LANE_SIZE; ++byte)
+                {
+                    output[byte * laneCount + i] = static_cast<uint8_t>(lane >> (8 * byte));
+                }
+            }
+
+            const auto tail = laneCount * LANE_SIZE;
+            memcpy(output.data() + tail, chunk.data() + tail, chunk.size() - tail);
+        }
+
+        /// @brief Inverse of EncodeLanes()
+        template <typename Lane>
+        void DecodeLanes(
+            const std::span<const uint8_t> filtered,
+            const VAMFilter filter,
+            const uint16_t elementSize,
+            const std::span<uint8_t> chunk)
+        {
+            constexpr size_t LANE_SIZE = sizeof(Lane);
+            const auto laneCount = filtered.size() / LANE_SIZE;
+            const auto distance = filter == VAMFilter::Delta ? elementSize / LANE_SIZE : 0;
+            for (size_t i = 0; i < laneCount; ++i)
+            {
+                Lane lane = 0;
+                for (size_t byte = 0; byte < LANE_SIZE; ++byte)
+                {
+                    lane |= static_cast<Lane>(filtered[byte * laneCount + i] << (8 * byte));
+                }
+                if (distance > 0 && i >= distance)
+                {
+                    // Earlier lanes are already restored
+                    Lane previous;
+                    memcpy(&previous, chunk.data() + (i - distance) * LANE_SIZE, LANE_SIZE);
+                    lane = static_cast<Lane>(lane + previous);
+                }
+                memcpy(chunk.data() + i * LANE_SIZE, &lane, LANE_SIZE);
+            }
+
+            const auto tail = laneCount * LANE_SIZE;
+            memcpy(chunk.data() + tail, filtered.data() + tail, filtered.size() - tail);
+        }
+
+        void EncodeChunk(
+            const VAMChunk& chunk,
+            const std::span<const uint8_t> source,
+            const std::span<uint8_t> output)
+        {
+            if (chunk.laneSize == 2)
+            {
+                EncodeLanes<uint16_t>(source, chunk.filter, chunk.elementSize, output);
+            }
+            else
+            {
+                EncodeLanes<uint32_t>(source, chunk.filter, chunk.elementSize, output);
+            }
+        }
+
+        void DecodeChunk(
+            const VAMChunk& chunk,
+            const std::span<const uint8_t> filtered,
+            const std::span<uint8_t> target)
+        {
+            if (chunk.laneSize == 2)
+            {
+                DecodeLanes<uint16_t>(filtered, chunk.filter, chunk.elementSize, target);
+            }
+            else
+            {
+                DecodeLanes<uint32_t>(filtered, chunk.filter, chunk.elementSize, target);
+            }
+        }
+
+        /// @brief LZ4 or LZ4-HC block of a chunk into compressed, false when it cannot shrink
+        ///        the chunk
+        bool CompressChunk(
+            const std::span<const uint8_t> chunk,
+            const int compressionLevel,
+            const std::span<const uint8_t> dictionary,
+            VAArray<uint8_t>& compressed)
+        {
+#ifdef LZ4_VERSION_MAJOR
+            compressed.resize(LZ4_compressBound(static_cast<int>(chunk.size())));
+            const auto* source = reinterpret_cast<const char*>(chunk.data());
+            auto* target = reinterpret_cast<char*>(compressed.data());
+            const auto sourceSize = static_cast<int>(chunk.size());
+            const auto capacity = static_cast<int>(compressed.size());
+            const auto* dictionaryBytes = reinterpret_cast<const char*>(dictionary.data());
+            const auto dictionarySize = static_cast<int>(dictionary.size());
+
+            // Both stream states are too large for the stack of a job
+            int compressedSize = 0;
+            if (compressionLevel >= LZ4HC_CLEVEL_MIN)
+            {
+                const std::unique_ptr<LZ4_streamHC_t, decltype(&LZ4_freeStreamHC)> stream(
+                    LZ4_createStreamHC(),
+                    &LZ4_freeStreamHC);
+                if (!stream) return false;
+
+                LZ4_resetStreamHC_fast(stream.get(), std::min(compressionLevel, LZ4HC_CLEVEL_MAX));
+                if (dictionarySize > 0)
+                {
+                    LZ4_loadDictHC(stream.get(), dictionaryBytes, dictionarySize);
+                }
+                compressedSize = LZ4_compress_HC_continue(
+                    stream.get(),
+                    source,
+                    target,
+                    sourceSize,
+                    capacity);
+            }
+            else
+            {
+                const std::unique_ptr<LZ4_stream_t, decltype(&LZ4_freeStream)> stream(
+                    LZ4_createStream(),
+                    &LZ4_freeStream);
+                if (!stream) return false;
+
+                if (dictionarySize > 0) LZ4_loadDict(stream.get(), dictionaryBytes, dictionarySize);
+                compressedSize = LZ4_compress_fast_continue(
+                    stream.get(),
+                    source,
+                    target,
+                    sourceSize,
+                    capacity,
+                    1);
+            }
+
+            if (compressedSize > 0 && static_cast<size_t>(compressedSize) < chunk.size())
+            {
+                compressed.resize(compressedSize);
+                return true;
+            }
+#endif
+            return false;
+        }
+
+        /// @brief Inverse of CompressChunk(), target is sized for the decompressed chunk
+        bool DecompressChunk(
+            const std::span<const uint8_t> chunk,
+            const std::span<uint8_t> target,
+            const std::span<const uint8_t> dictionary)
+        {
+#ifdef LZ4_VERSION_MAJOR
+            const auto decompressedSize = LZ4_decompress_safe_usingDict(
+                reinterpret_cast<const char*>(chunk.data()),
+                reinterpret_cast<char*>(target.data()),
+                static_cast<int>(chunk.size()),
+                static_cast<int>(target.size()),
+                reinterpret_cast<const char*>(dictionary.data()),
+                static_cast<int>(dictionary.size()));
+            return decompressedSize >= 0 && static_cast<size_t>(decompressedSize) == target.size();
+#else
+            return false;
+#endif
+        }
+    } // namespace
+
     bool VAMCompression::s_LZ4Initialized = false;
+    std::mutex VAMCompression::s_DictionariesMutex;
+    VAHashMap<uint32_t, std::shared_ptr<const VAArray<uint8_t>>> VAMCompression::s_Dictionaries;
 
     bool VAMCompression::IsLZ4Available()
     {
@@ -167,6 +386,473 @@ namespace VoidArchitect::Resources::Loaders
             originalSize);
     }
 
+    VAMCompression::CompressionResult VAMCompression::CompressChunks(
+        const std::span<const uint8_t> data,
+        const std::span<const Section> sections,
+        const uint32_t chunkSize,
+        const int compressionLevel,
+        const uint32_t dictionaryId)
+    {
+        // Sections follow each other in data
+        VAArray<uint64_t> sectionOffsets;
+        sectionOffsets.reserve(sections.size());
+        uint64_t sectionOffset = 0;
+        for (const auto& section : sections)
+        {
+            sectionOffsets.push_back(sectionOffset);
+            sectionOffset += section.size;
+        }
+        if (sectionOffset != data.size())
+        {
+            VA_ENGINE_ERROR(
+                "[VAMCompression] Section sizes do not match the data ({} for {} bytes).",
+                sectionOffset,
+                data.size());
+            CompressionResult result;
+            result.originalSize = static_cast<uint32_t>(data.size());
+            return result;
+        }
+
+        VAArray<uint8_t> block;
+        auto result = CompressChunksTo(
+            sections,
+            [&](const size_t section, const uint32_t offset, const std::span<uint8_t> bytes)
+            {
+                memcpy(bytes.data(), data.data() + sectionOffsets[section] + offset, bytes.size());
+            },
+            [&block](const uint64_t offset, const std::span<const uint8_t> bytes)
+            {
+                if (offset + bytes.size() > block.size()) block.resize(offset + bytes.size());
+                memcpy(block.data() + offset, bytes.data(), bytes.size());
+                return true;
+            },
+            chunkSize,
+            compressionLevel,
+            dictionaryId);
+        if (result.success) result.compressedData = std::move(block);
+        return result;
+    }
+
+    VAMCompression::CompressionResult VAMCompression::CompressChunksTo(
+        const std::span<const Section> sections,
+        const SectionReader& read,
+        const BlockWriter& write,
+        const uint32_t chunkSize,
+        const int compressionLevel,
+        const uint32_t dictionaryId)
+    {
+        CompressionResult result;
+        if (chunkSize == 0)
+        {
+            VA_ENGINE_ERROR("[VAMCompression] Chunk size must not be zero.");
+            return result;
+        }
+
+        // Where the bytes of a chunk are read from
+        struct ChunkSource
+        {
+            size_t section;
+            uint32_t offset;
+        };
+
+        // Chunks never straddle two sections, each one uses the filter of its section
+        VAArray<VAMChunk> chunks;
+        VAArray<ChunkSource> sources;
+        uint64_t sectionOffset = 0;
+        for (size_t s = 0; s < sections.size(); ++s)
+        {
+            const auto& section = sections[s];
+            VA_ENGINE_ASSERT(
+                IsValidFilter(section.filter, section.laneSize, section.elementSize),
+                "Invalid VAM section filter.");
+            for (uint32_t offset = 0; offset < section.size; offset += chunkSize)
+            {
+                chunks.push_back(
+                    {
+                        static_cast<uint32_t>(sectionOffset + offset),
+                        std::min(chunkSize, section.size - offset),
+                        0,
+                        0,
+                        section.filter,
+                        section.laneSize,
+                        section.elementSize
+                    });
+                sources.push_back({s, offset});
+            }
+            sectionOffset += section.size;
+        }
+        result.originalSize = static_cast<uint32_t>(sectionOffset);
+
+        const auto dictionary = dictionaryId != 0 ? FindDictionary(dictionaryId) : nullptr;
+        if (dictionaryId != 0 && !dictionary)
+        {
+            VA_ENGINE_WARN(
+                "[VAMCompression] Dictionary {:08x} is not registered, compressing without it.",
+                dictionaryId);
+        }
+        const auto dictionaryBytes = dictionary
+            ? std::span<const uint8_t>(*dictionary)
+            : std::span<const uint8_t>();
+
+        // Scratch of one chunk in flight, reused by every window
+        struct Slot
+        {
+            VAArray<uint8_t> source;
+            VAArray<uint8_t> filtered;
+            VAArray<uint8_t> compressed;
+            bool stored = false;
+        };
+        const auto slotCount = std::min<size_t>(chunks.size(), MAX_CHUNKS_IN_FLIGHT);
+        VAArray<Slot> slots(slotCount);
+
+        // Windows of chunks are compressed in parallel, then written in order after the table
+        const auto tableSize = sizeof(VAMChunkTable) + chunks.size() * sizeof(VAMChunk);
+        uint32_t compressedOffset = 0;
+        for (size_t first = 0; first < chunks.size(); first += slotCount)
+        {
+            const auto count = std::min(slotCount, chunks.size() - first);
+            Jobs::ParallelFor(
+                count,
+                [&](const size_t i)
+                {
+                    auto& chunk = chunks[first + i];
+                    auto& slot = slots[i];
+                    slot.source.resize(chunk.uncompressedSize);
+                    read(sources[first + i].section, sources[first + i].offset, slot.source);
+
+                    std::span<const uint8_t> input = slot.source;
+                    if (chunk.filter != VAMFilter::None)
+                    {
+                        slot.filtered.resize(slot.source.size());
+                        EncodeChunk(chunk, slot.source, slot.filtered);
+                        input = slot.filtered;
+                    }
+
+                    // Stored as is, without its filter
+                    slot.stored = !CompressChunk(
+                        input,
+                        compressionLevel,
+                        dictionaryBytes,
+                        slot.compressed);
+                    if (slot.stored) chunk.filter = VAMFilter::None;
+                },
+                "VAMCompressChunks");
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto& chunk = chunks[first + i];
+                const std::span<const uint8_t> bytes = slots[i].stored
+                    ? slots[i].source
+                    : slots[i].compressed;
+                // Incompressible chunks may grow the block past the 32-bit offsets of the table
+                if (sizeof(VAMHeader) + tableSize + compressedOffset + bytes.size() >
+                    VAM_MAX_FILE_SIZE)
+                {
+                    VA_ENGINE_ERROR("[VAMCompression] Compressed block exceeds {} bytes.",
+                        VAM_MAX_FILE_SIZE);
+                    return result;
+                }
+                chunk.compressedOffset = compressedOffset;
+                chunk.compressedSize = static_cast<uint32_t>(bytes.size());
+                if (!write(tableSize + compressedOffset, bytes))
+                {
+                    VA_ENGINE_ERROR("[VAMCompression] Failed to write a compressed chunk.");
+                    return result;
+                }
+                compressedOffset += chunk.compressedSize;
+            }
+        }
+
+        // Table last, once every chunk knows where it is
+        const VAMChunkTable table{
+            static_cast<uint32_t>(chunks.size()),
+            chunkSize,
+            dictionary ? dictionaryId : 0,
+            0
+        };
+        VAArray<uint8_t> tableBytes(tableSize);
+        memcpy(tableBytes.data(), &table, sizeof(table));
+        if (!chunks.empty())
+        {
+            memcpy(
+                tableBytes.data() + sizeof(table),
+                chunks.data(),
+                chunks.size() * sizeof(VAMChunk));
+        }
+        if (!write(0, tableBytes))
+        {
+            VA_ENGINE_ERROR("[VAMCompression] Failed to write the chunk table.");
+            return result;
+        }
+
+        result.compressedSize = static_cast<uint32_t>(tableSize + compressedOffset);
+        result.success = true;
+
+        VA_ENGINE_TRACE(
+            "[VAMCompression] Compressed {} bytes to {} bytes in {} chunks, level {} ({:.1f}% "
+            "savings).",
+            result.originalSize,
+            result.compressedSize,
+            chunks.size(),
+            compressionLevel,
+            GetCompressionRatio(result.originalSize, result.compressedSize) * 100.0f);
+        return result;
+    }
+
+    bool VAMCompression::DecompressChunks(
+        const std::span<const uint8_t> block,
+        const std::span<uint8_t> destination,
+        const uint32_t version)
+    {
+        // Version 9 tables and chunks are prefixes of the current ones, the rest stays zero
+        const bool hasFilters = version >= 10;
+        const auto tableHeaderSize = hasFilters ? sizeof(VAMChunkTable) : VAM_CHUNK_TABLE_SIZE_V9;
+        const auto chunkEntrySize = hasFilters ? sizeof(VAMChunk) : VAM_CHUNK_SIZE_V9;
+
+        VAMChunkTable table{};
+        if (block.size() < tableHeaderSize)
+        {
+            VA_ENGINE_ERROR("[VAMCompression] Compressed block is too small for its chunk table.");
+            return false;
+        }
+        memcpy(&table, block.data(), tableHeaderSize);
+
+        const auto tableSize = tableHeaderSize +
+            static_cast<uint64_t>(table.chunkCount) * chunkEntrySize;
+        if (block.size() < tableSize)
+        {
+            VA_ENGINE_ERROR("[VAMCompression] Compressed block is too small for its chunk table.");
+            return false;
+        }
+
+        VAArray<VAMChunk> chunks(table.chunkCount);
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            memcpy(&chunks[i], block.data() + tableHeaderSize + i * chunkEntrySize, chunkEntrySize);
+        }
+        const auto compressedBytes = block.subspan(tableSize);
+
+        const auto dictionary = table.dictionaryId != 0
+            ? FindDictionary(table.dictionaryId)
+            : nullptr;
+        if (table.dictionaryId != 0 && !dictionary)
+        {
+            VA_ENGINE_ERROR(
+                "[VAMCompression] Dictionary {:08x} is not registered.",
+                table.dictionaryId);
+            return false;
+        }
+        const auto dictionaryBytes = dictionary
+            ? std::span<const uint8_t>(*dictionary)
+            : std::span<const uint8_t>();
+
+        // Every chunk is checked before any job writes to the destination
+        uint64_t decompressedSize = 0;
+        for (const auto& chunk : chunks)
+        {
+            const bool stored = chunk.compressedSize == chunk.uncompressedSize;
+            if (static_cast<uint64_t>(chunk.uncompressedOffset) + chunk.uncompressedSize >
+                destination.size() ||
+                static_cast<uint64_t>(chunk.compressedOffset) + chunk.compressedSize >
+                compressedBytes.size() || (!stored && !IsLZ4Available()) ||
+                !IsValidFilter(chunk.filter, chunk.laneSize, chunk.elementSize) ||
+                (stored && chunk.filter != VAMFilter::None))
+            {
+                VA_ENGINE_ERROR("[VAMCompression] Invalid chunk in compressed block.");
+                return false;
+            }
+            decompressedSize += chunk.uncompressedSize;
+        }
+        if (decompressedSize != destination.size())
+        {
+            VA_ENGINE_ERROR(
+                "[VAMCompression] Chunks hold {} bytes, expected {}.",
+                decompressedSize,
+                destination.size());
+            return false;
+        }
+
+        // Windows of chunks keep a multi-GB block from flooding the job queues
+        std::atomic<bool> failed = false;
+        for (size_t first = 0; first < chunks.size() && !failed; first += MAX_CHUNKS_IN_FLIGHT)
+        {
+            Jobs::ParallelFor(
+                std::min(MAX_CHUNKS_IN_FLIGHT, chunks.size() - first),
+                [&](const size_t i)
+                {
+                    const auto& chunk = chunks[first + i];
+                    const auto source = compressedBytes.subspan(
+                        chunk.compressedOffset,
+                        chunk.compressedSize);
+                    const auto target = destination.subspan(
+                        chunk.uncompressedOffset,
+                        chunk.uncompressedSize);
+                    if (chunk.compressedSize == chunk.uncompressedSize)
+                    {
+                        memcpy(target.data(), source.data(), source.size());
+                        return;
+                    }
+                    if (chunk.filter == VAMFilter::None)
+                    {
+                        if (!DecompressChunk(source, target, dictionaryBytes)) failed = true;
+                        return;
+                    }
+
+                    VAArray<uint8_t> filtered(target.size());
+                    if (!DecompressChunk(source, filtered, dictionaryBytes))
+                    {
+                        failed = true;
+                        return;
+                    }
+                    DecodeChunk(chunk, filtered, target);
+                },
+                "VAMDecompressChunks");
+        }
+
+        if (failed)
+        {
+            VA_ENGINE_ERROR("[VAMCompression] LZ4 decompression of a chunk failed.");
+            return false;
+        }
+
+        VA_ENGINE_TRACE(
+            "[VAMCompression] Decompressed {} chunks, {} bytes to {} bytes.",
+            chunks.size(),
+            block.size(),
+            destination.size());
+        return true;
+    }
+
+    VAArray<uint8_t> VAMCompression::TrainDictionary(
+        const std::span<const VAArray<uint8_t>> samples,
+        const uint32_t maxSize)
+    {
+        // Runs of SEGMENT_SIZE bytes, every SEGMENT_STEP bytes of every sample
+        constexpr uint32_t SEGMENT_SIZE = 32;
+        constexpr uint32_t SEGMENT_STEP = 8;
+
+        struct Candidate
+        {
+            uint32_t sampleCount;
+            uint32_t lastSample;
+            uint32_t sample; // First sample the run was found in
+            uint32_t offset;
+        };
+
+        VAHashMap<uint64_t, Candidate> candidates;
+        for (uint32_t sample = 0; sample < samples.size(); ++sample)
+        {
+            const std::span<const uint8_t> bytes = samples[sample];
+            for (uint32_t offset = 0; offset + SEGMENT_SIZE <= bytes.size(); offset += SEGMENT_STEP)
+            {
+                auto& candidate = candidates.try_emplace(
+                    HashBytes(bytes.subspan(offset, SEGMENT_SIZE)),
+                    Candidate{0, UINT32_MAX, sample, offset}).first->second;
+                if (candidate.lastSample != sample)
+                {
+                    candidate.sampleCount++;
+                    candidate.lastSample = sample;
+                }
+            }
+        }
+
+        // Only runs shared by several samples help, the most shared first
+        VAArray<Candidate> shared;
+        for (const auto& candidate : candidates | std::views::values)
+        {
+            if (candidate.sampleCount >= 2) shared.push_back(candidate);
+        }
+        std::ranges::sort(
+            shared,
+            [](const Candidate& a, const Candidate& b)
+            {
+                if (a.sampleCount != b.sampleCount) return a.sampleCount > b.sampleCount;
+                return a.sample != b.sample ? a.sample < b.sample : a.offset < b.offset;
+            });
+
+        // Overlapping runs of the same sample are kept once
+        VAArray<const Candidate*> selected;
+        VAHashSet<uint64_t> coveredSteps;
+        const auto capacity = std::min(maxSize, MAX_DICTIONARY_SIZE) / SEGMENT_SIZE;
+        for (const auto& candidate : shared)
+        {
+            if (selected.size() >= capacity) break;
+
+            const auto firstStep = static_cast<uint64_t>(candidate.sample) << 32 |
+                candidate.offset / SEGMENT_STEP;
+            bool overlaps = false;
+            for (uint32_t step = 0; step < SEGMENT_SIZE / SEGMENT_STEP; ++step)
+            {
+                overlaps = overlaps || coveredSteps.contains(firstStep + step);
+            }
+            if (overlaps) continue;
+
+            for (uint32_t step = 0; step < SEGMENT_SIZE / SEGMENT_STEP; ++step)
+            {
+                coveredSteps.insert(firstStep + step);
+            }
+            selected.push_back(&candidate);
+        }
+
+        // LZ4 favors the end of a dictionary, the most shared runs go last
+        VAArray<uint8_t> dictionary;
+        dictionary.reserve(selected.size() * SEGMENT_SIZE);
+        for (auto it = selected.rbegin(); it != selected.rend(); ++it)
+        {
+            const auto& sample = samples[(*it)->sample];
+            const auto* run = sample.data() + (*it)->offset;
+            dictionary.insert(dictionary.end(), run, run + SEGMENT_SIZE);
+        }
+
+        VA_ENGINE_TRACE(
+            "[VAMCompression] Trained a {} bytes dictionary from {} samples.",
+            dictionary.size(),
+            samples.size());
+        return dictionary;
+    }
+
+    uint32_t VAMCompression::RegisterDictionary(VAArray<uint8_t> dictionary)
+    {
+        if (dictionary.size() > MAX_DICTIONARY_SIZE)
+        {
+            dictionary.erase(dictionary.begin(), dictionary.end() - MAX_DICTIONARY_SIZE);
+        }
+
+        // 0 means no dictionary
+        const auto hash = HashBytes(dictionary);
+        auto id = static_cast<uint32_t>(hash ^ hash >> 32);
+        if (id == 0) id = 1;
+
+        std::lock_guard lock(s_DictionariesMutex);
+        s_Dictionaries.try_emplace(
+            id,
+            std::make_shared<const VAArray<uint8_t>>(std::move(dictionary)));
+        VA_ENGINE_TRACE("[VAMCompression] Registered dictionary {:08x}.", id);
+        return id;
+    }
+
+    uint32_t VAMCompression::LoadDictionary(const std::string& path)
+    {
+        const auto file = Platform::VirtualFileSystem::Open(
+            path,
+            Platform::MappedFile::Mode::Read);
+        if (!file || file->GetSize() == 0)
+        {
+            VA_ENGINE_ERROR("[VAMCompression] Failed to load dictionary: {}", path);
+            return 0;
+        }
+
+        const auto bytes = file->GetBytes();
+        return RegisterDictionary({bytes.begin(), bytes.end()});
+    }
+
+    std::shared_ptr<const VAArray<uint8_t>> VAMCompression::FindDictionary(const uint32_t id)
+    {
+        std::lock_guard lock(s_DictionariesMutex);
+        const auto it = s_Dictionaries.find(id);
+        return it != s_Dictionaries.end() ? it->second : nullptr;
+    }
+
     float VAMCompression::GetCompressionRatio(uint32_t originalSize, uint32_t compressedSize)
     {
         if (originalSize == 0) return 0.0f;
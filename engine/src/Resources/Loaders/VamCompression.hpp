@@ -3,6 +3,10 @@
 //
 #pragma once
 
+#include <mutex>
+
+#include "VAMFormat.hpp"
+
 namespace VoidArchitect
 {
     namespace Resources
@@ -41,6 +45,82 @@ namespace VoidArchitect
                     const VAArray<uint8_t>& compressedData,
                     uint32_t originalSize);
 
+                // Section given to CompressChunks() and the filter applied to its chunks
+                struct Section
+                {
+                    uint32_t size;
+                    VAMFilter filter = VAMFilter::None;
+                    uint8_t laneSize = 4; // Bytes per lane, 2 or 4
+                    uint16_t elementSize = 0; // Bytes per element, required by Delta
+                };
+
+                // Compress each section on its own, in chunks of at most chunkSize bytes, into
+                // a block starting with its VAMChunkTable. Chunks are compressed in parallel on
+                // the job system, those LZ4 cannot shrink are stored as they are. Levels from
+                // LZ4HC_CLEVEL_MIN use LZ4-HC, which decompresses as fast. A non-zero
+                // dictionaryId compresses every chunk with that registered dictionary.
+                static CompressionResult CompressChunks(
+                    std::span<const uint8_t> data,
+                    std::span<const Section> sections,
+                    uint32_t chunkSize,
+                    int compressionLevel = 1,
+                    uint32_t dictionaryId = 0);
+
+                // Fill bytes with the bytes of a section starting at offset. Called from job
+                // workers, for disjoint ranges.
+                using SectionReader = std::function<void(
+                    size_t section,
+                    uint32_t offset,
+                    std::span<uint8_t> bytes)>;
+
+                // Write bytes at offset from the start of the block, false on failure
+                using BlockWriter = std::function<bool(
+                    uint64_t offset,
+                    std::span<const uint8_t> bytes)>;
+
+                // Same block as CompressChunks(), for sections produced on demand. Chunks are
+                // read through `read` and handed to `write` in order, the chunk table last.
+                // Only MAX_CHUNKS_IN_FLIGHT chunks are held in memory at once, compressedData
+                // stays empty.
+                static CompressionResult CompressChunksTo(
+                    std::span<const Section> sections,
+                    const SectionReader& read,
+                    const BlockWriter& write,
+                    uint32_t chunkSize,
+                    int compressionLevel = 1,
+                    uint32_t dictionaryId = 0);
+
+                // Chunks handed to the job system at once. CompressChunksTo() needs about three
+                // times chunkSize of scratch for each of them.
+                static constexpr size_t MAX_CHUNKS_IN_FLIGHT = 16;
+
+                // Decompress a block written by CompressChunks() straight into destination,
+                // sized for every section. Chunks are decompressed in parallel on the job
+                // system, MAX_CHUNKS_IN_FLIGHT at a time. Returns false if the block is
+                // invalid, needs a dictionary that is not registered or does not fill
+                // destination.
+                static bool DecompressChunks(
+                    std::span<const uint8_t> block,
+                    std::span<uint8_t> destination,
+                    uint32_t version = VAM_VERSION);
+
+                // Build a dictionary of at most maxSize bytes from the byte runs found in
+                // several samples, typically the sections of small VAM files of the corpus.
+                // Empty if the samples have nothing in common.
+                static VAArray<uint8_t> TrainDictionary(
+                    std::span<const VAArray<uint8_t>> samples,
+                    uint32_t maxSize = MAX_DICTIONARY_SIZE);
+
+                // Make a dictionary available to CompressChunks() and DecompressChunks(),
+                // returns its ID, derived from its content
+                static uint32_t RegisterDictionary(VAArray<uint8_t> dictionary);
+
+                // Register a dictionary written to a file, returns its ID or 0 on failure
+                static uint32_t LoadDictionary(const std::string& path);
+
+                // LZ4 only refers to the last 64 KiB of a dictionary
+                static constexpr uint32_t MAX_DICTIONARY_SIZE = 64 * 1024;
+
                 // Calculate compression savings
                 static float GetCompressionRatio(uint32_t originalSize, uint32_t compressedSize);
                 static uint32_t GetCompressionSavings(
@@ -55,7 +135,12 @@ namespace VoidArchitect
                 static bool InitializeLZ4();
                 static void ShutdownLZ4();
 
+                static std::shared_ptr<const VAArray<uint8_t>> FindDictionary(uint32_t id);
+
                 static bool s_LZ4Initialized;
+
+                static std::mutex s_DictionariesMutex;
+                static VAHashMap<uint32_t, std::shared_ptr<const VAArray<uint8_t>>> s_Dictionaries;
             };
 
             struct VAMCompressionSettings
@@ -64,8 +149,17 @@ namespace VoidArchitect
                 float minCompressionRatio = 0.1f; // Only compress if we save at least 10%
                 uint32_t minSizeThreshold = 1024; // Only compress file larger than 1KiB
 
-                // LZ4 specific settings (for futur expansion)
-                int compressionLevel = 1; // LZ4 compression level (0-9)
+                // LZ4 specific settings
+                int compressionLevel = 1; // 1-2: LZ4, 3-12: LZ4-HC, smaller and slower to bake
+                uint32_t chunkSize = 256 * 1024; // Sections are compressed in chunks of 256 KiB
+                bool filterVertexStreams = true; // Delta positions, shuffle other attributes
+                uint32_t dictionaryId = 0; // Registered dictionary of small files, 0 for none
+                uint32_t dictionaryMaxSize = 256 * 1024; // Larger files use no dictionary
+
+                // Vertex quantization, see VertexQuantization.hpp
+                bool compactVertices = true; // Bake 24-byte CompactVertex instead of VAMVertex
+                float compactVerticesMaxUV = 4.0f; // Half UVs are 1/512 apart beyond this
+
 
                 // Get default settings
                 static VAMCompressionSettings Default()
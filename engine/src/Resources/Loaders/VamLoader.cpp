@@ -3,20 +3,203 @@
 //
 #include "VamLoader.hpp"
 
+#include "Core/Hash.hpp"
 #include "Core/Logger.hpp"
+#include "Core/Memory/MemoryTracker.hpp"
+#include "Platform/FileSystem/VirtualFileSystem.hpp"
+#include "Resources/MeshOptimizer.hpp"
+#include "Resources/MeshSimplifier.hpp"
+#include "Resources/MeshletBuilder.hpp"
 #include "Systems/MaterialSystem.hpp"
 
 namespace VoidArchitect::Resources::Loaders
 {
+    namespace
+    {
+        /// @brief Vertices interleaved and decoded at once from compact streams, 6 KiB on the stack
+        constexpr size_t DECODE_BATCH_SIZE = 256;
+
+        /// @brief Sequential reader over the sections following a VAM header
+        class SectionReader
+        {
+        public:
+            explicit SectionReader(const std::span<const uint8_t> data)
+                : m_Data(data)
+            {
+            }
+
+            /// @brief Next section, empty and flagged as truncated past the end of the data
+            std::span<const uint8_t> Next(const size_t size)
+            {
+                if (m_Truncated || size > m_Data.size() - m_Offset)
+                {
+                    m_Truncated = true;
+                    return {};
+                }
+
+                const auto section = m_Data.subspan(m_Offset, size);
+                m_Offset += size;
+                return section;
+            }
+
+            [[nodiscard]] size_t GetOffset() const { return m_Offset; }
+            [[nodiscard]] bool IsTruncated() const { return m_Truncated; }
+
+        private:
+            std::span<const uint8_t> m_Data;
+            size_t m_Offset = 0;
+            bool m_Truncated = false;
+        };
+
+        /// @brief Elements converted at once while a section is baked, 4 KiB on the stack
+        constexpr size_t CONVERT_BATCH_BYTES = 4096;
+
+        /// @brief Sections of a baked file in file order, the vertex section split in its
+        ///        position and attribute streams
+        enum class BakedSection : size_t
+        {
+            StringTable,
+            Positions,
+            Attributes,
+            Indices,
+            Submeshes,
+            Materials,
+            Bindings,
+            Meshlets,
+            Lods
+        };
+
+        /// @brief Bytes [offset, offset + bytes.size()) of a section of T elements, converting
+        ///        only the elements the range covers, batch by batch
+        /// @param offset Offset in the section, not necessarily on an element boundary
+        /// @param bytes Receives the bytes
+        /// @param convert Called with the index of the first element of a batch and the batch
+        template <typename T, typename Convert>
+        void ReadConverted(const uint64_t offset, const std::span<uint8_t> bytes, Convert&& convert)
+        {
+            constexpr size_t BATCH_SIZE = std::max<size_t>(1, CONVERT_BATCH_BYTES / sizeof(T));
+            T batch[BATCH_SIZE];
+
+            size_t written = 0;
+            while (written < bytes.size())
+            {
+                const auto byteOffset = offset + written;
+                const auto first = static_cast<size_t>(byteOffset / sizeof(T));
+                const auto skip = static_cast<size_t>(byteOffset % sizeof(T));
+                const auto count = std::min(
+                    BATCH_SIZE,
+                    (skip + bytes.size() - written + sizeof(T) - 1) / sizeof(T));
+                convert(first, std::span<T>(batch, count));
+
+                const auto size = std::min(count * sizeof(T) - skip, bytes.size() - written);
+                memcpy(
+                    bytes.data() + written,
+                    reinterpret_cast<const uint8_t*>(batch) + skip,
+                    size);
+                written += size;
+            }
+        }
+
+        /// @brief Bytes [offset, offset + bytes.size()) of elements already in their VAM layout
+        template <typename T>
+        void CopyElements(
+            const std::span<const T> elements,
+            const uint64_t offset,
+            const std::span<uint8_t> bytes)
+        {
+            if (!bytes.empty())
+            {
+                memcpy(
+                    bytes.data(),
+                    reinterpret_cast<const uint8_t*>(elements.data()) + offset,
+                    bytes.size());
+            }
+        }
+
+        /// @brief Copy a section into an array already sized for it
+        template <typename T>
+        void CopySection(const std::span<const uint8_t> section, VAArray<T>& outElements)
+        {
+            if (!section.empty()) memcpy(outElements.data(), section.data(), section.size());
+        }
+
+        /// @brief View a section as `count` elements of T, in place when it is aligned for T
+        /// @param section Bytes of the elements
+        /// @param count Number of elements
+        /// @param storage Receives a copy of the elements when the section is misaligned
+        template <typename T>
+        std::span<const T> ViewSection(
+            const std::span<const uint8_t> section,
+            const size_t count,
+            VAArray<T>& storage)
+        {
+            if (reinterpret_cast<uintptr_t>(section.data()) % alignof(T) == 0)
+            {
+                return {reinterpret_cast<const T*>(section.data()), count};
+            }
+
+            // Files older than version 8 do not align their sections
+            storage.resize(count);
+            CopySection(section.first(count * sizeof(T)), storage);
+            return storage;
+        }
+
+        /// @brief File written next to its target and renamed over it once complete, so that a
+        ///        reader sees either file. Removed if it is never renamed.
+        class TemporaryFile
+        {
+        public:
+            explicit TemporaryFile(const std::string& target)
+                : m_Target(target),
+                  m_Path(target + ".tmp")
+            {
+            }
+
+            ~TemporaryFile()
+            {
+                std::error_code error;
+                if (!m_Path.empty()) std::filesystem::remove(m_Path, error);
+            }
+
+            TemporaryFile(const TemporaryFile&) = delete;
+            TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+            [[nodiscard]] const std::string& GetPath() const { return m_Path; }
+
+            /// @brief Rename the file over its target, false if it cannot be replaced
+            bool Replace()
+            {
+                std::error_code error;
+                std::filesystem::rename(m_Path, m_Target, error);
+                if (error)
+                {
+                    VA_ENGINE_ERROR(
+                        "[VAMLoader] Failed to replace '{}': {}",
+                        m_Target,
+                        error.message());
+                    return false;
+                }
+
+                m_Path.clear();
+                return true;
+            }
+
+        private:
+            std::string m_Target;
+            std::string m_Path;
+        };
+    } // namespace
+
     VAMLoader::VAMLoader(const std::string& baseAssetPath)
         : ILoader(baseAssetPath),
-          m_CompressionSettings(VAMCompressionSettings::Default())
+          m_CompressionSettings(VAMCompressionSettings::Default()),
+          m_CacheDirectory(m_BaseAssetPath + "../cache/")
     {
         // Create raw loader for fallback
         m_RawMeshLoader = std::make_unique<RawMeshLoader>(baseAssetPath);
 
         // Ensure cache directory exists
-        auto cacheDir = m_BaseAssetPath + "../cache/";
+        const auto& cacheDir = m_CacheDirectory;
         if (!std::filesystem::exists(cacheDir))
         {
             std::filesystem::create_directory(cacheDir);
@@ -34,18 +217,58 @@ namespace VoidArchitect::Resources::Loaders
                 "[VAMLoader] LZ4 compression not available, files will be stored uncompressed.");
             m_CompressionSettings.enableCompression = false;
         }
+
+        // Read once, every cached asset is then found with one lookup
+        if (m_CacheManifest.Load(cacheDir + VAM_MANIFEST_FILE_NAME))
+        {
+            VA_ENGINE_INFO(
+                "[VAMLoader] Cache manifest lists {} baked meshes.",
+                m_CacheManifest.GetSize());
+        }
+
+        // Files baked against the corpus dictionary cannot be read without it. Entries baked
+        // with another one no longer match the settings and are baked again.
+        const auto dictionaryPath = cacheDir + VAM_DICTIONARY_FILE_NAME;
+        if (Platform::VirtualFileSystem::Exists(dictionaryPath))
+        {
+            m_CompressionSettings.dictionaryId = VAMCompression::LoadDictionary(dictionaryPath);
+            if (m_CacheManifest.GetDictionaryId() != m_CompressionSettings.dictionaryId)
+            {
+                VA_ENGINE_WARN(
+                    "[VAMLoader] Dictionary {:08x} is not the one of the cache manifest ({:08x}).",
+                    m_CompressionSettings.dictionaryId,
+                    m_CacheManifest.GetDictionaryId());
+                m_CacheManifest.SetDictionaryId(m_CompressionSettings.dictionaryId);
+            }
+        }
     }
 
     std::shared_ptr<IResourceDefinition> VAMLoader::Load(const std::string& name)
     {
-        const auto vamPath = GetVAMPath(name);
+        if (const auto entry = m_CacheManifest.Find(name))
+        {
+            if (IsCacheEntryValid(name, *entry, m_CacheValidation, true))
+            {
+                VA_ENGINE_TRACE("[VAMLoader] Loading cached VAM: {}", name);
+                if (auto meshData = LoadMeshFromVAM(m_CacheDirectory + entry->vamFile))
+                {
+                    return meshData;
+                }
 
-        // Check if VAM cache is valid
-        if (const auto sourcePath = FindSourceAsset(name); IsVAMValid(vamPath, sourcePath))
+                VA_ENGINE_WARN(
+                    "[VAMLoader] Failed to load cached VAM, falling back to import: {}",
+                    name);
+            }
+        }
+        // Files baked before the manifest existed are checked against their source timestamp
+        // once, then adopted
+        else if (const auto sourcePath = FindSourceAsset(name);
+            IsVAMValid(GetVAMPath(name), sourcePath))
         {
             VA_ENGINE_TRACE("[VAMLoader] Loading cached VAM: {}", name);
-            if (auto meshData = LoadMeshFromVAM(vamPath))
+            if (auto meshData = LoadMeshFromVAM(GetVAMPath(name)))
             {
+                RecordInCache(name, GetVAMPath(name), sourcePath, true);
                 return meshData;
             }
 
@@ -65,15 +288,15 @@ namespace VoidArchitect::Resources::Loaders
         const MeshDataDefinition& meshData,
         const VAMCompressionSettings& compressionSettings)
     {
-        try
+        // Sections are written chunkSize bytes at a time, compressed or not
+        if (compressionSettings.chunkSize == 0)
         {
-            std::ofstream file(vamPath, std::ios::binary);
-            if (!file.is_open())
-            {
-                VA_ENGINE_ERROR("[VAMLoader] Failed to open VAM file for writing: {}", vamPath);
-                return false;
-            }
+            VA_ENGINE_ERROR("[VAMLoader] Invalid chunk size 0, VAM not saved: {}", vamPath);
+            return false;
+        }
 
+        try
+        {
             // Prepare string table and material data
             VAArray<uint8_t> stringTable;
             VAHashMap<std::string, uint32_t> stringOffsets;
@@ -89,24 +312,66 @@ namespace VoidArchitect::Resources::Loaders
                 stringOffsets,
                 allBindings);
 
-            // Prepare all data sections for potential compression
-            VAArray<uint8_t> allData;
-
-            // Calculate original section sizes
-            auto stringTableSize = static_cast<uint32_t>(stringTable.size());
-            auto verticesSize = static_cast<uint32_t>(meshData.GetVertices().size()) * sizeof(
-                VAMVertex);
-            auto indicesSize = static_cast<uint32_t>(meshData.GetIndices().size()) * sizeof(
-                uint32_t);
-            auto submeshesSize = static_cast<uint32_t>(meshData.GetSubmeshes().size()) * sizeof(
-                VAMSubMeshDescriptor);
-            auto materialsSize = static_cast<uint32_t>(vamMaterials.size()) * sizeof(
-                VAMMAterialTemplate);
-            auto bindingsSize = static_cast<uint32_t>(allBindings.size()) * sizeof(
-                VAMResourceBinding);
+            // Pad the string table so that the vertex section after it is aligned
+            stringTable.resize(
+                (stringTable.size() + VAM_SECTION_ALIGNMENT - 1) / VAM_SECTION_ALIGNMENT *
+                VAM_SECTION_ALIGNMENT);
+            const auto vamSubmeshes = ConvertSubmeshesToVAM(meshData, stringOffsets);
+
+            // Calculate original section sizes. Vertices, indices, meshlets and LODs are only
+            // converted chunk by chunk while they are written.
+            const auto vertexCount = meshData.GetVertices().size();
+            const auto indexCount = meshData.GetIndices().size();
+            const bool shortIndices = indexCount > 0 &&
+                MeshData::FitsShortIndices(meshData.GetIndices());
+            const uint64_t sectionSizes[] = {
+                stringTable.size(),
+                vertexCount * sizeof(VertexPosition),
+                vertexCount * (meshData.HasCompactVertices()
+                    ? sizeof(CompactVertexAttributes)
+                    : sizeof(VertexAttributes)),
+                indexCount * (shortIndices ? sizeof(uint16_t) : sizeof(uint32_t)),
+                vamSubmeshes.size() * sizeof(VAMSubMeshDescriptor),
+                vamMaterials.size() * sizeof(VAMMAterialTemplate),
+                allBindings.size() * sizeof(VAMResourceBinding),
+                meshData.GetMeshlets().size() * sizeof(VAMMeshlet),
+                meshData.GetLods().size() * sizeof(VAMLod)
+            };
+
+            // Checked before the file is touched, a wrapped size would describe a truncated
+            // file that still reads as valid
+            if (!FitsVAMFile(sectionSizes))
+            {
+                VA_ENGINE_ERROR(
+                    "[VAMLoader] Mesh too large for a VAM file, the sections exceed {} bytes: {}",
+                    VAM_MAX_FILE_SIZE,
+                    vamPath);
+                return false;
+            }
+
+            auto stringTableSize = static_cast<uint32_t>(sectionSizes[0]);
+            const auto positionsSize = static_cast<uint32_t>(sectionSizes[1]);
+            auto verticesSize = static_cast<uint32_t>(sectionSizes[1] + sectionSizes[2]);
+            auto indicesSize = static_cast<uint32_t>(sectionSizes[3]);
+            auto submeshesSize = static_cast<uint32_t>(sectionSizes[4]);
+            auto materialsSize = static_cast<uint32_t>(sectionSizes[5]);
+            auto bindingsSize = static_cast<uint32_t>(sectionSizes[6]);
+            auto meshletsSize = static_cast<uint32_t>(sectionSizes[7]);
+            auto lodsSize = static_cast<uint32_t>(sectionSizes[8]);
 
             auto totalDataSize = stringTableSize + verticesSize + indicesSize + submeshesSize +
-                materialsSize + bindingsSize;
+                materialsSize + bindingsSize + meshletsSize + lodsSize;
+
+            // Declared before the stream, which is closed before the file is removed
+            TemporaryFile temporaryFile(vamPath);
+            std::ofstream file(temporaryFile.GetPath(), std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                VA_ENGINE_ERROR(
+                    "[VAMLoader] Failed to open VAM file for writing: {}",
+                    temporaryFile.GetPath());
+                return false;
+            }
 
             // Decide whether to compress
             bool shouldCompress = compressionSettings.enableCompression &&
@@ -117,9 +382,16 @@ namespace VoidArchitect::Resources::Loaders
             VAMHeader header{};
             memcpy(header.magic, VAM_MAGIC, sizeof(header.magic));
             header.version = VAM_VERSION;
-            header.flags = shouldCompress
-                ? static_cast<uint32_t>(VAMFlags::Compressed)
+            auto vertexFlags = meshData.HasCompactVertices()
+                ? static_cast<uint32_t>(VAMFlags::CompactVertices)
                 : static_cast<uint32_t>(VAMFlags::None);
+            if (shortIndices)
+            {
+                vertexFlags |= static_cast<uint32_t>(VAMFlags::ShortIndices);
+            }
+            header.flags = vertexFlags | (shouldCompress
+                ? static_cast<uint32_t>(VAMFlags::Compressed)
+                : static_cast<uint32_t>(VAMFlags::None));
 
             // Get source timestamp (if available)
             if (!sourcePath.empty() && std::filesystem::exists(sourcePath))
@@ -154,91 +426,130 @@ namespace VoidArchitect::Resources::Loaders
             header.indexCount = static_cast<uint32_t>(meshData.GetIndices().size());
             header.submeshCount = static_cast<uint32_t>(meshData.GetSubmeshes().size());
             header.materialCount = static_cast<uint32_t>(vamMaterials.size());
-
-            if (shouldCompress)
-            {
-                // Assemble all data into a single buffer for compression
-                allData.reserve(totalDataSize);
-
-                // Add string table
-                allData.insert(allData.end(), stringTable.begin(), stringTable.end());
-
-                // Write vertices (convert to VAM format)
-                for (const auto& vertex : meshData.GetVertices())
+            header.meshletCount = static_cast<uint32_t>(meshData.GetMeshlets().size());
+            header.lodCount = static_cast<uint32_t>(meshData.GetLods().size());
+            header.bounds = VAMBounds(
+                meshData.GetBounds().IsValid()
+                ? meshData.GetBounds()
+                : MeshData::ComputeBounds(meshData.GetVertices()));
+
+            // Sections in file order. Floats of neighbor vertices share their high bytes, the
+            // filters of the vertex streams group them together before compression.
+            using Section = VAMCompression::Section;
+            const bool filter = compressionSettings.filterVertexStreams;
+            const auto attributeLaneSize = static_cast<uint8_t>(
+                meshData.HasCompactVertices() ? sizeof(uint16_t) : sizeof(float));
+            const Section sections[] = {
+                {stringTableSize},
                 {
-                    VAMVertex vamVertex(vertex.Position, vertex.Normal, vertex.UV0, vertex.Tangent);
-                    auto* vertexBytes = reinterpret_cast<const uint8_t*>(&vamVertex);
-                    allData.insert(allData.end(), vertexBytes, vertexBytes + sizeof(VAMVertex));
-                }
-
-                // Write indices
-                if (!meshData.GetIndices().empty())
+                    positionsSize,
+                    filter ? VAMFilter::Delta : VAMFilter::None,
+                    sizeof(float),
+                    sizeof(VertexPosition)
+                },
                 {
-                    auto* indicesBytes = reinterpret_cast<const uint8_t*>(meshData.GetIndices().
-                        data());
-                    allData.insert(allData.end(), indicesBytes, indicesBytes + indicesSize);
-                }
-
-                // Write submeshes (convert material handles to indices)
-                VAArray<VAMSubMeshDescriptor> vamSubmeshes;
-                VAHashMap<MaterialHandle, uint32_t> materialIndexMap;
-                uint32_t matIndex = 0;
-                for (const auto& submesh : meshData.GetSubmeshes())
+                    verticesSize - positionsSize,
+                    filter ? VAMFilter::Shuffle : VAMFilter::None,
+                    attributeLaneSize
+                },
+                {indicesSize},
+                {static_cast<uint32_t>(submeshesSize)},
+                {static_cast<uint32_t>(materialsSize)},
+                {static_cast<uint32_t>(bindingsSize)},
+                {static_cast<uint32_t>(meshletsSize)},
+                {static_cast<uint32_t>(lodsSize)}
+            };
+
+            // Produce any range of a section, only the elements it covers are converted
+            const auto& meshlets = meshData.GetMeshlets();
+            const auto& lods = meshData.GetLods();
+            const auto readSection = [&](
+                const size_t section,
+                const uint32_t offset,
+                const std::span<uint8_t> bytes)
+            {
+                switch (static_cast<BakedSection>(section))
                 {
-                    if (!materialIndexMap.contains(submesh.material))
-                    {
-                        materialIndexMap[submesh.material] = matIndex++;
-                    }
+                    case BakedSection::StringTable:
+                        CopyElements(std::span<const uint8_t>(stringTable), offset, bytes);
+                        break;
+                    case BakedSection::Positions:
+                        ReadVerticesForVAM(meshData, offset, bytes);
+                        break;
+                    case BakedSection::Attributes:
+                        ReadVerticesForVAM(meshData, positionsSize + offset, bytes);
+                        break;
+                    case BakedSection::Indices:
+                        ReadIndicesForVAM(meshData, shortIndices, offset, bytes);
+                        break;
+                    case BakedSection::Submeshes:
+                        CopyElements(
+                            std::span<const VAMSubMeshDescriptor>(vamSubmeshes),
+                            offset,
+                            bytes);
+                        break;
+                    case BakedSection::Materials:
+                        CopyElements(
+                            std::span<const VAMMAterialTemplate>(vamMaterials),
+                            offset,
+                            bytes);
+                        break;
+                    case BakedSection::Bindings:
+                        CopyElements(
+                            std::span<const VAMResourceBinding>(allBindings),
+                            offset,
+                            bytes);
+                        break;
+                    case BakedSection::Meshlets:
+                        ReadConverted<VAMMeshlet>(
+                            offset,
+                            bytes,
+                            [&meshlets](const size_t first, const std::span<VAMMeshlet> batch)
+                            {
+                                for (size_t i = 0; i < batch.size(); ++i)
+                                {
+                                    batch[i] = VAMMeshlet(meshlets[first + i]);
+                                }
+                            });
+                        break;
+                    case BakedSection::Lods:
+                        ReadConverted<VAMLod>(
+                            offset,
+                            bytes,
+                            [&lods](const size_t first, const std::span<VAMLod> batch)
+                            {
+                                for (size_t i = 0; i < batch.size(); ++i)
+                                {
+                                    batch[i] = VAMLod(lods[first + i]);
+                                }
+                            });
+                        break;
                 }
+            };
 
-                for (const auto& submesh : meshData.GetSubmeshes())
-                {
-                    VAMSubMeshDescriptor vamSubmesh{};
-                    auto it = stringOffsets.find(submesh.name);
-                    if (it != stringOffsets.end())
-                    {
-                        vamSubmesh.nameOffset = it->second;
-                    }
-                    else
+            if (shouldCompress)
+            {
+                // Header first, written again once the size of the compressed block is known
+                header.stringTableOffset = sizeof(VAMHeader);
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+                // Compress every section on its own, straight to the file chunk by chunk. A
+                // dictionary only pays off on files too small to find their own matches.
+                const auto dictionaryId = totalDataSize <= compressionSettings.dictionaryMaxSize
+                    ? compressionSettings.dictionaryId
+                    : 0;
+                auto compressionResult = VAMCompression::CompressChunksTo(
+                    sections,
+                    readSection,
+                    [&file](const uint64_t offset, const std::span<const uint8_t> bytes)
                     {
-                        VA_ENGINE_ERROR(
-                            "[VAMLoader] Submesh name '{}' not found in string table.",
-                            submesh.name);
-                        vamSubmesh.nameOffset = 0;
-                    }
-                    vamSubmesh.materialIndex = materialIndexMap[submesh.material];
-                    vamSubmesh.indexOffset = submesh.indexOffset;
-                    vamSubmesh.indexCount = submesh.indexCount;
-                    vamSubmesh.vertexOffset = submesh.vertexOffset;
-                    vamSubmesh.vertexCount = submesh.vertexCount;
-                    vamSubmesh.reserved = 0;
-
-                    vamSubmeshes.push_back(vamSubmesh);
-                }
-
-                // Add submeshes to data
-                if (!vamSubmeshes.empty())
-                {
-                    auto* submeshesBytes = reinterpret_cast<const uint8_t*>(vamSubmeshes.data());
-                    allData.insert(allData.end(), submeshesBytes, submeshesBytes + submeshesSize);
-                }
-
-                // Write materials
-                if (!vamMaterials.empty())
-                {
-                    auto* materialsBytes = reinterpret_cast<const uint8_t*>(vamMaterials.data());
-                    allData.insert(allData.end(), materialsBytes, materialsBytes + materialsSize);
-                }
-
-                // Write resource bindings
-                if (!allBindings.empty())
-                {
-                    auto* bindingsBytes = reinterpret_cast<const uint8_t*>(allBindings.data());
-                    allData.insert(allData.end(), bindingsBytes, bindingsBytes + bindingsSize);
-                }
-
-                // Compress all data
-                auto compressionResult = VAMCompression::Compress(allData);
+                        file.seekp(static_cast<std::streamoff>(sizeof(VAMHeader) + offset));
+                        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+                        return file.good();
+                    },
+                    compressionSettings.chunkSize,
+                    compressionSettings.compressionLevel,
+                    dictionaryId);
                 if (compressionResult.success)
                 {
                     auto compressionRatio = VAMCompression::GetCompressionRatio(
@@ -262,21 +573,21 @@ namespace VoidArchitect::Resources::Loaders
                         header.originalBindingsSize = bindingsSize;
 
                         // Set offsets for compressed format (everything is in one comrpessed block)
-                        header.stringTableOffset = sizeof(VAMHeader);
                         header.verticesOffset = 0;
                         header.indicesOffset = 0;
                         header.submeshesOffset = 0;
                         header.materialsOffset = 0;
 
                         // Write header
+                        file.seekp(0);
                         file.write(reinterpret_cast<const char*>(&header), sizeof(header));
-
-                        // Write compressed data
-                        file.write(
-                            reinterpret_cast<const char*>(compressionResult.compressedData.data()),
-                            compressionResult.compressedSize);
-
                         file.close();
+                        if (file.fail())
+                        {
+                            VA_ENGINE_ERROR("[VAMLoader] Failed to write VAM file: {}", vamPath);
+                            return false;
+                        }
+                        if (!temporaryFile.Replace()) return false;
 
                         VA_ENGINE_TRACE(
                             "[VAMLoader] Successfully saved compressed VAM: {} ({} vertices, {} indices, {} submeshes, {} materials) [{} -> {} bytes, {:.1f}% savings]",
@@ -302,10 +613,21 @@ namespace VoidArchitect::Resources::Loaders
                 {
                     VA_ENGINE_WARN("[VAMLoader] Compression failed, storing uncompressed.");
                 }
+
+                // Start over, the compressed block is already in the file
+                file.close();
+                file.open(temporaryFile.GetPath(), std::ios::binary | std::ios::trunc);
+                if (!file.is_open())
+                {
+                    VA_ENGINE_ERROR(
+                        "[VAMLoader] Failed to open VAM file for writing: {}",
+                        temporaryFile.GetPath());
+                    return false;
+                }
             }
 
             // Store uncompressed (either by choice or because compression failed/wasn't worth it)
-            header.flags = static_cast<uint32_t>(VAMFlags::None);
+            header.flags = vertexFlags;
             header.uncompressedSize = 0;
             header.compressionRatio = 0;
             header.stringTableSize = stringTableSize;
@@ -338,81 +660,27 @@ namespace VoidArchitect::Resources::Loaders
             // Write header
             file.write(reinterpret_cast<const char*>(&header), sizeof(header));
 
-            // Write section uncompressed
-
-            // Write string table
-            if (!stringTable.empty())
-            {
-                file.write(reinterpret_cast<const char*>(stringTable.data()), stringTable.size());
-            }
-
-            // Write vertices
-            for (const auto& vertex : meshData.GetVertices())
-            {
-                VAMVertex vamVertex(vertex.Position, vertex.Normal, vertex.UV0, vertex.Tangent);
-                file.write(reinterpret_cast<const char*>(&vamVertex), sizeof(vamVertex));
-            }
-
-            // Write indices
-            if (!meshData.GetIndices().empty())
-            {
-                file.write(
-                    reinterpret_cast<const char*>(meshData.GetIndices().data()),
-                    meshData.GetIndices().size() * sizeof(uint32_t));
-            }
-
-            // Write submeshes
-            VAHashMap<MaterialHandle, uint32_t> materialIndexMap;
-            uint32_t matIndex = 0;
-            for (const auto& submesh : meshData.GetSubmeshes())
-            {
-                if (materialIndexMap.contains(submesh.material))
-                {
-                    materialIndexMap[submesh.material] = matIndex++;
-                }
-            }
-
-            for (const auto& submesh : meshData.GetSubmeshes())
+            // Write every section back to back, through a scratch buffer of one chunk
+            VAArray<uint8_t> scratch;
+            for (size_t section = 0; section < std::size(sections); ++section)
             {
-                VAMSubMeshDescriptor vamSubmesh{};
-                auto it = stringOffsets.find(submesh.name);
-                if (it != stringOffsets.end())
+                const auto sectionSize = sections[section].size;
+                for (uint32_t offset = 0; offset < sectionSize;
+                     offset += compressionSettings.chunkSize)
                 {
-                    vamSubmesh.nameOffset = it->second;
-                }
-                else
-                {
-                    VA_ENGINE_ERROR(
-                        "[VAMLoader] Submesh name '{}' not found in string table.",
-                        submesh.name);
-                    vamSubmesh.nameOffset = 0;
+                    scratch.resize(std::min(compressionSettings.chunkSize, sectionSize - offset));
+                    readSection(section, offset, scratch);
+                    file.write(reinterpret_cast<const char*>(scratch.data()), scratch.size());
                 }
-
-                vamSubmesh.materialIndex = materialIndexMap[submesh.material];
-                vamSubmesh.indexOffset = submesh.indexOffset;
-                vamSubmesh.indexCount = submesh.indexCount;
-                vamSubmesh.vertexOffset = submesh.vertexOffset;
-                vamSubmesh.vertexCount = submesh.vertexCount;
-                vamSubmesh.reserved = 0;
-
-                file.write(reinterpret_cast<const char*>(&vamSubmesh), sizeof(vamSubmesh));
-            }
-
-            // Write materials
-            for (const auto& vamMat : vamMaterials)
-            {
-                file.write(reinterpret_cast<const char*>(&vamMat), sizeof(vamMat));
             }
 
-            // Write resource bindings
-            if (!allBindings.empty())
+            file.close();
+            if (file.fail())
             {
-                file.write(
-                    reinterpret_cast<const char*>(allBindings.data()),
-                    allBindings.size() * sizeof(VAMResourceBinding));
+                VA_ENGINE_ERROR("[VAMLoader] Failed to write VAM file: {}", vamPath);
+                return false;
             }
-
-            file.close();
+            if (!temporaryFile.Replace()) return false;
 
             VA_ENGINE_TRACE(
                 "[VAMLoader] Successfully saved VAM: {} ({} vertices, {} indices, {} submeshes, {} materials) [{} bytes]",
@@ -432,12 +700,14 @@ namespace VoidArchitect::Resources::Loaders
         }
     }
 
-    MeshDataDefinitionPtr VAMLoader::LoadMeshFromVAM(const std::string& vamPath)
+    MeshDataDefinitionPtr VAMLoader::LoadMeshFromVAM(
+        const std::string& vamPath,
+        const Platform::MappedFile::Mode mode)
     {
         try
         {
-            std::ifstream file(vamPath, std::ios::binary | std::ios::in);
-            if (!file.is_open())
+            const auto file = Platform::VirtualFileSystem::Open(vamPath, mode);
+            if (!file)
             {
                 VA_ENGINE_ERROR("[VAMLoader] Failed to open VAM file for reading: {}", vamPath);
                 return nullptr;
@@ -445,259 +715,77 @@ namespace VoidArchitect::Resources::Loaders
 
             // Read and validate header
             VAMHeader header{};
-            file.read(reinterpret_cast<char*>(reinterpret_cast<uint8_t*>(&header)), sizeof(header));
-            if (!header.IsValid())
+            if (!ReadHeader(file->GetBytes(), header))
             {
                 VA_ENGINE_ERROR("[VAMLoader] Invalid VAM header in file: {}", vamPath);
                 return nullptr;
             }
 
-            auto meshData = new MeshDataDefinition();
+            auto meshData = std::make_shared<MeshDataDefinition>();
+            const auto sections = file->GetBytes().subspan(header.GetSize());
 
-            if (header.IsCompressed())
+            if (!header.IsCompressed())
             {
-                // Handle compressed VAM file
-                if (!VAMCompression::IsLZ4Available())
-                {
-                    VA_ENGINE_ERROR(
-                        "[VAMLoader] Compressed VAM requires LZ4 but it's not available: {}",
-                        vamPath);
-                    delete meshData;
-                    return nullptr;
-                }
-
-                // Read compressed data
-                VAArray<uint8_t> compressedData(header.stringTableSize);
-                file.read(reinterpret_cast<char*>(compressedData.data()), header.stringTableSize);
-                file.close();
-
-                // Decompress all data
-                auto decompressedData = VAMCompression::Decompress(
-                    compressedData,
-                    header.uncompressedSize);
-                if (decompressedData.empty())
+                // Parsed in place, the file stays alive as long as its sections are attached
+                if (!ParseSections(sections, header, file, *meshData))
                 {
-                    VA_ENGINE_ERROR("[VAMLoader] Failed to decompress VAM: {}", vamPath);
-                    delete meshData;
+                    VA_ENGINE_ERROR("[VAMLoader] Truncated VAM file: {}", vamPath);
                     return nullptr;
                 }
 
-                // Parse decompressed data sections
-                uint32_t offset = 0;
-
-                // Extract string table
-                VAArray<uint8_t> stringTable(header.stringTableSize);
-                if (header.originalStringTableSize > 0)
-                {
-                    memcpy(
-                        stringTable.data(),
-                        decompressedData.data() + offset,
-                        header.stringTableSize);
-                    offset += header.originalStringTableSize;
-                }
-
-                // Extract vertices
-                meshData->m_Vertices.resize(header.vertexCount);
-                for (uint32_t i = 0; i < header.vertexCount; ++i)
-                {
-                    VAMVertex vamVertex;
-                    memcpy(&vamVertex, decompressedData.data() + offset, sizeof(VAMVertex));
-                    offset += sizeof(VAMVertex);
-
-                    // Convert to engine format
-                    MeshVertex& vertex = meshData->m_Vertices[i];
-                    vertex.Position = vamVertex.position;
-                    vertex.Normal = vamVertex.normal;
-                    vertex.UV0 = vamVertex.uv0;
-                    vertex.Tangent = vamVertex.tangent;
-                }
-
-                // Extract indices
-                meshData->m_Indices.resize(header.indexCount);
-                if (header.originalIndicesSize > 0)
-                {
-                    memcpy(
-                        meshData->m_Indices.data(),
-                        decompressedData.data() + offset,
-                        header.originalIndicesSize);
-                    offset += header.originalIndicesSize;
-                }
-
-                // Extract submeshes
-                VAArray<VAMSubMeshDescriptor> vamSubmeshes(header.submeshCount);
-                for (uint32_t i = 0; i < header.submeshCount; ++i)
-                {
-                    memcpy(
-                        &vamSubmeshes[i],
-                        decompressedData.data() + offset,
-                        sizeof(VAMSubMeshDescriptor));
-                    offset += sizeof(VAMSubMeshDescriptor);
-                }
-
-                // Extract materials
-                VAArray<VAMMAterialTemplate> vamMaterials(header.materialCount);
-                for (uint32_t i = 0; i < header.materialCount; ++i)
-                {
-                    memcpy(
-                        &vamMaterials[i],
-                        decompressedData.data() + offset,
-                        sizeof(VAMMAterialTemplate));
-                    offset += sizeof(VAMMAterialTemplate);
-                }
-
-                // Calculate total bindings and extract them
-                VAArray<VAMResourceBinding> allBindings;
-                if (header.originalBindingsSize > 0)
-                {
-                    auto bindingCount = header.originalBindingsSize / sizeof(VAMResourceBinding);
-                    allBindings.resize(bindingCount);
-                    memcpy(
-                        allBindings.data(),
-                        decompressedData.data() + offset,
-                        header.originalBindingsSize);
-                    offset += header.originalBindingsSize;
-                }
-
-                // Verify we consumed all data
-                if (offset != header.uncompressedSize)
-                {
-                    VA_ENGINE_WARN(
-                        "[VAMLoader] Data size mismatch during decompression (expected {}, consumed {}).",
-                        header.uncompressedSize,
-                        offset);
-                }
-
-                // Convert submeshes and restore materials
-                meshData->m_Submeshes.reserve(header.submeshCount);
-                for (const auto& vamSubmesh : vamSubmeshes)
-                {
-                    auto submeshName = ReadFromStringTable(stringTable, vamSubmesh.nameOffset);
-
-                    SubMeshDescriptor submesh;
-                    submesh.name = submeshName;
-                    submesh.material = vamSubmesh.materialIndex; // Will be converted later
-                    submesh.indexOffset = vamSubmesh.indexOffset;
-                    submesh.indexCount = vamSubmesh.indexCount;
-                    submesh.vertexOffset = vamSubmesh.vertexOffset;
-                    submesh.vertexCount = vamSubmesh.vertexCount;
-
-                    meshData->m_Submeshes.push_back(submesh);
-                }
-
-                // Restore materials and update submesh material handles
-                RestoreMaterialFromVAM(
-                    vamMaterials,
-                    allBindings,
-                    stringTable,
-                    meshData->m_Submeshes);
-
-                VA_ENGINE_INFO(
-                    "[VAMLoader] Loaded compressed VAM: {} ({} vertices, {} indices, {} submeshes, {} materials) [{:.1f}% compression].",
+                VA_ENGINE_TRACE(
+                    "[VAMLoader] Successfully loaded VAM: {} ({} vertices, {} indices, {} submeshes, {} materials).",
                     vamPath,
                     header.vertexCount,
                     header.indexCount,
                     header.submeshCount,
-                    header.materialCount,
-                    header.GetCompressionRatio() * 100.0f);
+                    header.materialCount);
+                return meshData;
             }
-            else
-            {
-                // Read string table
-                VAArray<uint8_t> stringTable(header.stringTableSize);
-                if (header.stringTableSize > 0)
-                {
-                    file.read(reinterpret_cast<char*>(stringTable.data()), header.stringTableSize);
-                }
-
-                // Read vertices
-                meshData->m_Vertices.resize(header.vertexCount);
-                for (uint32_t i = 0; i < header.vertexCount; ++i)
-                {
-                    VAMVertex vamVertex;
-                    file.read(reinterpret_cast<char*>(&vamVertex), sizeof(vamVertex));
-
-                    MeshVertex& vertex = meshData->m_Vertices[i];
-                    vertex.Position = vamVertex.position;
-                    vertex.Normal = vamVertex.normal;
-                    vertex.UV0 = vamVertex.uv0;
-                    vertex.Tangent = vamVertex.tangent;
-                }
-
-                // Read indices
-                meshData->m_Indices.resize(header.indexCount);
-                if (header.indexCount > 0)
-                {
-                    file.read(
-                        reinterpret_cast<char*>(meshData->m_Indices.data()),
-                        header.indexCount * sizeof(uint32_t));
-                }
-
-                // Read submeshes
-                VAArray<VAMSubMeshDescriptor> vamSubmeshes(header.submeshCount);
-                for (uint32_t i = 0; i < header.submeshCount; ++i)
-                {
-                    file.read(reinterpret_cast<char*>(&vamSubmeshes[i]), sizeof(vamSubmeshes[i]));
-                }
-
-                // Read materials
-                VAArray<VAMMAterialTemplate> vamMaterials(header.materialCount);
-                for (uint32_t i = 0; i < header.materialCount; ++i)
-                {
-                    file.read(reinterpret_cast<char*>(&vamMaterials[i]), sizeof(vamMaterials[i]));
-                }
-
-                // Calculate total bindings
-                uint32_t totalBindings = 0;
-                for (const auto& mat : vamMaterials)
-                {
-                    totalBindings += mat.bindingCount;
-                }
-
-                // Read resource bindings
-                VAArray<VAMResourceBinding> allBindings(totalBindings);
-                if (totalBindings > 0)
-                {
-                    file.read(
-                        reinterpret_cast<char*>(allBindings.data()),
-                        totalBindings * sizeof(VAMResourceBinding));
-                }
 
-                file.close();
-
-                // Convert VAM submeshes to engine format
-                meshData->m_Submeshes.reserve(header.submeshCount);
-                for (const auto& vamSubmesh : vamSubmeshes)
-                {
-                    auto submeshName = ReadFromStringTable(stringTable, vamSubmesh.nameOffset);
-
-                    SubMeshDescriptor submesh;
-                    submesh.name = submeshName;
-                    submesh.material = vamSubmesh.materialIndex; // Will be converted later
-                    submesh.indexOffset = vamSubmesh.indexOffset;
-                    submesh.indexCount = vamSubmesh.indexCount;
-                    submesh.vertexOffset = vamSubmesh.vertexOffset;
-                    submesh.vertexCount = vamSubmesh.vertexCount;
+            // Handle compressed VAM file
+            if (!VAMCompression::IsLZ4Available())
+            {
+                VA_ENGINE_ERROR(
+                    "[VAMLoader] Compressed VAM requires LZ4 but it's not available: {}",
+                    vamPath);
+                return nullptr;
+            }
+            if (sections.size() < header.stringTableSize)
+            {
+                VA_ENGINE_ERROR("[VAMLoader] Truncated VAM file: {}", vamPath);
+                return nullptr;
+            }
 
-                    meshData->m_Submeshes.push_back(submesh);
-                }
+            // Decompress straight from the file bytes into the buffer the sections are parsed
+            // from, which the GPU upload then stages the vertices and indices from
+            const auto decompressedData = std::make_shared<VAArray<uint8_t>>(
+                DecompressSections(sections.first(header.stringTableSize), header));
+            if (decompressedData->empty())
+            {
+                VA_ENGINE_ERROR("[VAMLoader] Failed to decompress VAM: {}", vamPath);
+                return nullptr;
+            }
 
-                // Restore materials and update submesh material handles
-                RestoreMaterialFromVAM(
-                    vamMaterials,
-                    allBindings,
-                    stringTable,
-                    meshData->m_Submeshes);
+            // Account for the decompressed sections while the mesh is being parsed.
+            const Memory::TrackedMemory<Memory::MemoryTag::Loader> trackedBuffers(
+                decompressedData->size());
 
-                VA_ENGINE_TRACE(
-                    "[VAMLoader] Successfully loaded VAM: {} ({} vertices, {} indices, {} submeshes, {} materials).",
-                    vamPath,
-                    header.vertexCount,
-                    header.indexCount,
-                    header.submeshCount,
-                    header.materialCount);
+            if (!ParseSections(*decompressedData, header, decompressedData, *meshData))
+            {
+                VA_ENGINE_ERROR("[VAMLoader] Truncated VAM data after decompression: {}", vamPath);
+                return nullptr;
             }
 
-            return MeshDataDefinitionPtr(meshData);
+            VA_ENGINE_INFO(
+                "[VAMLoader] Loaded compressed VAM: {} ({} vertices, {} indices, {} submeshes, {} materials) [{:.1f}% compression].",
+                vamPath,
+                header.vertexCount,
+                header.indexCount,
+                header.submeshCount,
+                header.materialCount,
+                header.GetCompressionRatio() * 100.0f);
+            return meshData;
         }
         catch (const std::exception& ex)
         {
@@ -706,10 +794,126 @@ namespace VoidArchitect::Resources::Loaders
         }
     }
 
-    bool VAMLoader::IsVAMValid(const std::string& vamPath, const std::string& sourcePath)
+    VAArray<uint8_t> VAMLoader::DecompressSections(
+        const std::span<const uint8_t> block,
+        const VAMHeader& header)
     {
-        // Check if VAM file exists
-        if (!std::filesystem::exists(vamPath))
+        if (!header.HasCompressedChunks())
+        {
+            return VAMCompression::Decompress(
+                block.data(),
+                static_cast<uint32_t>(block.size()),
+                header.uncompressedSize);
+        }
+
+        VAArray<uint8_t> sections(header.uncompressedSize);
+        if (!VAMCompression::DecompressChunks(block, sections, header.version)) sections.clear();
+        return sections;
+    }
+
+    VAArray<uint8_t> VAMLoader::ReadSectionsFromVAM(const std::string& vamPath)
+    {
+        const auto file = Platform::VirtualFileSystem::Open(vamPath);
+        VAMHeader header{};
+        if (!file || !ReadHeader(file->GetBytes(), header)) return {};
+
+        const auto sections = file->GetBytes().subspan(header.GetSize());
+        if (!header.IsCompressed()) return {sections.begin(), sections.end()};
+        if (sections.size() < header.stringTableSize) return {};
+        return DecompressSections(sections.first(header.stringTableSize), header);
+    }
+
+    bool VAMLoader::ParseSections(
+        const std::span<const uint8_t> data,
+        const VAMHeader& header,
+        const std::shared_ptr<const void>& owner,
+        MeshDataDefinition& meshData)
+    {
+        // Compressed files record the size of the string table before compression
+        const auto stringTableSize = header.IsCompressed()
+            ? header.originalStringTableSize
+            : header.stringTableSize;
+
+        SectionReader reader(data);
+        const auto stringTable = reader.Next(stringTableSize);
+        const auto vertexBytes = reader.Next(header.vertexCount * header.GetVertexSize());
+        const auto indexBytes = reader.Next(header.indexCount * header.GetIndexSize());
+        const auto submeshBytes = reader.Next(
+            header.submeshCount * header.GetSubMeshDescriptorSize());
+        const auto materialBytes = reader.Next(header.materialCount * sizeof(VAMMAterialTemplate));
+        if (reader.IsTruncated()) return false;
+
+        // The materials give the number of resource bindings
+        VAArray<VAMMAterialTemplate> vamMaterials(header.materialCount);
+        CopySection(materialBytes, vamMaterials);
+        uint32_t totalBindings = 0;
+        for (const auto& mat : vamMaterials)
+        {
+            totalBindings += mat.bindingCount;
+        }
+
+        const auto bindingBytes = reader.Next(totalBindings * sizeof(VAMResourceBinding));
+        const auto meshletBytes = reader.Next(header.GetMeshletCount() * sizeof(VAMMeshlet));
+        const auto lodBytes = reader.Next(header.GetLodCount() * sizeof(VAMLod));
+        if (reader.IsTruncated()) return false;
+
+        if (reader.GetOffset() != data.size())
+        {
+            VA_ENGINE_WARN(
+                "[VAMLoader] Data size mismatch while parsing (expected {}, consumed {}).",
+                data.size(),
+                reader.GetOffset());
+        }
+
+        VAArray<VAMResourceBinding> allBindings(totalBindings);
+        CopySection(bindingBytes, allBindings);
+
+        RestoreVerticesFromVAM(vertexBytes, header, meshData);
+        RestoreIndicesFromVAM(indexBytes.data(), header, meshData);
+
+        // Convert VAM submeshes to engine format
+        const auto vamSubmeshes = ParseSubmeshes(submeshBytes.data(), header);
+        meshData.m_Submeshes.reserve(header.submeshCount);
+        for (const auto& vamSubmesh : vamSubmeshes)
+        {
+            SubMeshDescriptor submesh;
+            submesh.name = ReadFromStringTable(stringTable, vamSubmesh.nameOffset);
+            submesh.material = vamSubmesh.materialIndex; // Will be converted later
+            submesh.indexOffset = vamSubmesh.indexOffset;
+            submesh.indexCount = vamSubmesh.indexCount;
+            submesh.vertexOffset = vamSubmesh.vertexOffset;
+            submesh.vertexCount = vamSubmesh.vertexCount;
+            submesh.bounds = vamSubmesh.bounds.ToBounds();
+
+            meshData.m_Submeshes.push_back(submesh);
+        }
+
+        // Restore materials and update submesh material handles
+        RestoreMaterialFromVAM(vamMaterials, allBindings, stringTable, meshData.m_Submeshes);
+        RestoreBounds(header, meshData);
+        RestoreMeshletsFromVAM(meshletBytes.data(), header, meshData);
+        RestoreLodsFromVAM(lodBytes.data(), header, meshData);
+
+        // Split streams are the GPU layout, the upload copies them without converting
+        if (owner && header.HasSplitVertexStreams())
+        {
+            const auto positionsSize = header.vertexCount * sizeof(VertexPosition);
+            meshData.m_PackedGeometry = {
+                owner,
+                vertexBytes.first(positionsSize),
+                vertexBytes.subspan(positionsSize),
+                indexBytes,
+                header.HasCompactVertices(),
+                header.HasShortIndices()
+            };
+        }
+        return true;
+    }
+
+    bool VAMLoader::IsVAMValid(const std::string& vamPath, const std::string& sourcePath)
+    {
+        // Check if VAM file exists
+        if (!std::filesystem::exists(vamPath))
         {
             return false;
         }
@@ -723,10 +927,10 @@ namespace VoidArchitect::Resources::Loaders
                 return false;
             }
             VAMHeader header{};
-            file.read(reinterpret_cast<char*>(reinterpret_cast<uint8_t*>(&header)), sizeof(header));
+            const bool headerRead = ReadHeader(file, header);
             file.close();
 
-            if (!header.IsValid())
+            if (!headerRead)
             {
                 VA_ENGINE_WARN("[VAMLoader] Invalid VAM header.");
                 return false;
@@ -775,14 +979,176 @@ namespace VoidArchitect::Resources::Loaders
 
     std::string VAMLoader::GetVAMPath(const std::string& sourcePath) const
     {
-        return m_BaseAssetPath + "../cache/" + sourcePath + ".vam";
+        return m_CacheDirectory + sourcePath + ".vam";
     }
 
-    std::string VAMLoader::FindSourceAsset(const std::string& name) const
+    VAMLoader::BakeStatus VAMLoader::Bake(const std::string& name, const bool force)
+    {
+        // Offline bakes always compare the sources, whatever the runtime validation
+        if (const auto entry = m_CacheManifest.Find(name); !force && entry &&
+            std::filesystem::exists(m_CacheDirectory + entry->vamFile) &&
+            IsCacheEntryValid(name, *entry, VAMCacheManifest::Validation::CheckSources, false))
+        {
+            return BakeStatus::UpToDate;
+        }
+
+        const auto meshData = ImportMesh(name);
+        if (!meshData) return BakeStatus::Failed;
+
+        return BakeToCache(name, *meshData, false) ? BakeStatus::Baked : BakeStatus::Failed;
+    }
+
+    bool VAMLoader::SaveCacheManifest() const
+    {
+        if (m_CacheManifest.Save(m_CacheDirectory + VAM_MANIFEST_FILE_NAME)) return true;
+
+        VA_ENGINE_WARN("[VAMLoader] Failed to save the cache manifest.");
+        return false;
+    }
+
+    bool VAMLoader::TrainDictionary()
+    {
+        // Sections as they are compressed, a dictionary only pays off on the small files
+        VAArray<VAArray<uint8_t>> samples;
+        for (const auto& name : FindSourceAssets())
+        {
+            const auto entry = m_CacheManifest.Find(name);
+            if (!entry) continue;
+
+            auto sections = ReadSectionsFromVAM(m_CacheDirectory + entry->vamFile);
+            if (!sections.empty() && sections.size() <= m_CompressionSettings.dictionaryMaxSize)
+            {
+                samples.push_back(std::move(sections));
+            }
+        }
+
+        auto dictionary = VAMCompression::TrainDictionary(samples);
+        if (dictionary.empty())
+        {
+            VA_ENGINE_WARN(
+                "[VAMLoader] No dictionary trained from {} small cached meshes.",
+                samples.size());
+            return false;
+        }
+
+        TemporaryFile temporaryFile(m_CacheDirectory + VAM_DICTIONARY_FILE_NAME);
+        {
+            std::ofstream file(temporaryFile.GetPath(), std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(dictionary.data()), dictionary.size());
+            file.close();
+            if (file.fail())
+            {
+                VA_ENGINE_ERROR(
+                    "[VAMLoader] Failed to write dictionary: {}",
+                    temporaryFile.GetPath());
+                return false;
+            }
+        }
+        if (!temporaryFile.Replace()) return false;
+
+        const auto size = dictionary.size();
+        m_CompressionSettings.dictionaryId = VAMCompression::RegisterDictionary(
+            std::move(dictionary));
+        m_CacheManifest.SetDictionaryId(m_CompressionSettings.dictionaryId);
+
+        VA_ENGINE_INFO(
+            "[VAMLoader] Trained dictionary {:08x}, {} bytes from {} small cached meshes.",
+            m_CompressionSettings.dictionaryId,
+            size,
+            samples.size());
+        return true;
+    }
+
+    VAArray<std::string> VAMLoader::FindSourceAssets() const
     {
-        static constexpr std::string extensions[] = {".gltf", ".fbx", ".obj"};
+        VAArray<std::string> names;
+        std::error_code error;
+        for (const auto& item : std::filesystem::recursive_directory_iterator(
+                 m_BaseAssetPath,
+                 error))
+        {
+            if (!item.is_regular_file()) continue;
 
-        for (const auto& extension : extensions)
+            const auto& path = item.path();
+            if (std::ranges::find(RawMeshLoader::SOURCE_EXTENSIONS, path.extension().string()) ==
+                std::end(RawMeshLoader::SOURCE_EXTENSIONS))
+            {
+                continue;
+            }
+
+            // Named as Load() expects them, relative and without extension
+            auto name = path.lexically_relative(m_BaseAssetPath).replace_extension();
+            names.push_back(name.generic_string());
+        }
+
+        // A mesh found with several extensions is imported once, FindSourceAsset() picks one
+        std::ranges::sort(names);
+        names.erase(std::ranges::unique(names).begin(), names.end());
+        return names;
+    }
+
+    bool VAMLoader::IsCacheEntryValid(
+        const std::string& name,
+        const VAMCacheManifest::Entry& entry,
+        const VAMCacheManifest::Validation validation,
+        const bool saveManifest)
+    {
+        if (entry.settingsHash != GetSettingsHash())
+        {
+            VA_ENGINE_TRACE("[VAMLoader] VAM of '{}' was baked with other settings.", name);
+            return false;
+        }
+
+        if (validation == VAMCacheManifest::Validation::Trust || entry.sourceFile.empty())
+        {
+            return true;
+        }
+
+        auto refreshed = entry;
+        switch (VAMCacheManifest::CheckSource(m_BaseAssetPath + entry.sourceFile, refreshed))
+        {
+            case VAMCacheManifest::SourceState::Unchanged:
+            case VAMCacheManifest::SourceState::Missing:
+                return true;
+            case VAMCacheManifest::SourceState::Touched:
+                // Same content, remember the new time so that it is not hashed on every start
+                m_CacheManifest.Record(name, std::move(refreshed));
+                if (saveManifest) SaveCacheManifest();
+                return true;
+            case VAMCacheManifest::SourceState::Modified:
+                VA_ENGINE_TRACE("[VAMLoader] Source of '{}' changed since it was baked.", name);
+                return false;
+        }
+        return false;
+    }
+
+    void VAMLoader::RecordInCache(
+        const std::string& name,
+        const std::string& vamPath,
+        const std::string& sourcePath,
+        const bool saveManifest)
+    {
+        // Relative paths, the cache stays valid when the checkout is moved
+        const auto relative = [](const std::string& path, const std::string& base)
+        {
+            return std::filesystem::path(path).lexically_relative(base).generic_string();
+        };
+
+        VAMCacheManifest::Entry entry;
+        entry.vamFile = relative(vamPath, m_CacheDirectory);
+        entry.settingsHash = GetSettingsHash();
+        if (!sourcePath.empty() && VAMCacheManifest::HashSource(sourcePath, entry))
+        {
+            entry.sourceFile = relative(sourcePath, m_BaseAssetPath);
+        }
+
+        m_CacheManifest.Record(name, std::move(entry));
+        if (saveManifest) SaveCacheManifest();
+    }
+
+    std::string VAMLoader::FindSourceAsset(const std::string& name) const
+    {
+        for (const auto& extension : RawMeshLoader::SOURCE_EXTENSIONS)
         {
             std::string path = m_BaseAssetPath + name;
             path += extension;
@@ -795,7 +1161,22 @@ namespace VoidArchitect::Resources::Loaders
         return "";
     }
 
-    MeshDataDefinitionPtr VAMLoader::ImportAndBake(const std::string& name) const
+    uint64_t VAMLoader::GetSettingsHash() const
+    {
+        // Caches baked through assimp keep the hash they had before the importer was a setting
+        const auto hash = VAMCacheManifest::HashSettings(m_CompressionSettings);
+        if (GetMeshImporter() == MeshImporter::Assimp) return hash;
+        return XXHash64::HashValue(GetMeshImporter(), hash);
+    }
+
+    MeshDataDefinitionPtr VAMLoader::ImportAndBake(const std::string& name)
+    {
+        auto meshData = ImportMesh(name);
+        if (meshData) BakeToCache(name, *meshData, true);
+        return meshData;
+    }
+
+    MeshDataDefinitionPtr VAMLoader::ImportMesh(const std::string& name) const
     {
         // Use raw loader to import from source file
         auto meshData = std::dynamic_pointer_cast<MeshDataDefinition>(m_RawMeshLoader->Load(name));
@@ -805,22 +1186,413 @@ namespace VoidArchitect::Resources::Loaders
             return nullptr;
         }
 
-        // Bake to VAM for future loads
-        auto vamPath = GetVAMPath(name);
-        if (SaveMeshToVAM(
-            vamPath,
-            FindSourceAsset(std::filesystem::path(vamPath).stem().string()),
-            *meshData,
-            m_CompressionSettings))
+        // Reorder triangles and vertices once, so that every later load gets them for free
+        OptimizeMeshForGPU(name, *meshData);
+        if (m_CompressionSettings.compactVertices)
         {
-            VA_ENGINE_TRACE("[VAMLoader] Successfully baked mesh '{}' to VAM.", name);
+            QuantizeVertices(name, *meshData, m_CompressionSettings.compactVerticesMaxUV);
         }
-        else
+        BuildLods(name, *meshData);
+        BuildMeshlets(name, *meshData);
+
+        return meshData;
+    }
+
+    bool VAMLoader::BakeToCache(
+        const std::string& name,
+        const MeshDataDefinition& meshData,
+        const bool saveManifest)
+    {
+        // Bake to VAM for future loads
+        const auto vamPath = GetVAMPath(name);
+        const auto sourcePath = FindSourceAsset(name);
+
+        // Meshes may live in subdirectories of the asset directory
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(vamPath).parent_path(), error);
+
+        if (!SaveMeshToVAM(vamPath, sourcePath, meshData, m_CompressionSettings))
         {
             VA_ENGINE_WARN("[VAMLoader] Failed to bake mesh '{}' to VAM.", name);
+            return false;
         }
 
-        return meshData;
+        VA_ENGINE_TRACE("[VAMLoader] Successfully baked mesh '{}' to VAM.", name);
+        RecordInCache(name, vamPath, sourcePath, saveManifest);
+        return true;
+    }
+
+    void VAMLoader::OptimizeMeshForGPU(const std::string& name, MeshDataDefinition& meshData)
+    {
+        VertexCacheStats totalBefore;
+        VertexCacheStats totalAfter;
+        float totalTriangles = 0.0f;
+        float totalVertices = 0.0f;
+
+        for (const auto& submesh : meshData.m_Submeshes)
+        {
+            const auto [before, after] = MeshOptimizer::Optimize(
+                meshData.m_Vertices,
+                meshData.m_Indices,
+                submesh);
+
+            VA_ENGINE_TRACE(
+                "[VAMLoader] Optimized submesh '{}': ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}.",
+                submesh.name,
+                before.acmr,
+                after.acmr,
+                before.atvr,
+                after.atvr);
+
+            // Weight the mesh totals by triangles (ACMR) and vertices (ATVR)
+            const auto triangles = static_cast<float>(submesh.indexCount / 3);
+            const auto vertices = static_cast<float>(submesh.vertexCount);
+            totalBefore.acmr += before.acmr * triangles;
+            totalAfter.acmr += after.acmr * triangles;
+            totalBefore.atvr += before.atvr * vertices;
+            totalAfter.atvr += after.atvr * vertices;
+            totalTriangles += triangles;
+            totalVertices += vertices;
+        }
+
+        if (totalTriangles == 0.0f || totalVertices == 0.0f) return;
+
+        VA_ENGINE_INFO(
+            "[VAMLoader] Optimized mesh '{}' for GPU: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}.",
+            name,
+            totalBefore.acmr / totalTriangles,
+            totalAfter.acmr / totalTriangles,
+            totalBefore.atvr / totalVertices,
+            totalAfter.atvr / totalVertices);
+    }
+
+    void VAMLoader::QuantizeVertices(
+        const std::string& name,
+        MeshDataDefinition& meshData,
+        const float maxUV)
+    {
+        auto& vertices = meshData.m_Vertices;
+        const auto uvOutOfRange = std::ranges::any_of(
+            vertices,
+            [maxUV](const MeshVertex& vertex)
+            {
+                return std::abs(vertex.UV0.X()) > maxUV || std::abs(vertex.UV0.Y()) > maxUV;
+            });
+        if (uvOutOfRange)
+        {
+            VA_ENGINE_TRACE(
+                "[VAMLoader] Mesh '{}' has UVs beyond {}, keeping full precision vertices.",
+                name,
+                maxUV);
+            return;
+        }
+
+        // Round trip now, so that this import matches what later loads of the VAM return
+        VAArray<CompactVertex> compactVertices(vertices.size());
+        VertexQuantization::Encode(vertices, compactVertices);
+        VertexQuantization::Decode(compactVertices, vertices);
+        meshData.m_CompactVertices = true;
+
+        VA_ENGINE_TRACE(
+            "[VAMLoader] Mesh '{}' vertices quantized, {} KiB -> {} KiB.",
+            name,
+            vertices.size() * sizeof(VAMVertex) / 1024,
+            vertices.size() * sizeof(CompactVertex) / 1024);
+    }
+
+    void VAMLoader::ReadVerticesForVAM(
+        const MeshDataDefinition& meshData,
+        const uint64_t offset,
+        const std::span<uint8_t> bytes)
+    {
+        // Every position, then every other attribute, see VertexStreams
+        const std::span vertices = meshData.GetVertices();
+        const auto positionsSize = vertices.size() * sizeof(VertexPosition);
+        auto remaining = bytes;
+        if (offset < positionsSize)
+        {
+            const auto count = std::min<size_t>(remaining.size(), positionsSize - offset);
+            ReadConverted<VertexPosition>(
+                offset,
+                remaining.first(count),
+                [vertices](const size_t first, const std::span<VertexPosition> batch)
+                {
+                    VertexStreams::ExtractPositions(
+                        vertices.subspan(first, batch.size()),
+                        batch);
+                });
+            remaining = remaining.subspan(count);
+        }
+        if (remaining.empty()) return;
+
+        const auto attributeOffset = offset + bytes.size() - remaining.size() - positionsSize;
+        if (meshData.HasCompactVertices())
+        {
+            ReadConverted<CompactVertexAttributes>(
+                attributeOffset,
+                remaining,
+                [vertices](const size_t first, const std::span<CompactVertexAttributes> batch)
+                {
+                    VertexStreams::ExtractCompactAttributes(
+                        vertices.subspan(first, batch.size()),
+                        batch);
+                });
+            return;
+        }
+
+        ReadConverted<VertexAttributes>(
+            attributeOffset,
+            remaining,
+            [vertices](const size_t first, const std::span<VertexAttributes> batch)
+            {
+                VertexStreams::ExtractAttributes(vertices.subspan(first, batch.size()), batch);
+            });
+    }
+
+    void VAMLoader::RestoreVerticesFromVAM(
+        const std::span<const uint8_t> data,
+        const VAMHeader& header,
+        MeshDataDefinition& meshData)
+    {
+        const size_t vertexCount = header.vertexCount;
+        meshData.m_Vertices.resize(vertexCount);
+        meshData.m_CompactVertices = header.HasCompactVertices();
+
+        if (header.HasSplitVertexStreams())
+        {
+            VAArray<VertexPosition> positionStorage;
+            const auto positions = ViewSection(data, vertexCount, positionStorage);
+            const auto attributeBytes = data.subspan(vertexCount * sizeof(VertexPosition));
+
+            if (meshData.m_CompactVertices)
+            {
+                VAArray<CompactVertexAttributes> attributeStorage;
+                const auto attributes = ViewSection(
+                    attributeBytes,
+                    vertexCount,
+                    attributeStorage);
+
+                // Interleave and decode batch by batch, the quantized vertices are transient
+                CompactVertex batch[DECODE_BATCH_SIZE];
+                for (size_t first = 0; first < vertexCount; first += DECODE_BATCH_SIZE)
+                {
+                    const auto count = std::min(DECODE_BATCH_SIZE, vertexCount - first);
+                    const std::span compactVertices(batch, count);
+                    VertexStreams::Interleave(
+                        positions.subspan(first, count),
+                        attributes.subspan(first, count),
+                        compactVertices);
+                    VertexQuantization::Decode(
+                        compactVertices,
+                        std::span(meshData.m_Vertices).subspan(first, count));
+                }
+                return;
+            }
+
+            VAArray<VertexAttributes> attributeStorage;
+            const auto attributes = ViewSection(attributeBytes, vertexCount, attributeStorage);
+            VertexStreams::Interleave(positions, attributes, meshData.m_Vertices);
+            return;
+        }
+
+        if (meshData.m_CompactVertices)
+        {
+            VAArray<CompactVertex> compactVertices(header.vertexCount);
+            CopySection(data, compactVertices);
+            VertexQuantization::Decode(compactVertices, meshData.m_Vertices);
+            return;
+        }
+
+        for (uint32_t i = 0; i < header.vertexCount; ++i)
+        {
+            VAMVertex vamVertex;
+            memcpy(&vamVertex, data.data() + i * sizeof(VAMVertex), sizeof(VAMVertex));
+
+            // Convert to engine format
+            MeshVertex& vertex = meshData.m_Vertices[i];
+            vertex.Position = vamVertex.position;
+            vertex.Normal = vamVertex.normal;
+            vertex.UV0 = vamVertex.uv0;
+            vertex.Tangent = vamVertex.tangent;
+        }
+    }
+
+    void VAMLoader::BuildMeshlets(const std::string& name, MeshDataDefinition& meshData)
+    {
+        meshData.m_Meshlets.clear();
+        for (uint32_t i = 0; i < meshData.m_Submeshes.size(); ++i)
+        {
+            auto& submesh = meshData.m_Submeshes[i];
+            submesh.meshletOffset = static_cast<uint32_t>(meshData.m_Meshlets.size());
+            MeshletBuilder::Build(
+                meshData.m_Vertices,
+                meshData.m_Indices,
+                submesh,
+                i,
+                meshData.m_Meshlets);
+            submesh.meshletCount = static_cast<uint32_t>(meshData.m_Meshlets.size()) -
+                submesh.meshletOffset;
+        }
+
+        VA_ENGINE_TRACE(
+            "[VAMLoader] Mesh '{}' split into {} meshlets.",
+            name,
+            meshData.m_Meshlets.size());
+    }
+
+    void VAMLoader::BuildLods(const std::string& name, MeshDataDefinition& meshData)
+    {
+        meshData.m_Lods.clear();
+        for (uint32_t i = 0; i < meshData.m_Submeshes.size(); ++i)
+        {
+            auto& submesh = meshData.m_Submeshes[i];
+            submesh.lodOffset = static_cast<uint32_t>(meshData.m_Lods.size());
+            MeshSimplifier::BuildLodChain(
+                meshData.m_Vertices,
+                meshData.m_Indices,
+                submesh,
+                i,
+                meshData.m_Lods);
+            submesh.lodCount = static_cast<uint32_t>(meshData.m_Lods.size()) - submesh.lodOffset;
+
+            std::string triangles = std::to_string(submesh.indexCount / 3);
+            for (const auto& lod : std::span(meshData.m_Lods).subspan(submesh.lodOffset))
+            {
+                triangles += " -> " + std::to_string(lod.GetTriangleCount());
+            }
+            VA_ENGINE_TRACE(
+                "[VAMLoader] Submesh '{}' LOD triangles: {}.",
+                submesh.name,
+                triangles);
+        }
+
+        VA_ENGINE_TRACE(
+            "[VAMLoader] Mesh '{}' simplified into {} LODs.",
+            name,
+            meshData.m_Lods.size());
+    }
+
+    void VAMLoader::RestoreLodsFromVAM(
+        const uint8_t* data,
+        const VAMHeader& header,
+        MeshDataDefinition& meshData)
+    {
+        const auto lodCount = header.GetLodCount();
+        meshData.m_Lods.resize(lodCount);
+        for (uint32_t i = 0; i < lodCount; ++i)
+        {
+            VAMLod vamLod;
+            memcpy(&vamLod, data + i * sizeof(VAMLod), sizeof(VAMLod));
+            meshData.m_Lods[i] = vamLod.ToLod();
+        }
+
+        // LODs are stored grouped by submesh, in submesh order, with their indices at the end
+        // of the index section
+        for (auto& submesh : meshData.m_Submeshes)
+        {
+            submesh.lodOffset = 0;
+            submesh.lodCount = 0;
+        }
+        for (uint32_t i = 0; i < lodCount; ++i)
+        {
+            const auto& lod = meshData.m_Lods[i];
+            if (lod.submeshIndex >= meshData.m_Submeshes.size() ||
+                lod.indexOffset + lod.indexCount > meshData.m_Indices.size())
+            {
+                VA_ENGINE_WARN("[VAMLoader] LOD {} is out of range, ignoring LODs.", i);
+                meshData.m_Lods.clear();
+                for (auto& submesh : meshData.m_Submeshes) submesh.lodCount = 0;
+                return;
+            }
+
+            auto& submesh = meshData.m_Submeshes[lod.submeshIndex];
+            if (submesh.lodCount == 0) submesh.lodOffset = i;
+            ++submesh.lodCount;
+        }
+    }
+
+    void VAMLoader::RestoreMeshletsFromVAM(
+        const uint8_t* data,
+        const VAMHeader& header,
+        MeshDataDefinition& meshData)
+    {
+        const auto meshletCount = header.GetMeshletCount();
+        meshData.m_Meshlets.resize(meshletCount);
+        for (uint32_t i = 0; i < meshletCount; ++i)
+        {
+            VAMMeshlet vamMeshlet;
+            memcpy(&vamMeshlet, data + i * sizeof(VAMMeshlet), sizeof(VAMMeshlet));
+            meshData.m_Meshlets[i] = vamMeshlet.ToMeshlet();
+        }
+
+        // Meshlets are stored grouped by submesh, in submesh order
+        for (auto& submesh : meshData.m_Submeshes)
+        {
+            submesh.meshletOffset = 0;
+            submesh.meshletCount = 0;
+        }
+        for (uint32_t i = 0; i < meshletCount; ++i)
+        {
+            const auto submeshIndex = meshData.m_Meshlets[i].submeshIndex;
+            if (submeshIndex >= meshData.m_Submeshes.size())
+            {
+                VA_ENGINE_WARN(
+                    "[VAMLoader] Meshlet {} refers to an invalid submesh, ignoring meshlets.",
+                    i);
+                meshData.m_Meshlets.clear();
+                for (auto& submesh : meshData.m_Submeshes) submesh.meshletCount = 0;
+                return;
+            }
+
+            auto& submesh = meshData.m_Submeshes[submeshIndex];
+            if (submesh.meshletCount == 0) submesh.meshletOffset = i;
+            ++submesh.meshletCount;
+        }
+    }
+
+    void VAMLoader::ReadIndicesForVAM(
+        const MeshDataDefinition& meshData,
+        const bool shortIndices,
+        const uint64_t offset,
+        const std::span<uint8_t> bytes)
+    {
+        const std::span indices = meshData.GetIndices();
+        if (!shortIndices)
+        {
+            CopyElements(indices, offset, bytes);
+            return;
+        }
+
+        ReadConverted<uint16_t>(
+            offset,
+            bytes,
+            [indices](const size_t first, const std::span<uint16_t> batch)
+            {
+                for (size_t i = 0; i < batch.size(); ++i)
+                {
+                    batch[i] = static_cast<uint16_t>(indices[first + i]);
+                }
+            });
+    }
+
+    void VAMLoader::RestoreIndicesFromVAM(
+        const uint8_t* data,
+        const VAMHeader& header,
+        MeshDataDefinition& meshData)
+    {
+        meshData.m_Indices.resize(header.indexCount);
+        if (!header.HasShortIndices())
+        {
+            memcpy(meshData.m_Indices.data(), data, header.indexCount * sizeof(uint32_t));
+            return;
+        }
+
+        for (uint32_t i = 0; i < header.indexCount; ++i)
+        {
+            uint16_t index;
+            memcpy(&index, data + i * sizeof(uint16_t), sizeof(uint16_t));
+            meshData.m_Indices[i] = index;
+        }
     }
 
     uint32_t VAMLoader::AddToStringTable(
@@ -849,7 +1621,9 @@ namespace VoidArchitect::Resources::Loaders
         return offset;
     }
 
-    std::string VAMLoader::ReadFromStringTable(const VAArray<uint8_t>& stringTable, uint32_t offset)
+    std::string VAMLoader::ReadFromStringTable(
+        const std::span<const uint8_t> stringTable,
+        const uint32_t offset)
     {
         if (offset >= stringTable.size())
         {
@@ -870,6 +1644,139 @@ namespace VoidArchitect::Resources::Loaders
         return result;
     }
 
+    bool VAMLoader::ReadHeader(std::istream& file, VAMHeader& header)
+    {
+        // Older headers are a prefix of the current one: read that prefix first, then the
+        // fields this version adds.
+        header = VAMHeader{};
+        file.read(reinterpret_cast<char*>(&header), VAM_HEADER_SIZE_V1);
+        if (!file || !header.IsValid())
+        {
+            return false;
+        }
+
+        if (header.GetSize() > VAM_HEADER_SIZE_V1)
+        {
+            file.read(
+                reinterpret_cast<char*>(&header) + VAM_HEADER_SIZE_V1,
+                static_cast<std::streamsize>(header.GetSize() - VAM_HEADER_SIZE_V1));
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    bool VAMLoader::ReadHeader(const std::span<const uint8_t> data, VAMHeader& header)
+    {
+        // Same prefix logic as the stream overload
+        header = VAMHeader{};
+        if (data.size() < VAM_HEADER_SIZE_V1) return false;
+
+        memcpy(&header, data.data(), VAM_HEADER_SIZE_V1);
+        if (!header.IsValid() || data.size() < header.GetSize()) return false;
+
+        memcpy(
+            reinterpret_cast<uint8_t*>(&header) + VAM_HEADER_SIZE_V1,
+            data.data() + VAM_HEADER_SIZE_V1,
+            header.GetSize() - VAM_HEADER_SIZE_V1);
+        return true;
+    }
+
+    VAArray<VAMSubMeshDescriptor> VAMLoader::ParseSubmeshes(
+        const uint8_t* data,
+        const VAMHeader& header)
+    {
+        VAArray<VAMSubMeshDescriptor> vamSubmeshes(header.submeshCount);
+        for (uint32_t i = 0; i < header.submeshCount; ++i)
+        {
+            if (header.HasBounds())
+            {
+                memcpy(&vamSubmeshes[i], data, sizeof(VAMSubMeshDescriptor));
+            }
+            else
+            {
+                VAMSubMeshDescriptorV1 v1;
+                memcpy(&v1, data, sizeof(VAMSubMeshDescriptorV1));
+                vamSubmeshes[i] = VAMSubMeshDescriptor(v1);
+            }
+            data += header.GetSubMeshDescriptorSize();
+        }
+
+        return vamSubmeshes;
+    }
+
+    VAArray<VAMSubMeshDescriptor> VAMLoader::ConvertSubmeshesToVAM(
+        const MeshDataDefinition& meshData,
+        const VAHashMap<std::string, uint32_t>& stringOffsets)
+    {
+        // Material indices follow the first-use order used by ConvertMaterialsToVAM
+        VAHashMap<MaterialHandle, uint32_t> materialIndexMap;
+        uint32_t matIndex = 0;
+        for (const auto& submesh : meshData.GetSubmeshes())
+        {
+            if (!materialIndexMap.contains(submesh.material))
+            {
+                materialIndexMap[submesh.material] = matIndex++;
+            }
+        }
+
+        VAArray<VAMSubMeshDescriptor> vamSubmeshes;
+        vamSubmeshes.reserve(meshData.GetSubmeshes().size());
+        for (const auto& submesh : meshData.GetSubmeshes())
+        {
+            VAMSubMeshDescriptor vamSubmesh{};
+            auto it = stringOffsets.find(submesh.name);
+            if (it != stringOffsets.end())
+            {
+                vamSubmesh.nameOffset = it->second;
+            }
+            else
+            {
+                VA_ENGINE_ERROR(
+                    "[VAMLoader] Submesh name '{}' not found in string table.",
+                    submesh.name);
+                vamSubmesh.nameOffset = 0;
+            }
+
+            vamSubmesh.materialIndex = materialIndexMap[submesh.material];
+            vamSubmesh.indexOffset = submesh.indexOffset;
+            vamSubmesh.indexCount = submesh.indexCount;
+            vamSubmesh.vertexOffset = submesh.vertexOffset;
+            vamSubmesh.vertexCount = submesh.vertexCount;
+
+            if (submesh.bounds.IsValid() ||
+                submesh.GetVertexEnd() > meshData.GetVertices().size())
+            {
+                vamSubmesh.bounds = VAMBounds(submesh.bounds);
+            }
+            else
+            {
+                vamSubmesh.bounds = VAMBounds(
+                    MeshData::ComputeBounds(
+                        std::span(meshData.GetVertices()).subspan(
+                            submesh.vertexOffset,
+                            submesh.vertexCount)));
+            }
+
+            vamSubmeshes.push_back(vamSubmesh);
+        }
+
+        return vamSubmeshes;
+    }
+
+    void VAMLoader::RestoreBounds(const VAMHeader& header, MeshDataDefinition& meshData)
+    {
+        if (header.HasBounds())
+        {
+            meshData.m_Bounds = header.bounds.ToBounds();
+            return;
+        }
+
+        VA_ENGINE_TRACE(
+            "[VAMLoader] VAM version {} has no bounds, computing them at load.",
+            header.version);
+        meshData.RecalculateBounds();
+    }
+
     VAArray<VAMMAterialTemplate> VAMLoader::ConvertMaterialsToVAM(
         const VAArray<SubMeshDescriptor>& submeshes,
         VAArray<uint8_t>& stringTable,
@@ -887,7 +1794,7 @@ namespace VoidArchitect::Resources::Loaders
             if (materialIndexMap.contains(handle)) continue;
 
             // Get material template from the system
-            auto& matTemplate = g_MaterialSystem->GetTemplateFor(handle);
+            const auto matTemplate = g_MaterialSystem->GetTemplateFor(handle);
 
             VAMMAterialTemplate vamMat;
 
@@ -937,7 +1844,7 @@ namespace VoidArchitect::Resources::Loaders
     void VAMLoader::RestoreMaterialFromVAM(
         const VAArray<VAMMAterialTemplate>& vamMaterials,
         const VAArray<VAMResourceBinding>& bindings,
-        const VAArray<uint8_t>& stringTable,
+        const std::span<const uint8_t> stringTable,
         VAArray<SubMeshDescriptor>& submeshes)
     {
         VAArray<MaterialHandle> materialHandles;
@@ -3,7 +3,9 @@
 //
 #pragma once
 #include "Loader.hpp"
+#include "Platform/FileSystem/MappedFile.hpp"
 #include "RawMeshLoader.hpp"
+#include "VamCacheManifest.hpp"
 #include "VamCompression.hpp"
 #include "VAMFormat.hpp"
 
@@ -17,6 +19,39 @@ namespace VoidArchitect::Resources::Loaders
 
         std::shared_ptr<IResourceDefinition> Load(const std::string& name) override;
 
+        /// @brief Outcome of Bake()
+        enum class BakeStatus : uint8_t
+        {
+            UpToDate, ///< The cached file matches the source and the settings, left as is
+            Baked,
+            Failed ///< The source cannot be imported or the file cannot be written
+        };
+
+        /// @brief Import a mesh and bake it to the cache, unless its cached file is up to date
+        /// @param name Name of the mesh, as given to Load()
+        /// @param force Bake even an up to date mesh
+        ///
+        /// Offline counterpart of Load(), the sources are checked whatever the cache
+        /// validation. Meshes can be baked in parallel from several jobs.
+        ///
+        /// @note The manifest is updated in memory only, call SaveCacheManifest() once done.
+        BakeStatus Bake(const std::string& name, bool force = false);
+
+        /// @brief Write the cache manifest, false if it cannot be written
+        bool SaveCacheManifest() const;
+
+        /// @brief Train the LZ4 dictionary of the cache on its small baked files, and bake
+        ///        against it from now on
+        /// @return false if no dictionary could be trained or written
+        ///
+        /// Every cached file whose sections fit dictionaryMaxSize is a sample. The dictionary is
+        /// written to the cache directory at once, registered and recorded in the manifest.
+        /// The files baked before are then out of date, Bake() them again and save the manifest.
+        bool TrainDictionary();
+
+        /// @brief Name of every source mesh under the asset directory, as given to Load()
+        VAArray<std::string> FindSourceAssets() const;
+
         // Compression settings
         void SetCompressionSettings(const VAMCompressionSettings& settings)
         {
@@ -28,32 +63,196 @@ namespace VoidArchitect::Resources::Loaders
             return m_CompressionSettings;
         }
 
+        /// @brief How cached files are checked against their sources, see VAMCacheManifest
+        ///
+        /// Debug builds check the sources so that edited assets are baked again, other builds
+        /// trust the manifest and start without accessing the asset directory.
+        void SetCacheValidation(const VAMCacheManifest::Validation validation)
+        {
+            m_CacheValidation = validation;
+        }
+
+        VAMCacheManifest::Validation GetCacheValidation() const { return m_CacheValidation; }
+
+        /// @brief Backend importing the source meshes, part of the settings of the cached files
+        void SetMeshImporter(const MeshImporter importer)
+        {
+            m_RawMeshLoader->SetImporter(importer);
+        }
+
+        MeshImporter GetMeshImporter() const { return m_RawMeshLoader->GetImporter(); }
+
+        const VAMCacheManifest& GetCacheManifest() const { return m_CacheManifest; }
+
         static bool SaveMeshToVAM(
             const std::string& vamPath,
             const std::string& sourcePath,
             const MeshDataDefinition& meshData,
             const VAMCompressionSettings& compressionSettings);
-        static MeshDataDefinitionPtr LoadMeshFromVAM(const std::string& vamPath);
+
+        /// @brief Read a VAM file of any supported version
+        /// @param vamPath Path of the file, from an asset pack or the disk
+        /// @param mode How a loose file is read, mapped by default
+        /// @return The mesh, nullptr if the file is invalid
+        ///
+        /// The sections are parsed in place from the file bytes, or from the buffer compressed
+        /// files are decompressed into, chunk by chunk in parallel. The vertex and index
+        /// sections stay attached to the definition, see
+        /// MeshDataDefinition::GetPackedGeometry(): the GPU upload stages them as they are.
+        static MeshDataDefinitionPtr LoadMeshFromVAM(
+            const std::string& vamPath,
+            Platform::MappedFile::Mode mode = Platform::MappedFile::Mode::Map);
 
         static bool IsVAMValid(const std::string& vamPath, const std::string& sourcePath);
 
     private:
         std::unique_ptr<RawMeshLoader> m_RawMeshLoader;
         VAMCompressionSettings m_CompressionSettings;
+        std::string m_CacheDirectory;
+        VAMCacheManifest m_CacheManifest;
+#ifdef DEBUG
+        VAMCacheManifest::Validation m_CacheValidation = VAMCacheManifest::Validation::CheckSources;
+#else
+        VAMCacheManifest::Validation m_CacheValidation = VAMCacheManifest::Validation::Trust;
+#endif
 
         std::string GetVAMPath(const std::string& sourcePath) const;
         std::string FindSourceAsset(const std::string& name) const;
+        uint64_t GetSettingsHash() const;
+
+        MeshDataDefinitionPtr ImportAndBake(const std::string& name);
 
-        MeshDataDefinitionPtr ImportAndBake(const std::string& name) const;
+        /// @brief Import a source mesh and prepare it for the GPU: optimized, quantized, with
+        ///        its LODs and meshlets
+        MeshDataDefinitionPtr ImportMesh(const std::string& name) const;
+
+        /// @brief Write an imported mesh to the cache and record it in the manifest
+        bool BakeToCache(
+            const std::string& name,
+            const MeshDataDefinition& meshData,
+            bool saveManifest);
+
+        /// @brief Whether a manifest entry was baked with the current settings from the
+        ///        current source, an entry whose source was only touched is refreshed
+        bool IsCacheEntryValid(
+            const std::string& name,
+            const VAMCacheManifest::Entry& entry,
+            VAMCacheManifest::Validation validation,
+            bool saveManifest);
+
+        /// @brief Record a baked file in the manifest, hashing its source
+        void RecordInCache(
+            const std::string& name,
+            const std::string& vamPath,
+            const std::string& sourcePath,
+            bool saveManifest);
+
+        /// @brief Run MeshOptimizer on every submesh and log the cache statistics
+        static void OptimizeMeshForGPU(const std::string& name, MeshDataDefinition& meshData);
+
+        /// @brief Quantize the vertices through VertexQuantization and mark them compact,
+        ///        unless a UV exceeds maxUV where half floats lose too much precision
+        static void QuantizeVertices(
+            const std::string& name,
+            MeshDataDefinition& meshData,
+            float maxUV);
+
+        /// @brief Bytes [offset, offset + bytes.size()) of the vertex section, split into a
+        ///        position and an attribute stream, the attributes compact or not depending on
+        ///        the mesh. Only the vertices the range covers are converted.
+        static void ReadVerticesForVAM(
+            const MeshDataDefinition& meshData,
+            uint64_t offset,
+            std::span<uint8_t> bytes);
+
+        /// @brief Decompress the sections following the header of a compressed file
+        /// @return The sections, empty if the block is invalid
+        static VAArray<uint8_t> DecompressSections(
+            std::span<const uint8_t> block,
+            const VAMHeader& header);
+
+        /// @brief Sections following the header of a VAM file, decompressed if needed
+        /// @return The sections, empty if the file cannot be read
+        static VAArray<uint8_t> ReadSectionsFromVAM(const std::string& vamPath);
+
+        /// @brief Parse every section following the header, compressed or not
+        /// @param data Sections, decompressed if the file is compressed
+        /// @param header Header of the file
+        /// @param owner Keeps `data` alive, the vertex and index sections are attached to the
+        ///        definition when set
+        /// @param meshData Definition to fill
+        /// @return false if `data` is too small for the sections the header describes
+        static bool ParseSections(
+            std::span<const uint8_t> data,
+            const VAMHeader& header,
+            const std::shared_ptr<const void>& owner,
+            MeshDataDefinition& meshData);
+
+        /// @brief Read a vertex section of any layout, split or interleaved
+        /// @note Aligned split sections are interleaved in place, without a copy.
+        static void RestoreVerticesFromVAM(
+            std::span<const uint8_t> data,
+            const VAMHeader& header,
+            MeshDataDefinition& meshData);
+
+        /// @brief Append the simplified levels of every submesh, see MeshSimplifier
+        static void BuildLods(const std::string& name, MeshDataDefinition& meshData);
+
+        /// @brief Read the LOD section and link every submesh to its levels
+        static void RestoreLodsFromVAM(
+            const uint8_t* data,
+            const VAMHeader& header,
+            MeshDataDefinition& meshData);
+
+        /// @brief Partition every submesh into meshlets, see MeshletBuilder
+        static void BuildMeshlets(const std::string& name, MeshDataDefinition& meshData);
+
+        /// @brief Read the meshlet section and link every submesh to its meshlets
+        static void RestoreMeshletsFromVAM(
+            const uint8_t* data,
+            const VAMHeader& header,
+            MeshDataDefinition& meshData);
+
+        /// @brief Bytes [offset, offset + bytes.size()) of the index section, narrowed to
+        ///        uint16_t when shortIndices is set
+        static void ReadIndicesForVAM(
+            const MeshDataDefinition& meshData,
+            bool shortIndices,
+            uint64_t offset,
+            std::span<uint8_t> bytes);
+
+        /// @brief Read an index section of either width into the 32-bit CPU indices
+        static void RestoreIndicesFromVAM(
+            const uint8_t* data,
+            const VAMHeader& header,
+            MeshDataDefinition& meshData);
 
         static uint32_t AddToStringTable(
             const std::string& str,
             VAArray<uint8_t>& stringTable,
             VAHashMap<std::string, uint32_t>& stringOffsets);
         static std::string ReadFromStringTable(
-            const VAArray<uint8_t>& stringTable,
+            std::span<const uint8_t> stringTable,
             uint32_t offset);
 
+        /// @brief Read a header of any supported version, return false if it is invalid
+        static bool ReadHeader(std::istream& file, VAMHeader& header);
+
+        /// @brief Read a header of any supported version from the start of a file in memory
+        static bool ReadHeader(std::span<const uint8_t> data, VAMHeader& header);
+
+        /// @brief Read the submesh descriptors of any supported version
+        static VAArray<VAMSubMeshDescriptor> ParseSubmeshes(
+            const uint8_t* data,
+            const VAMHeader& header);
+
+        static VAArray<VAMSubMeshDescriptor> ConvertSubmeshesToVAM(
+            const MeshDataDefinition& meshData,
+            const VAHashMap<std::string, uint32_t>& stringOffsets);
+
+        /// @brief Use the baked bounds, or compute them for files older than version 2
+        static void RestoreBounds(const VAMHeader& header, MeshDataDefinition& meshData);
+
         static VAArray<VAMMAterialTemplate> ConvertMaterialsToVAM(
             const VAArray<SubMeshDescriptor>& submeshes,
             VAArray<uint8_t>& stringTable,
@@ -63,7 +262,7 @@ namespace VoidArchitect::Resources::Loaders
         static void RestoreMaterialFromVAM(
             const VAArray<VAMMAterialTemplate>& vamMaterials,
             const VAArray<VAMResourceBinding>& bindings,
-            const VAArray<uint8_t>& stringTable,
+            std::span<const uint8_t> stringTable,
             VAArray<SubMeshDescriptor>& submeshes);
     };
 }
@@ -9,8 +9,10 @@ namespace VoidArchitect::Resources
     IMesh::IMesh(
         std::string name,
         std::shared_ptr<MeshData> data,
-        const VAArray<SubMeshDescriptor>& submeshes)
+        const VAArray<SubMeshDescriptor>& submeshes,
+        const Renderer::VertexFormat vertexFormat)
         : m_Name(std::move(name)),
+          m_VertexFormat(vertexFormat),
           m_Data(std::move(data)),
           m_Submeshes(submeshes)
     {
@@ -3,6 +3,7 @@
 //
 #pragma once
 #include "Core/Handle.hpp"
+#include "Systems/Renderer/RendererTypes.hpp"
 
 namespace VoidArchitect
 {
@@ -75,13 +76,18 @@ namespace VoidArchitect
             [[nodiscard]] virtual std::shared_ptr<MeshData> GetMeshData() const = 0;
             [[nodiscard]] virtual uint32_t GetDataGeneration() const = 0;
 
+            /// @brief Layout of the vertex buffer, the render state must expect the same one
+            [[nodiscard]] Renderer::VertexFormat GetVertexFormat() const { return m_VertexFormat; }
+
         protected:
             explicit IMesh(
                 std::string name,
                 std::shared_ptr<MeshData> data,
-                const VAArray<SubMeshDescriptor>& submeshes);
+                const VAArray<SubMeshDescriptor>& submeshes,
+                Renderer::VertexFormat vertexFormat);
 
             std::string m_Name;
+            Renderer::VertexFormat m_VertexFormat;
 
             std::shared_ptr<MeshData> m_Data;
             VAArray<SubMeshDescriptor> m_Submeshes;
@@ -3,6 +3,9 @@
 //
 #include "MeshData.hpp"
 
+#include "MeshNormals.hpp"
+#include "MeshOptimizer.hpp"
+#include "SubMesh.hpp"
 #include "Core/Core.hpp"
 #include "Core/Logger.hpp"
 
@@ -12,6 +15,20 @@ namespace VoidArchitect::Resources
         : vertices(std::move(vertices)),
           indices(std::move(indices))
     {
+        UpdateTrackedMemory();
+        RecalculateBounds();
+        m_Generation++;
+    }
+
+    MeshData::MeshData(
+        VAArray<MeshVertex> vertices,
+        VAArray<uint32_t> indices,
+        const Math::Bounds& bounds)
+        : vertices(std::move(vertices)),
+          indices(std::move(indices)),
+          m_Bounds(bounds)
+    {
+        UpdateTrackedMemory();
         m_Generation++;
     }
 
@@ -21,6 +38,9 @@ namespace VoidArchitect::Resources
     {
         const auto vertexOffset = static_cast<uint32_t>(vertices.size());
 
+        // The new indices must follow the existing submeshes
+        DropLods();
+
         // Add vertices
         vertices.reserve(vertices.size() + newVertices.size());
         vertices.insert(vertices.end(), newVertices.begin(), newVertices.end());
@@ -32,6 +52,12 @@ namespace VoidArchitect::Resources
             indices.push_back(index + vertexOffset);
         }
 
+        const auto indexOffset = static_cast<uint32_t>(indices.size() - newIndices.size());
+        m_DirtyVertices.Add(vertexOffset, static_cast<uint32_t>(newVertices.size()));
+        m_DirtyIndices.Add(indexOffset, static_cast<uint32_t>(newIndices.size()));
+
+        m_Bounds = Math::Bounds::Merge(m_Bounds, ComputeBounds(newVertices));
+        UpdateTrackedMemory();
         m_Generation++;
     }
 
@@ -48,6 +74,8 @@ namespace VoidArchitect::Resources
             indexOffset + indexCount <= indices.size(),
             "Index range is out of bounds");
 
+        DropLods();
+
         // Remove vertices
         vertices.erase(
             vertices.begin() + vertexOffset,
@@ -60,6 +88,17 @@ namespace VoidArchitect::Resources
             if (index >= vertexOffset + vertexCount) index -= vertexCount;
         }
 
+        // Following vertices moved down and every index may have been renumbered
+        const auto vertexTotal = static_cast<uint32_t>(vertices.size());
+        const auto indexTotal = static_cast<uint32_t>(indices.size());
+        m_DirtyVertices.Truncate(vertexTotal);
+        m_DirtyVertices.Add(vertexOffset, vertexTotal - vertexOffset);
+        m_DirtyIndices.Truncate(indexTotal);
+        m_DirtyIndices.Add(0, indexTotal);
+
+        m_Meshlets.clear();
+        UpdateTrackedMemory();
+        RecalculateBounds();
         m_Generation++;
     }
 
@@ -70,7 +109,7 @@ namespace VoidArchitect::Resources
             "Update vertices range is out of bounds");
 
         std::ranges::copy(newVertices, vertices.begin() + offset);
-        m_Generation++;
+        MarkVerticesDirty(offset, static_cast<uint32_t>(newVertices.size()));
     }
 
     void MeshData::UpdateIndices(const uint32_t offset, const VAArray<uint32_t>& newIndices)
@@ -80,113 +119,155 @@ namespace VoidArchitect::Resources
             "Update indices range is out of bounds");
 
         std::ranges::copy(newIndices, indices.begin() + offset);
-        m_Generation++;
+        MarkIndicesDirty(offset, static_cast<uint32_t>(newIndices.size()));
     }
 
-    void MeshData::OptimizeForGPU()
+    void MeshData::MarkVerticesDirty(const uint32_t offset, const uint32_t count)
     {
-        //TODO: Implement vertex cache optimization
-        //      This could include :
-        //          - Vertex cache optimization (reorder indices for better cache coherency)
-        //          - Vertex deduplication
-        //          - Triangle strip conversion
-        //          - Spatial locality optimization
-        //          - ... ?
+        VA_ENGINE_ASSERT(
+            offset + count <= vertices.size(),
+            "Dirty vertices range is out of bounds");
 
+        m_DirtyVertices.Add(offset, count);
+        m_Meshlets.clear();
+        DropLods();
+        RecalculateBounds();
         m_Generation++;
-
-        VA_ENGINE_WARN("[MeshData] OptimizeForGPU not implemented !");
     }
 
-    void MeshData::GenerateNormals()
+    void MeshData::MarkIndicesDirty(const uint32_t offset, const uint32_t count)
     {
-        for (auto& vertex : vertices) vertex.Normal = Math::Vec3::Zero();
+        VA_ENGINE_ASSERT(
+            offset + count <= indices.size(),
+            "Dirty indices range is out of bounds");
 
-        for (uint32_t i = 0; i < indices.size(); i += 3)
-        {
-            const uint32_t index0 = indices[i + 0];
-            const uint32_t index1 = indices[i + 1];
-            const uint32_t index2 = indices[i + 2];
+        m_DirtyIndices.Add(offset, count);
+        m_Meshlets.clear();
+        DropLods();
+        m_Generation++;
+    }
 
-            const Math::Vec3 edge0 = vertices[index1].Position - vertices[index0].Position;
-            const Math::Vec3 edge1 = vertices[index2].Position - vertices[index0].Position;
+    void MeshData::ClearDirtyRanges()
+    {
+        m_DirtyVertices.Clear();
+        m_DirtyIndices.Clear();
+    }
 
-            const auto normal = Math::Vec3::Cross(edge0, edge1);
+    void MeshData::OptimizeForGPU()
+    {
+        DropLods();
+        if (IsEmpty()) return;
+
+        const SubMeshDescriptor wholeMesh{
+            "MeshData",
+            InvalidMaterialHandle,
+            0,
+            static_cast<uint32_t>(indices.size()),
+            0,
+            static_cast<uint32_t>(vertices.size())
+        };
+        OptimizeForGPU({wholeMesh});
+    }
 
-            vertices[index0].Normal += normal;
-            vertices[index1].Normal += normal;
-            vertices[index2].Normal += normal;
+    void MeshData::OptimizeForGPU(const VAArray<SubMeshDescriptor>& submeshes)
+    {
+        // Vertex fetch reordering renumbers the vertices the levels point to
+        DropLods();
+        for (const auto& submesh : submeshes)
+        {
+            const auto [before, after] = MeshOptimizer::Optimize(vertices, indices, submesh);
+            VA_ENGINE_TRACE(
+                "[MeshData] Optimized '{}': ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}.",
+                submesh.name,
+                before.acmr,
+                after.acmr,
+                before.atvr,
+                after.atvr);
+            m_DirtyVertices.Add(submesh.vertexOffset, submesh.vertexCount);
+            m_DirtyIndices.Add(submesh.indexOffset, submesh.indexCount);
         }
 
-        for (auto& vertex : vertices) vertex.Normal.Normalize();
+        m_Meshlets.clear();
+        m_Generation++;
+    }
 
+    void MeshData::GenerateNormals()
+    {
+        MeshNormals::GenerateNormals(vertices, std::span(indices).first(GetLodIndexOffset()));
+        m_DirtyVertices.Add(0, static_cast<uint32_t>(vertices.size()));
         m_Generation++;
     }
 
     void MeshData::GenerateTangents()
     {
-        for (auto& vertex : vertices) vertex.Tangent = Math::Vec4::Zero();
-
-        VAArray<Math::Vec3> tangents(vertices.size(), Math::Vec3::Zero());
-        VAArray<Math::Vec3> bitangents(vertices.size(), Math::Vec3::Zero());
-
-        for (uint32_t i = 0; i < indices.size(); i += 3)
-        {
-            const uint32_t index0 = indices[i + 0];
-            const uint32_t index1 = indices[i + 1];
-            const uint32_t index2 = indices[i + 2];
-
-            const Math::Vec3& v0 = vertices[index0].Position;
-            const Math::Vec3& v1 = vertices[index1].Position;
-            const Math::Vec3& v2 = vertices[index2].Position;
-
-            const Math::Vec2& uv0 = vertices[index0].UV0;
-            const Math::Vec2& uv1 = vertices[index1].UV0;
-            const Math::Vec2& uv2 = vertices[index2].UV0;
-
-            const Math::Vec3 edge1 = v1 - v0;
-            const Math::Vec3 edge2 = v2 - v0;
-
-            const Math::Vec2 dUV1 = uv1 - uv0;
-            const Math::Vec2 dUV2 = uv2 - uv0;
+        MeshNormals::GenerateTangents(vertices, std::span(indices).first(GetLodIndexOffset()));
+        m_DirtyVertices.Add(0, static_cast<uint32_t>(vertices.size()));
+        m_Generation++;
+    }
 
-            const float r = 1.0f / (dUV1.X() * dUV2.Y() - dUV2.X() * dUV1.Y());
-            const Math::Vec3 sdir = (edge1 * dUV2.Y() - edge2 * dUV1.Y()) * r;
-            const Math::Vec3 tdir = (edge2 * dUV1.X() - edge1 * dUV2.X()) * r;
+    void MeshData::RecalculateBounds()
+    {
+        m_Bounds = ComputeBounds(vertices);
+    }
 
-            tangents[index0] += sdir;
-            tangents[index1] += sdir;
-            tangents[index2] += sdir;
+    Math::Bounds MeshData::ComputeBounds(const std::span<const MeshVertex> vertices)
+    {
+        static_assert(
+            sizeof(Math::Vec3) == 3 * sizeof(float),
+            "Bounds::FromPoints expects Vec3 to be three packed floats");
+
+        if (vertices.empty()) return {};
+        return Math::Bounds::FromPoints(
+            reinterpret_cast<const float*>(&vertices.front().Position),
+            vertices.size(),
+            sizeof(MeshVertex));
+    }
 
-            bitangents[index0] += tdir;
-            bitangents[index1] += tdir;
-            bitangents[index2] += tdir;
-        }
+    void MeshData::SetMeshlets(VAArray<Meshlet> meshlets)
+    {
+        m_Meshlets = std::move(meshlets);
+        UpdateTrackedMemory();
+    }
 
-        for (size_t i = 0; i < vertices.size(); ++i)
-        {
-            const Math::Vec3& n = vertices[i].Normal;
-            const Math::Vec3& t = tangents[i];
+    void MeshData::SetLods(VAArray<MeshLod> lods)
+    {
+        m_Lods = std::move(lods);
+        UpdateTrackedMemory();
+    }
 
-            // Gram-Schmidt orthogonalize
-            const Math::Vec3 orthoTangent = (t - n * Math::Vec3::Dot(n, t)).Normalize();
+    void MeshData::SetPackedGeometry(PackedGeometry geometry)
+    {
+        m_PackedGeometry = std::move(geometry);
+        m_PackedGeneration = m_Generation;
+    }
 
-            // Calculate handedness
-            const float handedness = (Math::Vec3::Dot(Math::Vec3::Cross(n, t), bitangents[i]) <
-                                         0.0f)
-                                         ? -1.0f
-                                         : 1.0f;
+    const PackedGeometry* MeshData::GetPackedGeometry() const
+    {
+        if (!m_PackedGeometry || m_PackedGeneration != m_Generation) return nullptr;
+        return &m_PackedGeometry.value();
+    }
 
-            vertices[i].Tangent = Math::Vec4(orthoTangent, handedness);
-        }
+    bool MeshData::FitsShortIndices(const std::span<const uint32_t> indices)
+    {
+        constexpr uint32_t PRIMITIVE_RESTART_16 = std::numeric_limits<uint16_t>::max();
+        return std::ranges::all_of(
+            indices,
+            [](const uint32_t index) { return index < PRIMITIVE_RESTART_16; });
+    }
 
-        m_Generation++;
+    void MeshData::UpdateTrackedMemory()
+    {
+        m_TrackedMemory.Update(
+            vertices.capacity() * sizeof(MeshVertex) + indices.capacity() * sizeof(uint32_t) +
+            m_Meshlets.capacity() * sizeof(Meshlet) + m_Lods.capacity() * sizeof(MeshLod));
     }
 
-    void MeshData::RecalculateBounds()
+    void MeshData::DropLods()
     {
-        //TODO: Implement bounding box calculation
-        //  This would calculate and store AABB for culling purpose
-        VA_ENGINE_WARN("[MeshData] RecalculateBounds not implemented !");
+        if (m_Lods.empty()) return;
+
+        indices.resize(GetLodIndexOffset());
+        m_DirtyIndices.Truncate(static_cast<uint32_t>(indices.size()));
+        m_Lods.clear();
     }
 }
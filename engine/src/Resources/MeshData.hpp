@@ -2,14 +2,23 @@
 // Created by Michael Desmedt on 14/06/2025.
 //
 #pragma once
+#include "Core/Math/Bounds.hpp"
 #include "Core/Math/Vec2.hpp"
 #include "Core/Math/Vec3.hpp"
 #include "Core/Math/Vec4.hpp"
+#include "Core/Memory/MemoryTracker.hpp"
+#include "Resources/DirtyRanges.hpp"
+#include "Resources/MeshLod.hpp"
+#include "Resources/Meshlet.hpp"
+
+#include <optional>
 
 namespace VoidArchitect
 {
     namespace Resources
     {
+        struct SubMeshDescriptor;
+
         struct MeshVertex
         {
             Math::Vec3 Position;
@@ -18,6 +27,21 @@ namespace VoidArchitect
             Math::Vec4 Tangent;
         };
 
+        /// @brief Vertex and index streams already in their GPU layout, see VertexStreams
+        ///
+        /// Baked meshes are read in that layout, e.g. straight from a mapped VAM file: the GPU
+        /// mesh copies these bytes to staging memory as they are instead of converting
+        /// `vertices` and `indices` once more.
+        struct PackedGeometry
+        {
+            std::shared_ptr<const void> owner; ///< Keeps the bytes alive, e.g. a mapped file
+            std::span<const uint8_t> positions; ///< VertexPosition stream
+            std::span<const uint8_t> attributes; ///< VertexAttributes or CompactVertexAttributes
+            std::span<const uint8_t> indices; ///< Every index, LOD indices included
+            bool compactAttributes = false; ///< Attributes are CompactVertexAttributes
+            bool shortIndices = false; ///< Indices are uint16_t rather than uint32_t
+        };
+
         class MeshData
         {
         public:
@@ -27,8 +51,19 @@ namespace VoidArchitect
             MeshData() = default;
             MeshData(VAArray<MeshVertex> vertices, VAArray<uint32_t> indices);
 
+            /// @brief Construct from geometry whose bounds are already known (e.g. baked)
+            MeshData(
+                VAArray<MeshVertex> vertices,
+                VAArray<uint32_t> indices,
+                const Math::Bounds& bounds);
+
             [[nodiscard]] uint32_t GetGeneration() const { return m_Generation; }
 
+            /// @brief Bounds of every vertex, kept up to date by the mutating methods
+            /// @note AddSubmesh() merges the new vertices in, leaving a slightly loose sphere
+            ///       until the next RecalculateBounds().
+            [[nodiscard]] const Math::Bounds& GetBounds() const { return m_Bounds; }
+
             void AddSubmesh(
                 const VAArray<MeshVertex>& newVertices,
                 const VAArray<uint32_t>& newIndices);
@@ -40,11 +75,100 @@ namespace VoidArchitect
             void UpdateVertices(uint32_t offset, const VAArray<MeshVertex>& newVertices);
             void UpdateIndices(uint32_t offset, const VAArray<uint32_t>& newIndices);
 
+            /// @brief Publish vertices written in place in `vertices`, e.g. by a deformer
+            /// @param offset First modified vertex
+            /// @param count Number of modified vertices
+            /// @note Same effects as UpdateVertices(), without the copy.
+            void MarkVerticesDirty(uint32_t offset, uint32_t count);
+
+            /// @brief Publish indices written in place in `indices`
+            /// @param offset First modified index
+            /// @param count Number of modified indices
+            /// @note Same effects as UpdateIndices(), without the copy.
+            void MarkIndicesDirty(uint32_t offset, uint32_t count);
+
+            /// @brief Vertices modified since the last ClearDirtyRanges()
+            /// @note Every mutating method records what it touched, the GPU mesh uploads these
+            ///       ranges only instead of the whole arrays. The constructors record nothing,
+            ///       the first upload always copies everything.
+            [[nodiscard]] const DirtyRangeSet& GetDirtyVertices() const
+            {
+                return m_DirtyVertices;
+            }
+
+            /// @brief Indices modified since the last ClearDirtyRanges()
+            [[nodiscard]] const DirtyRangeSet& GetDirtyIndices() const { return m_DirtyIndices; }
+
+            /// @brief Forget the dirty ranges once uploaded
+            /// @note The ranges have a single consumer, the GPU mesh created from this data.
+            void ClearDirtyRanges();
+
+            /// @brief Reorder triangles and vertices for the GPU, see MeshOptimizer
+            /// @note Treats the whole mesh as a single range, meshes made of several
+            ///       submeshes must use the overload taking their descriptors.
             void OptimizeForGPU();
+
+            /// @brief Reorder triangles and vertices of every submesh range independently
+            /// @param submeshes Ranges to optimize, indices relative to their vertex offset
+            void OptimizeForGPU(const VAArray<SubMeshDescriptor>& submeshes);
+
+            /// @brief Smooth, area-weighted vertex normals, see MeshNormals
+            /// @note Only the LOD 0 triangles are used, simplified levels share the vertices.
             void GenerateNormals();
+
+            /// @brief Vertex tangents from the UVs and the normals, see MeshNormals
+            /// @note Only the LOD 0 triangles are used, simplified levels share the vertices.
             void GenerateTangents();
             void RecalculateBounds();
 
+            /// @brief Compute the bounds of a range of vertices
+            /// @param vertices Vertices to enclose, e.g. the vertex range of a submesh
+            /// @return Bounds of the vertex positions, empty if there are no vertices
+            static Math::Bounds ComputeBounds(std::span<const MeshVertex> vertices);
+
+            /// @brief Meshlets of every submesh, see SubMeshDescriptor::meshletOffset
+            /// @note Empty for meshes that were not baked with meshlets. Any change to the
+            ///       vertex positions or to the indices, except AddSubmesh(), drops them.
+            [[nodiscard]] const VAArray<Meshlet>& GetMeshlets() const { return m_Meshlets; }
+
+            /// @brief Attach meshlets built for the current indices, see MeshletBuilder
+            void SetMeshlets(VAArray<Meshlet> meshlets);
+
+            /// @brief Simplified levels of every submesh, see SubMeshDescriptor::lodOffset
+            /// @note Their indices are stored at the end of `indices`, after the indices of
+            ///       every submesh. Empty for meshes that were not baked with LODs. Any change
+            ///       to the vertices or to the indices drops them along with their indices.
+            [[nodiscard]] const VAArray<MeshLod>& GetLods() const { return m_Lods; }
+
+            /// @brief Attach levels whose indices are already at the end of `indices`, see
+            ///        MeshSimplifier
+            void SetLods(VAArray<MeshLod> lods);
+
+            /// @brief Number of LOD 0 indices, i.e. where the indices of the levels start
+            [[nodiscard]] size_t GetLodIndexOffset() const
+            {
+                return m_Lods.empty() ? indices.size() : m_Lods.front().indexOffset;
+            }
+
+            /// @brief Check that indices can be stored as uint16_t
+            /// @param indices Indices to check, relative to their submesh vertex offset
+            /// @return true if every index is below 0xFFFF, the 16-bit primitive restart value
+            static bool FitsShortIndices(std::span<const uint32_t> indices);
+
+            /// @brief Check that the mesh indices can be uploaded as a 16-bit index buffer
+            [[nodiscard]] bool FitsShortIndices() const { return FitsShortIndices(indices); }
+
+            /// @brief Attach streams holding the current vertices and indices in their GPU layout
+            /// @note Any later change to the geometry makes them stale, they are then ignored.
+            void SetPackedGeometry(PackedGeometry geometry);
+
+            /// @brief Streams attached by SetPackedGeometry()
+            /// @return nullptr if none were attached or if the geometry changed since
+            [[nodiscard]] const PackedGeometry* GetPackedGeometry() const;
+
+            /// @brief Drop the attached streams, releasing their owner once uploaded
+            void ReleasePackedGeometry() { m_PackedGeometry.reset(); }
+
             [[nodiscard]] bool IsEmpty() const { return vertices.empty() || indices.empty(); }
 
             [[nodiscard]] size_t GetVertexDataSize() const
@@ -52,6 +176,7 @@ namespace VoidArchitect
                 return vertices.size() * sizeof(MeshVertex);
             }
 
+            /// @brief Size of the CPU index array, always 32-bit
             [[nodiscard]] size_t GetIndexDataSize() const
             {
                 return indices.size() * sizeof(uint32_t);
@@ -63,7 +188,21 @@ namespace VoidArchitect
             }
 
         private:
+            /// @brief Report the current CPU footprint of the vertex/index arrays
+            void UpdateTrackedMemory();
+
+            /// @brief Remove the simplified levels and their indices
+            void DropLods();
+
             uint32_t m_Generation = 0;
+            Math::Bounds m_Bounds;
+            DirtyRangeSet m_DirtyVertices;
+            DirtyRangeSet m_DirtyIndices;
+            VAArray<Meshlet> m_Meshlets;
+            VAArray<MeshLod> m_Lods;
+            std::optional<PackedGeometry> m_PackedGeometry;
+            uint32_t m_PackedGeneration = 0; ///< Generation m_PackedGeometry was attached at
+            VA_NO_UNIQUE_ADDRESS Memory::TrackedMemory<Memory::MemoryTag::Mesh> m_TrackedMemory;
         };
     } // Resources
 } // VoidArchitect
@@ -0,0 +1,56 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "MeshLod.hpp"
+
+#include <cmath>
+
+namespace VoidArchitect::Resources
+{
+    namespace
+    {
+        /// @brief Coarsest level whose projected error stays within the threshold
+        uint32_t CoarsestWithin(
+            const std::span<const MeshLod> lods,
+            const float pixelsPerUnit,
+            const float threshold)
+        {
+            for (auto lod = static_cast<uint32_t>(lods.size()); lod > 0; --lod)
+            {
+                if (lods[lod - 1].error * pixelsPerUnit <= threshold) return lod;
+            }
+            return 0;
+        }
+    } // namespace
+
+    uint32_t SelectLod(
+        const std::span<const MeshLod> lods,
+        const Math::Bounds& bounds,
+        const LodSelectionView& view,
+        const LodSettings& settings,
+        const uint32_t currentLod)
+    {
+        if (lods.empty() || !bounds.IsValid()) return 0;
+
+        const auto offset = bounds.center - view.cameraPosition;
+        const float distance = std::sqrt(Math::Vec3::Dot(offset, offset)) - bounds.radius;
+        if (distance <= 0.0f) return 0;
+
+        const float pixelsPerUnit = view.projectionScale / distance;
+        if (settings.hysteresis <= 0.0f || currentLod > lods.size())
+        {
+            return CoarsestWithin(lods, pixelsPerUnit, settings.errorThreshold);
+        }
+
+        // Go coarser only once clearly below the threshold, finer once clearly above it
+        const auto coarsest = CoarsestWithin(
+            lods,
+            pixelsPerUnit,
+            settings.errorThreshold * (1.0f + settings.hysteresis));
+        const auto finest = CoarsestWithin(
+            lods,
+            pixelsPerUnit,
+            settings.errorThreshold * (1.0f - settings.hysteresis));
+        return std::clamp(currentLod, finest, coarsest);
+    }
+} // namespace VoidArchitect::Resources
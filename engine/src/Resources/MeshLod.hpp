@@ -0,0 +1,62 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "Core/Math/Bounds.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Maximum number of detail levels of a submesh, including the full detail one
+    static constexpr uint32_t MESH_MAX_LODS = 5;
+
+    /// @brief Simplified detail level of a submesh
+    ///
+    /// LOD 0 is the submesh index range itself and has no MeshLod. Coarser levels are extra
+    /// index ranges over the same vertex range, stored after the indices of every submesh,
+    /// so a LOD is drawn exactly like its submesh with another index range.
+    struct MeshLod
+    {
+        uint32_t indexOffset; ///< First index, in the whole mesh index array
+        uint32_t indexCount;
+        float error; ///< Object-space geometric deviation from LOD 0, in position units
+        uint32_t submeshIndex; ///< Submesh the level belongs to
+
+        [[nodiscard]] uint32_t GetTriangleCount() const { return indexCount / 3; }
+    };
+
+    /// @brief Screen-space tolerances of LOD selection
+    struct LodSettings
+    {
+        /// @brief Largest accepted projected error, in pixels
+        float errorThreshold = 1.0f;
+
+        /// @brief Relative band around errorThreshold inside which the current level is kept,
+        ///        to avoid popping back and forth at a transition distance. 0 disables it.
+        float hysteresis = 0.2f;
+    };
+
+    /// @brief Camera as seen from the object space of one mesh instance, for LOD selection
+    struct LodSelectionView
+    {
+        Math::Vec3 cameraPosition; ///< Object-space camera position
+        float projectionScale; ///< Pixels covered by one unit at distance 1
+    };
+
+    /// @brief Pick the coarsest level of a submesh whose projected error is acceptable
+    /// @param lods Simplified levels of the submesh, finest first (LOD 1 to LOD n)
+    /// @param bounds Bounds of the submesh
+    /// @param view Camera in the object space of the mesh
+    /// @param settings Tolerances
+    /// @param currentLod Level drawn last frame, used by the hysteresis band
+    /// @return 0 for the submesh itself, i for lods[i - 1]
+    ///
+    /// The error of a level is projected at the distance of the closest point of the bounding
+    /// sphere, so a camera inside the sphere always gets LOD 0. The projection assumes a
+    /// perspective camera and a model matrix without scale.
+    uint32_t SelectLod(
+        std::span<const MeshLod> lods,
+        const Math::Bounds& bounds,
+        const LodSelectionView& view,
+        const LodSettings& settings,
+        uint32_t currentLod);
+} // namespace VoidArchitect::Resources
@@ -0,0 +1,243 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "MeshNormals.hpp"
+
+#include "Systems/Jobs/ParallelFor.hpp"
+
+#include <cmath>
+
+namespace VoidArchitect::Resources
+{
+    namespace
+    {
+        /// @brief Run body(begin, end) over [0, count) in chunks, on the job system when it
+        ///        is worth it
+        void ForEachChunk(
+            const size_t count,
+            const size_t chunkSize,
+            const std::function<void(size_t, size_t)>& body,
+            const char* name)
+        {
+            Jobs::ParallelFor(
+                (count + chunkSize - 1) / chunkSize,
+                [&body, chunkSize, count](const size_t chunk)
+                {
+                    body(chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+                },
+                name);
+        }
+
+        /// @brief 1 / length of a vector, 0 for the zero vector so that it stays zero
+        float InverseLength(const float x, const float y, const float z)
+        {
+            const float lengthSquared = x * x + y * y + z * z;
+            return lengthSquared > 0.0f ? 1.0f / std::sqrt(lengthSquared) : 0.0f;
+        }
+
+        /// @brief Per-triangle vectors, one array per component
+        struct FaceVectors
+        {
+            VAArray<float> x;
+            VAArray<float> y;
+            VAArray<float> z;
+
+            explicit FaceVectors(const size_t count)
+                : x(count),
+                  y(count),
+                  z(count)
+            {
+            }
+
+            void Set(const size_t face, const float fx, const float fy, const float fz)
+            {
+                x[face] = fx;
+                y[face] = fy;
+                z[face] = fz;
+            }
+        };
+    } // namespace
+
+    void MeshNormals::GenerateNormals(
+        const std::span<MeshVertex> vertices,
+        const std::span<const uint32_t> indices)
+    {
+        const size_t triangleCount = indices.size() / 3;
+
+        // Face pass: unnormalized cross products, their length weights them by area
+        FaceVectors normals(triangleCount);
+        ForEachChunk(
+            triangleCount,
+            TRIANGLES_PER_JOB,
+            [&](const size_t begin, const size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                {
+                    const auto& p0 = vertices[indices[t * 3 + 0]].Position;
+                    const auto& p1 = vertices[indices[t * 3 + 1]].Position;
+                    const auto& p2 = vertices[indices[t * 3 + 2]].Position;
+
+                    const float e0x = p1.X() - p0.X();
+                    const float e0y = p1.Y() - p0.Y();
+                    const float e0z = p1.Z() - p0.Z();
+                    const float e1x = p2.X() - p0.X();
+                    const float e1y = p2.Y() - p0.Y();
+                    const float e1z = p2.Z() - p0.Z();
+
+                    normals.Set(
+                        t,
+                        e0y * e1z - e0z * e1y,
+                        e0z * e1x - e0x * e1z,
+                        e0x * e1y - e0y * e1x);
+                }
+            },
+            "GenerateNormalsFaces");
+
+        VAArray<uint32_t> offsets;
+        VAArray<uint32_t> triangles;
+        BuildVertexTriangles(indices, vertices.size(), offsets, triangles);
+
+        // Gather pass
+        ForEachChunk(
+            vertices.size(),
+            VERTICES_PER_JOB,
+            [&](const size_t begin, const size_t end)
+            {
+                for (size_t v = begin; v < end; ++v)
+                {
+                    float nx = 0.0f, ny = 0.0f, nz = 0.0f;
+                    for (auto a = offsets[v]; a < offsets[v + 1]; ++a)
+                    {
+                        const auto t = triangles[a];
+                        nx += normals.x[t];
+                        ny += normals.y[t];
+                        nz += normals.z[t];
+                    }
+
+                    const float scale = InverseLength(nx, ny, nz);
+                    vertices[v].Normal = Math::Vec3(nx * scale, ny * scale, nz * scale);
+                }
+            },
+            "GenerateNormalsVertices");
+    }
+
+    void MeshNormals::GenerateTangents(
+        const std::span<MeshVertex> vertices,
+        const std::span<const uint32_t> indices)
+    {
+        const size_t triangleCount = indices.size() / 3;
+
+        // Face pass: UV-space directions of every triangle
+        FaceVectors tangents(triangleCount);
+        FaceVectors bitangents(triangleCount);
+        ForEachChunk(
+            triangleCount,
+            TRIANGLES_PER_JOB,
+            [&](const size_t begin, const size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                {
+                    const auto& v0 = vertices[indices[t * 3 + 0]];
+                    const auto& v1 = vertices[indices[t * 3 + 1]];
+                    const auto& v2 = vertices[indices[t * 3 + 2]];
+
+                    const float e1x = v1.Position.X() - v0.Position.X();
+                    const float e1y = v1.Position.Y() - v0.Position.Y();
+                    const float e1z = v1.Position.Z() - v0.Position.Z();
+                    const float e2x = v2.Position.X() - v0.Position.X();
+                    const float e2y = v2.Position.Y() - v0.Position.Y();
+                    const float e2z = v2.Position.Z() - v0.Position.Z();
+
+                    const float du1 = v1.UV0.X() - v0.UV0.X();
+                    const float dv1 = v1.UV0.Y() - v0.UV0.Y();
+                    const float du2 = v2.UV0.X() - v0.UV0.X();
+                    const float dv2 = v2.UV0.Y() - v0.UV0.Y();
+
+                    const float determinant = du1 * dv2 - du2 * dv1;
+                    const float r = determinant != 0.0f ? 1.0f / determinant : 0.0f;
+
+                    tangents.Set(
+                        t,
+                        (e1x * dv2 - e2x * dv1) * r,
+                        (e1y * dv2 - e2y * dv1) * r,
+                        (e1z * dv2 - e2z * dv1) * r);
+                    bitangents.Set(
+                        t,
+                        (e2x * du1 - e1x * du2) * r,
+                        (e2y * du1 - e1y * du2) * r,
+                        (e2z * du1 - e1z * du2) * r);
+                }
+            },
+            "GenerateTangentsFaces");
+
+        VAArray<uint32_t> offsets;
+        VAArray<uint32_t> triangles;
+        BuildVertexTriangles(indices, vertices.size(), offsets, triangles);
+
+        // Gather pass, then Gram-Schmidt against the vertex normal
+        ForEachChunk(
+            vertices.size(),
+            VERTICES_PER_JOB,
+            [&](const size_t begin, const size_t end)
+            {
+                for (size_t v = begin; v < end; ++v)
+                {
+                    float tx = 0.0f, ty = 0.0f, tz = 0.0f;
+                    float bx = 0.0f, by = 0.0f, bz = 0.0f;
+                    for (auto a = offsets[v]; a < offsets[v + 1]; ++a)
+                    {
+                        const auto t = triangles[a];
+                        tx += tangents.x[t];
+                        ty += tangents.y[t];
+                        tz += tangents.z[t];
+                        bx += bitangents.x[t];
+                        by += bitangents.y[t];
+                        bz += bitangents.z[t];
+                    }
+
+                    const auto& n = vertices[v].Normal;
+                    const float nDotT = n.X() * tx + n.Y() * ty + n.Z() * tz;
+                    float ox = tx - n.X() * nDotT;
+                    float oy = ty - n.Y() * nDotT;
+                    float oz = tz - n.Z() * nDotT;
+                    const float scale = InverseLength(ox, oy, oz);
+                    ox *= scale;
+                    oy *= scale;
+                    oz *= scale;
+
+                    // Handedness: is the bitangent on the side of cross(n, t)
+                    const float cx = n.Y() * tz - n.Z() * ty;
+                    const float cy = n.Z() * tx - n.X() * tz;
+                    const float cz = n.X() * ty - n.Y() * tx;
+                    const float handedness = (cx * bx + cy * by + cz * bz) < 0.0f ? -1.0f : 1.0f;
+
+                    vertices[v].Tangent = Math::Vec4(ox, oy, oz, handedness);
+                }
+            },
+            "GenerateTangentsVertices");
+    }
+
+    void MeshNormals::BuildVertexTriangles(
+        const std::span<const uint32_t> indices,
+        const size_t vertexCount,
+        VAArray<uint32_t>& outOffsets,
+        VAArray<uint32_t>& outTriangles)
+    {
+        const size_t indexCount = indices.size() - indices.size() % 3;
+
+        // Count the triangles of every vertex, then turn counts into starts (prefix sum)
+        outOffsets.assign(vertexCount + 1, 0);
+        for (size_t i = 0; i < indexCount; ++i) ++outOffsets[indices[i] + 1];
+        for (size_t v = 0; v < vertexCount; ++v) outOffsets[v + 1] += outOffsets[v];
+
+        // Fill in triangle order, using each start as a cursor: the starts end up shifted by
+        // one vertex, which the last loop undoes
+        outTriangles.resize(indexCount);
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            outTriangles[outOffsets[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+        for (size_t v = vertexCount; v > 0; --v) outOffsets[v] = outOffsets[v - 1];
+        outOffsets[0] = 0;
+    }
+} // namespace VoidArchitect::Resources
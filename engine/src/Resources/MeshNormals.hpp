@@ -0,0 +1,73 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "MeshData.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Smooth normal and tangent generation, spread over the job system
+    ///
+    /// Both generators run in two passes instead of scattering every triangle into its
+    /// three vertices:
+    /// 1. Face pass: the data of every triangle (area-weighted normal, or tangent and
+    ///    bitangent directions) is written to struct-of-arrays buffers, in parallel chunks
+    ///    of triangles.
+    /// 2. Gather pass: every vertex sums the data of its triangles through a
+    ///    vertex -> triangles adjacency, in parallel chunks of vertices.
+    ///
+    /// Each output is written by exactly one chunk, so there are no atomics and no locks.
+    /// The adjacency lists triangles in ascending order, so every vertex sums its triangles
+    /// in the same order as a serial scatter loop would: results do not depend on the
+    /// number of workers or on the chunking.
+    ///
+    /// Small meshes, and calls made while the job system is not running, are processed
+    /// inline. Otherwise the calling thread helps executing the chunks while it waits, which
+    /// makes the generators safe to call from a job.
+    ///
+    /// Usage example:
+    /// @code
+    /// MeshNormals::GenerateNormals(meshData.vertices, meshData.indices);
+    /// MeshNormals::GenerateTangents(meshData.vertices, meshData.indices);
+    /// @endcode
+    class MeshNormals
+    {
+    public:
+        /// @brief Replace the normal of every vertex by the area-weighted average of the
+        ///        normals of its triangles
+        /// @param vertices Vertices to update, vertices without triangles get a zero normal
+        /// @param indices Triangle list, every index must be lower than vertices.size()
+        static void GenerateNormals(
+            std::span<MeshVertex> vertices,
+            std::span<const uint32_t> indices);
+
+        /// @brief Replace the tangent of every vertex by the UV-space tangent of its
+        ///        triangles, orthogonalized against its normal (Lengyel's method)
+        /// @param vertices Vertices to update, normals must already be set
+        /// @param indices Triangle list, every index must be lower than vertices.size()
+        ///
+        /// Tangent.w holds the handedness of the UV mapping, 1 or -1. Triangles with a
+        /// degenerate UV mapping do not contribute.
+        static void GenerateTangents(
+            std::span<MeshVertex> vertices,
+            std::span<const uint32_t> indices);
+
+        /// @brief Build the triangles of every vertex in compressed rows
+        /// @param indices Triangle list
+        /// @param vertexCount Number of vertices referenced by the indices
+        /// @param outOffsets Receives vertexCount + 1 offsets, the triangles of vertex v are
+        ///        outTriangles[outOffsets[v]] to outTriangles[outOffsets[v + 1]] excluded
+        /// @param outTriangles Receives one triangle per index, ascending for every vertex
+        static void BuildVertexTriangles(
+            std::span<const uint32_t> indices,
+            size_t vertexCount,
+            VAArray<uint32_t>& outOffsets,
+            VAArray<uint32_t>& outTriangles);
+
+        /// @brief Triangles processed by a single face pass job
+        static constexpr uint32_t TRIANGLES_PER_JOB = 32768;
+
+        /// @brief Vertices processed by a single gather pass job
+        static constexpr uint32_t VERTICES_PER_JOB = 32768;
+    };
+} // namespace VoidArchitect::Resources
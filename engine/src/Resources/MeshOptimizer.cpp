@@ -0,0 +1,406 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "MeshOptimizer.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <cmath>
+
+namespace VoidArchitect::Resources
+{
+    namespace
+    {
+        constexpr uint32_t INVALID_VERTEX = std::numeric_limits<uint32_t>::max();
+
+        /// @brief FIFO post-transform cache simulation shared by the analyzer and passes
+        ///
+        /// A vertex is cached if it was one of the last `cacheSize` misses: every miss stamps
+        /// the vertex with the current time and advances the time.
+        class FifoCache
+        {
+        public:
+            FifoCache(const uint32_t vertexCount, const uint32_t cacheSize)
+                : m_Timestamps(vertexCount, 0),
+                  m_CacheSize(cacheSize),
+                  m_Time(cacheSize + 1)
+            {
+            }
+
+            /// @brief Reference a vertex, return true on a cache miss
+            bool Access(const uint32_t vertex)
+            {
+                if (m_Time - m_Timestamps[vertex] <= m_CacheSize) return false;
+
+                m_Timestamps[vertex] = m_Time++;
+                return true;
+            }
+
+            /// @brief Reference the three vertices of a triangle, return the miss count
+            uint32_t AccessTriangle(const uint32_t* triangle)
+            {
+                return static_cast<uint32_t>(Access(triangle[0])) +
+                    static_cast<uint32_t>(Access(triangle[1])) +
+                    static_cast<uint32_t>(Access(triangle[2]));
+            }
+
+            /// @brief Evict every vertex
+            void Flush() { m_Time += m_CacheSize + 1; }
+
+        private:
+            VAArray<uint32_t> m_Timestamps;
+            uint32_t m_CacheSize;
+            uint32_t m_Time;
+        };
+    } // namespace
+
+    std::pair<VertexCacheStats, VertexCacheStats> MeshOptimizer::Optimize(
+        VAArray<MeshVertex>& vertices,
+        VAArray<uint32_t>& indices,
+        const SubMeshDescriptor& submesh,
+        const MeshOptimizerSettings& settings)
+    {
+        if (submesh.IsEmpty() || submesh.GetVertexEnd() > vertices.size() ||
+            submesh.GetIndexEnd() > indices.size() || submesh.indexCount % 3 != 0)
+        {
+            VA_ENGINE_WARN(
+                "[MeshOptimizer] Skipping submesh '{}', its ranges are empty or invalid.",
+                submesh.name);
+            return {};
+        }
+
+        const std::span rangeVertices(vertices.data() + submesh.vertexOffset, submesh.vertexCount);
+        const std::span rangeIndices(indices.data() + submesh.indexOffset, submesh.indexCount);
+
+        if (std::ranges::any_of(
+            rangeIndices,
+            [&](const uint32_t index) { return index >= submesh.vertexCount; }))
+        {
+            VA_ENGINE_WARN(
+                "[MeshOptimizer] Skipping submesh '{}', it references vertices outside its range.",
+                submesh.name);
+            return {};
+        }
+
+        const auto before = AnalyzeVertexCache(
+            rangeIndices,
+            submesh.vertexCount,
+            settings.cacheSize);
+
+        VAArray<uint32_t> clusters;
+        OptimizeVertexCache(rangeIndices, submesh.vertexCount, settings.cacheSize, &clusters);
+        OptimizeOverdraw(
+            rangeIndices,
+            rangeVertices,
+            clusters,
+            settings.cacheSize,
+            settings.overdrawThreshold);
+        OptimizeVertexFetch(rangeVertices, rangeIndices);
+
+        const auto after = AnalyzeVertexCache(
+            rangeIndices,
+            submesh.vertexCount,
+            settings.cacheSize);
+
+        return {before, after};
+    }
+
+    VertexCacheStats MeshOptimizer::AnalyzeVertexCache(
+        const std::span<const uint32_t> indices,
+        const uint32_t vertexCount,
+        const uint32_t cacheSize)
+    {
+        VertexCacheStats stats;
+        if (indices.size() < 3 || vertexCount == 0) return stats;
+
+        FifoCache cache(vertexCount, cacheSize);
+        VAArray<uint8_t> referenced(vertexCount, 0);
+        uint32_t misses = 0;
+        uint32_t uniqueVertices = 0;
+
+        for (const auto index : indices)
+        {
+            misses += static_cast<uint32_t>(cache.Access(index));
+            uniqueVertices += referenced[index] == 0 ? 1 : 0;
+            referenced[index] = 1;
+        }
+
+        stats.acmr = static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+        stats.atvr = static_cast<float>(misses) / static_cast<float>(uniqueVertices);
+        return stats;
+    }
+
+    void MeshOptimizer::OptimizeVertexCache(
+        const std::span<uint32_t> indices,
+        const uint32_t vertexCount,
+        const uint32_t cacheSize,
+        VAArray<uint32_t>* clusters)
+    {
+        const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+        if (clusters) clusters->clear();
+        if (triangleCount == 0) return;
+
+        // Vertex -> triangles adjacency, in compressed rows
+        VAArray<uint32_t> liveTriangles(vertexCount, 0);
+        for (const auto index : indices) liveTriangles[index]++;
+
+        VAArray<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+        for (uint32_t v = 0; v < vertexCount; ++v)
+        {
+            adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+        }
+
+        VAArray<uint32_t> adjacency(indices.size());
+        {
+            VAArray<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (uint32_t i = 0; i < indices.size(); ++i)
+            {
+                adjacency[fill[indices[i]]++] = i / 3;
+            }
+        }
+
+        VAArray<uint32_t> timestamps(vertexCount, 0);
+        VAArray<uint8_t> emitted(triangleCount, 0);
+        VAArray<uint32_t> deadEnd;
+        VAArray<uint32_t> candidates;
+        VAArray<uint32_t> output;
+        deadEnd.reserve(indices.size());
+        output.reserve(indices.size());
+
+        uint32_t time = cacheSize + 1;
+        uint32_t cursor = 0;
+
+        // Find the next vertex with live triangles, in input order
+        const auto scanNextVertex = [&]() -> uint32_t
+        {
+            while (cursor < vertexCount && liveTriangles[cursor] == 0) cursor++;
+            return cursor < vertexCount ? cursor : INVALID_VERTEX;
+        };
+
+        auto fanning = scanNextVertex();
+        if (clusters) clusters->push_back(0);
+
+        while (fanning != INVALID_VERTEX)
+        {
+            // Emit every remaining triangle around the fanning vertex
+            candidates.clear();
+            for (auto a = adjacencyOffsets[fanning]; a < adjacencyOffsets[fanning + 1]; ++a)
+            {
+                const auto triangle = adjacency[a];
+                if (emitted[triangle]) continue;
+
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    const auto vertex = indices[triangle * 3 + k];
+                    output.push_back(vertex);
+                    deadEnd.push_back(vertex);
+                    candidates.push_back(vertex);
+                    liveTriangles[vertex]--;
+                    if (time - timestamps[vertex] > cacheSize) timestamps[vertex] = time++;
+                }
+                emitted[triangle] = 1;
+            }
+
+            // Prefer the candidate that stays in cache for all its remaining triangles and
+            // entered the cache the earliest, so that it is used before it gets evicted.
+            auto next = INVALID_VERTEX;
+            int64_t bestPriority = -1;
+            for (const auto vertex : candidates)
+            {
+                if (liveTriangles[vertex] == 0) continue;
+
+                int64_t priority = 0;
+                const auto age = time - timestamps[vertex];
+                if (age + 2 * liveTriangles[vertex] <= cacheSize) priority = age;
+                if (priority > bestPriority)
+                {
+                    bestPriority = priority;
+                    next = vertex;
+                }
+            }
+
+            // Dead end: restart from a recent vertex, or the next unprocessed one
+            if (next == INVALID_VERTEX)
+            {
+                while (!deadEnd.empty() && next == INVALID_VERTEX)
+                {
+                    const auto vertex = deadEnd.back();
+                    deadEnd.pop_back();
+                    if (liveTriangles[vertex] > 0) next = vertex;
+                }
+                if (next == INVALID_VERTEX) next = scanNextVertex();
+
+                if (clusters && next != INVALID_VERTEX)
+                {
+                    clusters->push_back(static_cast<uint32_t>(output.size() / 3));
+                }
+            }
+
+            fanning = next;
+        }
+
+        // Triangles of vertices never reached (degenerate input) keep their relative order
+        for (uint32_t t = 0; t < triangleCount; ++t)
+        {
+            if (emitted[t]) continue;
+            output.insert(output.end(), indices.begin() + t * 3, indices.begin() + t * 3 + 3);
+        }
+
+        std::ranges::copy(output, indices.begin());
+    }
+
+    void MeshOptimizer::OptimizeOverdraw(
+        const std::span<uint32_t> indices,
+        const std::span<const MeshVertex> vertices,
+        const VAArray<uint32_t>& clusters,
+        const uint32_t cacheSize,
+        const float threshold)
+    {
+        const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+        if (triangleCount == 0 || clusters.empty()) return;
+
+        const auto vertexCount = static_cast<uint32_t>(vertices.size());
+
+        // Split the hard clusters further wherever the ACMR of the sub-cluster started so
+        // far is already within `threshold` of the ACMR of the whole cluster. More clusters
+        // give the sort more freedom, the threshold bounds the cache cost of the cuts.
+        VAArray<uint32_t> softClusters;
+        FifoCache cache(vertexCount, cacheSize);
+        for (size_t c = 0; c < clusters.size(); ++c)
+        {
+            const auto start = clusters[c];
+            const auto end = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+
+            cache.Flush();
+            uint32_t clusterMisses = 0;
+            for (auto t = start; t < end; ++t) clusterMisses += cache.AccessTriangle(&indices[t * 3]);
+
+            const float limit = threshold * static_cast<float>(clusterMisses) /
+                static_cast<float>(end - start);
+
+            cache.Flush();
+            softClusters.push_back(start);
+            uint32_t misses = 0;
+            uint32_t triangles = 0;
+            for (auto t = start; t < end; ++t)
+            {
+                misses += cache.AccessTriangle(&indices[t * 3]);
+                triangles++;
+
+                if (t + 1 < end &&
+                    static_cast<float>(misses) <= limit * static_cast<float>(triangles))
+                {
+                    softClusters.push_back(t + 1);
+                    misses = 0;
+                    triangles = 0;
+                    cache.Flush();
+                }
+            }
+        }
+
+        // Area-weighted centroid and normal of every cluster and of the whole range
+        struct ClusterInfo
+        {
+            uint32_t start;
+            uint32_t end;
+            float sortKey;
+        };
+
+        VAArray<ClusterInfo> infos(softClusters.size());
+        VAArray<std::array<float, 6>> sums(softClusters.size(), std::array<float, 6>{});
+        float meshCentroid[3] = {0.0f, 0.0f, 0.0f};
+        float meshArea = 0.0f;
+
+        for (size_t c = 0; c < softClusters.size(); ++c)
+        {
+            infos[c].start = softClusters[c];
+            infos[c].end = c + 1 < softClusters.size() ? softClusters[c + 1] : triangleCount;
+
+            auto& [cx, cy, cz, nx, ny, nz] = sums[c];
+            float clusterArea = 0.0f;
+            for (auto t = infos[c].start; t < infos[c].end; ++t)
+            {
+                const auto& p0 = vertices[indices[t * 3 + 0]].Position;
+                const auto& p1 = vertices[indices[t * 3 + 1]].Position;
+                const auto& p2 = vertices[indices[t * 3 + 2]].Position;
+
+                const auto normal = Math::Vec3::Cross(p1 - p0, p2 - p0);
+                const float area = std::sqrt(Math::Vec3::Dot(normal, normal));
+
+                cx += (p0.X() + p1.X() + p2.X()) * area / 3.0f;
+                cy += (p0.Y() + p1.Y() + p2.Y()) * area / 3.0f;
+                cz += (p0.Z() + p1.Z() + p2.Z()) * area / 3.0f;
+                nx += normal.X();
+                ny += normal.Y();
+                nz += normal.Z();
+                clusterArea += area;
+            }
+
+            meshCentroid[0] += cx;
+            meshCentroid[1] += cy;
+            meshCentroid[2] += cz;
+            meshArea += clusterArea;
+
+            const float inverseArea = clusterArea > 0.0f ? 1.0f / clusterArea : 0.0f;
+            cx *= inverseArea;
+            cy *= inverseArea;
+            cz *= inverseArea;
+        }
+
+        const float inverseMeshArea = meshArea > 0.0f ? 1.0f / meshArea : 0.0f;
+        for (auto& value : meshCentroid) value *= inverseMeshArea;
+
+        // Clusters facing away from the mesh center are likely to occlude the others from
+        // most viewpoints, draw them first.
+        for (size_t c = 0; c < infos.size(); ++c)
+        {
+            const auto& [cx, cy, cz, nx, ny, nz] = sums[c];
+            const float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+            const float inverseLength = length > 0.0f ? 1.0f / length : 0.0f;
+
+            infos[c].sortKey = ((cx - meshCentroid[0]) * nx + (cy - meshCentroid[1]) * ny +
+                (cz - meshCentroid[2]) * nz) * inverseLength;
+        }
+
+        std::ranges::stable_sort(
+            infos,
+            [](const ClusterInfo& a, const ClusterInfo& b) { return a.sortKey > b.sortKey; });
+
+        VAArray<uint32_t> output;
+        output.reserve(indices.size());
+        for (const auto& info : infos)
+        {
+            output.insert(
+                output.end(),
+                indices.begin() + info.start * 3,
+                indices.begin() + info.end * 3);
+        }
+
+        std::ranges::copy(output, indices.begin());
+    }
+
+    void MeshOptimizer::OptimizeVertexFetch(
+        const std::span<MeshVertex> vertices,
+        const std::span<uint32_t> indices)
+    {
+        const auto vertexCount = static_cast<uint32_t>(vertices.size());
+
+        VAArray<uint32_t> remap(vertexCount, INVALID_VERTEX);
+        uint32_t nextVertex = 0;
+        for (auto& index : indices)
+        {
+            if (remap[index] == INVALID_VERTEX) remap[index] = nextVertex++;
+            index = remap[index];
+        }
+
+        // Unreferenced vertices keep their slots at the end of the range
+        for (auto& target : remap)
+        {
+            if (target == INVALID_VERTEX) target = nextVertex++;
+        }
+
+        VAArray<MeshVertex> reordered(vertexCount);
+        for (uint32_t v = 0; v < vertexCount; ++v) reordered[remap[v]] = vertices[v];
+        std::ranges::copy(reordered, vertices.begin());
+    }
+} // namespace VoidArchitect::Resources
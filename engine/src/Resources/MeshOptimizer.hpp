@@ -0,0 +1,112 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "MeshData.hpp"
+#include "SubMesh.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Post-transform vertex cache efficiency of an index sequence
+    ///
+    /// Both figures come from a FIFO cache simulation. Lower is better:
+    /// - ACMR (average cache miss ratio): vertex shader invocations per triangle, between
+    ///   0.5 (ideal on large regular meshes) and 3.0 (no reuse at all)
+    /// - ATVR (average transformed vertex ratio): vertex shader invocations per referenced
+    ///   vertex, 1.0 means every vertex is transformed exactly once
+    struct VertexCacheStats
+    {
+        float acmr = 0.0f;
+        float atvr = 0.0f;
+    };
+
+    /// @brief Tuning of MeshOptimizer passes
+    struct MeshOptimizerSettings
+    {
+        /// @brief Size of the simulated post-transform FIFO cache, in vertices
+        uint32_t cacheSize = 16;
+
+        /// @brief ACMR degradation accepted to split clusters for overdraw ordering.
+        /// At 1.0 only the clusters found by the vertex cache pass are reordered, higher
+        /// values allow more, smaller clusters.
+        float overdrawThreshold = 1.05f;
+    };
+
+    /// @brief Offline triangle and vertex reordering for faster GPU rendering
+    ///
+    /// Optimize() runs three passes over one index range:
+    /// 1. Vertex cache optimization (Tipsify, Sander et al. 2007): triangles are emitted
+    ///    fanning around recently used vertices so that the post-transform cache hits.
+    /// 2. Overdraw ordering: the Tipsify output is split into clusters at its cache flush
+    ///    points and clusters are sorted front-facing-outward first, a view-independent
+    ///    approximation of front-to-back order, without losing more than
+    ///    `overdrawThreshold` of ACMR.
+    /// 3. Vertex fetch reordering: vertices are renumbered in first-use order so that
+    ///    vertex fetches walk memory linearly.
+    ///
+    /// Indices of a range are relative to its first vertex, as in SubMeshDescriptor, and the
+    /// vertex count of the range never changes (unreferenced vertices are moved to its end).
+    ///
+    /// Usage example:
+    /// @code
+    /// for (const auto& submesh : submeshes)
+    /// {
+    ///     const auto [before, after] = MeshOptimizer::Optimize(vertices, indices, submesh);
+    ///     VA_ENGINE_TRACE("ACMR {} -> {}", before.acmr, after.acmr);
+    /// }
+    /// @endcode
+    class MeshOptimizer
+    {
+    public:
+        /// @brief Run every pass on the range of a submesh
+        /// @param vertices Whole vertex array, only the submesh vertex range is modified
+        /// @param indices Whole index array, only the submesh index range is modified
+        /// @param submesh Range to optimize
+        /// @param settings Optimizer tuning
+        /// @return Cache statistics before and after optimization
+        static std::pair<VertexCacheStats, VertexCacheStats> Optimize(
+            VAArray<MeshVertex>& vertices,
+            VAArray<uint32_t>& indices,
+            const SubMeshDescriptor& submesh,
+            const MeshOptimizerSettings& settings = {});
+
+        /// @brief Simulate a FIFO post-transform cache over an index sequence
+        /// @param indices Triangle list indices, relative to the first vertex of the range
+        /// @param vertexCount Number of vertices in the range
+        /// @param cacheSize Simulated cache size, in vertices
+        static VertexCacheStats AnalyzeVertexCache(
+            std::span<const uint32_t> indices,
+            uint32_t vertexCount,
+            uint32_t cacheSize = 16);
+
+        /// @brief Reorder triangles for the post-transform cache (Tipsify)
+        /// @param indices Triangle list indices, reordered in place
+        /// @param vertexCount Number of vertices in the range
+        /// @param cacheSize Target cache size, in vertices
+        /// @param clusters If not null, receives the first triangle of every cluster, i.e. the
+        ///        points where Tipsify had to restart away from the cached vertices
+        static void OptimizeVertexCache(
+            std::span<uint32_t> indices,
+            uint32_t vertexCount,
+            uint32_t cacheSize,
+            VAArray<uint32_t>* clusters = nullptr);
+
+        /// @brief Reorder the clusters of a cache-optimized sequence to reduce overdraw
+        /// @param indices Output of OptimizeVertexCache(), reordered in place
+        /// @param vertices Vertices of the range
+        /// @param clusters Cluster starts returned by OptimizeVertexCache()
+        /// @param cacheSize Cache size used for OptimizeVertexCache()
+        /// @param threshold Accepted ACMR degradation, see MeshOptimizerSettings
+        static void OptimizeOverdraw(
+            std::span<uint32_t> indices,
+            std::span<const MeshVertex> vertices,
+            const VAArray<uint32_t>& clusters,
+            uint32_t cacheSize,
+            float threshold);
+
+        /// @brief Renumber vertices in first-use order
+        /// @param vertices Vertices of the range, permuted in place
+        /// @param indices Indices of the range, rewritten in place
+        static void OptimizeVertexFetch(std::span<MeshVertex> vertices, std::span<uint32_t> indices);
+    };
+} // namespace VoidArchitect::Resources
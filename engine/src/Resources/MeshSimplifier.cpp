@@ -0,0 +1,450 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "MeshSimplifier.hpp"
+
+#include "MeshNormals.hpp"
+#include "MeshOptimizer.hpp"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <numeric>
+
+namespace VoidArchitect::Resources
+{
+    namespace
+    {
+        constexpr uint32_t INVALID_VERTEX = std::numeric_limits<uint32_t>::max();
+
+        /// @brief Symmetric 4x4 matrix summing squared distances to a set of planes, with
+        ///        the total area of those planes
+        struct Quadric
+        {
+            double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+            double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+            double a22 = 0.0, a23 = 0.0;
+            double a33 = 0.0;
+            double weight = 0.0;
+
+            void AddPlane(
+                const double x,
+                const double y,
+                const double z,
+                const double d,
+                const double area)
+            {
+                a00 += area * x * x;
+                a01 += area * x * y;
+                a02 += area * x * z;
+                a03 += area * x * d;
+                a11 += area * y * y;
+                a12 += area * y * z;
+                a13 += area * y * d;
+                a22 += area * z * z;
+                a23 += area * z * d;
+                a33 += area * d * d;
+                weight += area;
+            }
+
+            void Add(const Quadric& other)
+            {
+                a00 += other.a00;
+                a01 += other.a01;
+                a02 += other.a02;
+                a03 += other.a03;
+                a11 += other.a11;
+                a12 += other.a12;
+                a13 += other.a13;
+                a22 += other.a22;
+                a23 += other.a23;
+                a33 += other.a33;
+                weight += other.weight;
+            }
+
+            /// @brief Area-weighted sum of squared distances from a point to the planes
+            [[nodiscard]] double Evaluate(const Math::Vec3& point) const
+            {
+                const double x = point.X();
+                const double y = point.Y();
+                const double z = point.Z();
+                return a00 * x * x + a11 * y * y + a22 * z * z + a33 +
+                    2.0 * (a01 * x * y + a02 * x * z + a12 * y * z + a03 * x + a13 * y + a23 * z);
+            }
+        };
+
+        /// @brief Root mean square distance from the merged planes after a collapse onto
+        ///        a point
+        float CollapseError(const Quadric& source, const Quadric& target, const Math::Vec3& point)
+        {
+            const double weight = source.weight + target.weight;
+            if (weight <= 0.0) return 0.0f;
+
+            const double squared = (source.Evaluate(point) + target.Evaluate(point)) / weight;
+            return static_cast<float>(std::sqrt(std::max(0.0, squared)));
+        }
+
+        struct Collapse
+        {
+            float error;
+            uint32_t source; ///< Position moved away
+            uint32_t target; ///< Position kept
+        };
+
+        /// @brief Map every vertex to the lowest vertex sharing its position
+        VAArray<uint32_t> WeldPositions(const std::span<const MeshVertex> vertices)
+        {
+            // Adding 0 turns -0 into +0 so that both weld together
+            const auto key = [&](const uint32_t v)
+            {
+                const auto& position = vertices[v].Position;
+                return std::array{
+                    std::bit_cast<uint32_t>(position.X() + 0.0f),
+                    std::bit_cast<uint32_t>(position.Y() + 0.0f),
+                    std::bit_cast<uint32_t>(position.Z() + 0.0f)
+                };
+            };
+
+            VAArray<uint32_t> order(vertices.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(
+                order.begin(),
+                order.end(),
+                [&](const uint32_t a, const uint32_t b) { return key(a) < key(b); });
+
+            VAArray<uint32_t> remap(vertices.size());
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                const bool sameAsPrevious = i > 0 && key(order[i]) == key(order[i - 1]);
+                remap[order[i]] = sameAsPrevious ? remap[order[i - 1]] : order[i];
+            }
+            return remap;
+        }
+
+        /// @brief Flag positions that must not move: seams, borders and non-manifold edges
+        VAArray<uint8_t> FindLockedPositions(
+            const std::span<const uint32_t> indices,
+            const VAArray<uint32_t>& remap)
+        {
+            VAArray<uint8_t> locked(remap.size(), 0);
+
+            // A position referenced through several vertices lies on an attribute seam
+            VAArray<uint32_t> firstVertex(remap.size(), INVALID_VERTEX);
+            for (const auto vertex : indices)
+            {
+                auto& first = firstVertex[remap[vertex]];
+                if (first == INVALID_VERTEX) first = vertex;
+                else if (first != vertex) locked[remap[vertex]] = 1;
+            }
+
+            // Closed manifold edges are shared by exactly two triangles
+            VAArray<uint64_t> edges;
+            edges.reserve(indices.size());
+            for (size_t i = 0; i < indices.size(); i += 3)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const uint64_t a = remap[indices[i + c]];
+                    const uint64_t b = remap[indices[i + (c + 1) % 3]];
+                    edges.push_back(std::min(a, b) << 32 | std::max(a, b));
+                }
+            }
+            std::sort(edges.begin(), edges.end());
+
+            for (size_t begin = 0, end = 0; begin < edges.size(); begin = end)
+            {
+                while (end < edges.size() && edges[end] == edges[begin]) ++end;
+                if (end - begin != 2)
+                {
+                    locked[edges[begin] >> 32] = 1;
+                    locked[edges[begin] & 0xFFFFFFFFu] = 1;
+                }
+            }
+            return locked;
+        }
+    } // namespace
+
+    float MeshSimplifier::Simplify(
+        const std::span<const MeshVertex> vertices,
+        const std::span<const uint32_t> indices,
+        const size_t targetIndexCount,
+        const float maxError,
+        VAArray<uint32_t>& outIndices)
+    {
+        outIndices.assign(indices.begin(), indices.end() - indices.size() % 3);
+        const size_t targetTriangles = targetIndexCount / 3;
+        if (outIndices.size() / 3 <= targetTriangles) return 0.0f;
+
+        const auto vertexCount = vertices.size();
+        const auto remap = WeldPositions(vertices);
+        const auto locked = FindLockedPositions(outIndices, remap);
+        const auto position = [&](const uint32_t v) -> const Math::Vec3&
+        {
+            return vertices[v].Position;
+        };
+
+        // Area-weighted planes of the input triangles, accumulated on their positions
+        VAArray<Quadric> quadrics(vertexCount);
+        for (size_t i = 0; i < outIndices.size(); i += 3)
+        {
+            const auto& p0 = position(outIndices[i]);
+            const auto normal = Math::Vec3::Cross(
+                position(outIndices[i + 1]) - p0,
+                position(outIndices[i + 2]) - p0);
+            const double length = std::sqrt(Math::Vec3::Dot(normal, normal));
+            if (length <= 0.0) continue;
+
+            const double x = normal.X() / length;
+            const double y = normal.Y() / length;
+            const double z = normal.Z() / length;
+            const double d = -(x * p0.X() + y * p0.Y() + z * p0.Z());
+            for (size_t c = 0; c < 3; ++c)
+            {
+                quadrics[remap[outIndices[i + c]]].AddPlane(x, y, z, d, length * 0.5);
+            }
+        }
+
+        VAArray<uint32_t> corners;
+        VAArray<uint32_t> offsets;
+        VAArray<uint32_t> triangles;
+        VAArray<Collapse> candidates;
+        VAArray<uint8_t> touched(vertexCount);
+        VAArray<uint32_t> sourceRing;
+        VAArray<uint32_t> targetRing;
+        float resultError = 0.0f;
+
+        // Drop triangles collapsed to a line and refresh the position of every corner
+        const auto compact = [&]()
+        {
+            size_t kept = 0;
+            for (size_t i = 0; i < outIndices.size(); i += 3)
+            {
+                const auto a = remap[outIndices[i]];
+                const auto b = remap[outIndices[i + 1]];
+                const auto c = remap[outIndices[i + 2]];
+                if (a == b || b == c || c == a) continue;
+
+                for (size_t k = 0; k < 3; ++k) outIndices[kept + k] = outIndices[i + k];
+                kept += 3;
+            }
+            outIndices.resize(kept);
+
+            corners.resize(kept);
+            for (size_t i = 0; i < kept; ++i) corners[i] = remap[outIndices[i]];
+        };
+
+        // Positions of the triangles of p other than p, sorted and unique
+        const auto gatherRing = [&](const uint32_t p, VAArray<uint32_t>& ring)
+        {
+            ring.clear();
+            for (auto a = offsets[p]; a < offsets[p + 1]; ++a)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const auto corner = corners[triangles[a] * 3 + c];
+                    if (corner != p) ring.push_back(corner);
+                }
+            }
+            std::sort(ring.begin(), ring.end());
+            ring.erase(std::unique(ring.begin(), ring.end()), ring.end());
+        };
+
+        // Vertex of the target used by the triangles shared with the source, it replaces
+        // the source vertex. INVALID_VERTEX when the collapse would break the surface.
+        const auto validateCollapse = [&](const uint32_t source, const uint32_t target)
+        {
+            auto targetVertex = INVALID_VERTEX;
+            size_t sharedCount = 0;
+            for (auto a = offsets[source]; a < offsets[source + 1]; ++a)
+            {
+                const auto triangle = triangles[a] * 3;
+                Math::Vec3 before[3];
+                Math::Vec3 after[3];
+                bool shared = false;
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const auto corner = corners[triangle + c];
+                    if (corner == target)
+                    {
+                        if (targetVertex != INVALID_VERTEX &&
+                            targetVertex != outIndices[triangle + c])
+                        {
+                            return INVALID_VERTEX;
+                        }
+                        targetVertex = outIndices[triangle + c];
+                        shared = true;
+                    }
+                    before[c] = position(corner);
+                    after[c] = corner == source ? position(target) : before[c];
+                }
+
+                if (shared)
+                {
+                    ++sharedCount;
+                    continue;
+                }
+
+                // The remaining triangles must keep their orientation
+                const auto normalBefore = Math::Vec3::Cross(
+                    before[1] - before[0],
+                    before[2] - before[0]);
+                const auto normalAfter = Math::Vec3::Cross(
+                    after[1] - after[0],
+                    after[2] - after[0]);
+                if (Math::Vec3::Dot(normalBefore, normalAfter) <= 0.0f) return INVALID_VERTEX;
+            }
+
+            // Link condition: a neighbour of both ends outside their shared triangles would
+            // get two triangles on the same edge
+            gatherRing(source, sourceRing);
+            gatherRing(target, targetRing);
+            size_t commonCount = 0;
+            for (size_t i = 0, j = 0; i < sourceRing.size() && j < targetRing.size();)
+            {
+                if (sourceRing[i] < targetRing[j]) ++i;
+                else if (targetRing[j] < sourceRing[i]) ++j;
+                else
+                {
+                    ++commonCount;
+                    ++i;
+                    ++j;
+                }
+            }
+            return commonCount == sharedCount ? targetVertex : INVALID_VERTEX;
+        };
+
+        compact();
+        size_t triangleCount = outIndices.size() / 3;
+        while (triangleCount > targetTriangles)
+        {
+            MeshNormals::BuildVertexTriangles(corners, vertexCount, offsets, triangles);
+
+            // Both directions of every edge, interior edges show up twice and the second
+            // occurrence is skipped as touched
+            candidates.clear();
+            for (size_t i = 0; i < corners.size(); i += 3)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const auto a = corners[i + c];
+                    const auto b = corners[i + (c + 1) % 3];
+                    for (const auto& [source, target] : {std::pair{a, b}, std::pair{b, a}})
+                    {
+                        if (locked[source]) continue;
+
+                        const auto error = CollapseError(
+                            quadrics[source],
+                            quadrics[target],
+                            position(target));
+                        if (error <= maxError) candidates.push_back({error, source, target});
+                    }
+                }
+            }
+            std::sort(
+                candidates.begin(),
+                candidates.end(),
+                [](const Collapse& a, const Collapse& b)
+                {
+                    return std::tie(a.error, a.source, a.target) <
+                        std::tie(b.error, b.source, b.target);
+                });
+
+            std::fill(touched.begin(), touched.end(), 0);
+            size_t collapseCount = 0;
+            for (const auto& [error, source, target] : candidates)
+            {
+                if (triangleCount <= targetTriangles) break;
+                if (touched[source] || touched[target]) continue;
+
+                const auto targetVertex = validateCollapse(source, target);
+                if (targetVertex == INVALID_VERTEX) continue;
+
+                // The source has a single vertex since seams are locked
+                for (auto a = offsets[source]; a < offsets[source + 1]; ++a)
+                {
+                    const auto triangle = triangles[a] * 3;
+                    bool shared = false;
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        touched[corners[triangle + c]] = 1;
+                        shared |= corners[triangle + c] == target;
+                        if (corners[triangle + c] == source)
+                        {
+                            outIndices[triangle + c] = targetVertex;
+                        }
+                    }
+                    if (shared) --triangleCount;
+                }
+
+                quadrics[target].Add(quadrics[source]);
+                resultError = std::max(resultError, error);
+                ++collapseCount;
+            }
+
+            compact();
+            if (collapseCount == 0) break;
+        }
+
+        return resultError;
+    }
+
+    void MeshSimplifier::BuildLodChain(
+        const std::span<const MeshVertex> vertices,
+        VAArray<uint32_t>& indices,
+        const SubMeshDescriptor& submesh,
+        const uint32_t submeshIndex,
+        VAArray<MeshLod>& outLods,
+        const LodChainSettings& settings)
+    {
+        if (submesh.IsEmpty()) return;
+
+        const auto rangeVertices = vertices.subspan(submesh.vertexOffset, submesh.vertexCount);
+        const auto bounds = submesh.bounds.IsValid()
+            ? submesh.bounds
+            : MeshData::ComputeBounds(rangeVertices);
+        const float maxError = settings.maxRelativeError * bounds.radius;
+
+        VAArray<uint32_t> current(
+            indices.begin() + submesh.indexOffset,
+            indices.begin() + submesh.GetIndexEnd());
+        VAArray<uint32_t> simplified;
+        float error = 0.0f;
+
+        for (uint32_t level = 0; level < settings.maxLods; ++level)
+        {
+            const size_t triangleCount = current.size() / 3;
+            if (triangleCount <= settings.minTriangles) break;
+
+            const auto target = static_cast<size_t>(
+                static_cast<float>(triangleCount) * settings.reduction) * 3;
+            const auto stepError = Simplify(
+                rangeVertices,
+                current,
+                target,
+                std::max(0.0f, maxError - error),
+                simplified);
+            if (simplified.empty() ||
+                static_cast<float>(simplified.size()) >
+                static_cast<float>(current.size()) * settings.minReduction)
+            {
+                break;
+            }
+
+            error += stepError;
+            MeshOptimizer::OptimizeVertexCache(
+                simplified,
+                submesh.vertexCount,
+                MeshOptimizerSettings{}.cacheSize);
+
+            outLods.push_back(
+                {
+                    static_cast<uint32_t>(indices.size()),
+                    static_cast<uint32_t>(simplified.size()),
+                    error,
+                    submeshIndex
+                });
+            indices.insert(indices.end(), simplified.begin(), simplified.end());
+            std::swap(current, simplified);
+        }
+    }
+} // namespace VoidArchitect::Resources
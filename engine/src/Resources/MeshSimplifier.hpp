@@ -0,0 +1,94 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "MeshData.hpp"
+#include "MeshLod.hpp"
+#include "SubMesh.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Tuning of the LOD chain built for every submesh
+    struct LodChainSettings
+    {
+        /// @brief Simplified levels to build at most, LOD 0 excluded
+        uint32_t maxLods = MESH_MAX_LODS - 1;
+
+        /// @brief Target triangle count of a level, relative to the previous one
+        float reduction = 0.5f;
+
+        /// @brief Largest accepted error, relative to the bounding sphere radius of the submesh
+        float maxRelativeError = 0.1f;
+
+        /// @brief No level is built from a level with this many triangles or fewer
+        uint32_t minTriangles = 32;
+
+        /// @brief The chain stops when a level keeps more than this fraction of the triangles
+        ///        of the previous one, the mesh cannot be simplified any further
+        float minReduction = 0.8f;
+    };
+
+    /// @brief Bake-time mesh simplification by quadric error metrics
+    ///
+    /// Simplify() collapses edges (Garland and Heckbert 1997), cheapest first. Every collapse
+    /// moves a vertex onto one of its neighbours instead of an optimal new position, so the
+    /// simplified triangles only reference existing vertices and every LOD shares the vertex
+    /// buffer of the mesh: a LOD is just another index range.
+    ///
+    /// Vertices are welded by position so that UV and normal seams do not tear open.
+    /// Vertices on borders, on non-manifold edges and on seams are never moved, which keeps
+    /// silhouettes and attribute discontinuities intact at the cost of less reduction around
+    /// them. Collapses that would flip a triangle or pinch the surface are rejected.
+    ///
+    /// Collapses are applied in passes: every pass sorts the candidate edges by error and
+    /// applies them in that order, skipping edges around a vertex already changed during the
+    /// pass. The result is deterministic.
+    ///
+    /// Usage example:
+    /// @code
+    /// VAArray<MeshLod> lods;
+    /// for (uint32_t i = 0; i < submeshes.size(); ++i)
+    /// {
+    ///     submeshes[i].lodOffset = static_cast<uint32_t>(lods.size());
+    ///     MeshSimplifier::BuildLodChain(vertices, indices, submeshes[i], i, lods);
+    ///     submeshes[i].lodCount = static_cast<uint32_t>(lods.size()) - submeshes[i].lodOffset;
+    /// }
+    /// @endcode
+    class MeshSimplifier
+    {
+    public:
+        /// @brief Simplify a triangle list
+        /// @param vertices Vertices of the range
+        /// @param indices Triangle list, relative to the first vertex of the range
+        /// @param targetIndexCount Index count to reach, the result may stay above it when
+        ///        the error limit or the locked vertices prevent further collapses
+        /// @param maxError Largest accepted distance from the input surface
+        /// @param outIndices Receives the simplified triangle list, over the same vertices
+        /// @return Error of the result, in position units
+        static float Simplify(
+            std::span<const MeshVertex> vertices,
+            std::span<const uint32_t> indices,
+            size_t targetIndexCount,
+            float maxError,
+            VAArray<uint32_t>& outIndices);
+
+        /// @brief Build the simplified levels of a submesh
+        /// @param vertices Whole vertex array of the mesh
+        /// @param indices Whole index array of the mesh, the levels are appended at its end
+        /// @param submesh Submesh to simplify
+        /// @param submeshIndex Index stored in the generated levels
+        /// @param outLods Receives the levels, finest first
+        /// @param settings Chain tuning
+        ///
+        /// Every level is simplified from the previous one and optimized for the vertex
+        /// cache. Its error is the sum of the errors of the steps, an upper bound of its
+        /// distance from LOD 0.
+        static void BuildLodChain(
+            std::span<const MeshVertex> vertices,
+            VAArray<uint32_t>& indices,
+            const SubMeshDescriptor& submesh,
+            uint32_t submeshIndex,
+            VAArray<MeshLod>& outLods,
+            const LodChainSettings& settings = {});
+    };
+} // namespace VoidArchitect::Resources
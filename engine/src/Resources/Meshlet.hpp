@@ -0,0 +1,39 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "Core/Math/Vec3.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Maximum number of unique vertices referenced by one meshlet
+    static constexpr uint32_t MESHLET_MAX_VERTICES = 64;
+
+    /// @brief Maximum number of triangles in one meshlet
+    static constexpr uint32_t MESHLET_MAX_TRIANGLES = 124;
+
+    /// @brief Cluster of up to 124 triangles and 64 vertices, the unit of cluster culling
+    ///
+    /// The triangles of a meshlet are contiguous in the mesh index buffer, so a visible
+    /// meshlet is drawn as a plain index range with the vertex offset of its submesh.
+    ///
+    /// Culling data is in the object space of the mesh:
+    /// - center and radius enclose every vertex of the meshlet
+    /// - coneAxis and coneCutoff bound the triangle normals. The meshlet is entirely
+    ///   backfacing from a camera at c when
+    ///   dot(center - c, coneAxis) >= coneCutoff * length(center - c) + radius.
+    ///   A cutoff of 1 disables the test, for meshlets whose normals spread too much.
+    struct Meshlet
+    {
+        uint32_t indexOffset; ///< First index, in the whole mesh index array
+        uint32_t triangleCount;
+        uint32_t vertexCount; ///< Unique vertices referenced by the triangles
+        uint32_t submeshIndex; ///< Submesh the meshlet belongs to
+        Math::Vec3 center; ///< Bounding sphere center
+        float radius; ///< Bounding sphere radius
+        Math::Vec3 coneAxis; ///< Average direction of the triangle normals
+        float coneCutoff; ///< Sine of the normal cone half angle, 1 if the cone is too wide
+
+        [[nodiscard]] uint32_t GetIndexCount() const { return triangleCount * 3; }
+    };
+} // namespace VoidArchitect::Resources
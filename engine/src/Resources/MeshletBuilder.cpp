@@ -0,0 +1,144 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "MeshletBuilder.hpp"
+
+#include <cmath>
+
+namespace VoidArchitect::Resources
+{
+    namespace
+    {
+        /// @brief Cones wider than acos(0.1), about 84 degrees, can never be backfacing as a
+        ///        whole from a useful distance, their test is disabled
+        constexpr float MIN_CONE_DOT = 0.1f;
+    } // namespace
+
+    void MeshletBuilder::Build(
+        const std::span<const MeshVertex> vertices,
+        const std::span<const uint32_t> indices,
+        const SubMeshDescriptor& submesh,
+        const uint32_t submeshIndex,
+        VAArray<Meshlet>& outMeshlets,
+        const uint32_t maxVertices,
+        const uint32_t maxTriangles)
+    {
+        if (submesh.IsEmpty()) return;
+
+        const auto submeshVertices = vertices.subspan(submesh.vertexOffset, submesh.vertexCount);
+        const auto submeshIndices = indices.subspan(submesh.indexOffset, submesh.indexCount);
+
+        // Meshlet that last referenced each vertex, a vertex is new to the current meshlet
+        // when it belongs to another one
+        VAArray<uint32_t> owners(submesh.vertexCount, std::numeric_limits<uint32_t>::max());
+        uint32_t currentId = 0;
+
+        Meshlet current{};
+        current.indexOffset = submesh.indexOffset;
+        current.submeshIndex = submeshIndex;
+
+        const auto countNewVertices = [&](const uint32_t* triangle)
+        {
+            const uint32_t a = triangle[0];
+            const uint32_t b = triangle[1];
+            const uint32_t c = triangle[2];
+            return static_cast<uint32_t>(owners[a] != currentId) +
+                static_cast<uint32_t>(owners[b] != currentId && b != a) +
+                static_cast<uint32_t>(owners[c] != currentId && c != a && c != b);
+        };
+
+        const auto closeMeshlet = [&]()
+        {
+            ComputeCullingData(
+                submeshVertices,
+                submeshIndices.subspan(
+                    current.indexOffset - submesh.indexOffset,
+                    current.GetIndexCount()),
+                current);
+            outMeshlets.push_back(current);
+
+            current.indexOffset += current.GetIndexCount();
+            current.triangleCount = 0;
+            current.vertexCount = 0;
+            ++currentId;
+        };
+
+        for (uint32_t i = 0; i + 2 < submesh.indexCount; i += 3)
+        {
+            const uint32_t* triangle = submeshIndices.data() + i;
+            if (current.triangleCount == maxTriangles ||
+                current.vertexCount + countNewVertices(triangle) > maxVertices)
+            {
+                closeMeshlet();
+            }
+
+            for (uint32_t corner = 0; corner < 3; ++corner)
+            {
+                if (owners[triangle[corner]] != currentId)
+                {
+                    owners[triangle[corner]] = currentId;
+                    ++current.vertexCount;
+                }
+            }
+            ++current.triangleCount;
+        }
+
+        if (current.triangleCount > 0) closeMeshlet();
+    }
+
+    void MeshletBuilder::ComputeCullingData(
+        const std::span<const MeshVertex> vertices,
+        const std::span<const uint32_t> indices,
+        Meshlet& meshlet)
+    {
+        VAArray<float> positions;
+        VAArray<Math::Vec3> normals;
+        positions.reserve(indices.size() * 3);
+        normals.reserve(indices.size() / 3);
+
+        auto axis = Math::Vec3::Zero();
+        for (size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            const auto& p0 = vertices[indices[i]].Position;
+            const auto& p1 = vertices[indices[i + 1]].Position;
+            const auto& p2 = vertices[indices[i + 2]].Position;
+            for (const auto* position : {&p0, &p1, &p2})
+            {
+                positions.insert(positions.end(), {position->X(), position->Y(), position->Z()});
+            }
+
+            // Counter-clockwise triangles are front facing, the normal points to the viewer
+            auto normal = Math::Vec3::Cross(p1 - p0, p2 - p0);
+            const float area = std::sqrt(Math::Vec3::Dot(normal, normal));
+            if (area == 0.0f) continue;
+
+            normal = normal / area;
+            normals.push_back(normal);
+            axis += normal;
+        }
+
+        const auto bounds = Math::Bounds::FromPoints(
+            positions.data(),
+            positions.size() / 3,
+            3 * sizeof(float));
+        meshlet.center = bounds.center;
+        meshlet.radius = bounds.radius;
+
+        // Degenerate or opposite normals leave no usable cone
+        meshlet.coneAxis = Math::Vec3::Zero();
+        meshlet.coneCutoff = 1.0f;
+        const float axisLength = std::sqrt(Math::Vec3::Dot(axis, axis));
+        if (axisLength == 0.0f) return;
+
+        axis = axis / axisLength;
+        float minDot = 1.0f;
+        for (const auto& normal : normals)
+        {
+            minDot = std::min(minDot, Math::Vec3::Dot(axis, normal));
+        }
+        if (minDot <= MIN_CONE_DOT) return;
+
+        meshlet.coneAxis = axis;
+        meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+    }
+} // namespace VoidArchitect::Resources
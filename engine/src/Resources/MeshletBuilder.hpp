@@ -0,0 +1,58 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "MeshData.hpp"
+#include "Meshlet.hpp"
+#include "SubMesh.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Bake-time partitioning of index ranges into meshlets
+    ///
+    /// Triangles are scanned in index buffer order and a meshlet is closed as soon as the
+    /// next triangle would exceed one of the limits. Running MeshOptimizer first matters:
+    /// its cache-optimized order keeps consecutive triangles close to each other, which
+    /// gives tight meshlets, and the partition itself never reorders indices so the cache
+    /// and overdraw gains are preserved.
+    ///
+    /// Usage example:
+    /// @code
+    /// for (uint32_t i = 0; i < submeshes.size(); ++i)
+    /// {
+    ///     submeshes[i].meshletOffset = static_cast<uint32_t>(meshlets.size());
+    ///     MeshletBuilder::Build(vertices, indices, submeshes[i], i, meshlets);
+    ///     submeshes[i].meshletCount = static_cast<uint32_t>(meshlets.size()) -
+    ///         submeshes[i].meshletOffset;
+    /// }
+    /// @endcode
+    class MeshletBuilder
+    {
+    public:
+        /// @brief Partition the triangles of a submesh into meshlets
+        /// @param vertices Whole vertex array of the mesh
+        /// @param indices Whole index array of the mesh, relative to the submesh vertex offset
+        /// @param submesh Range to partition
+        /// @param submeshIndex Index stored in the generated meshlets
+        /// @param outMeshlets Receives the meshlets, appended in index order
+        /// @param maxVertices Vertex limit, at least 3
+        /// @param maxTriangles Triangle limit, at least 1
+        static void Build(
+            std::span<const MeshVertex> vertices,
+            std::span<const uint32_t> indices,
+            const SubMeshDescriptor& submesh,
+            uint32_t submeshIndex,
+            VAArray<Meshlet>& outMeshlets,
+            uint32_t maxVertices = MESHLET_MAX_VERTICES,
+            uint32_t maxTriangles = MESHLET_MAX_TRIANGLES);
+
+        /// @brief Fill the bounding sphere and normal cone of a meshlet from its triangles
+        /// @param vertices Vertices of the submesh range
+        /// @param indices Indices of the meshlet, relative to the submesh vertex offset
+        /// @param meshlet Meshlet to update
+        static void ComputeCullingData(
+            std::span<const MeshVertex> vertices,
+            std::span<const uint32_t> indices,
+            Meshlet& meshlet);
+    };
+} // namespace VoidArchitect::Resources
@@ -3,6 +3,7 @@
 //
 #pragma once
 #include "Material.hpp"
+#include "Core/Math/Bounds.hpp"
 
 namespace VoidArchitect::Resources
 {
@@ -16,6 +17,11 @@ namespace VoidArchitect::Resources
         uint32_t indexCount;
         uint32_t vertexOffset;
         uint32_t vertexCount;
+        Math::Bounds bounds; ///< Bounds of the vertex range, empty until computed
+        uint32_t meshletOffset = 0; ///< First meshlet of the submesh in MeshData::GetMeshlets()
+        uint32_t meshletCount = 0; ///< 0 when the submesh has no meshlets
+        uint32_t lodOffset = 0; ///< First simplified level of the submesh in MeshData::GetLods()
+        uint32_t lodCount = 0; ///< Simplified levels, the submesh range itself is LOD 0
 
         SubMeshDescriptor() = default;
         SubMeshDescriptor(
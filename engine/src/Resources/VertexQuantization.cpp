@@ -0,0 +1,600 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "VertexQuantization.hpp"
+
+#include "Core/Core.hpp"
+#include "Core/Logger.hpp"
+
+#include <bit>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define VA_QUANTIZATION_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VA_QUANTIZATION_NEON 1
+#endif
+
+namespace VoidArchitect::Resources
+{
+    namespace
+    {
+        constexpr uint32_t BATCH_SIZE = 4;
+        constexpr float SNORM16_SCALE = 32767.0f;
+        constexpr float SNORM16_INV_SCALE = 1.0f / 32767.0f;
+
+        /// @brief Smallest magnitude of the folded tangent coordinate, one snorm16 step, so
+        ///        that a negative handedness survives quantization when v is exactly -1
+        constexpr float TANGENT_SIGN_EPSILON = 1.0f / 32767.0f;
+
+        // === Half floats ===
+        // Float to half is "float_to_half_fast3_rtne" by F. Giesen: normal values are
+        // rounded by integer arithmetic, subnormals by letting the FPU align the mantissa.
+
+        constexpr uint32_t F32_INFINITY = 0x7f800000;
+        constexpr uint32_t F16_MAX_AS_F32 = 0x47800000; ///< 65536, first value rounding to inf
+        constexpr uint32_t F16_MIN_NORMAL_AS_F32 = 0x38800000; ///< 2^-14
+        constexpr uint32_t SUBNORMAL_MAGIC = 0x3f000000; ///< 0.5f, aligns 2^-24 to bit 0
+        constexpr uint32_t REBIAS_AND_ROUND = 0xc8000fff; ///< ((15 - 127) << 23) + 0xfff
+
+        uint16_t FloatToHalfScalar(const float value)
+        {
+            uint32_t bits = std::bit_cast<uint32_t>(value);
+            const uint32_t sign = bits & 0x80000000u;
+            bits ^= sign;
+
+            uint32_t half;
+            if (bits >= F16_MAX_AS_F32)
+            {
+                half = bits > F32_INFINITY ? 0x7e00 : 0x7c00;
+            }
+            else if (bits < F16_MIN_NORMAL_AS_F32)
+            {
+                const float aligned = std::bit_cast<float>(bits) +
+                    std::bit_cast<float>(SUBNORMAL_MAGIC);
+                half = std::bit_cast<uint32_t>(aligned) - SUBNORMAL_MAGIC;
+            }
+            else
+            {
+                const uint32_t mantissaOdd = (bits >> 13) & 1;
+                half = (bits + REBIAS_AND_ROUND + mantissaOdd) >> 13;
+            }
+
+            return static_cast<uint16_t>(half | (sign >> 16));
+        }
+
+        float HalfToFloatScalar(const uint16_t value)
+        {
+            constexpr uint32_t EXPONENT_MASK = 0x7c00u << 13;
+
+            uint32_t bits = (value & 0x7fffu) << 13;
+            const uint32_t exponent = bits & EXPONENT_MASK;
+            bits += (127 - 15) << 23;
+
+            if (exponent == EXPONENT_MASK)
+            {
+                // Infinity or NaN
+                bits += (128 - 16) << 23;
+            }
+            else if (exponent == 0)
+            {
+                // Zero or subnormal, renormalized by the FPU
+                bits += 1 << 23;
+                bits = std::bit_cast<uint32_t>(
+                    std::bit_cast<float>(bits) - std::bit_cast<float>(113u << 23));
+            }
+
+            return std::bit_cast<float>(bits | (static_cast<uint32_t>(value & 0x8000u) << 16));
+        }
+
+        // === Scalar reference of the octahedral mapping ===
+
+        void OctEncodeScalar(const float x, const float y, const float z, float& u, float& v)
+        {
+            const float l1 = std::max(std::abs(x) + std::abs(y) + std::abs(z), FLT_MIN);
+            const float ox = x / l1;
+            const float oy = y / l1;
+            if (z < 0.0f)
+            {
+                u = std::copysign(1.0f - std::abs(oy), ox);
+                v = std::copysign(1.0f - std::abs(ox), oy);
+            }
+            else
+            {
+                u = ox;
+                v = oy;
+            }
+        }
+
+        void OctDecodeScalar(const float u, const float v, float& x, float& y, float& z)
+        {
+            z = 1.0f - std::abs(u) - std::abs(v);
+            const float t = std::max(-z, 0.0f);
+            x = u - std::copysign(t, u);
+            y = v - std::copysign(t, v);
+
+            const float invLength = 1.0f / std::sqrt(x * x + y * y + z * z);
+            x *= invLength;
+            y *= invLength;
+            z *= invLength;
+        }
+
+        int16_t QuantizeSnorm16Scalar(const float value)
+        {
+            return static_cast<int16_t>(
+                std::nearbyint(std::clamp(value, -1.0f, 1.0f) * SNORM16_SCALE));
+        }
+
+        float DequantizeSnorm16Scalar(const int16_t value)
+        {
+            return std::max(static_cast<float>(value) * SNORM16_INV_SCALE, -1.0f);
+        }
+
+        // === Four-lane kernels ===
+
+        void OctEncode4(
+            const float* x,
+            const float* y,
+            const float* z,
+            float* outU,
+            float* outV)
+        {
+#if defined(VA_QUANTIZATION_SSE2)
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 vx = _mm_loadu_ps(x);
+            const __m128 vy = _mm_loadu_ps(y);
+            const __m128 vz = _mm_loadu_ps(z);
+
+            const __m128 l1 = _mm_max_ps(
+                _mm_add_ps(
+                    _mm_add_ps(_mm_andnot_ps(signMask, vx), _mm_andnot_ps(signMask, vy)),
+                    _mm_andnot_ps(signMask, vz)),
+                _mm_set1_ps(FLT_MIN));
+            const __m128 ox = _mm_div_ps(vx, l1);
+            const __m128 oy = _mm_div_ps(vy, l1);
+
+            // Lower hemisphere folds over the diagonals, 1 - |o| is never negative so OR-ing
+            // the sign bit in is a copysign
+            const __m128 foldU = _mm_or_ps(
+                _mm_sub_ps(one, _mm_andnot_ps(signMask, oy)),
+                _mm_and_ps(signMask, ox));
+            const __m128 foldV = _mm_or_ps(
+                _mm_sub_ps(one, _mm_andnot_ps(signMask, ox)),
+                _mm_and_ps(signMask, oy));
+            const __m128 lower = _mm_cmplt_ps(vz, _mm_setzero_ps());
+
+            _mm_storeu_ps(outU, _mm_or_ps(_mm_and_ps(lower, foldU), _mm_andnot_ps(lower, ox)));
+            _mm_storeu_ps(outV, _mm_or_ps(_mm_and_ps(lower, foldV), _mm_andnot_ps(lower, oy)));
+#elif defined(VA_QUANTIZATION_NEON)
+            const uint32x4_t signMask = vdupq_n_u32(0x80000000u);
+            const float32x4_t one = vdupq_n_f32(1.0f);
+            const float32x4_t vx = vld1q_f32(x);
+            const float32x4_t vy = vld1q_f32(y);
+            const float32x4_t vz = vld1q_f32(z);
+
+            const float32x4_t l1 = vmaxq_f32(
+                vaddq_f32(vaddq_f32(vabsq_f32(vx), vabsq_f32(vy)), vabsq_f32(vz)),
+                vdupq_n_f32(FLT_MIN));
+            const float32x4_t ox = vdivq_f32(vx, l1);
+            const float32x4_t oy = vdivq_f32(vy, l1);
+
+            const float32x4_t foldU = vbslq_f32(signMask, ox, vsubq_f32(one, vabsq_f32(oy)));
+            const float32x4_t foldV = vbslq_f32(signMask, oy, vsubq_f32(one, vabsq_f32(ox)));
+            const uint32x4_t lower = vcltq_f32(vz, vdupq_n_f32(0.0f));
+
+            vst1q_f32(outU, vbslq_f32(lower, foldU, ox));
+            vst1q_f32(outV, vbslq_f32(lower, foldV, oy));
+#else
+            for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+            {
+                OctEncodeScalar(x[i], y[i], z[i], outU[i], outV[i]);
+            }
+#endif
+        }
+
+        void OctDecode4(
+            const float* u,
+            const float* v,
+            float* outX,
+            float* outY,
+            float* outZ)
+        {
+#if defined(VA_QUANTIZATION_SSE2)
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 vu = _mm_loadu_ps(u);
+            const __m128 vv = _mm_loadu_ps(v);
+
+            const __m128 z = _mm_sub_ps(
+                _mm_sub_ps(_mm_set1_ps(1.0f), _mm_andnot_ps(signMask, vu)),
+                _mm_andnot_ps(signMask, vv));
+            const __m128 t = _mm_max_ps(_mm_sub_ps(zero, z), zero);
+            const __m128 x = _mm_sub_ps(vu, _mm_or_ps(t, _mm_and_ps(signMask, vu)));
+            const __m128 y = _mm_sub_ps(vv, _mm_or_ps(t, _mm_and_ps(signMask, vv)));
+
+            const __m128 lengthSq = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+                _mm_mul_ps(z, z));
+            const __m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSq));
+
+            _mm_storeu_ps(outX, _mm_mul_ps(x, invLength));
+            _mm_storeu_ps(outY, _mm_mul_ps(y, invLength));
+            _mm_storeu_ps(outZ, _mm_mul_ps(z, invLength));
+#elif defined(VA_QUANTIZATION_NEON)
+            const uint32x4_t signMask = vdupq_n_u32(0x80000000u);
+            const float32x4_t vu = vld1q_f32(u);
+            const float32x4_t vv = vld1q_f32(v);
+
+            const float32x4_t z = vsubq_f32(
+                vsubq_f32(vdupq_n_f32(1.0f), vabsq_f32(vu)),
+                vabsq_f32(vv));
+            const float32x4_t t = vmaxq_f32(vnegq_f32(z), vdupq_n_f32(0.0f));
+            const float32x4_t x = vsubq_f32(vu, vbslq_f32(signMask, vu, t));
+            const float32x4_t y = vsubq_f32(vv, vbslq_f32(signMask, vv, t));
+
+            const float32x4_t lengthSq = vaddq_f32(
+                vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y)),
+                vmulq_f32(z, z));
+            const float32x4_t invLength = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(lengthSq));
+
+            vst1q_f32(outX, vmulq_f32(x, invLength));
+            vst1q_f32(outY, vmulq_f32(y, invLength));
+            vst1q_f32(outZ, vmulq_f32(z, invLength));
+#else
+            for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+            {
+                OctDecodeScalar(u[i], v[i], outX[i], outY[i], outZ[i]);
+            }
+#endif
+        }
+
+        void QuantizeSnorm16x4(const float* values, int16_t* outValues)
+        {
+#if defined(VA_QUANTIZATION_SSE2)
+            const __m128 clamped = _mm_min_ps(
+                _mm_max_ps(_mm_loadu_ps(values), _mm_set1_ps(-1.0f)),
+                _mm_set1_ps(1.0f));
+            // cvtps rounds to nearest even, like nearbyint in the default rounding mode
+            const __m128i quantized = _mm_cvtps_epi32(
+                _mm_mul_ps(clamped, _mm_set1_ps(SNORM16_SCALE)));
+            _mm_storel_epi64(
+                reinterpret_cast<__m128i*>(outValues),
+                _mm_packs_epi32(quantized, quantized));
+#elif defined(VA_QUANTIZATION_NEON)
+            const float32x4_t clamped = vminq_f32(
+                vmaxq_f32(vld1q_f32(values), vdupq_n_f32(-1.0f)),
+                vdupq_n_f32(1.0f));
+            const int32x4_t quantized = vcvtnq_s32_f32(
+                vmulq_f32(clamped, vdupq_n_f32(SNORM16_SCALE)));
+            vst1_s16(outValues, vqmovn_s32(quantized));
+#else
+            for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+            {
+                outValues[i] = QuantizeSnorm16Scalar(values[i]);
+            }
+#endif
+        }
+
+        void DequantizeSnorm16x4(const int16_t* values, float* outValues)
+        {
+#if defined(VA_QUANTIZATION_SSE2)
+            const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values));
+            const __m128i widened = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+            _mm_storeu_ps(
+                outValues,
+                _mm_max_ps(
+                    _mm_mul_ps(_mm_cvtepi32_ps(widened), _mm_set1_ps(SNORM16_INV_SCALE)),
+                    _mm_set1_ps(-1.0f)));
+#elif defined(VA_QUANTIZATION_NEON)
+            const float32x4_t widened = vcvtq_f32_s32(vmovl_s16(vld1_s16(values)));
+            vst1q_f32(
+                outValues,
+                vmaxq_f32(
+                    vmulq_f32(widened, vdupq_n_f32(SNORM16_INV_SCALE)),
+                    vdupq_n_f32(-1.0f)));
+#else
+            for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+            {
+                outValues[i] = DequantizeSnorm16Scalar(values[i]);
+            }
+#endif
+        }
+
+        void FloatToHalf4(const float* values, uint16_t* outValues)
+        {
+#if defined(VA_QUANTIZATION_SSE2)
+            const __m128i signMask = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+            __m128i bits = _mm_castps_si128(_mm_loadu_ps(values));
+            const __m128i sign = _mm_and_si128(bits, signMask);
+            bits = _mm_xor_si128(bits, sign);
+
+            // Sign bits are cleared, signed comparisons are fine
+            const __m128i isNaN = _mm_cmpgt_epi32(bits, _mm_set1_epi32(F32_INFINITY));
+            const __m128i isFinite = _mm_cmpgt_epi32(_mm_set1_epi32(F16_MAX_AS_F32), bits);
+            const __m128i isSubnormal = _mm_cmpgt_epi32(
+                _mm_set1_epi32(F16_MIN_NORMAL_AS_F32),
+                bits);
+
+            const __m128i infOrNaN = _mm_or_si128(
+                _mm_set1_epi32(0x7c00),
+                _mm_and_si128(isNaN, _mm_set1_epi32(0x0200)));
+            const __m128i subnormal = _mm_sub_epi32(
+                _mm_castps_si128(
+                    _mm_add_ps(
+                        _mm_castsi128_ps(bits),
+                        _mm_castsi128_ps(_mm_set1_epi32(SUBNORMAL_MAGIC)))),
+                _mm_set1_epi32(SUBNORMAL_MAGIC));
+            const __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+            const __m128i normal = _mm_srli_epi32(
+                _mm_add_epi32(
+                    _mm_add_epi32(bits, _mm_set1_epi32(static_cast<int32_t>(REBIAS_AND_ROUND))),
+                    mantissaOdd),
+                13);
+
+            __m128i half = _mm_or_si128(
+                _mm_and_si128(isSubnormal, subnormal),
+                _mm_andnot_si128(isSubnormal, normal));
+            half = _mm_or_si128(
+                _mm_and_si128(isFinite, half),
+                _mm_andnot_si128(isFinite, infOrNaN));
+            half = _mm_or_si128(half, _mm_srli_epi32(sign, 16));
+
+            // Sign-extend so that the saturating pack keeps the 16 bits untouched
+            half = _mm_srai_epi32(_mm_slli_epi32(half, 16), 16);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(outValues), _mm_packs_epi32(half, half));
+#elif defined(VA_QUANTIZATION_NEON)
+            vst1_u16(outValues, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(values))));
+#else
+            for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+            {
+                outValues[i] = FloatToHalfScalar(values[i]);
+            }
+#endif
+        }
+
+        void HalfToFloat4(const uint16_t* values, float* outValues)
+        {
+#if defined(VA_QUANTIZATION_SSE2)
+            const __m128i exponentMask = _mm_set1_epi32(0x7c00 << 13);
+            const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values));
+            const __m128i half = _mm_unpacklo_epi16(packed, _mm_setzero_si128());
+
+            __m128i bits = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x7fff)), 13);
+            const __m128i exponent = _mm_and_si128(bits, exponentMask);
+            bits = _mm_add_epi32(bits, _mm_set1_epi32((127 - 15) << 23));
+
+            const __m128i isInfOrNaN = _mm_cmpeq_epi32(exponent, exponentMask);
+            bits = _mm_add_epi32(bits, _mm_and_si128(isInfOrNaN, _mm_set1_epi32((128 - 16) << 23)));
+
+            const __m128i isSubnormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+            const __m128i renormalized = _mm_castps_si128(
+                _mm_sub_ps(
+                    _mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))),
+                    _mm_castsi128_ps(_mm_set1_epi32(113 << 23))));
+            bits = _mm_or_si128(
+                _mm_and_si128(isSubnormal, renormalized),
+                _mm_andnot_si128(isSubnormal, bits));
+
+            const __m128i sign = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16);
+            _mm_storeu_ps(outValues, _mm_castsi128_ps(_mm_or_si128(bits, sign)));
+#elif defined(VA_QUANTIZATION_NEON)
+            vst1q_f32(outValues, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(values))));
+#else
+            for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+            {
+                outValues[i] = HalfToFloatScalar(values[i]);
+            }
+#endif
+        }
+
+        /// @brief Structure-of-arrays view of four vertices, the layout the kernels work on
+        struct alignas(16) VertexBatch
+        {
+            float normal[3][BATCH_SIZE];
+            float tangent[4][BATCH_SIZE];
+            float uv[2][BATCH_SIZE];
+            float octNormal[2][BATCH_SIZE];
+            float octTangent[2][BATCH_SIZE];
+        };
+    } // namespace
+
+    void VertexQuantization::Encode(
+        const std::span<const MeshVertex> vertices,
+        const std::span<CompactVertex> outVertices)
+    {
+        VA_ENGINE_ASSERT(
+            outVertices.size() >= vertices.size(),
+            "Compact vertex output is too small.");
+
+        const MeshVertex padding{
+            Math::Vec3(0.0f, 0.0f, 0.0f),
+            Math::Vec3(0.0f, 0.0f, 1.0f),
+            Math::Vec2(0.0f, 0.0f),
+            Math::Vec4(1.0f, 0.0f, 0.0f, 1.0f)
+        };
+
+        VertexBatch batch;
+        int16_t quantized[4][BATCH_SIZE];
+        uint16_t halves[2][BATCH_SIZE];
+        for (size_t first = 0; first < vertices.size(); first += BATCH_SIZE)
+        {
+            const auto count = std::min<size_t>(BATCH_SIZE, vertices.size() - first);
+
+            // Gather, padding a partial batch with a valid frame
+            for (uint32_t lane = 0; lane < BATCH_SIZE; ++lane)
+            {
+                const auto& vertex = lane < count ? vertices[first + lane] : padding;
+                batch.normal[0][lane] = vertex.Normal.X();
+                batch.normal[1][lane] = vertex.Normal.Y();
+                batch.normal[2][lane] = vertex.Normal.Z();
+                batch.tangent[0][lane] = vertex.Tangent.X();
+                batch.tangent[1][lane] = vertex.Tangent.Y();
+                batch.tangent[2][lane] = vertex.Tangent.Z();
+                batch.tangent[3][lane] = vertex.Tangent.W();
+                batch.uv[0][lane] = vertex.UV0.X();
+                batch.uv[1][lane] = vertex.UV0.Y();
+            }
+
+            OctEncode4(
+                batch.normal[0],
+                batch.normal[1],
+                batch.normal[2],
+                batch.octNormal[0],
+                batch.octNormal[1]);
+            OctEncode4(
+                batch.tangent[0],
+                batch.tangent[1],
+                batch.tangent[2],
+                batch.octTangent[0],
+                batch.octTangent[1]);
+
+            // Fold the handedness into the sign of the remapped tangent v coordinate
+            for (uint32_t lane = 0; lane < BATCH_SIZE; ++lane)
+            {
+                const float magnitude = std::max(
+                    batch.octTangent[1][lane] * 0.5f + 0.5f,
+                    TANGENT_SIGN_EPSILON);
+                batch.octTangent[1][lane] = batch.tangent[3][lane] < 0.0f
+                    ? -magnitude
+                    : magnitude;
+            }
+
+            QuantizeSnorm16x4(batch.octNormal[0], quantized[0]);
+            QuantizeSnorm16x4(batch.octNormal[1], quantized[1]);
+            QuantizeSnorm16x4(batch.octTangent[0], quantized[2]);
+            QuantizeSnorm16x4(batch.octTangent[1], quantized[3]);
+            FloatToHalf4(batch.uv[0], halves[0]);
+            FloatToHalf4(batch.uv[1], halves[1]);
+
+            // Scatter
+            for (uint32_t lane = 0; lane < count; ++lane)
+            {
+                const auto& vertex = vertices[first + lane];
+                auto& compact = outVertices[first + lane];
+                compact.position[0] = vertex.Position.X();
+                compact.position[1] = vertex.Position.Y();
+                compact.position[2] = vertex.Position.Z();
+                compact.normal[0] = quantized[0][lane];
+                compact.normal[1] = quantized[1][lane];
+                compact.tangent[0] = quantized[2][lane];
+                compact.tangent[1] = quantized[3][lane];
+                compact.uv0[0] = halves[0][lane];
+                compact.uv0[1] = halves[1][lane];
+            }
+        }
+    }
+
+    void VertexQuantization::Decode(
+        const std::span<const CompactVertex> vertices,
+        const std::span<MeshVertex> outVertices)
+    {
+        VA_ENGINE_ASSERT(outVertices.size() >= vertices.size(), "Vertex output is too small.");
+
+        constexpr CompactVertex padding{{0.0f, 0.0f, 0.0f}, {0, 0}, {0, 32767}, {0, 0}};
+
+        VertexBatch batch;
+        int16_t quantized[4][BATCH_SIZE];
+        uint16_t halves[2][BATCH_SIZE];
+        for (size_t first = 0; first < vertices.size(); first += BATCH_SIZE)
+        {
+            const auto count = std::min<size_t>(BATCH_SIZE, vertices.size() - first);
+
+            // Gather, padding a partial batch with a valid frame
+            for (uint32_t lane = 0; lane < BATCH_SIZE; ++lane)
+            {
+                const auto& compact = lane < count ? vertices[first + lane] : padding;
+                quantized[0][lane] = compact.normal[0];
+                quantized[1][lane] = compact.normal[1];
+                quantized[2][lane] = compact.tangent[0];
+                quantized[3][lane] = compact.tangent[1];
+                halves[0][lane] = compact.uv0[0];
+                halves[1][lane] = compact.uv0[1];
+            }
+
+            DequantizeSnorm16x4(quantized[0], batch.octNormal[0]);
+            DequantizeSnorm16x4(quantized[1], batch.octNormal[1]);
+            DequantizeSnorm16x4(quantized[2], batch.octTangent[0]);
+            DequantizeSnorm16x4(quantized[3], batch.octTangent[1]);
+            HalfToFloat4(halves[0], batch.uv[0]);
+            HalfToFloat4(halves[1], batch.uv[1]);
+
+            // Unfold the handedness
+            for (uint32_t lane = 0; lane < BATCH_SIZE; ++lane)
+            {
+                const float folded = batch.octTangent[1][lane];
+                batch.tangent[3][lane] = quantized[3][lane] < 0 ? -1.0f : 1.0f;
+                batch.octTangent[1][lane] = std::abs(folded) * 2.0f - 1.0f;
+            }
+
+            OctDecode4(
+                batch.octNormal[0],
+                batch.octNormal[1],
+                batch.normal[0],
+                batch.normal[1],
+                batch.normal[2]);
+            OctDecode4(
+                batch.octTangent[0],
+                batch.octTangent[1],
+                batch.tangent[0],
+                batch.tangent[1],
+                batch.tangent[2]);
+
+            // Scatter
+            for (uint32_t lane = 0; lane < count; ++lane)
+            {
+                const auto& compact = vertices[first + lane];
+                auto& vertex = outVertices[first + lane];
+                vertex.Position = Math::Vec3(
+                    compact.position[0],
+                    compact.position[1],
+                    compact.position[2]);
+                vertex.Normal = Math::Vec3(
+                    batch.normal[0][lane],
+                    batch.normal[1][lane],
+                    batch.normal[2][lane]);
+                vertex.UV0 = Math::Vec2(batch.uv[0][lane], batch.uv[1][lane]);
+                vertex.Tangent = Math::Vec4(
+                    batch.tangent[0][lane],
+                    batch.tangent[1][lane],
+                    batch.tangent[2][lane],
+                    batch.tangent[3][lane]);
+            }
+        }
+    }
+
+    std::array<int16_t, 2> VertexQuantization::EncodeOctahedral(const Math::Vec3& direction)
+    {
+        float u;
+        float v;
+        OctEncodeScalar(direction.X(), direction.Y(), direction.Z(), u, v);
+        return {QuantizeSnorm16Scalar(u), QuantizeSnorm16Scalar(v)};
+    }
+
+    Math::Vec3 VertexQuantization::DecodeOctahedral(const std::array<int16_t, 2>& encoded)
+    {
+        float x;
+        float y;
+        float z;
+        OctDecodeScalar(
+            DequantizeSnorm16Scalar(encoded[0]),
+            DequantizeSnorm16Scalar(encoded[1]),
+            x,
+            y,
+            z);
+        return Math::Vec3(x, y, z);
+    }
+
+    uint16_t VertexQuantization::FloatToHalf(const float value)
+    {
+        return FloatToHalfScalar(value);
+    }
+
+    float VertexQuantization::HalfToFloat(const uint16_t value)
+    {
+        return HalfToFloatScalar(value);
+    }
+} // namespace VoidArchitect::Resources
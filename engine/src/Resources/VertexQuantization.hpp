@@ -0,0 +1,74 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "MeshData.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Quantized MeshVertex, 24 bytes instead of 48
+    ///
+    /// - Position stays float3, so that depth-only and shading passes produce the exact same
+    ///   positions and no per-submesh dequantization constant is needed at draw time.
+    /// - Normal and tangent direction are octahedral-encoded as two snorm16 each, which keeps
+    ///   the angular error around 0.005 degree.
+    /// - The tangent handedness (MeshVertex::Tangent.w) is folded into the sign of
+    ///   tangent[1], whose magnitude stores (v * 0.5 + 0.5) of the octahedral v coordinate.
+    /// - UV0 is two IEEE half floats, exact to 1/2048 on [0, 1].
+    ///
+    /// The layout maps directly to Renderer::VertexFormat::PositionNormalUVTangentCompact:
+    /// R32G32B32_SFLOAT, R16G16_SNORM, R16G16_SNORM, R16G16_SFLOAT.
+    struct CompactVertex
+    {
+        float position[3];
+        int16_t normal[2]; ///< Octahedral normal, snorm16
+        int16_t tangent[2]; ///< Octahedral tangent, snorm16, handedness in the sign of [1]
+        uint16_t uv0[2]; ///< Half floats
+    };
+
+    static_assert(sizeof(CompactVertex) == 24, "CompactVertex must be exactly 24 bytes");
+
+    /// @brief Conversion between MeshVertex and CompactVertex
+    ///
+    /// Encode() and Decode() gather vertices in batches of four and run SSE2 or NEON kernels
+    /// on them when available, scalar loops otherwise. The single-value helpers follow the
+    /// same arithmetic and are exposed for tests and tools.
+    ///
+    /// Usage example:
+    /// @code
+    /// VAArray<CompactVertex> compact(vertices.size());
+    /// VertexQuantization::Encode(vertices, compact);
+    /// @endcode
+    class VertexQuantization
+    {
+    public:
+        /// @brief Quantize vertices
+        /// @param vertices Source vertices, normals and tangents are expected unit length
+        /// @param outVertices Destination, must hold at least vertices.size() elements
+        static void Encode(
+            std::span<const MeshVertex> vertices,
+            std::span<CompactVertex> outVertices);
+
+        /// @brief Expand quantized vertices
+        /// @param vertices Source vertices
+        /// @param outVertices Destination, must hold at least vertices.size() elements
+        ///
+        /// Decoded normals and tangents are renormalized, Tangent.w is exactly 1 or -1.
+        static void Decode(
+            std::span<const CompactVertex> vertices,
+            std::span<MeshVertex> outVertices);
+
+        /// @brief Octahedral encoding of a unit vector to two snorm16
+        static std::array<int16_t, 2> EncodeOctahedral(const Math::Vec3& direction);
+
+        /// @brief Unit vector from its octahedral encoding
+        static Math::Vec3 DecodeOctahedral(const std::array<int16_t, 2>& encoded);
+
+        /// @brief Round a float to the nearest IEEE half float (ties to even)
+        /// @note Values beyond the half range become infinities, NaNs stay NaNs.
+        static uint16_t FloatToHalf(float value);
+
+        /// @brief Expand an IEEE half float
+        static float HalfToFloat(uint16_t value);
+    };
+} // namespace VoidArchitect::Resources
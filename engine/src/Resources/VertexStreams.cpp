@@ -0,0 +1,119 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "VertexStreams.hpp"
+
+#include "Core/Core.hpp"
+#include "Core/Logger.hpp"
+
+namespace VoidArchitect::Resources
+{
+    namespace
+    {
+        /// @brief Vertices quantized at once by ExtractCompactAttributes(), 6 KiB on the stack
+        constexpr size_t COMPACT_BATCH_SIZE = 256;
+    } // namespace
+
+    void VertexStreams::ExtractPositions(
+        const std::span<const MeshVertex> vertices,
+        const std::span<VertexPosition> outPositions)
+    {
+        VA_ENGINE_ASSERT(
+            outPositions.size() >= vertices.size(),
+            "Vertex position output is too small.");
+
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            const auto& position = vertices[i].Position;
+            outPositions[i] = {{position.X(), position.Y(), position.Z()}};
+        }
+    }
+
+    void VertexStreams::ExtractAttributes(
+        const std::span<const MeshVertex> vertices,
+        const std::span<VertexAttributes> outAttributes)
+    {
+        VA_ENGINE_ASSERT(
+            outAttributes.size() >= vertices.size(),
+            "Vertex attribute output is too small.");
+
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            const auto& vertex = vertices[i];
+            outAttributes[i] = {
+                {vertex.Normal.X(), vertex.Normal.Y(), vertex.Normal.Z()},
+                {vertex.UV0.X(), vertex.UV0.Y()},
+                {vertex.Tangent.X(), vertex.Tangent.Y(), vertex.Tangent.Z(), vertex.Tangent.W()}
+            };
+        }
+    }
+
+    void VertexStreams::ExtractCompactAttributes(
+        const std::span<const MeshVertex> vertices,
+        const std::span<CompactVertexAttributes> outAttributes)
+    {
+        VA_ENGINE_ASSERT(
+            outAttributes.size() >= vertices.size(),
+            "Vertex attribute output is too small.");
+
+        // Quantize through the batched kernels, then drop the positions
+        CompactVertex batch[COMPACT_BATCH_SIZE];
+        for (size_t first = 0; first < vertices.size(); first += COMPACT_BATCH_SIZE)
+        {
+            const auto count = std::min(COMPACT_BATCH_SIZE, vertices.size() - first);
+            VertexQuantization::Encode(vertices.subspan(first, count), batch);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto& vertex = batch[i];
+                outAttributes[first + i] = {
+                    {vertex.normal[0], vertex.normal[1]},
+                    {vertex.tangent[0], vertex.tangent[1]},
+                    {vertex.uv0[0], vertex.uv0[1]}
+                };
+            }
+        }
+    }
+
+    void VertexStreams::Interleave(
+        const std::span<const VertexPosition> positions,
+        const std::span<const VertexAttributes> attributes,
+        const std::span<MeshVertex> outVertices)
+    {
+        VA_ENGINE_ASSERT(
+            attributes.size() == positions.size() && outVertices.size() >= positions.size(),
+            "Vertex stream sizes do not match.");
+
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            const auto& [position] = positions[i];
+            const auto& [normal, uv0, tangent] = attributes[i];
+            auto& vertex = outVertices[i];
+            vertex.Position = Math::Vec3(position[0], position[1], position[2]);
+            vertex.Normal = Math::Vec3(normal[0], normal[1], normal[2]);
+            vertex.UV0 = Math::Vec2(uv0[0], uv0[1]);
+            vertex.Tangent = Math::Vec4(tangent[0], tangent[1], tangent[2], tangent[3]);
+        }
+    }
+
+    void VertexStreams::Interleave(
+        const std::span<const VertexPosition> positions,
+        const std::span<const CompactVertexAttributes> attributes,
+        const std::span<CompactVertex> outVertices)
+    {
+        VA_ENGINE_ASSERT(
+            attributes.size() == positions.size() && outVertices.size() >= positions.size(),
+            "Vertex stream sizes do not match.");
+
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            const auto& [position] = positions[i];
+            const auto& [normal, tangent, uv0] = attributes[i];
+            outVertices[i] = {
+                {position[0], position[1], position[2]},
+                {normal[0], normal[1]},
+                {tangent[0], tangent[1]},
+                {uv0[0], uv0[1]}
+            };
+        }
+    }
+} // namespace VoidArchitect::Resources
@@ -0,0 +1,99 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "VertexQuantization.hpp"
+
+namespace VoidArchitect::Resources
+{
+    /// @brief Element of the position stream, 12 bytes, shared by every vertex format
+    struct VertexPosition
+    {
+        float position[3];
+    };
+
+    /// @brief Element of the attribute stream of a MeshVertex, 36 bytes
+    ///
+    /// Maps to the attributes of Renderer::VertexFormat::PositionNormalUVTangent past the
+    /// position: R32G32B32_SFLOAT, R32G32_SFLOAT, R32G32B32A32_SFLOAT.
+    struct VertexAttributes
+    {
+        float normal[3];
+        float uv0[2];
+        float tangent[4];
+    };
+
+    /// @brief Element of the attribute stream of a CompactVertex, 12 bytes
+    ///
+    /// Maps to the attributes of Renderer::VertexFormat::PositionNormalUVTangentCompact past
+    /// the position: R16G16_SNORM, R16G16_SNORM, R16G16_SFLOAT.
+    struct CompactVertexAttributes
+    {
+        int16_t normal[2]; ///< Octahedral normal, snorm16
+        int16_t tangent[2]; ///< Octahedral tangent, snorm16, handedness in the sign of [1]
+        uint16_t uv0[2]; ///< Half floats
+    };
+
+    static_assert(sizeof(VertexPosition) == 12, "VertexPosition must be exactly 12 bytes");
+    static_assert(sizeof(VertexAttributes) == 36, "VertexAttributes must be exactly 36 bytes");
+    static_assert(
+        sizeof(CompactVertexAttributes) == 12,
+        "CompactVertexAttributes must be exactly 12 bytes");
+
+    /// @brief Conversion between interleaved vertices and split vertex streams
+    ///
+    /// GPU meshes and baked VAM files store their vertices as two streams: the positions,
+    /// then every other attribute. Depth-only passes bind the position stream alone and
+    /// fetch 12 bytes per vertex instead of 48 (24 when compact); the shading passes bind
+    /// both streams and see the same attributes as the interleaved layout.
+    ///
+    /// Each stream is extracted on its own, so that a caller can fill a staging area before
+    /// reserving the next one.
+    ///
+    /// Usage example:
+    /// @code
+    /// VAArray<VertexPosition> positions(vertices.size());
+    /// VAArray<VertexAttributes> attributes(vertices.size());
+    /// VertexStreams::ExtractPositions(vertices, positions);
+    /// VertexStreams::ExtractAttributes(vertices, attributes);
+    /// @endcode
+    class VertexStreams
+    {
+    public:
+        /// @brief Position stream of vertices, identical for every vertex format
+        /// @param vertices Source vertices
+        /// @param outPositions Destination, must hold at least vertices.size() elements
+        static void ExtractPositions(
+            std::span<const MeshVertex> vertices,
+            std::span<VertexPosition> outPositions);
+
+        /// @brief Attribute stream of vertices in full precision
+        /// @param vertices Source vertices
+        /// @param outAttributes Destination, must hold at least vertices.size() elements
+        static void ExtractAttributes(
+            std::span<const MeshVertex> vertices,
+            std::span<VertexAttributes> outAttributes);
+
+        /// @brief Attribute stream of vertices quantized by VertexQuantization
+        /// @param vertices Source vertices, normals and tangents are expected unit length
+        /// @param outAttributes Destination, must hold at least vertices.size() elements
+        static void ExtractCompactAttributes(
+            std::span<const MeshVertex> vertices,
+            std::span<CompactVertexAttributes> outAttributes);
+
+        /// @brief Interleave position and attribute streams back into vertices
+        /// @param positions Source positions
+        /// @param attributes Source attributes, as many as positions
+        /// @param outVertices Destination, must hold at least positions.size() elements
+        static void Interleave(
+            std::span<const VertexPosition> positions,
+            std::span<const VertexAttributes> attributes,
+            std::span<MeshVertex> outVertices);
+
+        /// @brief Interleave quantized streams back into quantized vertices
+        static void Interleave(
+            std::span<const VertexPosition> positions,
+            std::span<const CompactVertexAttributes> attributes,
+            std::span<CompactVertex> outVertices);
+    };
+} // namespace VoidArchitect::Resources
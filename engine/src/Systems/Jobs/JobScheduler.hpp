@@ -6,6 +6,7 @@
 #include "JobTypes.hpp"
 #include "SyncPoint.hpp"
 #include "Core/Collections/FixedStorage.hpp"
+#include "Core/Memory/MemoryTracker.hpp"
 
 namespace moodycamel
 {
@@ -367,6 +368,10 @@ namespace VoidArchitect::Jobs
         /// @brief Fixed storage for SyncPoint objects
         FixedStorage<SyncPoint, MAX_SYNCPOINTS> m_SyncPointStorage;
 
+        /// @brief Accounts both fixed storages against the Jobs memory tag
+        VA_NO_UNIQUE_ADDRESS Memory::TrackedMemory<Memory::MemoryTag::Jobs> m_TrackedStorage{
+            sizeof(m_JobStorage) + sizeof(m_SyncPointStorage)};
+
         // === Worker Thread Management ===
 
         /// @brief Worker thread instances
@@ -17,6 +17,7 @@ namespace VoidArchitect::Jobs
     // ==============================================================
 
     JobSystem::JobSystem(uint32_t workerCount)
+        : m_MainThreadId(std::this_thread::get_id())
     {
         VA_ENGINE_INFO("[JobSystem] Initializing with {} workers.", workerCount);
 
@@ -427,6 +428,11 @@ namespace VoidArchitect::Jobs
         return m_Scheduler->HasPendingMainThreadJobs();
     }
 
+    bool JobSystem::IsMainThread() const
+    {
+        return std::this_thread::get_id() == m_MainThreadId;
+    }
+
     // ==============================================================
     // === Stats and Monitoring ===
     // ==============================================================
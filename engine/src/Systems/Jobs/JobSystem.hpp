@@ -5,6 +5,8 @@
 
 #include "JobScheduler.hpp"
 
+#include <thread>
+
 /// @file JobSystem.hpp
 /// @brief JobSystem class following VoidArchitect engine patterns
 
@@ -331,6 +333,13 @@ namespace VoidArchitect::Jobs
         ///     this call and actually processing jobs due to concurrent modifications.
         bool HasPendingMainThreadJobs() const;
 
+        /// @brief Check if the calling thread is the one MAIN_THREAD_ONLY jobs run on
+        /// @return true if called from the thread that created the job system
+        ///
+        /// Lets code that may run on a worker decide between doing main thread work inline
+        /// and submitting it as a MAIN_THREAD_ONLY job.
+        bool IsMainThread() const;
+
         // === Batch operations ===
 
         /// @brief Utility class for managing batches of related jobs
@@ -410,6 +419,9 @@ namespace VoidArchitect::Jobs
 
         /// @brief Internal job scheduler managing all operations
         std::unique_ptr<JobScheduler> m_Scheduler;
+
+        /// @brief Thread that created the job system and processes main thread jobs
+        std::thread::id m_MainThreadId;
     };
 
     // === Global Instance Declaration ===
@@ -0,0 +1,49 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "ParallelFor.hpp"
+
+#include "JobSystem.hpp"
+
+namespace VoidArchitect::Jobs
+{
+    void ParallelFor(
+        const size_t count,
+        const std::function<void(size_t)>& body,
+        const char* name)
+    {
+        if (count < 2 || !g_JobSystem)
+        {
+            for (size_t i = 0; i < count; ++i) body(i);
+            return;
+        }
+
+        const auto done = g_JobSystem->CreateSyncPoint(static_cast<uint32_t>(count), name);
+        if (!done.IsValid())
+        {
+            for (size_t i = 0; i < count; ++i) body(i);
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto job = g_JobSystem->Submit(
+                [&body, i]() -> JobResult
+                {
+                    body(i);
+                    return JobResult::Success();
+                },
+                done,
+                JobPriority::High,
+                name);
+
+            // Refused under backpressure, run it here and count it done ourselves
+            if (!job.IsValid())
+            {
+                body(i);
+                g_JobSystem->Signal(done, JobResult::Success());
+            }
+        }
+        g_JobSystem->WaitFor(done);
+    }
+}
@@ -0,0 +1,22 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <functional>
+
+/// @file ParallelFor.hpp
+/// @brief Blocking fan-out of an index range over the job system
+
+namespace VoidArchitect::Jobs
+{
+    /// @brief Run body(i) for every i in [0, count), one job each when the job system is up
+    /// @param count Number of indices to run
+    /// @param body Function called once per index, from any thread
+    /// @param name Debug name of the jobs and their sync point (should be static string)
+    ///
+    /// Returns once every body has returned. Indices the scheduler refuses, under backpressure
+    /// or without a sync point, run inline on the calling thread instead, so the wait always
+    /// completes. Callers with an unbounded count should still submit it in windows.
+    void ParallelFor(size_t count, const std::function<void(size_t)>& body, const char* name);
+}
@@ -1,6 +1,7 @@
 #include "MaterialSystem.hpp"
 
 #include "Core/Logger.hpp"
+#include "Core/Memory/PoolAllocator.hpp"
 #include "Platform/RHI/IRenderingHardware.hpp"
 #include "ResourceSystem.hpp"
 #include "Resources/Loaders/MaterialLoader.hpp"
@@ -8,9 +9,16 @@
 #include "TextureSystem.hpp"
 #include "Renderer/RenderSystem.hpp"
 #include "Resources/Shader.hpp"
+#include "Jobs/JobSystem.hpp"
 
 namespace VoidArchitect
 {
+    namespace
+    {
+        /// @brief The RHI belongs to the main thread, GPU materials are only created there
+        bool IsOnMainThread() { return !Jobs::g_JobSystem || Jobs::g_JobSystem->IsMainThread(); }
+    }
+
     size_t MaterialTemplate::GetHash() const
     {
         size_t seed = 0;
@@ -45,7 +53,7 @@ namespace VoidArchitect
 
     MaterialSystem::MaterialSystem()
     {
-        m_Materials.reserve(256); // Reserve some space for the material nodes
+        m_NameToHandleMap.reserve(256); // Reserve some space for the material names
         LoadDefaultMaterials();
     }
 
@@ -55,145 +63,239 @@ namespace VoidArchitect
         {
             if (m_Material.state == MaterialLoadingState::Loaded)
             {
-                delete m_Material.materialPtr;
+                Memory::PoolDelete(m_Material.materialPtr);
             }
         }
         m_Materials.clear();
+        m_NameToHandleMap.clear();
     }
 
     MaterialHandle MaterialSystem::GetHandleFor(const std::string& name)
     {
-        // Check if the material is in the cache
-        for (MaterialHandle handle = 0; handle < m_Materials.size(); ++handle)
+        // Fast path: the material is known and needs nothing from us, readers never block each
+        // other.
         {
-            if (const auto& node = m_Materials[handle]; node.config.name == name)
+            std::shared_lock lock(m_Mutex);
+            if (const auto it = m_NameToHandleMap.find(name); it != m_NameToHandleMap.end() &&
+                !NeedsLoad(it->second))
             {
-                if (node.state == MaterialLoadingState::Loaded) return handle;
-
-                // The material exist but is unloaded, we need to load it first.
-                LoadMaterial(handle);
-                return handle;
+                return it->second;
             }
         }
 
-        // This is the first time the system is asked a handle for this material.
-        // We have to load its config file from the disk.
-        const auto handle = LoadTemplate(name);
-        LoadMaterial(handle);
+        std::unique_lock lock(m_Mutex);
 
+        // Check if the material is in the cache, it may be unloaded and we need to load it
+        // first. Otherwise this is the first time the system is asked a handle for this
+        // material and we have to load its config file from the disk.
+        MaterialHandle handle;
+        if (const auto it = m_NameToHandleMap.find(name); it != m_NameToHandleMap.end())
+        {
+            handle = it->second;
+        }
+        else
+        {
+            handle = LoadTemplate(name, lock);
+            if (handle == InvalidMaterialHandle) return handle;
+        }
+
+        // Only the handle is reserved under the lock, the GPU material is created after it
+        const bool load = ReserveLoad(handle);
+        lock.unlock();
+        if (load) LoadMaterial(handle);
         return handle;
     }
 
     Renderer::MaterialClass MaterialSystem::GetClass(const MaterialHandle handle) const
     {
+        std::shared_lock lock(m_Mutex);
         const auto& node = m_Materials[handle];
         if (node.config.renderStateClass.empty() || node.config.renderStateClass != "UI") return
             Renderer::MaterialClass::Standard;
         else return Renderer::MaterialClass::UI;
     }
 
-    MaterialTemplate& MaterialSystem::GetTemplateFor(const MaterialHandle handle)
+    MaterialTemplate MaterialSystem::GetTemplateFor(const MaterialHandle handle) const
     {
+        std::shared_lock lock(m_Mutex);
         return m_Materials[handle].config;
     }
 
     Resources::IMaterial* MaterialSystem::GetPointerFor(const MaterialHandle handle)
     {
-        const auto& node = m_Materials[handle];
-        if (node.state != MaterialLoadingState::Loaded)
-        {
-            // We should load the material
-            LoadMaterial(handle);
-        }
-
-        if (node.state != MaterialLoadingState::Loaded)
+        if (!EnsureLoaded(handle))
         {
             VA_ENGINE_ERROR("[MaterialSystem] Failed to load material.");
             return nullptr;
         }
 
+        std::shared_lock lock(m_Mutex);
         return m_Materials[handle].materialPtr;
     }
 
     void MaterialSystem::Bind(const MaterialHandle handle, const RenderStateHandle stateHandle)
     {
-        // Is this handle valid?
-        if (handle >= m_Materials.size())
+        // Is this handle valid? If the material is unloaded, load it now.
+        if (!EnsureLoaded(handle))
         {
             VA_ENGINE_ERROR("[MaterialSystem] Invalid material handle.");
             return;
         }
 
-        // Is the material loaded?
-        if (m_Materials[handle].state != MaterialLoadingState::Loaded)
-        {
-            // This material is unloaded, load it now.
-            LoadMaterial(handle);
-        }
-
         // Bind the material
         Renderer::g_RenderSystem->GetRHI()->BindMaterial(handle, stateHandle);
     }
 
-    MaterialHandle MaterialSystem::LoadTemplate(const std::string& name)
+    MaterialHandle MaterialSystem::LoadTemplate(
+        const std::string& name,
+        std::unique_lock<std::shared_mutex>& lock)
     {
         // Check if the material is already registered in the system, if so, return its handle.
-        for (MaterialHandle handle = 0; handle < m_Materials.size(); ++handle)
+        if (const auto it = m_NameToHandleMap.find(name); it != m_NameToHandleMap.end())
         {
-            if (const auto& node = m_Materials[handle]; node.config.name == name)
-            {
-                VA_ENGINE_WARN("[MaterialSystem] Material template '{}' already exists.", name);
-                return handle;
-            }
+            VA_ENGINE_WARN("[MaterialSystem] Material template '{}' already exists.", name);
+            return it->second;
         }
 
-        // Load the MaterialTemplate from the disk
+        // Load the MaterialTemplate from the disk, other threads may use the system meanwhile.
+        lock.unlock();
         const auto materialData = g_ResourceSystem->LoadResource<
             Resources::Loaders::MaterialDataDefinition>(ResourceType::Material, name);
+        lock.lock();
+
         if (!materialData)
         {
             VA_ENGINE_ERROR("[MaterialSystem] Failed to load material template '{}'.", name);
             return InvalidMaterialHandle;
         }
 
-        return RegisterTemplate(name, materialData->GetConfig());
+        // If another thread registered the same template meanwhile, its handle is returned.
+        return RegisterTemplateLocked(name, materialData->GetConfig());
     }
 
     MaterialHandle MaterialSystem::RegisterTemplate(
         const std::string& name,
         const MaterialTemplate& config)
+    {
+        std::unique_lock lock(m_Mutex);
+        return RegisterTemplateLocked(name, config);
+    }
+
+    MaterialHandle MaterialSystem::RegisterTemplateLocked(
+        const std::string& name,
+        const MaterialTemplate& config)
     {
         // Check if the material is already registered in the system, if so, return its handle.
-        for (MaterialHandle handle = 0; handle < m_Materials.size(); ++handle)
+        if (const auto it = m_NameToHandleMap.find(name); it != m_NameToHandleMap.end())
         {
-            if (const auto& node = m_Materials[handle]; node.config.name == name)
-            {
-                return handle;
-            }
+            return it->second;
         }
 
         const MaterialData node{InvalidUUID, config, MaterialLoadingState::Unloaded, nullptr};
         const MaterialHandle handle = GetFreeMaterialHandle();
         m_Materials[handle] = node;
+        m_NameToHandleMap[name] = handle;
 
         VA_ENGINE_TRACE("[MaterialSystem] Registered material template '{}'.", name);
         return handle;
     }
 
+    bool MaterialSystem::NeedsLoad(const MaterialHandle handle) const
+    {
+        // Offline tools such as the asset baker have no GPU, they only need the templates.
+        if (!Renderer::g_RenderSystem) return false;
+
+        // A material handed over to the main thread is created by the first main thread caller,
+        // the pending job then finds it loaded.
+        const auto state = m_Materials[handle].state;
+        return state == MaterialLoadingState::Unloaded ||
+            (state == MaterialLoadingState::Loading && IsOnMainThread());
+    }
+
+    bool MaterialSystem::ReserveLoad(const MaterialHandle handle)
+    {
+        if (!NeedsLoad(handle)) return false;
+
+        m_Materials[handle].state = MaterialLoadingState::Loading;
+        return true;
+    }
+
     void MaterialSystem::LoadMaterial(const MaterialHandle handle)
     {
-        auto node = m_Materials[handle];
-        if (node.state == MaterialLoadingState::Loaded) return;
+        if (IsOnMainThread())
+        {
+            CreateReservedMaterial(handle);
+            return;
+        }
 
-        const auto material = CreateMaterial(node.config);
+        const auto job = Jobs::g_JobSystem->SubmitJob(
+            [this, handle]() -> Jobs::JobResult
+            {
+                return CreateReservedMaterial(handle)
+                    ? Jobs::JobResult::Success()
+                    : Jobs::JobResult::Failed("Failed to create GPU material.");
+            },
+            "MaterialGPUCreate",
+            Jobs::JobPriority::Normal,
+            Jobs::MAIN_THREAD_ONLY);
+        if (!job.IsValid())
+        {
+            std::unique_lock lock(m_Mutex);
+            VA_ENGINE_ERROR(
+                "[MaterialSystem] Failed to submit the creation of material '{}'.",
+                m_Materials[handle].config.name);
+            m_Materials[handle].state = MaterialLoadingState::Failed;
+        }
+    }
+
+    bool MaterialSystem::CreateReservedMaterial(const MaterialHandle handle)
+    {
+        MaterialTemplate config;
+        {
+            std::shared_lock lock(m_Mutex);
+            const auto& node = m_Materials[handle];
+            if (node.state != MaterialLoadingState::Loading)
+            {
+                return node.state == MaterialLoadingState::Loaded;
+            }
+            config = node.config;
+        }
+
+        // Textures and descriptors are created without holding the lock, lookups go on
+        const auto material = CreateMaterial(config);
+
+        std::unique_lock lock(m_Mutex);
+        auto& node = m_Materials[handle];
         if (!material)
         {
-            VA_ENGINE_ERROR("[MaterialSystem] Failed to load material '{}'.", node.config.name);
+            VA_ENGINE_ERROR("[MaterialSystem] Failed to load material '{}'.", config.name);
+            node.state = MaterialLoadingState::Failed;
+            return false;
+        }
+
+        VA_ENGINE_TRACE("[MaterialSystem] Loaded material '{}'.", config.name);
+        node.materialPtr = material;
+        node.state = MaterialLoadingState::Loaded;
+        return true;
+    }
+
+    bool MaterialSystem::EnsureLoaded(const MaterialHandle handle)
+    {
+        {
+            std::shared_lock lock(m_Mutex);
+            if (handle >= m_Materials.size()) return false;
+            if (m_Materials[handle].state == MaterialLoadingState::Loaded) return true;
+        }
+
+        bool load;
+        {
+            std::unique_lock lock(m_Mutex);
+            load = ReserveLoad(handle);
         }
+        if (load) LoadMaterial(handle);
 
-        VA_ENGINE_TRACE("[MaterialSystem] Loaded material '{}'.", node.config.name);
-        m_Materials[handle].materialPtr = material;
-        m_Materials[handle].state = MaterialLoadingState::Loaded;
+        std::shared_lock lock(m_Mutex);
+        return m_Materials[handle].state == MaterialLoadingState::Loaded;
     }
 
     Resources::IMaterial* MaterialSystem::CreateMaterial(const MaterialTemplate& matTemplate)
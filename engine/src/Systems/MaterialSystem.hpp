@@ -1,5 +1,8 @@
 #pragma once
 
+#include <deque>
+#include <shared_mutex>
+
 #include "RenderStateSystem.hpp"
 #include "Resources/Material.hpp"
 #include "Resources/RenderState.hpp"
@@ -29,6 +32,13 @@ namespace VoidArchitect
         size_t GetBindingsHash() const;
     };
 
+    /// @brief Registry of material templates and their loaded GPU materials
+    ///
+    /// Every public method is thread-safe. Lookups of loaded materials only take a shared
+    /// lock, while registering a material or reserving its load takes it exclusively.
+    /// Templates read from disk and GPU materials are created without holding the lock, the
+    /// latter always on the main thread: other threads hand them over as MAIN_THREAD_ONLY
+    /// jobs and get a handle that is still loading.
     class MaterialSystem
     {
     public:
@@ -40,18 +50,45 @@ namespace VoidArchitect
         Renderer::MaterialClass GetClass(MaterialHandle handle) const;
         MaterialHandle RegisterTemplate(const std::string& name, const MaterialTemplate& config);
 
-        MaterialTemplate& GetTemplateFor(MaterialHandle handle);
+        /// @note Returned by copy, RegisterTemplate() may overwrite the template of a handle
+        /// once the lock is released.
+        MaterialTemplate GetTemplateFor(MaterialHandle handle) const;
         Resources::IMaterial* GetPointerFor(MaterialHandle handle);;
 
         // Interaction with Material
         void Bind(MaterialHandle handle, RenderStateHandle stateHandle);
 
     private:
-        MaterialHandle LoadTemplate(const std::string& name);
+        // NOTE Unless stated otherwise, private methods expect m_Mutex to be held exclusively.
+
+        /// @brief Read a template from disk and register it, `lock` is released during I/O
+        MaterialHandle LoadTemplate(
+            const std::string& name,
+            std::unique_lock<std::shared_mutex>& lock);
+        MaterialHandle RegisterTemplateLocked(
+            const std::string& name,
+            const MaterialTemplate& config);
+
+        /// @brief Whether the calling thread has to load the material, shared lock is enough
+        bool NeedsLoad(MaterialHandle handle) const;
+
+        /// @brief Mark the material Loading if the calling thread has to load it
+        /// @return True if the caller must call LoadMaterial() once m_Mutex is released
+        bool ReserveLoad(MaterialHandle handle);
 
+        /// @brief Create a reserved material, inline on the main thread or as a
+        ///        MAIN_THREAD_ONLY job from other threads. Expects m_Mutex to be released.
         void LoadMaterial(MaterialHandle handle);
         //void UnloadMaterial(MaterialHandle handle);
 
+        /// @brief Create and publish the GPU material, main thread only, takes m_Mutex itself
+        /// @return False if the RHI could not create it, the material is then Failed
+        bool CreateReservedMaterial(MaterialHandle handle);
+
+        /// @brief Load the material if needed, takes m_Mutex itself
+        /// @return False if the handle is invalid or the material is not loaded yet
+        bool EnsureLoaded(MaterialHandle handle);
+
         void LoadDefaultMaterials();
 
         MaterialHandle GetFreeMaterialHandle();
@@ -61,8 +98,9 @@ namespace VoidArchitect
         enum class MaterialLoadingState
         {
             Unloaded,
-            Loading,
-            Loaded
+            Loading, ///< Reserved, waiting for its creation on the main thread
+            Loaded,
+            Failed
         };
 
         struct MaterialData
@@ -74,10 +112,15 @@ namespace VoidArchitect
             Resources::IMaterial* materialPtr = nullptr;
         };
 
+        mutable std::shared_mutex m_Mutex;
+
         std::queue<MaterialHandle> m_FreeMaterialHandles;
         MaterialHandle m_NextFreeMaterialHandle = 0;
 
-        VAArray<MaterialData> m_Materials;
+        // std::deque keeps elements in place when growing, so a registration never moves the
+        // materials other threads read under the shared lock.
+        std::deque<MaterialData> m_Materials;
+        VAHashMap<std::string, MaterialHandle> m_NameToHandleMap;
     };
 
     inline std::unique_ptr<MaterialSystem> g_MaterialSystem;
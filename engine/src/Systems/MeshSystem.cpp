@@ -9,6 +9,7 @@
 #include "Core/Math/Constants.hpp"
 #include "Platform/RHI/IRenderingHardware.hpp"
 #include "Renderer/RenderSystem.hpp"
+#include "Resources/MeshNormals.hpp"
 #include "Resources/Loaders/RawMeshLoader.hpp"
 #include "Jobs/JobSystem.hpp"
 
@@ -66,9 +67,9 @@ namespace VoidArchitect
         const VAArray<Resources::SubMeshDescriptor>& submeshes)
     {
         // Check cache first
-        if (const auto it = m_NameToHandleMap.find(name); it != m_NameToHandleMap.end())
+        if (const auto cached = m_NameToHandleMap.Find(name))
         {
-            const auto handle = it->second;
+            const auto handle = *cached;
 
             // Verify handle is still valid (could have been freed)
             if (auto* node = m_MeshStorage.Get(handle); node)
@@ -86,20 +87,24 @@ namespace VoidArchitect
                         }
                         else
                         {
-                            // Async loading failed - mark as failed
-                            node->state = Resources::MeshLoadingState::Failed;
-                            node->loadingComplete = Jobs::InvalidSyncPointHandle;
-                            VA_ENGINE_ERROR("[MeshSystem] Failed to load mesh '{}'.", name);
+                            // Async loading failed - mark as failed, only one caller reports it
+                            auto expected = Resources::MeshLoadingState::Loading;
+                            if (node->state.compare_exchange_strong(
+                                expected,
+                                Resources::MeshLoadingState::Failed))
+                            {
+                                VA_ENGINE_ERROR("[MeshSystem] Failed to load mesh '{}'.", name);
+                            }
                         }
                     }
                 }
 
                 return handle;
             }
-            else
+
+            // Handle is invalid - remove from cache, unless another thread replaced it already
+            if (m_NameToHandleMap.EraseIfEqual(name, handle))
             {
-                // Handle is invalid - remove from cache
-                m_NameToHandleMap.erase(it);
                 VA_ENGINE_WARN("[MeshSystem] Mesh handle for '{}' is invalid.", name);
             }
         }
@@ -107,20 +112,41 @@ namespace VoidArchitect
         // Handle procedural mesh creation (vertices / indices provided)
         if (!vertices.empty() && !indices.empty())
         {
-            return CreateProceduralMesh(name, vertices, indices, submeshes);
+            // Only the node is reserved under the shard lock, the GPU upload happens after it
+            // so that lookups hashing to the same shard do not wait for it.
+            const auto [handle, inserted] = m_NameToHandleMap.GetOrInsert(
+                name,
+                [&]() -> std::optional<Resources::MeshHandle>
+                {
+                    const auto created = CreateMeshNode(name);
+                    if (!created.IsValid()) return std::nullopt;
+                    return created;
+                });
+            if (inserted)
+            {
+                CreateProceduralMesh(*handle, vertices, indices, submeshes);
+            }
+            return handle.value_or(Resources::InvalidMeshHandle);
         }
 
         // Handle file-based mesh loading (no vertices / indices provided)
         if (vertices.empty() && indices.empty())
         {
-            // First time request - create new mesh node and start async loading
-            auto handle = CreateMeshNode(name);
-            if (handle.IsValid())
+            // First time request - create new mesh node, only the inserting caller starts the
+            // async loading.
+            const auto [handle, inserted] = m_NameToHandleMap.GetOrInsert(
+                name,
+                [&]() -> std::optional<Resources::MeshHandle>
+                {
+                    const auto created = CreateMeshNode(name);
+                    if (!created.IsValid()) return std::nullopt;
+                    return created;
+                });
+            if (inserted)
             {
-                m_NameToHandleMap[name] = handle;
-                StartAsyncMeshLoading(handle);
+                StartAsyncMeshLoading(*handle);
             }
-            return handle;
+            return handle.value_or(Resources::InvalidMeshHandle);
         }
 
         VA_ENGINE_ERROR("[MeshSystem] Failed to create mesh handle for '{}'.", name);
@@ -143,14 +169,15 @@ namespace VoidArchitect
             return nullptr;
         }
 
-        // Return actual mesh if loaded
-        if (node->meshPtr)
+        // Return actual mesh if loaded, the acquire pairs with the release that published it
+        const auto state = node->state.load(std::memory_order_acquire);
+        if (state == Resources::MeshLoadingState::Loaded)
         {
             return node->meshPtr.get();
         }
 
         // Handle different status appropriately
-        switch (node->state)
+        switch (state)
         {
             case Resources::MeshLoadingState::Failed:
                 // Failed -> Return error mesh
@@ -214,6 +241,105 @@ namespace VoidArchitect
         return g_MaterialSystem->GetHandleForDefaultMaterial();
     }
 
+    Math::Bounds MeshSystem::GetBoundsFor(const Resources::MeshHandle handle) const
+    {
+        const auto* mesh = GetPointerFor(handle);
+        return mesh ? mesh->GetMeshData()->GetBounds() : Math::Bounds{};
+    }
+
+    Math::Bounds MeshSystem::GetSubMeshBoundsFor(
+        const Resources::MeshHandle handle,
+        const uint32_t submeshIndex) const
+    {
+        const auto* mesh = GetPointerFor(handle);
+        if (mesh && submeshIndex < mesh->GetSubMeshCount())
+        {
+            return mesh->GetSubMesh(submeshIndex).bounds;
+        }
+
+        return {};
+    }
+
+    Renderer::VertexFormat MeshSystem::GetVertexFormatFor(const Resources::MeshHandle handle) const
+    {
+        const auto* mesh = GetPointerFor(handle);
+        return mesh ? mesh->GetVertexFormat() : Renderer::VertexFormat::PositionNormalUVTangent;
+    }
+
+    std::span<const Resources::Meshlet> MeshSystem::GetMeshletsFor(
+        const Resources::MeshHandle handle) const
+    {
+        const auto* mesh = GetPointerFor(handle);
+        if (!mesh) return {};
+        return mesh->GetMeshData()->GetMeshlets();
+    }
+
+    std::span<const Resources::MeshLod> MeshSystem::GetLodsFor(
+        const Resources::MeshHandle handle) const
+    {
+        const auto* mesh = GetPointerFor(handle);
+        if (!mesh) return {};
+        return mesh->GetMeshData()->GetLods();
+    }
+
+    uint32_t MeshSystem::SelectLodFor(
+        const Resources::MeshHandle handle,
+        const uint32_t submeshIndex,
+        const Resources::LodSelectionView& view,
+        const uint32_t currentLod) const
+    {
+        const auto* mesh = GetPointerFor(handle);
+        if (!mesh || submeshIndex >= mesh->GetSubMeshCount()) return 0;
+
+        // Levels are dropped when the mesh data changes, the descriptors may lag behind
+        const auto& submesh = mesh->GetSubMesh(submeshIndex);
+        const auto lods = std::span(mesh->GetMeshData()->GetLods());
+        if (submesh.lodOffset + submesh.lodCount > lods.size()) return 0;
+
+        return Resources::SelectLod(
+            lods.subspan(submesh.lodOffset, submesh.lodCount),
+            submesh.bounds,
+            view,
+            m_LodSettings,
+            currentLod);
+    }
+
+    VAArray<uint32_t> MeshSystem::GetTriangleCountsPerLod(const Resources::MeshHandle handle) const
+    {
+        const auto* mesh = GetPointerFor(handle);
+        if (!mesh) return {};
+
+        const auto& lods = mesh->GetMeshData()->GetLods();
+        const auto levelCount = [&](const Resources::SubMeshDescriptor& submesh) -> uint32_t
+        {
+            return submesh.lodOffset + submesh.lodCount <= lods.size() ? submesh.lodCount : 0;
+        };
+
+        uint32_t maxLodCount = 0;
+        for (uint32_t i = 0; i < mesh->GetSubMeshCount(); ++i)
+        {
+            maxLodCount = std::max(maxLodCount, levelCount(mesh->GetSubMesh(i)));
+        }
+
+        VAArray<uint32_t> counts(maxLodCount + 1, 0);
+        for (uint32_t i = 0; i < mesh->GetSubMeshCount(); ++i)
+        {
+            const auto& submesh = mesh->GetSubMesh(i);
+            const auto lodCount = levelCount(submesh);
+
+            auto triangles = submesh.indexCount / 3;
+            for (uint32_t level = 0; level < counts.size(); ++level)
+            {
+                if (level > 0 && level <= lodCount)
+                {
+                    triangles = lods[submesh.lodOffset + level - 1].GetTriangleCount();
+                }
+                counts[level] += triangles;
+            }
+        }
+        return counts;
+    }
+
     void MeshSystem::AddSubMeshTo(
         const Resources::MeshHandle handle,
         const std::string& submeshName,
@@ -222,7 +348,8 @@ namespace VoidArchitect
         const VAArray<uint32_t>& indices) const
     {
         const auto* node = m_MeshStorage.Get(handle);
-        if (!node || !node->meshPtr)
+        if (!node || node->state.load(std::memory_order_acquire) !=
+            Resources::MeshLoadingState::Loaded)
         {
             VA_ENGINE_ERROR("[MeshSystem] Invalid mesh handle or mesh not loaded.");
             return;
@@ -232,13 +359,13 @@ namespace VoidArchitect
         auto meshData = mesh->GetMeshData();
 
         const uint32_t vertexOffset = static_cast<uint32_t>(meshData->vertices.size());
-        const uint32_t indexOffset = static_cast<uint32_t>(meshData->indices.size());
+        const uint32_t indexOffset = static_cast<uint32_t>(meshData->GetLodIndexOffset());
 
         // Add geometry to mesh data
         meshData->AddSubmesh(vertices, indices);
 
         // Create a new submesh descriptor
-        const Resources::SubMeshDescriptor submesh{
+        Resources::SubMeshDescriptor submesh{
             submeshName,
             material,
             indexOffset,
@@ -246,6 +373,7 @@ namespace VoidArchitect
             vertexOffset,
             static_cast<uint32_t>(vertices.size())
         };
+        submesh.bounds = Resources::MeshData::ComputeBounds(vertices);
 
         // Add submesh to mesh (this will trigger GPU buffer update)
         mesh->m_Submeshes.push_back(submesh);
@@ -263,7 +391,8 @@ namespace VoidArchitect
         const uint32_t submeshIndex) const
     {
         const auto* node = m_MeshStorage.Get(handle);
-        if (!node || !node->meshPtr)
+        if (!node || node->state.load(std::memory_order_acquire) !=
+            Resources::MeshLoadingState::Loaded)
         {
             VA_ENGINE_ERROR("[MeshSystem] Invalid mesh handle or mesh not loaded.");
             return;
@@ -438,18 +567,38 @@ namespace VoidArchitect
                 // Create GPU mesh using existing infrastructure
                 auto meshData = std::make_shared<Resources::MeshData>(
                     meshDefinition->GetVertices(),
-                    meshDefinition->GetIndices());
+                    meshDefinition->GetIndices(),
+                    meshDefinition->GetBounds());
+                meshData->SetMeshlets(meshDefinition->GetMeshlets());
+                meshData->SetLods(meshDefinition->GetLods());
 
-                auto* meshPtr = CreateMesh(meshName, meshData, meshDefinition->GetSubmeshes());
+                // Baked streams read in place skip the conversion on upload
+                if (const auto& packed = meshDefinition->GetPackedGeometry(); packed.owner)
+                {
+                    meshData->SetPackedGeometry(packed);
+                }
+
+                // Vertices that already went through quantization stay compact on the GPU
+                const auto vertexFormat = meshDefinition->HasCompactVertices()
+                    ? Renderer::VertexFormat::PositionNormalUVTangentCompact
+                    : Renderer::VertexFormat::PositionNormalUVTangent;
+
+                auto* meshPtr = CreateMesh(
+                    meshName,
+                    meshData,
+                    meshDefinition->GetSubmeshes(),
+                    vertexFormat);
                 if (!meshPtr)
                 {
-                    node->state = Resources::MeshLoadingState::Failed;
+                    node->state.store(
+                        Resources::MeshLoadingState::Failed,
+                        std::memory_order_release);
                     return Jobs::JobResult::Failed("Failed to create GPU mesh.");
                 }
 
-                // Update node with loaded mesh
+                // Update node with loaded mesh, published to readers by the state store
                 node->meshPtr.reset(meshPtr);
-                node->state = Resources::MeshLoadingState::Loaded;
+                node->state.store(Resources::MeshLoadingState::Loaded, std::memory_order_release);
 
                 VA_ENGINE_TRACE("[MeshSystem] Completed mesh GPU upload for '{}'.", meshName);
                 return Jobs::JobResult::Success();
@@ -465,12 +614,14 @@ namespace VoidArchitect
     Resources::IMesh* MeshSystem::CreateMesh(
         const std::string& name,
         std::shared_ptr<Resources::MeshData> data,
-        const VAArray<Resources::SubMeshDescriptor>& submeshes)
+        const VAArray<Resources::SubMeshDescriptor>& submeshes,
+        const Renderer::VertexFormat vertexFormat)
     {
         Resources::IMesh* mesh = Renderer::g_RenderSystem->GetRHI()->CreateMesh(
             name,
             data,
-            submeshes);
+            submeshes,
+            vertexFormat);
         if (!mesh)
         {
             VA_ENGINE_WARN("[MeshSystem] Failed to create mesh '{}'.", name);
@@ -498,12 +649,16 @@ namespace VoidArchitect
     // Procedural Mesh Creation Helper
     //=========================================================================
 
-    Resources::MeshHandle MeshSystem::CreateProceduralMesh(
-        const std::string& name,
+    void MeshSystem::CreateProceduralMesh(
+        const Resources::MeshHandle handle,
         const VAArray<Resources::MeshVertex>& vertices,
         const VAArray<uint32_t>& indices,
         const VAArray<Resources::SubMeshDescriptor>& submeshes)
     {
+        auto* node = m_MeshStorage.Get(handle);
+        if (!node) return;
+        const auto& name = node->name;
+
         // If no submeshes are provided, create a single submesh mesh
         VAArray<Resources::SubMeshDescriptor> finalSubmeshes = submeshes;
         if (finalSubmeshes.empty())
@@ -520,9 +675,10 @@ namespace VoidArchitect
             finalSubmeshes.push_back(singleSubmesh);
         }
 
-        // Validate all submeshes
+        // Validate all submeshes. Other callers may already hold the handle, the node is marked
+        // Failed rather than released so that they fall back to the error mesh.
         auto meshData = std::make_shared<Resources::MeshData>(vertices, indices);
-        for (const auto& submesh : finalSubmeshes)
+        for (auto& submesh : finalSubmeshes)
         {
             if (!submesh.IsValid(*meshData))
             {
@@ -530,44 +686,83 @@ namespace VoidArchitect
                     "[MeshSystem] Submesh '{}‘ for mesh '{}' is invalid.",
                     submesh.name,
                     name);
-                return Resources::InvalidMeshHandle;
+                node->state.store(Resources::MeshLoadingState::Failed, std::memory_order_release);
+                return;
+            }
+
+            if (!submesh.bounds.IsValid())
+            {
+                submesh.bounds = Resources::MeshData::ComputeBounds(
+                    std::span(meshData->vertices).subspan(
+                        submesh.vertexOffset,
+                        submesh.vertexCount));
             }
         }
 
-        // Create the mesh
-        auto* meshPtr = CreateMesh(name, meshData, finalSubmeshes);
-        if (!meshPtr)
+        auto uploadJob = CreateProceduralUploadJob(
+            handle,
+            std::move(meshData),
+            std::move(finalSubmeshes));
+
+        // The RHI, its geometry pool and staging ring belong to the main thread
+        if (!Jobs::g_JobSystem || Jobs::g_JobSystem->IsMainThread())
         {
-            VA_ENGINE_ERROR("[MeshSystem] Failed to create mesh '{}'.", name);
-            return Resources::InvalidMeshHandle;
+            uploadJob();
+            return;
         }
 
-        // Allocate handle and store mesh
-        const auto handle = m_MeshStorage.Allocate();
-        if (!handle.IsValid())
+        const auto completionSP = Jobs::g_JobSystem->CreateSyncPoint(1, "MeshLoaded");
+        node->loadingComplete = completionSP;
+        node->state.store(Resources::MeshLoadingState::Loading, std::memory_order_release);
+
+        const auto job = Jobs::g_JobSystem->Submit(
+            std::move(uploadJob),
+            completionSP,
+            Jobs::JobPriority::Normal,
+            "MeshGPUUpload",
+            Jobs::MAIN_THREAD_ONLY);
+        if (!job.IsValid())
         {
-            VA_ENGINE_ERROR("[MeshSystem] Failed to allocate mesh slot for '{}'.", name);
-            delete meshPtr;
-            return Resources::InvalidMeshHandle;
+            VA_ENGINE_ERROR("[MeshSystem] Failed to submit GPU upload for mesh '{}'.", name);
+            node->state.store(Resources::MeshLoadingState::Failed, std::memory_order_release);
         }
+    }
 
-        auto* node = m_MeshStorage.Get(handle);
-        node->name = name;
-        node->state = Resources::MeshLoadingState::Loaded;
-        node->meshPtr.reset(meshPtr);
-        node->loadingComplete = Jobs::InvalidSyncPointHandle;
-
-        // Add to cache
-        m_NameToHandleMap[name] = handle;
+    Jobs::JobFunction MeshSystem::CreateProceduralUploadJob(
+        const Resources::MeshHandle handle,
+        std::shared_ptr<Resources::MeshData> data,
+        VAArray<Resources::SubMeshDescriptor> submeshes)
+    {
+        return [this, handle, data = std::move(data), submeshes = std::move(submeshes)
+            ]() -> Jobs::JobResult
+        {
+            auto* node = m_MeshStorage.Get(handle);
+            if (!node)
+            {
+                return Jobs::JobResult::Failed("Failed to retrieve mesh node.");
+            }
 
-        VA_ENGINE_TRACE(
-            "[MeshSystem] Created procedural mesh '{}' with handle ({}, {})) and {} submeshes.",
-            name,
-            handle.GetIndex(),
-            handle.GetGeneration(),
-            finalSubmeshes.size());
+            auto* meshPtr = CreateMesh(node->name, data, submeshes);
+            if (!meshPtr)
+            {
+                VA_ENGINE_ERROR("[MeshSystem] Failed to create mesh '{}'.", node->name);
+                node->state.store(Resources::MeshLoadingState::Failed, std::memory_order_release);
+                return Jobs::JobResult::Failed("Failed to create GPU mesh.");
+            }
 
-        return handle;
+            // Update node with created mesh, published to readers by the state store
+            node->meshPtr.reset(meshPtr);
+            node->state.store(Resources::MeshLoadingState::Loaded, std::memory_order_release);
+
+            VA_ENGINE_TRACE(
+                "[MeshSystem] Created procedural mesh '{}' with handle ({}, {})) and {} "
+                "submeshes.",
+                node->name,
+                handle.GetIndex(),
+                handle.GetGeneration(),
+                submeshes.size());
+            return Jobs::JobResult::Success();
+        };
     }
 
     //=========================================================================
@@ -915,61 +1110,13 @@ namespace VoidArchitect
         VAArray<Resources::MeshVertex>& vertices,
         const VAArray<uint32_t>& indices)
     {
-        for (uint32_t i = 0; i < indices.size(); i += 3)
-        {
-            const uint32_t index0 = indices[i + 0];
-            const uint32_t index1 = indices[i + 1];
-            const uint32_t index2 = indices[i + 2];
-
-            const Math::Vec3 edge0 = vertices[index1].Position - vertices[index0].Position;
-            const Math::Vec3 edge1 = vertices[index2].Position - vertices[index0].Position;
-
-            auto normal = Math::Vec3::Cross(edge0, edge1);
-            normal.Normalize();
-
-            // NOTE: This just generate a face normal, smoothing could be done in a separate pass.
-            vertices[index0].Normal = normal;
-            vertices[index1].Normal = normal;
-            vertices[index2].Normal = normal;
-        }
+        Resources::MeshNormals::GenerateNormals(vertices, indices);
     }
 
     void MeshSystem::GenerateTangents(
         VAArray<Resources::MeshVertex>& vertices,
         const VAArray<uint32_t>& indices)
     {
-        for (uint32_t i = 0; i < indices.size(); i += 3)
-        {
-            const uint32_t index0 = indices[i + 0];
-            const uint32_t index1 = indices[i + 1];
-            const uint32_t index2 = indices[i + 2];
-
-            const Math::Vec3 edge0 = vertices[index1].Position - vertices[index0].Position;
-            const Math::Vec3 edge1 = vertices[index2].Position - vertices[index0].Position;
-
-            const auto deltaU0 = vertices[index1].UV0.X() - vertices[index0].UV0.X();
-            const auto deltaU1 = vertices[index2].UV0.X() - vertices[index0].UV0.X();
-            const auto deltaV0 = vertices[index1].UV0.Y() - vertices[index0].UV0.Y();
-            const auto deltaV1 = vertices[index2].UV0.Y() - vertices[index0].UV0.Y();
-
-            const auto dividend = (deltaU0 * deltaV1) - (deltaU1 * deltaV0);
-            const auto fc = 1.0f / dividend;
-
-            auto tangent = (edge0 * deltaV1) - (edge1 * deltaV0);
-            tangent *= fc;
-            tangent.Normalize();
-
-            // Inverse tangent is normal are flipped, used in shader.
-            const auto sx = deltaU0;
-            const auto sy = deltaU1;
-            const auto tx = deltaV0;
-            const auto ty = deltaV1;
-            const auto handedness = ((tx * sy - ty * sx) < 0.0f) ? 1.0f : -1.0f;
-            const auto t4 = Math::Vec4(tangent, handedness);
-
-            vertices[index0].Tangent = t4;
-            vertices[index1].Tangent = t4;
-            vertices[index2].Tangent = t4;
-        }
+        Resources::MeshNormals::GenerateTangents(vertices, indices);
     }
 } // namespace VoidArchitect
@@ -2,7 +2,9 @@
 // Created by Michael Desmedt on 01/06/2025.
 //
 #pragma once
+#include "Core/Collections/ConcurrentHashMap.hpp"
 #include "Core/Collections/FixedStorage.hpp"
+#include "Core/Memory/PoolAllocator.hpp"
 #include "Jobs/JobTypes.hpp"
 #include "Resources/Mesh.hpp"
 #include "Resources/MeshData.hpp"
@@ -28,19 +30,20 @@ namespace VoidArchitect
     struct MeshNode
     {
         std::string name; ///< Mesh identifier/filename
-        Resources::MeshLoadingState state = Resources::MeshLoadingState::Unloaded;
-        ///< Current loading state
-        std::unique_ptr<Resources::IMesh> meshPtr = nullptr; ///< Actual mesh resource (when loaded)
+        std::atomic<Resources::MeshLoadingState> state = Resources::MeshLoadingState::Unloaded;
+        ///< Current loading state, read by any thread resolving the mesh name
+        Memory::PoolPtr<Resources::IMesh> meshPtr = nullptr;
+        ///< Actual mesh resource (when loaded), allocated from the engine pool
         Jobs::SyncPointHandle loadingComplete = Jobs::InvalidSyncPointHandle;
-        ///< Sync point for async operations
+        ///< Sync point for async operations, written before state becomes Loading
 
         MeshNode() = default;
-        MeshNode(MeshNode&& other) noexcept = default;
-        MeshNode& operator=(MeshNode&& other) noexcept = default;
 
-        // Disable copy operations
+        // Nodes live in place in FixedStorage, disable copy and move operations
         MeshNode(const MeshNode&) = delete;
         MeshNode& operator=(const MeshNode&) = delete;
+        MeshNode(MeshNode&&) = delete;
+        MeshNode& operator=(MeshNode&&) = delete;
     };
 
     /// @brief Thread-safe storage for completed mesh data from background job
@@ -91,11 +94,16 @@ namespace VoidArchitect
         /// @param vertices Optional vertex data for procedural meshes
         /// @param indices Optional index data for procedural meshes
         /// @param submeshes Optional submesh descriptors for procedural meshes
-        /// @return Handle to mesh resource (may be loading initially for file-based meshes)
+        /// @return Handle to mesh resource (may be loading initially for file-based meshes,
+        ///         and for procedural meshes requested off the main thread)
         ///
         /// This is the primary entry point for mesh requests. If the mesh
         /// is not loaded, it will be requested asynchronously and a handle returned
         /// immediately.
+        ///
+        /// Safe to call from job workers: concurrent requests for the same name resolve to
+        /// the same handle and only the first one starts the loading pipeline. GPU uploads
+        /// always run on the main thread.
         Resources::MeshHandle GetHandleFor(
             const std::string& name,
             const VAArray<Resources::MeshVertex>& vertices = {},
@@ -163,6 +171,76 @@ namespace VoidArchitect
             Resources::MeshHandle handle,
             uint32_t submeshIndex) const;
 
+        /// @brief Get the bounds of a whole mesh
+        /// @param handle Handle to mesh resource
+        /// @return Mesh bounds, the error mesh bounds for failed loads, or empty bounds while
+        ///         the mesh is loading
+        [[nodiscard]] Math::Bounds GetBoundsFor(Resources::MeshHandle handle) const;
+
+        /// @brief Get the bounds of a submesh
+        /// @param handle Handle to mesh resource
+        /// @param submeshIndex Index of the submesh
+        /// @return Submesh bounds, or empty bounds if the submesh is not available
+        [[nodiscard]] Math::Bounds GetSubMeshBoundsFor(
+            Resources::MeshHandle handle,
+            uint32_t submeshIndex) const;
+
+        /// @brief Get the layout of a mesh vertex buffer, to pick a matching render state
+        /// @param handle Handle to mesh resource
+        /// @return Vertex format of the mesh (or of the error mesh for failed loads)
+        ///
+        /// Meshes baked with compact vertices are uploaded as
+        /// VertexFormat::PositionNormalUVTangentCompact, everything else as
+        /// VertexFormat::PositionNormalUVTangent.
+        [[nodiscard]] Renderer::VertexFormat GetVertexFormatFor(
+            Resources::MeshHandle handle) const;
+
+        /// @brief Get the meshlets of a mesh, for cluster culling
+        /// @param handle Handle to mesh resource
+        /// @return Meshlets of every submesh, empty if the mesh has none or is not loaded
+        ///
+        /// The view stays valid until the mesh data changes, which happens on the main thread.
+        /// SubMeshDescriptor::meshletOffset and meshletCount index into it.
+        [[nodiscard]] std::span<const Resources::Meshlet> GetMeshletsFor(
+            Resources::MeshHandle handle) const;
+
+        /// @brief Get the simplified levels of a mesh
+        /// @param handle Handle to mesh resource
+        /// @return Levels of every submesh, empty if the mesh has none or is not loaded
+        ///
+        /// SubMeshDescriptor::lodOffset and lodCount index into it, with the same lifetime as
+        /// GetMeshletsFor().
+        [[nodiscard]] std::span<const Resources::MeshLod> GetLodsFor(
+            Resources::MeshHandle handle) const;
+
+        /// @brief Pick the level of detail to draw a submesh with
+        /// @param handle Handle to mesh resource
+        /// @param submeshIndex Index of the submesh
+        /// @param view Camera in the object space of the mesh
+        /// @param currentLod Level drawn last frame, for hysteresis
+        /// @return 0 for the submesh index range, i for GetLodsFor()[lodOffset + i - 1]
+        ///
+        /// Uses the settings of SetLodSettings(), see Resources::SelectLod().
+        [[nodiscard]] uint32_t SelectLodFor(
+            Resources::MeshHandle handle,
+            uint32_t submeshIndex,
+            const Resources::LodSelectionView& view,
+            uint32_t currentLod) const;
+
+        /// @brief Count the triangles of every level of a mesh
+        /// @param handle Handle to mesh resource
+        /// @return Triangles of LOD 0, LOD 1... summed over the submeshes. A submesh with
+        ///         fewer levels counts its coarsest level for the missing ones.
+        [[nodiscard]] VAArray<uint32_t> GetTriangleCountsPerLod(
+            Resources::MeshHandle handle) const;
+
+        /// @brief Set the screen-space tolerances used by SelectLodFor()
+        void SetLodSettings(const Resources::LodSettings& settings) { m_LodSettings = settings; }
+        [[nodiscard]] const Resources::LodSettings& GetLodSettings() const
+        {
+            return m_LodSettings;
+        }
+
         //==========================================================================================
         // Basic shape procedural generators
         //==========================================================================================
@@ -219,15 +297,15 @@ namespace VoidArchitect
         // Math helpers specialized for meshes
         //==========================================================================================
 
-        /// @brief Generate normals for mesh vertices
+        /// @brief Generate smooth normals for mesh vertices, see Resources::MeshNormals
         /// @param vertices Array of vertices to update
         /// @param indices Index array for face calculations
         static void GenerateNormals(
             VAArray<Resources::MeshVertex>& vertices,
             const VAArray<uint32_t>& indices);
 
-        /// @brief Generate tangents for mesh vertices
-        /// @param vertices Array of vertices to update
+        /// @brief Generate tangents for mesh vertices, see Resources::MeshNormals
+        /// @param vertices Array of vertices to update, normals must already be set
         /// @param indices Index array for face calculations
         static void GenerateTangents(
             VAArray<Resources::MeshVertex>& vertices,
@@ -263,15 +341,28 @@ namespace VoidArchitect
             const std::string& meshName,
             Resources::MeshHandle handle);
 
+        /// @brief Create a job function for procedural mesh upload
+        /// @param handle Handle to mesh node
+        /// @param data Validated mesh data
+        /// @param submeshes Validated submesh descriptors
+        /// @return Job function that performs GPU upload (main thread only)
+        Jobs::JobFunction CreateProceduralUploadJob(
+            Resources::MeshHandle handle,
+            std::shared_ptr<Resources::MeshData> data,
+            VAArray<Resources::SubMeshDescriptor> submeshes);
+
         /// @brief Create a mesh resource from data and submeshes
         /// @param name Mesh name
         /// @param data Shared pointer to mesh data
         /// @param submeshes Array of submesh descriptors
+        /// @param vertexFormat Layout of the GPU vertex buffer
         /// @return Pointer to created mesh resource, or nullptr on failure
         static Resources::IMesh* CreateMesh(
             const std::string& name,
             std::shared_ptr<Resources::MeshData> data,
-            const VAArray<Resources::SubMeshDescriptor>& submeshes);
+            const VAArray<Resources::SubMeshDescriptor>& submeshes,
+            Renderer::VertexFormat vertexFormat =
+                Renderer::VertexFormat::PositionNormalUVTangent);
 
         /// @brief Generate default error mesh for failed loads
         ///
@@ -280,16 +371,19 @@ namespace VoidArchitect
         void CreateErrorMesh();
 
         /// @brief Create procedural mesh from provided geometry data
-        /// @param name Mesh name / identifier
+        /// @param handle Node created by CreateMeshNode(), named after the mesh
         /// @param vertices Vertex data array
         /// @param indices Index data array
         /// @param submeshes Submesh descriptor array
-        /// @return Handle to created procedural mesh
         ///
-        /// Helper method for handling procedural mesh creation with immediate
-        /// GPU upload and proper handle allocation.
-        Resources::MeshHandle CreateProceduralMesh(
-            const std::string& name,
+        /// Helper method for handling procedural mesh creation. GetHandleFor() reserves the
+        /// node under the insert-once guard of the name cache, then calls this once the cache
+        /// shard is unlocked. Submeshes are validated on the calling thread. The GPU upload
+        /// runs inline on the main thread, from any other thread it is submitted as a
+        /// MAIN_THREAD_ONLY job and the node stays Loading until it ran. The node is marked
+        /// Failed, never released, when either step fails.
+        void CreateProceduralMesh(
+            Resources::MeshHandle handle,
             const VAArray<Resources::MeshVertex>& vertices,
             const VAArray<uint32_t>& indices,
             const VAArray<Resources::SubMeshDescriptor>& submeshes);
@@ -311,14 +405,17 @@ namespace VoidArchitect
         /// @brief Shared storage for async loading communication between background jobs and main thread
         MeshLoadingStorage m_LoadingStorage;
 
-        /// @brief Cache mapping mesh names to their handles
-        VAHashMap<std::string, Resources::MeshHandle> m_NameToHandleMap;
+        /// @brief Cache mapping mesh names to their handles, shared by every thread
+        ConcurrentHashMap<std::string, Resources::MeshHandle> m_NameToHandleMap;
 
         /// @brief Handle to error mesh for failed loads
         ///
         /// Simple cube mesh with error material used as fallback when
         /// mesh loading fails. Created during system initialization.
         Resources::MeshHandle m_ErrorMeshHandle;
+
+        /// @brief Screen-space tolerances of LOD selection
+        Resources::LodSettings m_LodSettings;
     };
 
     inline std::unique_ptr<MeshSystem> g_MeshSystem;
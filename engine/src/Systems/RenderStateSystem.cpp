@@ -5,6 +5,7 @@
 
 #include "RenderPassSystem.hpp"
 #include "Core/Logger.hpp"
+#include "Core/Memory/PoolAllocator.hpp"
 #include "Platform/RHI/IRenderingHardware.hpp"
 #include "Renderer/RenderGraph.hpp"
 #include "ShaderSystem.hpp"
@@ -18,7 +19,7 @@ namespace VoidArchitect
     {
         for (uint32_t i = 0; i < m_RenderStates.size(); ++i)
         {
-            delete m_RenderStates[i].renderStatePtr;
+            Memory::PoolDelete(m_RenderStates[i].renderStatePtr);
         }
         m_RenderStates.clear();
         m_ConfigMap.clear();
@@ -115,7 +116,11 @@ namespace VoidArchitect
         // Add required data to the config
         if (config.vertexAttributes.empty())
         {
-            switch (config.vertexFormat)
+            // Depth-only passes only fetch the position stream, whatever the mesh format
+            const auto vertexFormat = Renderer::IsDepthOnlyPass(config.passType)
+                ? Renderer::VertexFormat::Position
+                : config.vertexFormat;
+            switch (vertexFormat)
             {
                 case Renderer::VertexFormat::Position:
                 {
@@ -197,6 +202,31 @@ namespace VoidArchitect
                         });
                 }
                 break;
+                case Renderer::VertexFormat::PositionNormalUVTangentCompact:
+                {
+                    // Resources::CompactVertex: octahedral normal and tangent, half UVs
+                    config.vertexAttributes.push_back(
+                        Renderer::VertexAttribute{
+                            Renderer::AttributeType::Vec3,
+                            Renderer::AttributeFormat::Float32
+                        });
+                    config.vertexAttributes.push_back(
+                        Renderer::VertexAttribute{
+                            Renderer::AttributeType::Vec2,
+                            Renderer::AttributeFormat::SNorm16
+                        });
+                    config.vertexAttributes.push_back(
+                        Renderer::VertexAttribute{
+                            Renderer::AttributeType::Vec2,
+                            Renderer::AttributeFormat::SNorm16
+                        });
+                    config.vertexAttributes.push_back(
+                        Renderer::VertexAttribute{
+                            Renderer::AttributeType::Vec2,
+                            Renderer::AttributeFormat::Float16
+                        });
+                }
+                break;
                 case Renderer::VertexFormat::PositionUV:
                 {
                     config.vertexAttributes.push_back(
@@ -284,6 +314,17 @@ namespace VoidArchitect
         RegisterPermutation(renderStateConfig);
         VA_ENGINE_INFO("[RenderStateSystem] Default render state template registered.");
 
+        // Same state for meshes uploaded with compact vertices, only the vertex stage differs
+        auto compactRenderStateConfig = renderStateConfig;
+        compactRenderStateConfig.name = "DefaultCompact";
+        compactRenderStateConfig.vertexFormat =
+            Renderer::VertexFormat::PositionNormalUVTangentCompact;
+        compactRenderStateConfig.shaders[0] = g_ShaderSystem->GetHandleFor(
+            "BuiltinObjectCompact.vert");
+
+        RegisterPermutation(compactRenderStateConfig);
+        VA_ENGINE_INFO("[RenderStateSystem] Default compact render state template registered.");
+
         // UI RenderState
         auto uiRenderStateConfig = RenderStateConfig{};
         uiRenderStateConfig.name = "UI";
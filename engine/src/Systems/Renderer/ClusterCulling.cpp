@@ -0,0 +1,147 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#include "ClusterCulling.hpp"
+
+#include "Systems/Jobs/ParallelFor.hpp"
+#include "Systems/MeshSystem.hpp"
+
+#include <cmath>
+
+namespace VoidArchitect::Renderer
+{
+    namespace
+    {
+        void AppendRange(VAArray<IndexRange>& ranges, const uint32_t offset, const uint32_t count)
+        {
+            if (!ranges.empty() && ranges.back().indexOffset + ranges.back().indexCount == offset)
+            {
+                ranges.back().indexCount += count;
+                return;
+            }
+            ranges.push_back({offset, count});
+        }
+    } // namespace
+
+    ClusterCullingView ClusterCullingView::FromCamera(
+        const Math::Mat4& viewProjection,
+        const Math::Vec3& cameraPosition,
+        const Math::Mat4& model)
+    {
+        const auto localCamera = Math::Mat4::Inverse(model) * Math::Vec4(cameraPosition, 1.0f);
+
+        ClusterCullingView view;
+        view.frustum = Math::Frustum::FromMatrix(viewProjection * model);
+        view.cameraPosition = Math::Vec3(localCamera.X(), localCamera.Y(), localCamera.Z());
+        return view;
+    }
+
+    ClusterCullingStats& ClusterCullingStats::operator+=(const ClusterCullingStats& other)
+    {
+        tested += other.tested;
+        frustumCulled += other.frustumCulled;
+        backfaceCulled += other.backfaceCulled;
+        return *this;
+    }
+
+    bool ClusterCulling::IsBackfacing(
+        const Resources::Meshlet& meshlet,
+        const Math::Vec3& cameraPosition)
+    {
+        const auto toCenter = meshlet.center - cameraPosition;
+        const float distance = std::sqrt(Math::Vec3::Dot(toCenter, toCenter));
+        return Math::Vec3::Dot(toCenter, meshlet.coneAxis) >=
+            meshlet.coneCutoff * distance + meshlet.radius;
+    }
+
+    ClusterCullingStats ClusterCulling::CullSubMesh(
+        const ClusterCullingView& view,
+        const Resources::SubMeshDescriptor& submesh,
+        const std::span<const Resources::Meshlet> meshlets,
+        VAArray<IndexRange>& outRanges)
+    {
+        ClusterCullingStats stats;
+        stats.tested = submesh.meshletCount;
+
+        // The whole submesh first, most of an architectural scene is off-screen
+        if (submesh.bounds.IsValid() &&
+            !view.frustum.IntersectsSphere(submesh.bounds.center, submesh.bounds.radius))
+        {
+            stats.frustumCulled = submesh.meshletCount;
+            return stats;
+        }
+
+        if (submesh.meshletCount == 0 ||
+            submesh.meshletOffset + submesh.meshletCount > meshlets.size())
+        {
+            stats.tested = 0;
+            AppendRange(outRanges, submesh.indexOffset, submesh.indexCount);
+            return stats;
+        }
+
+        for (const auto& meshlet : meshlets.subspan(submesh.meshletOffset, submesh.meshletCount))
+        {
+            if (!view.frustum.IntersectsSphere(meshlet.center, meshlet.radius))
+            {
+                ++stats.frustumCulled;
+                continue;
+            }
+            if (IsBackfacing(meshlet, view.cameraPosition))
+            {
+                ++stats.backfaceCulled;
+                continue;
+            }
+
+            AppendRange(outRanges, meshlet.indexOffset, meshlet.GetIndexCount());
+        }
+
+        return stats;
+    }
+
+    ClusterCullingStats ClusterCulling::CullMesh(
+        const ClusterCullingView& view,
+        const Resources::MeshHandle mesh,
+        VAArray<VAArray<IndexRange>>& outRanges)
+    {
+        const auto submeshCount = g_MeshSystem->GetSubMeshCountFor(mesh);
+        const auto meshlets = g_MeshSystem->GetMeshletsFor(mesh);
+
+        outRanges.resize(submeshCount);
+        for (auto& ranges : outRanges) ranges.clear();
+
+        // Group consecutive submeshes into batches of roughly the same meshlet count
+        VAArray<std::pair<uint32_t, uint32_t>> batches;
+        uint32_t batchStart = 0;
+        uint32_t batchMeshlets = 0;
+        for (uint32_t i = 0; i < submeshCount; ++i)
+        {
+            batchMeshlets += std::max(g_MeshSystem->GetSubMesh(mesh, i).meshletCount, 1u);
+            if (batchMeshlets >= CULLING_MESHLETS_PER_JOB || i + 1 == submeshCount)
+            {
+                batches.emplace_back(batchStart, i + 1);
+                batchStart = i + 1;
+                batchMeshlets = 0;
+            }
+        }
+
+        VAArray<ClusterCullingStats> batchStats(batches.size());
+        const auto cullBatch = [&, mesh](const size_t batch)
+        {
+            for (uint32_t i = batches[batch].first; i < batches[batch].second; ++i)
+            {
+                batchStats[batch] += CullSubMesh(
+                    view,
+                    g_MeshSystem->GetSubMesh(mesh, i),
+                    meshlets,
+                    outRanges[i]);
+            }
+        };
+
+        // Every batch writes to its own submesh ranges and counters, no locking needed
+        Jobs::ParallelFor(batches.size(), cullBatch, "CullClusters");
+
+        ClusterCullingStats stats;
+        for (const auto& batch : batchStats) stats += batch;
+        return stats;
+    }
+} // namespace VoidArchitect::Renderer
@@ -0,0 +1,101 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+#include "Core/Math/Frustum.hpp"
+#include "Core/Math/Mat4.hpp"
+#include "Resources/Meshlet.hpp"
+#include "Resources/SubMesh.hpp"
+
+namespace VoidArchitect::Renderer
+{
+    /// @brief Contiguous range of the mesh index buffer, drawn with the submesh vertex offset
+    struct IndexRange
+    {
+        uint32_t indexOffset;
+        uint32_t indexCount;
+    };
+
+    /// @brief Camera as seen from the object space of one mesh instance
+    ///
+    /// Meshlet culling data is in object space, so the camera is brought to the mesh rather
+    /// than every meshlet to the world. The backface cone test assumes the model matrix
+    /// does not scale non-uniformly.
+    struct ClusterCullingView
+    {
+        Math::Frustum frustum; ///< Object-space frustum
+        Math::Vec3 cameraPosition; ///< Object-space camera position
+
+        /// @brief Build the view of a mesh instance
+        /// @param viewProjection Camera projection * view matrix
+        /// @param cameraPosition World-space camera position
+        /// @param model Model matrix of the mesh instance
+        static ClusterCullingView FromCamera(
+            const Math::Mat4& viewProjection,
+            const Math::Vec3& cameraPosition,
+            const Math::Mat4& model);
+    };
+
+    /// @brief Counters of a culling pass, in meshlets
+    struct ClusterCullingStats
+    {
+        uint32_t tested = 0; ///< Meshlets considered, including those of culled submeshes
+        uint32_t frustumCulled = 0; ///< Rejected by the frustum, alone or with their submesh
+        uint32_t backfaceCulled = 0; ///< Rejected by their normal cone
+
+        ClusterCullingStats& operator+=(const ClusterCullingStats& other);
+    };
+
+    /// @brief CPU cluster culling: rejects off-screen and backfacing meshlets per camera
+    ///
+    /// Each submesh is first tested as a whole against the frustum, then every meshlet is
+    /// tested against the frustum and against its normal cone. Visible meshlets are turned
+    /// into index ranges, merging neighbours so that a fully visible submesh stays a single
+    /// draw. Submeshes without meshlets are drawn whole when they intersect the frustum.
+    ///
+    /// Usage example:
+    /// @code
+    /// const auto view = ClusterCullingView::FromCamera(viewProjection, cameraPosition, model);
+    /// VAArray<VAArray<IndexRange>> ranges;
+    /// ClusterCulling::CullMesh(view, mesh, ranges);
+    /// for (const auto& range : ranges[submeshIndex])
+    ///     rhi.DrawIndexed(range.indexCount, range.indexOffset, submesh.vertexOffset);
+    /// @endcode
+    class ClusterCulling
+    {
+    public:
+        /// @brief Cull one submesh
+        /// @param view Camera in the object space of the mesh
+        /// @param submesh Submesh to cull
+        /// @param meshlets Meshlets of the whole mesh, indexed by submesh.meshletOffset
+        /// @param outRanges Receives the visible index ranges, in index order
+        /// @return Counters for this submesh
+        static ClusterCullingStats CullSubMesh(
+            const ClusterCullingView& view,
+            const Resources::SubMeshDescriptor& submesh,
+            std::span<const Resources::Meshlet> meshlets,
+            VAArray<IndexRange>& outRanges);
+
+        /// @brief Cull every submesh of a loaded mesh, spread over the job system
+        /// @param view Camera in the object space of the mesh
+        /// @param mesh Mesh to cull
+        /// @param outRanges Resized to the submesh count, receives the ranges of each submesh
+        /// @return Counters for the whole mesh
+        ///
+        /// Submeshes are grouped into jobs of about CULLING_MESHLETS_PER_JOB meshlets and the
+        /// call waits for all of them, so it must be made from the main thread. Small meshes
+        /// are culled inline.
+        static ClusterCullingStats CullMesh(
+            const ClusterCullingView& view,
+            Resources::MeshHandle mesh,
+            VAArray<VAArray<IndexRange>>& outRanges);
+
+        /// @brief Is a meshlet entirely backfacing from a camera position
+        static bool IsBackfacing(
+            const Resources::Meshlet& meshlet,
+            const Math::Vec3& cameraPosition);
+
+        /// @brief Meshlets culled by a single job
+        static constexpr uint32_t CULLING_MESHLETS_PER_JOB = 512;
+    };
+} // namespace VoidArchitect::Renderer
@@ -82,15 +82,9 @@ namespace VoidArchitect::Renderer
 
         // NOTE: Currently we just use the same renderState for submeshes, we will need
         //      to filter submeshes at some point, e.g. transparent vs opaque submeshes.
-        const RenderStateCacheKey key = {
-            MaterialClass::Standard,
-            RenderPassType::ForwardOpaque,
-            VertexFormat::PositionNormalUVTangent,
-            context.currentPassSignature
-        };
-        const auto stateHandle = g_RenderStateSystem->GetHandleFor(key, context.currentPassHandle);
-
-        context.rhi.BindRenderState(stateHandle);
+        //      The state only changes with the vertex format of the mesh.
+        auto boundFormat = VertexFormat::Custom;
+        auto stateHandle = InvalidRenderStateHandle;
 
         // Traverse the array of meshes/transform and draw them.
         for (uint32_t j = 0; j < 2; j++)
@@ -98,6 +92,19 @@ namespace VoidArchitect::Renderer
             const auto& mesh = meshes[j];
             const auto& transformMatrix = transforms[j];
 
+            if (const auto format = g_MeshSystem->GetVertexFormatFor(mesh); format != boundFormat)
+            {
+                const RenderStateCacheKey key = {
+                    MaterialClass::Standard,
+                    RenderPassType::ForwardOpaque,
+                    format,
+                    context.currentPassSignature
+                };
+                stateHandle = g_RenderStateSystem->GetHandleFor(key, context.currentPassHandle);
+                context.rhi.BindRenderState(stateHandle);
+                boundFormat = format;
+            }
+
             // Only proceed if mesh binding was successfull
             if (!context.rhi.BindMesh(mesh))
             {
@@ -112,9 +119,24 @@ namespace VoidArchitect::Renderer
                 sizeof(Math::Mat4),
                 &transformMatrix);
 
+            // Reject off-screen and backfacing clusters before building the draws
+            const auto view = ClusterCullingView::FromCamera(
+                context.frameData.viewProjection,
+                context.frameData.cameraPosition,
+                transformMatrix);
+            ClusterCulling::CullMesh(view, mesh, m_VisibleRanges);
+            const Resources::LodSelectionView lodView{
+                view.cameraPosition,
+                context.frameData.projectionScale
+            };
+            const auto lods = g_MeshSystem->GetLodsFor(mesh);
+
             const auto submeshesCount = g_MeshSystem->GetSubMeshCountFor(mesh);
             for (uint32_t i = 0; i < submeshesCount; i++)
             {
+                const auto& ranges = m_VisibleRanges[i];
+                if (ranges.empty()) continue;
+
                 const auto& submesh = g_MeshSystem->GetSubMesh(mesh, i);
                 const auto materialToUse = (submesh.material != InvalidMaterialHandle)
                     ? submesh.material
@@ -122,11 +144,25 @@ namespace VoidArchitect::Renderer
 
                 context.rhi.BindMaterial(materialToUse, stateHandle);
 
+                // Simplified levels are drawn whole, only LOD 0 has per-cluster ranges
+                const auto lodKey = static_cast<uint64_t>(mesh.GetPacked()) << 32 | i;
+                auto& currentLod = m_CurrentLods[lodKey];
+                currentLod = g_MeshSystem->SelectLodFor(mesh, i, lodView, currentLod);
+                if (currentLod > 0)
+                {
+                    const auto& lod = lods[submesh.lodOffset + currentLod - 1];
+                    context.rhi.DrawIndexed(lod.indexCount, lod.indexOffset, submesh.vertexOffset);
+                    continue;
+                }
+
                 //TODO: Draw each submeshes sorted by material handle
-                context.rhi.DrawIndexed(
-                    submesh.indexCount,
-                    submesh.indexOffset,
-                    submesh.vertexOffset);
+                for (const auto& range : ranges)
+                {
+                    context.rhi.DrawIndexed(
+                        range.indexCount,
+                        range.indexOffset,
+                        submesh.vertexOffset);
+                }
             }
         }
     }
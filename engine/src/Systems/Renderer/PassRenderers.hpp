@@ -4,6 +4,7 @@
 #pragma once
 #include <any>
 
+#include "ClusterCulling.hpp"
 #include "RendererTypes.hpp"
 #include "Systems/RenderPassSystem.hpp"
 
@@ -72,6 +73,11 @@ namespace VoidArchitect
 
         private:
             static const std::string m_Name;
+
+            VAArray<VAArray<IndexRange>> m_VisibleRanges; ///< Reused across meshes and frames
+
+            /// @brief LOD drawn last frame for every (mesh, submesh), for hysteresis
+            VAHashMap<uint64_t, uint32_t> m_CurrentLods;
         };
 
         class ForwardTransparentPassRenderer final : public IPassRenderer
@@ -129,6 +129,16 @@ namespace VoidArchitect
             ubo.DebugMode = static_cast<uint32_t>(m_DebugMode); // No debug mode by default
 
             m_RHI->UpdateGlobalState(ubo);
+
+            // The Y scale of the projection is 1 / tan(fov / 2), possibly flipped
+            const auto projectionScaleY = std::abs(
+                (m_MainCamera.GetProjection() * Math::Vec4(0.f, 1.f, 0.f, 0.f)).Y());
+            const FrameData frameData{
+                frameTime,
+                m_MainCamera.GetProjection() * m_MainCamera.GetView(),
+                m_MainCamera.GetPosition(),
+                projectionScaleY * static_cast<float>(m_Height) * 0.5f
+            };
             for (const auto& step : executionPlan)
             {
                 // Ask the RenderPassSystem the handle for the config of this pass.
@@ -137,7 +147,7 @@ namespace VoidArchitect
                     step.passPosition);
 
                 const auto& passSignature = g_RenderPassSystem->GetSignatureFor(passHandle);
-                RenderContext context{*m_RHI.get(), {frameTime}, passHandle, passSignature};
+                RenderContext context{*m_RHI.get(), frameData, passHandle, passSignature};
                 // Get the handles of RenderTargets
                 m_RHI->BeginRenderPass(passHandle, step.renderTargets);
                 step.passRenderer->Execute(context);
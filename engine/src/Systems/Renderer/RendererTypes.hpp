@@ -3,6 +3,8 @@
 //
 #pragma once
 #include "Core/Core.hpp"
+#include "Core/Math/Mat4.hpp"
+#include "Core/Math/Vec3.hpp"
 #include "Core/Math/Vec4.hpp"
 #include "Resources/RenderTarget.hpp"
 
@@ -54,6 +56,12 @@ namespace VoidArchitect::Renderer
         Unknown
     };
 
+    /// @brief Passes that only write depth, their states read the position stream alone
+    constexpr bool IsDepthOnlyPass(const RenderPassType type)
+    {
+        return type == RenderPassType::Shadow || type == RenderPassType::DepthPrepass;
+    }
+
     enum class PassPosition
     {
         First, // UNDEFINED -> COLOR_ATTACHMENT
@@ -64,18 +72,21 @@ namespace VoidArchitect::Renderer
 
     enum class VertexFormat
     {
-        Position,
+        Position, ///< Position stream alone, what depth-only states read from every mesh
         PositionColor,
         PositionUV,
         PositionNormal,
         PositionNormalUV,
         PositionNormalUVTangent,
+        PositionNormalUVTangentCompact, ///< Resources::CompactVertex, 24 bytes
         Custom
     };
 
     enum class AttributeFormat
     {
         Float32,
+        Float16,
+        SNorm16, ///< Signed 16-bit integer read as a float in [-1, 1]
     };
 
     enum class AttributeType
@@ -163,6 +174,9 @@ namespace VoidArchitect::Renderer
     struct FrameData
     {
         float deltaTime;
+        Math::Mat4 viewProjection; ///< Main camera projection * view
+        Math::Vec3 cameraPosition; ///< Main camera world-space position
+        float projectionScale; ///< Pixels covered by one unit at distance 1, for LOD selection
     };
 
     struct RenderPassConfig
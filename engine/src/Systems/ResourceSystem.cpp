@@ -4,6 +4,7 @@
 #include "ResourceSystem.hpp"
 
 #include "Core/Logger.hpp"
+#include "Platform/FileSystem/VirtualFileSystem.hpp"
 #include "Resources/Loaders/ImageLoader.hpp"
 #include "Resources/Loaders/Loader.hpp"
 #include "Resources/Loaders/MaterialLoader.hpp"
@@ -21,6 +22,9 @@ namespace VoidArchitect
         const std::string SHADER_PATH = BASE_ASSET_DIR + "shaders/";
         const std::string MESH_PATH = BASE_ASSET_DIR + "meshes/";
 
+        // Shipped builds read every asset from assets.vapack, development ones the loose files
+        Platform::VirtualFileSystem::MountIfPresent(BASE_ASSET_DIR);
+
         // Initialize default loaders
         RegisterLoader(ResourceType::Image, new Resources::Loaders::ImageLoader(IMAGE_PATH));
         RegisterLoader(
@@ -30,6 +34,8 @@ namespace VoidArchitect
         RegisterLoader(ResourceType::Mesh, new Resources::Loaders::VAMLoader(MESH_PATH));
     }
 
+    ResourceSystem::~ResourceSystem() { Platform::VirtualFileSystem::UnmountAll(); }
+
     void ResourceSystem::RegisterLoader(ResourceType type, Resources::Loaders::ILoader* loader)
     {
         // Check if a loader already exists for this type
@@ -19,7 +19,7 @@ namespace VoidArchitect
     {
     public:
         ResourceSystem();
-        ~ResourceSystem() = default;
+        ~ResourceSystem();
 
         void RegisterLoader(ResourceType type, Resources::Loaders::ILoader* loader);
         void UnregisterLoader(ResourceType type);
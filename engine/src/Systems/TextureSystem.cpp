@@ -20,15 +20,15 @@ namespace VoidArchitect
 
     TextureSystem::~TextureSystem()
     {
-        m_NameToHandleMap.clear();
+        m_NameToHandleMap.Clear();
     }
 
     Resources::TextureHandle TextureSystem::GetHandleFor(const std::string& name)
     {
         // Check cache first for last lookup
-        if (const auto it = m_NameToHandleMap.find(name); it != m_NameToHandleMap.end())
+        if (const auto cached = m_NameToHandleMap.Find(name))
         {
-            const auto handle = it->second;
+            const auto handle = *cached;
 
             // Verify handle is still valid (could have been freed)
             if (auto* node = m_TextureStorage.Get(handle))
@@ -46,31 +46,46 @@ namespace VoidArchitect
                         }
                         else
                         {
-                            // Async loading failed - mark as failed (GetPointerFro will handle fallback)
-                            node->state = TextureLoadState::Failed;
-                            VA_ENGINE_ERROR("[TextureSystem] Failed to load texture '{}'.", name);
+                            // Async loading failed - mark as failed (GetPointerFro will handle
+                            // fallback), only one caller reports it
+                            auto expected = TextureLoadState::Loading;
+                            if (node->state.compare_exchange_strong(
+                                expected,
+                                TextureLoadState::Failed))
+                            {
+                                VA_ENGINE_ERROR(
+                                    "[TextureSystem] Failed to load texture '{}'.",
+                                    name);
+                            }
                         }
                     }
                 }
 
                 return handle;
             }
-            else
+
+            // Handle is invalid - remove from cache, unless another thread replaced it already
+            if (m_NameToHandleMap.EraseIfEqual(name, handle))
             {
-                // Handle is invalid - remove from cache
-                m_NameToHandleMap.erase(it);
                 VA_ENGINE_WARN("[TextureSystem] Texture handle for '{}' is invalid.", name);
             }
         }
 
-        // First time request - create new texture node and start async loading
-        auto handle = CreateTextureNode(name);
-        if (handle.IsValid())
+        // First time request - create new texture node, only the inserting caller starts the
+        // async loading.
+        const auto [handle, inserted] = m_NameToHandleMap.GetOrInsert(
+            name,
+            [&]() -> std::optional<Resources::TextureHandle>
+            {
+                const auto created = CreateTextureNode(name);
+                if (!created.IsValid()) return std::nullopt;
+                return created;
+            });
+        if (inserted)
         {
-            m_NameToHandleMap[name] = handle;
-            StartAsyncTextureLoading(handle);
+            StartAsyncTextureLoading(*handle);
         }
-        return handle;
+        return handle.value_or(Resources::InvalidTextureHandle);
     }
 
     Resources::ITexture* TextureSystem::GetPointerFor(const Resources::TextureHandle handle) const
@@ -138,7 +153,7 @@ namespace VoidArchitect
             if (!handle.IsValid())
             {
                 VA_ENGINE_ERROR("[TextureSystem] Failed to allocate texture slot for '{}'.", name);
-                delete texture;
+                Memory::PoolDelete(texture);
                 return Resources::InvalidTextureHandle;
             }
 
@@ -148,7 +163,7 @@ namespace VoidArchitect
             node->texturePtr.reset(texture);
             node->loadingComplete = Jobs::InvalidSyncPointHandle;
 
-            m_NameToHandleMap[name] = handle;
+            m_NameToHandleMap.InsertOrAssign(name, handle);
 
             VA_ENGINE_TRACE(
                 "[TextureSystem] Created texture '{}' with handle ({}, {}).",
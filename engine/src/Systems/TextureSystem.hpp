@@ -3,7 +3,9 @@
 //
 #pragma once
 
+#include "Core/Collections/ConcurrentHashMap.hpp"
 #include "Core/Collections/FixedStorage.hpp"
+#include "Core/Memory/PoolAllocator.hpp"
 #include "Jobs/SyncPoint.hpp"
 #include "Resources/Texture.hpp"
 
@@ -85,19 +87,20 @@ namespace VoidArchitect
     struct TextureNode
     {
         std::string name; ///< Texture identifier/filename
-        TextureLoadState state = TextureLoadState::Unloaded; ///< Current loading state
-        std::unique_ptr<Resources::ITexture> texturePtr = nullptr;
-        ///< Actual texture resource (when loaded)
+        std::atomic<TextureLoadState> state = TextureLoadState::Unloaded;
+        ///< Current loading state, read by any thread resolving the texture name
+        Memory::PoolPtr<Resources::ITexture> texturePtr = nullptr;
+        ///< Actual texture resource (when loaded), allocated from the engine pool
         Jobs::SyncPointHandle loadingComplete = Jobs::InvalidSyncPointHandle;
-        ///< Sync point for async operations
+        ///< Sync point for async operations, written before state becomes Loading
 
         TextureNode() = default;
-        TextureNode(TextureNode&& other) noexcept = default;
-        TextureNode& operator=(TextureNode&& other) noexcept = default;
 
-        // Disable copy operations
+        // Nodes live in place in FixedStorage, disable copy and move operations
         TextureNode(const TextureNode&) = delete;
         TextureNode& operator=(const TextureNode&) = delete;
+        TextureNode(TextureNode&&) = delete;
+        TextureNode& operator=(TextureNode&&) = delete;
     };
 
     class TextureSystem
@@ -114,6 +117,9 @@ namespace VoidArchitect
         /// is not loaded, it will be requested asynchronously and a handle returned
         /// immediately. The handle will initially point to a placeholder until
         /// loading completes, at which point the generation will increment;
+        ///
+        /// Safe to call from job workers: concurrent requests for the same name resolve to
+        /// the same handle and only the first one starts the loading pipeline.
         Resources::TextureHandle GetHandleFor(const std::string& name);
 
         /// @brief Get texture pointer from a handle
@@ -214,7 +220,8 @@ namespace VoidArchitect
         ///
         /// Avoids linear search when requesting the same texture multiple times.
         /// Updated when new textures are allocated or when textures are freed.
-        VAHashMap<std::string, Resources::TextureHandle> m_NameToHandleMap;
+        /// Sharded so that any thread can resolve names concurrently.
+        ConcurrentHashMap<std::string, Resources::TextureHandle> m_NameToHandleMap;
 
         // === Default Texture Handles ===
 
@@ -0,0 +1,105 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// File read throughput, blocking reads one file after the other against batches queued to the
+// AsyncFileIO backends, with the queue depth they reach
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Platform/FileSystem/AsyncFileIO.hpp>
+
+#include <filesystem>
+#include <thread>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Platform;
+using namespace VoidArchitect::Testing;
+
+/// @brief Report the MiB/s of reading a set of files, blocking or through AsyncFileIO
+bool BenchmarkAsyncFileIO()
+{
+    constexpr size_t FILE_COUNT = 32;
+    constexpr size_t FILE_SIZE = 2 * 1024 * 1024;
+
+    const auto root = std::filesystem::temp_directory_path() / "va_benchmark_io";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+
+    VAArray<std::string> paths;
+    VAArray<char> content(FILE_SIZE, 'v');
+    for (size_t i = 0; i < FILE_COUNT; ++i)
+    {
+        paths.push_back((root / ("file_" + std::to_string(i) + ".bin")).string());
+        std::ofstream(paths.back(), std::ios::binary).write(content.data(), content.size());
+    }
+
+    const auto totalMiB = static_cast<double>(FILE_COUNT * FILE_SIZE) / (1024.0 * 1024.0);
+    std::cout << std::endl << "  File reads, " << FILE_COUNT << " files of " <<
+        FILE_SIZE / 1024 << " KiB, from the page cache:" << std::endl;
+
+    // The first run warms the page cache, every variant then reads from memory
+    bool valid = true;
+    const auto blockingMs = MeasureBestMs(
+        5,
+        [&]()
+        {
+            for (const auto& path : paths)
+            {
+                const auto file = MappedFile::Open(path, MappedFile::Mode::Read);
+                valid = valid && file && file->GetSize() == FILE_SIZE;
+            }
+        });
+
+    // Without a job system, each batch is waited for through its callbacks
+    std::atomic<bool> readsValid{true};
+    const auto measure = [&](const AsyncFileIOConfig& config, uint32_t& maxQueueDepth)
+    {
+        AsyncFileIO io(config);
+        const auto ms = MeasureBestMs(
+            5,
+            [&]()
+            {
+                std::atomic<size_t> remaining{FILE_COUNT};
+                VAArray<AsyncFileIO::ReadRequest> requests;
+                for (const auto& path : paths)
+                {
+                    requests.push_back({
+                        path,
+                        [&](const auto& file)
+                        {
+                            if (!file || file->GetSize() != FILE_SIZE) readsValid = false;
+                            remaining.fetch_sub(1, std::memory_order_release);
+                        }
+                    });
+                }
+                io.ReadBatch(requests);
+                while (remaining.load(std::memory_order_acquire) > 0) std::this_thread::yield();
+            });
+        maxQueueDepth = io.GetStats().maxQueueDepth;
+        return std::pair(ms, io.GetBackendType());
+    };
+
+    AsyncFileIOConfig ringConfig;
+    uint32_t ringDepth = 0;
+    const auto [ringMs, ringBackend] = measure(ringConfig, ringDepth);
+
+    AsyncFileIOConfig poolConfig;
+    poolConfig.useIoUring = false;
+    uint32_t poolDepth = 0;
+    const auto [poolMs, poolBackend] = measure(poolConfig, poolDepth);
+    std::filesystem::remove_all(root);
+
+    PrintBenchmarkResult("Blocking, one file at a time", totalMiB * 1000.0 / blockingMs, "MiB/s");
+    if (ringBackend == AsyncFileIO::BackendType::IoUring)
+    {
+        PrintBenchmarkResult("io_uring batch", totalMiB * 1000.0 / ringMs, "MiB/s");
+        PrintBenchmarkResult("io_uring max queue depth", ringDepth, "segments");
+    }
+    PrintBenchmarkResult("Thread pool batch", totalMiB * 1000.0 / poolMs, "MiB/s");
+    PrintBenchmarkResult("Thread pool max queue depth", poolDepth, "segments");
+    return valid && readsValid && poolBackend == AsyncFileIO::BackendType::ThreadPool;
+}
+
+// Register all AsyncFileIO benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkAsyncFileIO, BenchmarkAsyncFileIO);
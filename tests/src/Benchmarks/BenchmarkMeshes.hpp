@@ -0,0 +1,112 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include "../Resources/TestMeshes.hpp"
+#include <Resources/MeshData.hpp>
+#include <Resources/SubMesh.hpp>
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <cstdlib>
+#include <filesystem>
+
+namespace VoidArchitect::Testing
+{
+    /// @brief Sponza locations tried in order, VA_SPONZA_PATH overrides them
+    inline constexpr const char* SPONZA_PATHS[] = {
+        "../../assets/models/sponza/sponza.gltf",
+        "../../assets/models/sponza/sponza.obj",
+        "../../../../../assets/models/sponza/sponza.gltf",
+        "../../../../../assets/models/sponza/sponza.obj",
+    };
+
+    struct BenchmarkMesh
+    {
+        std::string name;
+        VAArray<Resources::MeshVertex> vertices;
+        VAArray<uint32_t> indices;
+        VAArray<Resources::SubMeshDescriptor> submeshes;
+    };
+
+    /// @brief Path of the Sponza source file, empty if it is not installed
+    inline std::string FindSponzaPath()
+    {
+        if (const char* overridePath = std::getenv("VA_SPONZA_PATH")) return overridePath;
+
+        for (const auto* candidate : SPONZA_PATHS)
+        {
+            if (std::filesystem::exists(candidate)) return candidate;
+        }
+        return "";
+    }
+
+    /// @brief Import Sponza the way RawMeshLoader does, one submesh per assimp mesh
+    inline bool LoadSponza(BenchmarkMesh& mesh)
+    {
+        const auto path = FindSponzaPath();
+        if (path.empty()) return false;
+
+        Assimp::Importer importer;
+        const auto* scene = importer.ReadFile(
+            path,
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+        if (!scene) return false;
+
+        for (uint32_t m = 0; m < scene->mNumMeshes; ++m)
+        {
+            const auto* source = scene->mMeshes[m];
+            if (source->mNumVertices == 0 || source->mNumFaces == 0) continue;
+
+            const auto vertexOffset = static_cast<uint32_t>(mesh.vertices.size());
+            const auto indexOffset = static_cast<uint32_t>(mesh.indices.size());
+            for (uint32_t v = 0; v < source->mNumVertices; ++v)
+            {
+                Resources::MeshVertex vertex{};
+                const auto& position = source->mVertices[v];
+                vertex.Position = Math::Vec3(position.x, position.y, position.z);
+                mesh.vertices.push_back(vertex);
+            }
+
+            uint32_t indexCount = 0;
+            for (uint32_t f = 0; f < source->mNumFaces; ++f)
+            {
+                const auto& face = source->mFaces[f];
+                if (face.mNumIndices != 3) continue;
+                mesh.indices.insert(mesh.indices.end(), face.mIndices, face.mIndices + 3);
+                indexCount += 3;
+            }
+
+            mesh.submeshes.emplace_back(
+                source->mName.C_Str(),
+                InvalidMaterialHandle,
+                indexOffset,
+                indexCount,
+                vertexOffset,
+                source->mNumVertices);
+        }
+
+        mesh.name = "Sponza (" + path + ")";
+        return !mesh.indices.empty();
+    }
+
+    /// @brief Stand-in when Sponza is not installed: a scanline-ordered 512x512 grid, the
+    ///        typical output of exporters that do not optimize
+    inline void BuildFallbackGrid(BenchmarkMesh& mesh)
+    {
+        constexpr uint32_t GRID_SIZE = 512;
+        AppendGrid(mesh.vertices, mesh.indices, GRID_SIZE);
+
+        mesh.submeshes.emplace_back(
+            "Grid",
+            InvalidMaterialHandle,
+            0,
+            static_cast<uint32_t>(mesh.indices.size()),
+            0,
+            static_cast<uint32_t>(mesh.vertices.size()));
+        mesh.name = "512x512 grid (Sponza not found, set VA_SPONZA_PATH)";
+    }
+} // namespace VoidArchitect::Testing
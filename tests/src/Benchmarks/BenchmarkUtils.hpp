@@ -0,0 +1,42 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+#pragma once
+
+#include <chrono>
+#include <iomanip>
+#include <limits>
+
+namespace VoidArchitect::Testing
+{
+    /// @brief Run a callable several times and return the best wall-clock time
+    /// @param iterations Number of timed runs
+    /// @param func Callable to measure
+    /// @return Fastest run duration in milliseconds
+    ///
+    /// Taking the best run filters out scheduler noise, which matters more than the mean
+    /// for the short benchmarks registered with the TestRunner.
+    template <typename Func>
+    double MeasureBestMs(const int iterations, Func&& func)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < iterations; ++i)
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            func();
+            const auto end = std::chrono::high_resolution_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    }
+
+    /// @brief Print one benchmark result line in a fixed-width layout
+    /// @param label Name of the measured variant
+    /// @param value Measured value
+    /// @param unit Unit of the value
+    inline void PrintBenchmarkResult(const std::string& label, const double value, const char* unit)
+    {
+        std::cout << "    " << std::left << std::setw(40) << label << std::right << std::setw(12)
+            << std::fixed << std::setprecision(2) << value << " " << unit << std::endl;
+    }
+} // namespace VoidArchitect::Testing
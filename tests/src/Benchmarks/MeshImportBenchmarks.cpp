@@ -0,0 +1,108 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// Source mesh import benchmark on Sponza, RawMeshLoader through assimp versus the native
+// glTF/OBJ importer
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkMeshes.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Resources/Loaders/RawMeshLoader.hpp>
+#include <Systems/Jobs/JobSystem.hpp>
+#include <Systems/MaterialSystem.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief Write the fallback grid as an OBJ file with UVs and normals
+    void WriteFallbackObj(const std::filesystem::path& path)
+    {
+        BenchmarkMesh mesh;
+        BuildFallbackGrid(mesh);
+
+        std::ofstream obj(path);
+        obj << "o Grid\n";
+        for (const auto& vertex : mesh.vertices)
+        {
+            obj << "v " << vertex.Position.X() << " " << vertex.Position.Y() << " "
+                << vertex.Position.Z() << "\n";
+        }
+        for (const auto& vertex : mesh.vertices)
+        {
+            obj << "vt " << vertex.Position.X() / 64.0f << " " << vertex.Position.Z() / 64.0f
+                << "\n";
+        }
+        obj << "vn 0 1 0\n";
+        for (size_t i = 0; i < mesh.indices.size(); i += 3)
+        {
+            obj << "f";
+            for (size_t c = 0; c < 3; ++c)
+            {
+                const auto index = mesh.indices[i + c] + 1;
+                obj << " " << index << "/" << index << "/1";
+            }
+            obj << "\n";
+        }
+    }
+} // namespace
+
+/// @brief Report the time RawMeshLoader takes to import Sponza with each backend
+bool BenchmarkMeshImporters()
+{
+    const auto ownedMaterialSystem = !g_MaterialSystem;
+    if (ownedMaterialSystem) g_MaterialSystem = std::make_unique<MaterialSystem>();
+    const auto ownedJobSystem = !Jobs::g_JobSystem;
+    if (ownedJobSystem) Jobs::g_JobSystem = std::make_unique<Jobs::JobSystem>();
+
+    const auto fallbackDirectory = std::filesystem::temp_directory_path() / "va_benchmark_import";
+    std::filesystem::path path = FindSponzaPath();
+    if (path.empty())
+    {
+        std::filesystem::create_directories(fallbackDirectory);
+        path = fallbackDirectory / "grid.obj";
+        WriteFallbackObj(path);
+    }
+
+    RawMeshLoader loader(path.parent_path().string() + "/");
+    const auto name = path.stem().string();
+    MeshDataDefinitionPtr meshes[2];
+    const auto measure = [&](const MeshImporter importer)
+    {
+        loader.SetImporter(importer);
+        auto& mesh = meshes[static_cast<size_t>(importer)];
+        return MeasureBestMs(
+            3,
+            [&]() { mesh = std::dynamic_pointer_cast<MeshDataDefinition>(loader.Load(name)); });
+    };
+    const auto assimpMs = measure(MeshImporter::Assimp);
+    const auto nativeMs = measure(MeshImporter::Native);
+
+    if (ownedJobSystem) Jobs::g_JobSystem.reset();
+    if (ownedMaterialSystem) g_MaterialSystem.reset();
+    std::filesystem::remove_all(fallbackDirectory);
+
+    const auto& assimp = meshes[static_cast<size_t>(MeshImporter::Assimp)];
+    const auto& native = meshes[static_cast<size_t>(MeshImporter::Native)];
+    if (!assimp || !native) return false;
+
+    std::cout << std::endl << "  Mesh import, " << path.filename().string() << ", "
+        << native->GetIndices().size() / 3 << " triangles:" << std::endl;
+    PrintBenchmarkResult("Assimp", assimpMs, "ms");
+    PrintBenchmarkResult("Native", nativeMs, "ms");
+    PrintBenchmarkResult("Speedup, native vs assimp", assimpMs / nativeMs, "x");
+    PrintBenchmarkResult("Assimp vertices", static_cast<double>(assimp->GetVertices().size()), "");
+    PrintBenchmarkResult("Native vertices", static_cast<double>(native->GetVertices().size()), "");
+
+    // Both triangulate the same faces, welding may differ on vertices equal up to rounding
+    return assimp->GetIndices().size() == native->GetIndices().size();
+}
+
+// Register all mesh import benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkMeshImporters, BenchmarkMeshImporters);
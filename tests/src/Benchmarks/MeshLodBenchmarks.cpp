@@ -0,0 +1,94 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// LOD chain bake benchmark on the Sponza scene, simplification cost and triangles per level
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkMeshes.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Resources/MeshOptimizer.hpp>
+#include <Resources/MeshSimplifier.hpp>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Testing;
+
+/// @brief Time the LOD chains of every submesh, as VAMLoader bakes them, and report the
+///        triangles left at every level
+bool BenchmarkMeshLodChainSponza()
+{
+    BenchmarkMesh mesh;
+    if (!LoadSponza(mesh)) BuildFallbackGrid(mesh);
+
+    // The bake simplifies optimized geometry with its bounds
+    for (auto& submesh : mesh.submeshes)
+    {
+        MeshOptimizer::Optimize(mesh.vertices, mesh.indices, submesh);
+        submesh.bounds = MeshData::ComputeBounds(
+            std::span(mesh.vertices).subspan(submesh.vertexOffset, submesh.vertexCount));
+    }
+
+    std::cout << std::endl << "  LOD chain, " << mesh.name << ", " << mesh.submeshes.size() <<
+        " submeshes, " << mesh.indices.size() / 3 << " triangles:" << std::endl;
+
+    const auto baseIndexCount = mesh.indices.size();
+    VAArray<MeshLod> lods;
+    const auto bakeMs = MeasureBestMs(
+        3,
+        [&]()
+        {
+            mesh.indices.resize(baseIndexCount);
+            lods.clear();
+            for (uint32_t i = 0; i < mesh.submeshes.size(); ++i)
+            {
+                MeshSimplifier::BuildLodChain(
+                    mesh.vertices,
+                    mesh.indices,
+                    mesh.submeshes[i],
+                    i,
+                    lods);
+            }
+        });
+
+    // A submesh that stops early keeps drawing its coarsest level at the next ones
+    VAArray<uint32_t> triangles(MESH_MAX_LODS, 0);
+    VAArray<float> errors(MESH_MAX_LODS, 0.0f);
+    size_t lodIndex = 0;
+    for (uint32_t i = 0; i < mesh.submeshes.size(); ++i)
+    {
+        auto count = mesh.submeshes[i].indexCount / 3;
+        triangles[0] += count;
+        for (uint32_t level = 1; level < MESH_MAX_LODS; ++level)
+        {
+            if (lodIndex < lods.size() && lods[lodIndex].submeshIndex == i)
+            {
+                count = lods[lodIndex].GetTriangleCount();
+                errors[level] = std::max(errors[level], lods[lodIndex].error);
+                ++lodIndex;
+            }
+            triangles[level] += count;
+        }
+    }
+
+    PrintBenchmarkResult("Bake time, every LOD chain", bakeMs, "ms");
+    PrintBenchmarkResult(
+        "Bake throughput",
+        static_cast<double>(baseIndexCount / 3) / (bakeMs * 1000.0),
+        "M tris/s");
+    for (uint32_t level = 0; level < MESH_MAX_LODS; ++level)
+    {
+        const auto label = "LOD " + std::to_string(level) + " triangles";
+        PrintBenchmarkResult(label, triangles[level], "");
+        if (level > 0)
+        {
+            const auto errorLabel = "LOD " + std::to_string(level) + " max error";
+            PrintBenchmarkResult(errorLabel, errors[level], "units");
+        }
+    }
+
+    return !lods.empty() && triangles.back() < triangles.front();
+}
+
+// Register all MeshLod benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkMeshLodChainSponza, BenchmarkMeshLodChainSponza);
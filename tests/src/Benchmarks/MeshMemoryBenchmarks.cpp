@@ -0,0 +1,69 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// Mesh memory footprint on the Sponza scene, compact vertices and automatic 16-bit indices
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkMeshes.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Resources/VertexQuantization.hpp>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    double ToKiB(const size_t bytes) { return static_cast<double>(bytes) / 1024.0; }
+} // namespace
+
+/// @brief Report the GPU vertex and index memory of the full and compact mesh layouts
+bool BenchmarkMeshMemorySponza()
+{
+    BenchmarkMesh mesh;
+    if (!LoadSponza(mesh)) BuildFallbackGrid(mesh);
+
+    std::cout << std::endl << "  Mesh memory, " << mesh.name << ", " << mesh.submeshes.size()
+        << " submeshes, " << mesh.vertices.size() << " vertices, " << mesh.indices.size() / 3
+        << " triangles:" << std::endl;
+
+    // One index buffer per mesh, 16-bit only when every submesh-relative index fits
+    const auto vertexBytes = mesh.vertices.size() * sizeof(MeshVertex);
+    const auto compactVertexBytes = mesh.vertices.size() * sizeof(CompactVertex);
+    const auto indexBytes = mesh.indices.size() * sizeof(uint32_t);
+    const auto shortIndices = MeshData::FitsShortIndices(mesh.indices);
+    const auto autoIndexBytes = mesh.indices.size() *
+        (shortIndices ? sizeof(uint16_t) : sizeof(uint32_t));
+
+    uint32_t shortSubmeshes = 0;
+    for (const auto& submesh : mesh.submeshes)
+    {
+        const std::span submeshIndices(
+            mesh.indices.data() + submesh.indexOffset,
+            submesh.indexCount);
+        if (MeshData::FitsShortIndices(submeshIndices)) ++shortSubmeshes;
+    }
+
+    PrintBenchmarkResult("Vertices, MeshVertex", ToKiB(vertexBytes), "KiB");
+    PrintBenchmarkResult("Vertices, CompactVertex", ToKiB(compactVertexBytes), "KiB");
+    PrintBenchmarkResult("Indices, 32-bit", ToKiB(indexBytes), "KiB");
+    PrintBenchmarkResult(
+        shortIndices ? "Indices, automatic (16-bit)" : "Indices, automatic (32-bit)",
+        ToKiB(autoIndexBytes),
+        "KiB");
+    PrintBenchmarkResult("Submeshes fitting 16-bit indices", shortSubmeshes, "");
+    PrintBenchmarkResult("Total before", ToKiB(vertexBytes + indexBytes), "KiB");
+    PrintBenchmarkResult("Total after", ToKiB(compactVertexBytes + autoIndexBytes), "KiB");
+    PrintBenchmarkResult(
+        "Saved",
+        100.0 * (1.0 - static_cast<double>(compactVertexBytes + autoIndexBytes) /
+            static_cast<double>(vertexBytes + indexBytes)),
+        "%");
+
+    // A mesh whose submeshes all fit must be uploaded with 16-bit indices
+    return shortIndices == (shortSubmeshes == mesh.submeshes.size());
+}
+
+// Register all mesh memory benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkMeshMemorySponza, BenchmarkMeshMemorySponza);
@@ -0,0 +1,138 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// Normal and tangent generation benchmark on a 1M triangle mesh, serial scatter versus
+// MeshNormals inline and on the job system
+//
+#include "../Core/TestRunner.hpp"
+#include "../Resources/TestMeshes.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Resources/MeshNormals.hpp>
+#include <Systems/Jobs/JobSystem.hpp>
+
+#include <cmath>
+#include <cstring>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief 708 x 708 vertices, 999698 triangles
+    constexpr uint32_t GRID_SIZE = 708;
+
+    /// @brief The scatter loop MeshData::GenerateNormals used to run
+    void ScatterNormals(VAArray<Resources::MeshVertex>& vertices, const VAArray<uint32_t>& indices)
+    {
+        for (auto& vertex : vertices) vertex.Normal = Math::Vec3::Zero();
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const auto& p0 = vertices[indices[i]].Position;
+            const auto normal = Math::Vec3::Cross(
+                vertices[indices[i + 1]].Position - p0,
+                vertices[indices[i + 2]].Position - p0);
+            vertices[indices[i]].Normal += normal;
+            vertices[indices[i + 1]].Normal += normal;
+            vertices[indices[i + 2]].Normal += normal;
+        }
+        for (auto& vertex : vertices) vertex.Normal.Normalize();
+    }
+
+    /// @brief The scatter loop MeshData::GenerateTangents used to run, with its temporaries
+    void ScatterTangents(VAArray<Resources::MeshVertex>& vertices, const VAArray<uint32_t>& indices)
+    {
+        VAArray<Math::Vec3> tangents(vertices.size(), Math::Vec3::Zero());
+        VAArray<Math::Vec3> bitangents(vertices.size(), Math::Vec3::Zero());
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const auto& v0 = vertices[indices[i]];
+            const auto& v1 = vertices[indices[i + 1]];
+            const auto& v2 = vertices[indices[i + 2]];
+            const auto edge1 = v1.Position - v0.Position;
+            const auto edge2 = v2.Position - v0.Position;
+            const auto dUV1 = v1.UV0 - v0.UV0;
+            const auto dUV2 = v2.UV0 - v0.UV0;
+            const float r = 1.0f / (dUV1.X() * dUV2.Y() - dUV2.X() * dUV1.Y());
+            const auto sdir = (edge1 * dUV2.Y() - edge2 * dUV1.Y()) * r;
+            const auto tdir = (edge2 * dUV1.X() - edge1 * dUV2.X()) * r;
+            for (size_t c = 0; c < 3; ++c)
+            {
+                tangents[indices[i + c]] += sdir;
+                bitangents[indices[i + c]] += tdir;
+            }
+        }
+        for (size_t v = 0; v < vertices.size(); ++v)
+        {
+            const auto& n = vertices[v].Normal;
+            const auto& t = tangents[v];
+            const auto handedness =
+                Math::Vec3::Dot(Math::Vec3::Cross(n, t), bitangents[v]) < 0.0f ? -1.0f : 1.0f;
+            auto tangent = t - n * Math::Vec3::Dot(n, t);
+            vertices[v].Tangent = Math::Vec4(tangent.Normalize(), handedness);
+        }
+    }
+
+    bool SameBits(const VAArray<Resources::MeshVertex>& a, const VAArray<Resources::MeshVertex>& b)
+    {
+        return a.size() == b.size() &&
+            std::memcmp(a.data(), b.data(), a.size() * sizeof(Resources::MeshVertex)) == 0;
+    }
+} // namespace
+
+bool BenchmarkGenerateNormalsTangents()
+{
+    Resources::MeshData mesh;
+    BuildWavyGrid(mesh, GRID_SIZE);
+
+    std::cout << std::endl << "  Normals and tangents, " << mesh.vertices.size() << " vertices, "
+        << mesh.indices.size() / 3 << " triangles:" << std::endl;
+
+    auto vertices = mesh.vertices;
+    const auto scatterNormalsMs = MeasureBestMs(
+        3,
+        [&]() { ScatterNormals(vertices, mesh.indices); });
+    const auto scatterTangentsMs = MeasureBestMs(
+        3,
+        [&]() { ScatterTangents(vertices, mesh.indices); });
+
+    // Inline: what a job, or a tool without job system, gets
+    const auto ownedJobSystem = !Jobs::g_JobSystem;
+    auto previousJobSystem = std::move(Jobs::g_JobSystem);
+    auto inlineVertices = mesh.vertices;
+    const auto inlineNormalsMs = MeasureBestMs(
+        3,
+        [&]() { Resources::MeshNormals::GenerateNormals(inlineVertices, mesh.indices); });
+    const auto inlineTangentsMs = MeasureBestMs(
+        3,
+        [&]() { Resources::MeshNormals::GenerateTangents(inlineVertices, mesh.indices); });
+
+    Jobs::g_JobSystem = ownedJobSystem
+        ? std::make_unique<Jobs::JobSystem>()
+        : std::move(previousJobSystem);
+    auto parallelVertices = mesh.vertices;
+    const auto parallelNormalsMs = MeasureBestMs(
+        3,
+        [&]() { Resources::MeshNormals::GenerateNormals(parallelVertices, mesh.indices); });
+    const auto parallelTangentsMs = MeasureBestMs(
+        3,
+        [&]() { Resources::MeshNormals::GenerateTangents(parallelVertices, mesh.indices); });
+    if (ownedJobSystem) Jobs::g_JobSystem.reset();
+
+    PrintBenchmarkResult("Normals, serial scatter", scatterNormalsMs, "ms");
+    PrintBenchmarkResult("Normals, MeshNormals inline", inlineNormalsMs, "ms");
+    PrintBenchmarkResult("Normals, MeshNormals jobs", parallelNormalsMs, "ms");
+    PrintBenchmarkResult("Tangents, serial scatter", scatterTangentsMs, "ms");
+    PrintBenchmarkResult("Tangents, MeshNormals inline", inlineTangentsMs, "ms");
+    PrintBenchmarkResult("Tangents, MeshNormals jobs", parallelTangentsMs, "ms");
+    PrintBenchmarkResult(
+        "Speedup, jobs vs scatter",
+        (scatterNormalsMs + scatterTangentsMs) / (parallelNormalsMs + parallelTangentsMs),
+        "x");
+
+    // Chunking must not change a single bit of the result
+    return SameBits(inlineVertices, parallelVertices);
+}
+
+// Register all MeshNormals benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkGenerateNormalsTangents, BenchmarkGenerateNormalsTangents);
@@ -0,0 +1,86 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// MeshOptimizer benchmark on the Sponza scene, vertex cache statistics and optimizer cost
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkMeshes.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Resources/MeshOptimizer.hpp>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief Triangle-weighted ACMR and vertex-weighted ATVR over every submesh
+    VertexCacheStats AnalyzeMesh(const BenchmarkMesh& mesh, const uint32_t cacheSize)
+    {
+        VertexCacheStats total;
+        float triangles = 0.0f;
+        float vertices = 0.0f;
+        for (const auto& submesh : mesh.submeshes)
+        {
+            const auto stats = MeshOptimizer::AnalyzeVertexCache(
+                std::span(mesh.indices.data() + submesh.indexOffset, submesh.indexCount),
+                submesh.vertexCount,
+                cacheSize);
+            total.acmr += stats.acmr * static_cast<float>(submesh.indexCount / 3);
+            total.atvr += stats.atvr * static_cast<float>(submesh.vertexCount);
+            triangles += static_cast<float>(submesh.indexCount / 3);
+            vertices += static_cast<float>(submesh.vertexCount);
+        }
+        total.acmr /= triangles;
+        total.atvr /= vertices;
+        return total;
+    }
+} // namespace
+
+/// @brief Report ACMR/ATVR before and after MeshOptimizer, and the time it takes to run
+bool BenchmarkMeshOptimizerSponza()
+{
+    BenchmarkMesh source;
+    if (!LoadSponza(source)) BuildFallbackGrid(source);
+
+    std::cout << std::endl << "  MeshOptimizer, " << source.name << ", " <<
+        source.submeshes.size() << " submeshes, " << source.vertices.size() << " vertices, "
+        << source.indices.size() / 3 << " triangles:" << std::endl;
+
+    BenchmarkMesh optimized;
+    const auto optimizeMs = MeasureBestMs(
+        3,
+        [&]()
+        {
+            optimized = source;
+            for (const auto& submesh : optimized.submeshes)
+            {
+                MeshOptimizer::Optimize(optimized.vertices, optimized.indices, submesh);
+            }
+        });
+
+    PrintBenchmarkResult("Optimize (all passes)", optimizeMs, "ms");
+    for (const uint32_t cacheSize : {16u, 32u})
+    {
+        const auto before = AnalyzeMesh(source, cacheSize);
+        const auto after = AnalyzeMesh(optimized, cacheSize);
+        const auto suffix = " (FIFO " + std::to_string(cacheSize) + ")";
+
+        PrintBenchmarkResult("ACMR before" + suffix, before.acmr, "");
+        PrintBenchmarkResult("ACMR after" + suffix, after.acmr, "");
+        PrintBenchmarkResult("ATVR before" + suffix, before.atvr, "");
+        PrintBenchmarkResult("ATVR after" + suffix, after.atvr, "");
+
+        if (after.acmr > before.acmr)
+        {
+            std::cout << "    Optimized mesh has a worse ACMR" << std::endl;
+            return false;
+        }
+    }
+
+    return optimized.indices.size() == source.indices.size();
+}
+
+// Register all MeshOptimizer benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkMeshOptimizerSponza, BenchmarkMeshOptimizerSponza);
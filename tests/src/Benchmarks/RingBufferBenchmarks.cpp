@@ -0,0 +1,311 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// Ring buffer throughput/latency benchmarks against moodycamel::ConcurrentQueue
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Core/Collections/RingBuffer.hpp>
+
+#include "concurrentqueue.h"
+
+#include <thread>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Collections;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    constexpr size_t BENCH_RING_CAPACITY = 4096;
+    constexpr size_t BENCH_BATCH_SIZE = 32;
+
+    /// @brief Move `itemsPerProducer` items from every producer to the consumers
+    /// @return Mega-items per second
+    template <typename PushFn, typename PopFn>
+    double RunThroughput(
+        const int producers,
+        const int consumers,
+        const size_t itemsPerProducer,
+        PushFn push,
+        PopFn pop)
+    {
+        const auto totalItems = itemsPerProducer * producers;
+        std::atomic<size_t> consumed{0};
+
+        const auto ms = MeasureBestMs(
+            3,
+            [&]()
+            {
+                consumed = 0;
+                VAArray<std::thread> threads;
+                for (int p = 0; p < producers; ++p)
+                {
+                    threads.emplace_back([&]() { push(itemsPerProducer); });
+                }
+                for (int c = 0; c < consumers; ++c)
+                {
+                    threads.emplace_back(
+                        [&]()
+                        {
+                            while (consumed.load(std::memory_order_relaxed) < totalItems)
+                            {
+                                const auto count = pop();
+                                if (count == 0)
+                                {
+                                    std::this_thread::yield();
+                                    continue;
+                                }
+                                consumed.fetch_add(count, std::memory_order_relaxed);
+                            }
+                        });
+                }
+                for (auto& thread : threads) thread.join();
+            });
+
+        return static_cast<double>(totalItems) / (ms * 1000.0);
+    }
+
+    /// @brief Measure the average round-trip time of a ping-pong between two threads
+    /// @return Nanoseconds per round trip
+    ///
+    /// Both sides yield when the queue is empty so the benchmark stays meaningful on
+    /// machines with fewer cores than threads.
+    template <typename Queue>
+    double RunPingPong(Queue& ping, Queue& pong, const int roundTrips)
+    {
+        const auto ms = MeasureBestMs(
+            3,
+            [&]()
+            {
+                std::thread echo(
+                    [&]()
+                    {
+                        uint64_t value;
+                        for (int i = 0; i < roundTrips; ++i)
+                        {
+                            while (!ping.TryPop(value)) std::this_thread::yield();
+                            while (!pong.TryPush(value)) std::this_thread::yield();
+                        }
+                    });
+
+                uint64_t value = 0;
+                for (int i = 0; i < roundTrips; ++i)
+                {
+                    while (!ping.TryPush(static_cast<uint64_t>(i))) std::this_thread::yield();
+                    while (!pong.TryPop(value)) std::this_thread::yield();
+                }
+                echo.join();
+            });
+
+        return ms * 1e6 / roundTrips;
+    }
+
+    /// @brief Adapter exposing the ring buffer try-interface on top of moodycamel
+    struct MoodycamelAdapter
+    {
+        moodycamel::ConcurrentQueue<uint64_t> queue;
+
+        bool TryPush(const uint64_t value) { return queue.try_enqueue(value); }
+        bool TryPop(uint64_t& value) { return queue.try_dequeue(value); }
+    };
+} // namespace
+
+/// @brief Multi-producer/multi-consumer throughput (4 producers, 4 consumers)
+bool BenchmarkMPMCRingBufferThroughput()
+{
+    constexpr size_t ITEMS_PER_PRODUCER = 100000;
+    std::cout << std::endl << "  MPMC throughput, 4P/4C, " << ITEMS_PER_PRODUCER * 4 << " items:"
+        << std::endl;
+
+    auto ring = std::make_unique<MPMCRingBuffer<uint64_t, BENCH_RING_CAPACITY>>();
+    PrintBenchmarkResult(
+        "MPMCRingBuffer (single)",
+        RunThroughput(
+            4,
+            4,
+            ITEMS_PER_PRODUCER,
+            [&](const size_t count)
+            {
+                for (size_t i = 0; i < count;)
+                {
+                    if (ring->TryPush(i)) ++i;
+                    else std::this_thread::yield();
+                }
+            },
+            [&]()
+            {
+                uint64_t value;
+                return ring->TryPop(value) ? size_t{1} : size_t{0};
+            }),
+        "Mitems/s");
+
+    PrintBenchmarkResult(
+        "MPMCRingBuffer (batch 32)",
+        RunThroughput(
+            4,
+            4,
+            ITEMS_PER_PRODUCER,
+            [&](const size_t count)
+            {
+                uint64_t batch[BENCH_BATCH_SIZE] = {};
+                for (size_t i = 0; i < count;)
+                {
+                    const auto pushed = ring->TryPushBatch(
+                        batch,
+                        std::min(BENCH_BATCH_SIZE, count - i));
+                    if (pushed == 0) std::this_thread::yield();
+                    i += pushed;
+                }
+            },
+            [&]()
+            {
+                uint64_t batch[BENCH_BATCH_SIZE];
+                return ring->TryPopBatch(batch, BENCH_BATCH_SIZE);
+            }),
+        "Mitems/s");
+
+    moodycamel::ConcurrentQueue<uint64_t> queue;
+    PrintBenchmarkResult(
+        "moodycamel::ConcurrentQueue (single)",
+        RunThroughput(
+            4,
+            4,
+            ITEMS_PER_PRODUCER,
+            [&](const size_t count) { for (size_t i = 0; i < count; ++i) queue.enqueue(i); },
+            [&]()
+            {
+                uint64_t value;
+                return queue.try_dequeue(value) ? size_t{1} : size_t{0};
+            }),
+        "Mitems/s");
+
+    PrintBenchmarkResult(
+        "moodycamel::ConcurrentQueue (bulk 32)",
+        RunThroughput(
+            4,
+            4,
+            ITEMS_PER_PRODUCER,
+            [&](const size_t count)
+            {
+                uint64_t batch[BENCH_BATCH_SIZE] = {};
+                for (size_t i = 0; i < count; i += BENCH_BATCH_SIZE)
+                {
+                    queue.enqueue_bulk(batch, std::min(BENCH_BATCH_SIZE, count - i));
+                }
+            },
+            [&]()
+            {
+                uint64_t batch[BENCH_BATCH_SIZE];
+                return queue.try_dequeue_bulk(batch, BENCH_BATCH_SIZE);
+            }),
+        "Mitems/s");
+
+    return true;
+}
+
+/// @brief Single-producer/single-consumer throughput
+bool BenchmarkSPSCRingBufferThroughput()
+{
+    constexpr size_t ITEM_COUNT = 1000000;
+    std::cout << std::endl << "  SPSC throughput, 1P/1C, " << ITEM_COUNT << " items:" << std::endl;
+
+    auto ring = std::make_unique<SPSCRingBuffer<uint64_t, BENCH_RING_CAPACITY>>();
+    PrintBenchmarkResult(
+        "SPSCRingBuffer (single)",
+        RunThroughput(
+            1,
+            1,
+            ITEM_COUNT,
+            [&](const size_t count)
+            {
+                for (size_t i = 0; i < count;)
+                {
+                    if (ring->TryPush(i)) ++i;
+                    else std::this_thread::yield();
+                }
+            },
+            [&]()
+            {
+                uint64_t value;
+                return ring->TryPop(value) ? size_t{1} : size_t{0};
+            }),
+        "Mitems/s");
+
+    PrintBenchmarkResult(
+        "SPSCRingBuffer (batch 32)",
+        RunThroughput(
+            1,
+            1,
+            ITEM_COUNT,
+            [&](const size_t count)
+            {
+                uint64_t batch[BENCH_BATCH_SIZE] = {};
+                for (size_t i = 0; i < count;)
+                {
+                    const auto pushed = ring->TryPushBatch(
+                        batch,
+                        std::min(BENCH_BATCH_SIZE, count - i));
+                    if (pushed == 0) std::this_thread::yield();
+                    i += pushed;
+                }
+            },
+            [&]()
+            {
+                uint64_t batch[BENCH_BATCH_SIZE];
+                return ring->TryPopBatch(batch, BENCH_BATCH_SIZE);
+            }),
+        "Mitems/s");
+
+    moodycamel::ConcurrentQueue<uint64_t> queue;
+    PrintBenchmarkResult(
+        "moodycamel::ConcurrentQueue (single)",
+        RunThroughput(
+            1,
+            1,
+            ITEM_COUNT,
+            [&](const size_t count) { for (size_t i = 0; i < count; ++i) queue.enqueue(i); },
+            [&]()
+            {
+                uint64_t value;
+                return queue.try_dequeue(value) ? size_t{1} : size_t{0};
+            }),
+        "Mitems/s");
+
+    return true;
+}
+
+/// @brief Round-trip latency of a two-thread ping-pong
+bool BenchmarkRingBufferLatency()
+{
+    constexpr int ROUND_TRIPS = 20000;
+    std::cout << std::endl << "  Ping-pong latency, " << ROUND_TRIPS << " round trips:"
+        << std::endl;
+
+    {
+        auto ping = std::make_unique<SPSCRingBuffer<uint64_t, 64>>();
+        auto pong = std::make_unique<SPSCRingBuffer<uint64_t, 64>>();
+        PrintBenchmarkResult("SPSCRingBuffer", RunPingPong(*ping, *pong, ROUND_TRIPS), "ns/rt");
+    }
+    {
+        auto ping = std::make_unique<MPMCRingBuffer<uint64_t, 64>>();
+        auto pong = std::make_unique<MPMCRingBuffer<uint64_t, 64>>();
+        PrintBenchmarkResult("MPMCRingBuffer", RunPingPong(*ping, *pong, ROUND_TRIPS), "ns/rt");
+    }
+    {
+        MoodycamelAdapter ping;
+        MoodycamelAdapter pong;
+        PrintBenchmarkResult(
+            "moodycamel::ConcurrentQueue",
+            RunPingPong(ping, pong, ROUND_TRIPS),
+            "ns/rt");
+    }
+
+    return true;
+}
+
+// Register all RingBuffer benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkMPMCRingBufferThroughput, BenchmarkMPMCRingBufferThroughput);
+VA_REGISTER_TEST(BenchmarkSPSCRingBufferThroughput, BenchmarkSPSCRingBufferThroughput);
+VA_REGISTER_TEST(BenchmarkRingBufferLatency, BenchmarkRingBufferLatency);
@@ -0,0 +1,149 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// GenerateNormals benchmark, array-of-structs (MeshData) versus struct-of-arrays (SoAArray)
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Core/Collections/SoAArray.hpp>
+#include <Resources/MeshData.hpp>
+
+#include <cmath>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Collections;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    constexpr uint32_t GRID_SIZE = 512;
+
+    /// @brief Position/normal columns: PX, PY, PZ, NX, NY, NZ
+    using VertexColumns = SoAArray<float, float, float, float, float, float>;
+
+    /// @brief Build a wavy grid so that normals are not trivially constant
+    void BuildGrid(Resources::MeshData& aos, VertexColumns& soa)
+    {
+        aos.vertices.resize(GRID_SIZE * GRID_SIZE);
+        soa.Resize(GRID_SIZE * GRID_SIZE);
+        for (uint32_t z = 0; z < GRID_SIZE; ++z)
+        {
+            for (uint32_t x = 0; x < GRID_SIZE; ++x)
+            {
+                const auto index = z * GRID_SIZE + x;
+                const auto fx = static_cast<float>(x);
+                const auto fz = static_cast<float>(z);
+                const auto fy = std::sin(fx * 0.1f) * std::cos(fz * 0.1f);
+
+                aos.vertices[index].Position = Math::Vec3(fx, fy, fz);
+                soa.Get<0>(index) = fx;
+                soa.Get<1>(index) = fy;
+                soa.Get<2>(index) = fz;
+            }
+        }
+
+        aos.indices.reserve((GRID_SIZE - 1) * (GRID_SIZE - 1) * 6);
+        for (uint32_t z = 0; z < GRID_SIZE - 1; ++z)
+        {
+            for (uint32_t x = 0; x < GRID_SIZE - 1; ++x)
+            {
+                const auto i0 = z * GRID_SIZE + x;
+                const auto i1 = i0 + 1;
+                const auto i2 = i0 + GRID_SIZE;
+                const auto i3 = i2 + 1;
+                aos.indices.insert(aos.indices.end(), {i0, i2, i1, i1, i2, i3});
+            }
+        }
+    }
+
+    /// @brief SoA equivalent of MeshData::GenerateNormals
+    void GenerateNormalsSoA(VertexColumns& soa, const VAArray<uint32_t>& indices)
+    {
+        const auto* px = soa.Data<0>();
+        const auto* py = soa.Data<1>();
+        const auto* pz = soa.Data<2>();
+        auto* nx = soa.Data<3>();
+        auto* ny = soa.Data<4>();
+        auto* nz = soa.Data<5>();
+
+        for (auto& value : soa.PaddedColumn<3>()) value = 0.0f;
+        for (auto& value : soa.PaddedColumn<4>()) value = 0.0f;
+        for (auto& value : soa.PaddedColumn<5>()) value = 0.0f;
+
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const auto i0 = indices[i + 0];
+            const auto i1 = indices[i + 1];
+            const auto i2 = indices[i + 2];
+
+            const auto e0x = px[i1] - px[i0];
+            const auto e0y = py[i1] - py[i0];
+            const auto e0z = pz[i1] - pz[i0];
+            const auto e1x = px[i2] - px[i0];
+            const auto e1y = py[i2] - py[i0];
+            const auto e1z = pz[i2] - pz[i0];
+
+            const auto cx = e0y * e1z - e0z * e1y;
+            const auto cy = e0z * e1x - e0x * e1z;
+            const auto cz = e0x * e1y - e0y * e1x;
+
+            nx[i0] += cx;
+            ny[i0] += cy;
+            nz[i0] += cz;
+            nx[i1] += cx;
+            ny[i1] += cy;
+            nz[i1] += cz;
+            nx[i2] += cx;
+            ny[i2] += cy;
+            nz[i2] += cz;
+        }
+
+        // Column-wise normalization over the padded range, no scalar tail needed.
+        const auto count = soa.PaddedColumn<3>().size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto lengthSq = nx[i] * nx[i] + ny[i] * ny[i] + nz[i] * nz[i];
+            const auto invLength = lengthSq > 0.0f ? 1.0f / std::sqrt(lengthSq) : 0.0f;
+            nx[i] *= invLength;
+            ny[i] *= invLength;
+            nz[i] *= invLength;
+        }
+    }
+} // namespace
+
+/// @brief Compare MeshData::GenerateNormals with its SoA counterpart on a 512x512 grid
+bool BenchmarkGenerateNormalsAoSvsSoA()
+{
+    Resources::MeshData aos;
+    VertexColumns soa;
+    BuildGrid(aos, soa);
+
+    std::cout << std::endl << "  GenerateNormals, " << aos.vertices.size() << " vertices, "
+        << aos.indices.size() / 3 << " triangles:" << std::endl;
+
+    const auto aosMs = MeasureBestMs(5, [&]() { aos.GenerateNormals(); });
+    const auto soaMs = MeasureBestMs(5, [&]() { GenerateNormalsSoA(soa, aos.indices); });
+
+    PrintBenchmarkResult("AoS (MeshData::GenerateNormals)", aosMs, "ms");
+    PrintBenchmarkResult("SoA (SoAArray columns)", soaMs, "ms");
+    PrintBenchmarkResult("Speedup", aosMs / soaMs, "x");
+
+    // Both layouts must produce the same normals
+    for (size_t i = 0; i < aos.vertices.size(); ++i)
+    {
+        const auto& normal = aos.vertices[i].Normal;
+        if (std::abs(normal.X() - soa.Get<3>(i)) > 1e-4f ||
+            std::abs(normal.Y() - soa.Get<4>(i)) > 1e-4f ||
+            std::abs(normal.Z() - soa.Get<5>(i)) > 1e-4f)
+        {
+            std::cout << "    Normal mismatch at vertex " << i << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Register all SoAArray benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkGenerateNormalsAoSvsSoA, BenchmarkGenerateNormalsAoSvsSoA);
@@ -0,0 +1,224 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// VAM compression settings, ratio and decode throughput of LZ4 and LZ4-HC with and without the
+// vertex stream filters, and a trained dictionary on small files
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkMeshes.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Resources/Loaders/VamCompression.hpp>
+#include <Resources/VertexStreams.hpp>
+
+#include <cstring>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief Vertex and index sections of a baked file, full precision vertices
+    struct BakedSections
+    {
+        VAArray<uint8_t> bytes;
+        uint32_t positionsSize = 0;
+        uint32_t attributesSize = 0;
+        uint32_t indicesSize = 0;
+
+        [[nodiscard]] VAArray<VAMCompression::Section> Layout(const bool filter) const
+        {
+            return {
+                {
+                    positionsSize,
+                    filter ? VAMFilter::Delta : VAMFilter::None,
+                    sizeof(float),
+                    sizeof(VertexPosition)
+                },
+                {attributesSize, filter ? VAMFilter::Shuffle : VAMFilter::None},
+                {indicesSize}
+            };
+        }
+    };
+
+    BakedSections BakeSections(
+        const std::span<const MeshVertex> vertices,
+        const std::span<const uint32_t> indices)
+    {
+        VAArray<VertexPosition> positions(vertices.size());
+        VAArray<VertexAttributes> attributes(vertices.size());
+        VertexStreams::ExtractPositions(vertices, positions);
+        VertexStreams::ExtractAttributes(vertices, attributes);
+
+        BakedSections sections;
+        sections.positionsSize = static_cast<uint32_t>(positions.size() * sizeof(VertexPosition));
+        sections.attributesSize = static_cast<uint32_t>(
+            attributes.size() * sizeof(VertexAttributes));
+        sections.indicesSize = static_cast<uint32_t>(indices.size() * sizeof(uint32_t));
+
+        auto& bytes = sections.bytes;
+        bytes.resize(sections.positionsSize + sections.attributesSize + sections.indicesSize);
+        std::memcpy(bytes.data(), positions.data(), sections.positionsSize);
+        std::memcpy(
+            bytes.data() + sections.positionsSize,
+            attributes.data(),
+            sections.attributesSize);
+        std::memcpy(
+            bytes.data() + sections.positionsSize + sections.attributesSize,
+            indices.data(),
+            sections.indicesSize);
+        return sections;
+    }
+} // namespace
+
+/// @brief Report the ratio and the decode MiB/s of every compression level and filter
+bool BenchmarkVamCompressionSettings()
+{
+    BenchmarkMesh mesh;
+    if (!LoadSponza(mesh)) BuildFallbackGrid(mesh);
+
+    const auto sections = BakeSections(mesh.vertices, mesh.indices);
+    const auto sectionsMiB = static_cast<double>(sections.bytes.size()) / (1024.0 * 1024.0);
+    const auto chunkSize = VAMCompressionSettings::Default().chunkSize;
+    std::cout << std::endl << "  VAM compression settings, " << mesh.name << ", " <<
+        sectionsMiB << " MiB of vertices and indices:" << std::endl;
+
+    struct Setting
+    {
+        const char* name;
+        int level;
+        bool filter;
+    };
+    constexpr Setting settings[] = {
+        {"LZ4", 1, false},
+        {"LZ4, filtered", 1, true},
+        {"LZ4-HC 9", 9, false},
+        {"LZ4-HC 9, filtered", 9, true},
+        {"LZ4-HC 12, filtered", 12, true},
+    };
+
+    bool valid = true;
+    VAArray<uint8_t> destination(sections.bytes.size());
+    for (const auto& setting : settings)
+    {
+        const auto layout = sections.Layout(setting.filter);
+        VAMCompression::CompressionResult result;
+        const auto compressMs = MeasureBestMs(
+            1,
+            [&]()
+            {
+                result = VAMCompression::CompressChunks(
+                    sections.bytes,
+                    layout,
+                    chunkSize,
+                    setting.level);
+            });
+        const auto decodeMs = MeasureBestMs(
+            5,
+            [&]()
+            {
+                valid = valid && result.success &&
+                    VAMCompression::DecompressChunks(result.compressedData, destination) &&
+                    destination == sections.bytes;
+            });
+
+        const std::string name = setting.name;
+        PrintBenchmarkResult(
+            name + ", savings",
+            VAMCompression::GetCompressionRatio(result.originalSize, result.compressedSize) *
+            100.0,
+            "%");
+        PrintBenchmarkResult(name + ", compress", sectionsMiB * 1000.0 / compressMs, "MiB/s");
+        PrintBenchmarkResult(name + ", decode", sectionsMiB * 1000.0 / decodeMs, "MiB/s");
+    }
+    return valid;
+}
+
+/// @brief Report the savings a dictionary trained on other small files brings
+bool BenchmarkVamCompressionDictionary()
+{
+    BenchmarkMesh mesh;
+    if (!LoadSponza(mesh)) BuildFallbackGrid(mesh);
+
+    // Small files of 512 vertices and their triangles, the even ones train the dictionary
+    constexpr size_t SLICE_VERTICES = 512;
+    VAArray<BakedSections> files;
+    for (size_t first = 0; first + SLICE_VERTICES <= mesh.vertices.size() && files.size() < 256;
+         first += SLICE_VERTICES)
+    {
+        VAArray<uint32_t> indices(SLICE_VERTICES * 3 / 2);
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            indices[i] = static_cast<uint32_t>((i * 7 + i / 3) % SLICE_VERTICES);
+        }
+        files.push_back(
+            BakeSections(
+                std::span(mesh.vertices).subspan(first, SLICE_VERTICES),
+                indices));
+    }
+    if (files.size() < 2) return false;
+
+    VAArray<VAArray<uint8_t>> samples;
+    for (size_t i = 0; i < files.size(); i += 2) samples.push_back(files[i].bytes);
+    const auto dictionary = VAMCompression::TrainDictionary(samples);
+    const auto dictionaryId = VAMCompression::RegisterDictionary(dictionary);
+
+    const auto fileKiB = files[0].bytes.size() / 1024.0;
+    std::cout << std::endl << "  VAM dictionary, " << mesh.name << ", " << files.size() / 2 <<
+        " files of " << fileKiB << " KiB, " << dictionary.size() / 1024.0 <<
+        " KiB dictionary:" << std::endl;
+
+    bool valid = true;
+    const auto measure = [&](const uint32_t id)
+    {
+        uint64_t originalSize = 0;
+        uint64_t compressedSize = 0;
+        VAArray<VAMCompression::CompressionResult> results;
+        for (size_t i = 1; i < files.size(); i += 2)
+        {
+            results.push_back(
+                VAMCompression::CompressChunks(
+                    files[i].bytes,
+                    files[i].Layout(true),
+                    VAMCompressionSettings::Default().chunkSize,
+                    9,
+                    id));
+            originalSize += results.back().originalSize;
+            compressedSize += results.back().compressedSize;
+        }
+
+        const auto decodeMs = MeasureBestMs(
+            5,
+            [&]()
+            {
+                for (size_t i = 0; i < results.size(); ++i)
+                {
+                    const auto& original = files[i * 2 + 1].bytes;
+                    VAArray<uint8_t> destination(original.size());
+                    valid = valid && VAMCompression::DecompressChunks(
+                        results[i].compressedData,
+                        destination) && destination == original;
+                }
+            });
+
+        const auto originalMiB = static_cast<double>(originalSize) / (1024.0 * 1024.0);
+        return std::pair{
+            100.0 * (1.0 - static_cast<double>(compressedSize) / originalSize),
+            originalMiB * 1000.0 / decodeMs
+        };
+    };
+    const auto [plainSavings, plainDecode] = measure(0);
+    const auto [dictionarySavings, dictionaryDecode] = measure(dictionaryId);
+
+    PrintBenchmarkResult("LZ4-HC 9, filtered, savings", plainSavings, "%");
+    PrintBenchmarkResult("LZ4-HC 9, filtered, decode", plainDecode, "MiB/s");
+    PrintBenchmarkResult("With dictionary, savings", dictionarySavings, "%");
+    PrintBenchmarkResult("With dictionary, decode", dictionaryDecode, "MiB/s");
+    return valid;
+}
+
+// Register all VAM compression benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkVamCompressionSettings, BenchmarkVamCompressionSettings);
+VA_REGISTER_TEST(BenchmarkVamCompressionDictionary, BenchmarkVamCompressionDictionary);
@@ -0,0 +1,132 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// VAM load throughput, the file read into a buffer against the file mapped and parsed in place,
+// and LZ4 decompression as a single block against independent chunks inline and on the job system
+//
+#include "../Core/TestRunner.hpp"
+#include "BenchmarkMeshes.hpp"
+#include "BenchmarkUtils.hpp"
+#include <Resources/Loaders/VamLoader.hpp>
+#include <Systems/Jobs/JobSystem.hpp>
+
+#include <cstring>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+/// @brief Report the MiB/s of loading an uncompressed VAM file, read or mapped
+bool BenchmarkVamLoadSponza()
+{
+    BenchmarkMesh mesh;
+    if (!LoadSponza(mesh)) BuildFallbackGrid(mesh);
+
+    // Without submeshes, saving and loading the file needs no material system
+    const MeshDataDefinition definition(mesh.vertices, mesh.indices);
+    auto settings = VAMCompressionSettings::Default();
+    settings.enableCompression = false;
+    const auto path = (std::filesystem::temp_directory_path() / "va_benchmark.vam").string();
+    if (!VAMLoader::SaveMeshToVAM(path, "", definition, settings)) return false;
+
+    const auto fileMiB = static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0);
+    std::cout << std::endl << "  VAM load, " << mesh.name << ", " << mesh.vertices.size() <<
+        " vertices, " << mesh.indices.size() << " indices:" << std::endl;
+
+    // The first run warms the page cache, both variants then read from memory
+    bool valid = true;
+    const auto measure = [&](const Platform::MappedFile::Mode mode)
+    {
+        return MeasureBestMs(
+            5,
+            [&]()
+            {
+                const auto loaded = VAMLoader::LoadMeshFromVAM(path, mode);
+                valid = valid && loaded && loaded->GetVertices().size() == mesh.vertices.size() &&
+                    loaded->GetPackedGeometry().owner;
+            });
+    };
+    const auto readMs = measure(Platform::MappedFile::Mode::Read);
+    const auto mapMs = measure(Platform::MappedFile::Mode::Map);
+    std::filesystem::remove(path);
+
+    PrintBenchmarkResult("File size", fileMiB, "MiB");
+    PrintBenchmarkResult("Read into a buffer", fileMiB * 1000.0 / readMs, "MiB/s");
+    PrintBenchmarkResult("Mapped, parsed in place", fileMiB * 1000.0 / mapMs, "MiB/s");
+    PrintBenchmarkResult("Speedup", readMs / mapMs, "x");
+    return valid;
+}
+
+/// @brief Report the MiB/s of decompressing the vertex and index sections of a VAM file
+bool BenchmarkVamDecompressSponza()
+{
+    BenchmarkMesh mesh;
+    if (!LoadSponza(mesh)) BuildFallbackGrid(mesh);
+
+    // The two largest sections of a baked file, back to back
+    const auto verticesSize = static_cast<uint32_t>(mesh.vertices.size() * sizeof(MeshVertex));
+    const auto indicesSize = static_cast<uint32_t>(mesh.indices.size() * sizeof(uint32_t));
+    VAArray<uint8_t> sections(verticesSize + indicesSize);
+    std::memcpy(sections.data(), mesh.vertices.data(), verticesSize);
+    std::memcpy(sections.data() + verticesSize, mesh.indices.data(), indicesSize);
+
+    const VAMCompression::Section layout[] = {{verticesSize}, {indicesSize}};
+    const auto block = VAMCompression::Compress(sections);
+    const auto chunks = VAMCompression::CompressChunks(
+        sections,
+        layout,
+        VAMCompressionSettings::Default().chunkSize);
+    if (!block.success || !chunks.success) return false;
+
+    const auto sectionsMiB = static_cast<double>(sections.size()) / (1024.0 * 1024.0);
+    std::cout << std::endl << "  VAM decompression, " << mesh.name << ", " << sectionsMiB <<
+        " MiB of vertices and indices:" << std::endl;
+
+    bool valid = true;
+    VAArray<uint8_t> destination(sections.size());
+    const auto singleMs = MeasureBestMs(
+        5,
+        [&]()
+        {
+            const auto decompressed = VAMCompression::Decompress(
+                block.compressedData,
+                block.originalSize);
+            valid = valid && decompressed == sections;
+        });
+
+    // Inline first, then on the running job system or one owned by the benchmark
+    const auto measureChunks = [&]()
+    {
+        return MeasureBestMs(
+            5,
+            [&]()
+            {
+                valid = valid &&
+                    VAMCompression::DecompressChunks(chunks.compressedData, destination) &&
+                    destination == sections;
+            });
+    };
+    const auto ownedJobSystem = !Jobs::g_JobSystem;
+    auto previousJobSystem = std::move(Jobs::g_JobSystem);
+    const auto inlineMs = measureChunks();
+
+    Jobs::g_JobSystem = ownedJobSystem
+        ? std::make_unique<Jobs::JobSystem>()
+        : std::move(previousJobSystem);
+    const auto parallelMs = measureChunks();
+    if (ownedJobSystem) Jobs::g_JobSystem.reset();
+
+    PrintBenchmarkResult("Single block size", block.compressedSize / (1024.0 * 1024.0), "MiB");
+    PrintBenchmarkResult("Chunked size", chunks.compressedSize / (1024.0 * 1024.0), "MiB");
+    PrintBenchmarkResult("Single block", sectionsMiB * 1000.0 / singleMs, "MiB/s");
+    PrintBenchmarkResult("Chunks inline", sectionsMiB * 1000.0 / inlineMs, "MiB/s");
+    PrintBenchmarkResult("Chunks jobs", sectionsMiB * 1000.0 / parallelMs, "MiB/s");
+    PrintBenchmarkResult("Speedup, jobs vs single block", singleMs / parallelMs, "x");
+    return valid;
+}
+
+// Register all VAM load benchmarks with the TestRunner
+VA_REGISTER_TEST(BenchmarkVamLoadSponza, BenchmarkVamLoadSponza);
+VA_REGISTER_TEST(BenchmarkVamDecompressSponza, BenchmarkVamDecompressSponza);
@@ -0,0 +1,126 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// ConcurrentHashMap tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Core/Collections/ConcurrentHashMap.hpp>
+
+#include <thread>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Collections;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test single-threaded lookup, insertion and removal
+bool TestConcurrentHashMapBasics()
+{
+    ConcurrentHashMap<std::string, int, 4> map;
+    if (!map.IsEmpty() || map.Find("a").has_value())
+    {
+        return false;
+    }
+
+    if (!map.InsertOrAssign("a", 1) || map.InsertOrAssign("a", 2) || map.Find("a") != 2)
+    {
+        return false;
+    }
+
+    // Existing keys are returned without calling the factory
+    bool called = false;
+    auto [value, inserted] = map.GetOrInsert(
+        "a",
+        [&]() -> std::optional<int>
+        {
+            called = true;
+            return 3;
+        });
+    if (called || inserted || value != 2)
+    {
+        return false;
+    }
+
+    // A failing factory leaves the map unchanged
+    auto [failed, failedInserted] = map.GetOrInsert("b", []() -> std::optional<int> { return {}; });
+    if (failed.has_value() || failedInserted || map.Contains("b"))
+    {
+        return false;
+    }
+
+    auto [created, createdInserted] = map.GetOrInsert("b", []() -> std::optional<int> { return 5; });
+    if (created != 5 || !createdInserted || map.Size() != 2)
+    {
+        return false;
+    }
+
+    // Conditional erase only removes the expected value
+    if (map.EraseIfEqual("b", 4) || !map.EraseIfEqual("b", 5) || map.Contains("b"))
+    {
+        return false;
+    }
+
+    int sum = 0;
+    map.ForEach([&sum](const std::string&, const int v) { sum += v; });
+    if (sum != 2)
+    {
+        return false;
+    }
+
+    if (!map.Erase("a") || map.Erase("a"))
+    {
+        return false;
+    }
+
+    map.InsertOrAssign("c", 1);
+    map.Clear();
+    return map.IsEmpty();
+}
+
+/// @brief Test that concurrent GetOrInsert calls create each key exactly once
+bool TestConcurrentHashMapInsertOnce()
+{
+    constexpr int THREAD_COUNT = 8;
+    constexpr int KEY_COUNT = 2000;
+
+    ConcurrentHashMap<std::string, int> map;
+    std::atomic<int> factoryCalls{0};
+    std::atomic<int> insertions{0};
+    std::atomic<bool> consistent{true};
+
+    VAArray<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                // Every thread walks the keys in a different order
+                for (int i = 0; i < KEY_COUNT; ++i)
+                {
+                    const int key = (i * 7 + t * 131) % KEY_COUNT;
+                    const auto name = "Resource_" + std::to_string(key);
+                    auto [value, inserted] = map.GetOrInsert(
+                        name,
+                        [&]() -> std::optional<int>
+                        {
+                            factoryCalls.fetch_add(1);
+                            return key;
+                        });
+
+                    if (inserted) insertions.fetch_add(1);
+                    if (value != key) consistent.store(false);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return consistent.load() && factoryCalls.load() == KEY_COUNT &&
+        insertions.load() == KEY_COUNT && map.Size() == KEY_COUNT;
+}
+
+// Register all ConcurrentHashMap tests with the TestRunner
+VA_REGISTER_TEST(ConcurrentHashMapBasics, TestConcurrentHashMapBasics);
+VA_REGISTER_TEST(ConcurrentHashMapInsertOnce, TestConcurrentHashMapInsertOnce);
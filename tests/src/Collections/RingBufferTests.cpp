@@ -0,0 +1,195 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// MPMCRingBuffer / SPSCRingBuffer tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Core/Collections/RingBuffer.hpp>
+
+#include <thread>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Collections;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test single and batch operations of the MPMC ring buffer on one thread
+bool TestMPMCRingBufferBasics()
+{
+    MPMCRingBuffer<int, 8> ring;
+    if (!ring.IsEmptyApprox() || ring.GetCapacity() != 8)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (!ring.TryPush(i)) return false;
+    }
+    if (ring.TryPush(99) || ring.GetSizeApprox() != 8)
+    {
+        return false;
+    }
+
+    int value = -1;
+    if (!ring.TryPop(value) || value != 0)
+    {
+        return false;
+    }
+
+    // Only one cell is free, the batch must be truncated
+    const int batch[4] = {8, 9, 10, 11};
+    if (ring.TryPushBatch(batch, 4) != 1)
+    {
+        return false;
+    }
+
+    int out[16] = {};
+    if (ring.TryPopBatch(out, 16) != 8)
+    {
+        return false;
+    }
+    for (int i = 0; i < 8; ++i)
+    {
+        if (out[i] != i + 1) return false;
+    }
+
+    return !ring.TryPop(value) && ring.IsEmptyApprox();
+}
+
+/// @brief Test that elements left in the buffer are destroyed with it
+bool TestMPMCRingBufferDestruction()
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        MPMCRingBuffer<std::shared_ptr<int>, 4> ring;
+        ring.TryPush(counter);
+        ring.TryPush(counter);
+        if (counter.use_count() != 3)
+        {
+            return false;
+        }
+    }
+    return counter.use_count() == 1;
+}
+
+/// @brief Test concurrent producers/consumers mixing single and batch operations
+bool TestMPMCRingBufferThreadSafety()
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int CONSUMERS = 4;
+    constexpr int ITEMS_PER_PRODUCER = 20000;
+
+    MPMCRingBuffer<uint64_t, 1024> ring;
+    std::atomic<uint64_t> consumedSum{0};
+    std::atomic<int> consumedCount{0};
+
+    VAArray<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        threads.emplace_back(
+            [&ring, p]()
+            {
+                uint64_t batch[16];
+                int next = 0;
+                while (next < ITEMS_PER_PRODUCER)
+                {
+                    if (p % 2 == 0)
+                    {
+                        if (ring.TryPush(static_cast<uint64_t>(next + 1))) ++next;
+                        continue;
+                    }
+
+                    const auto count = std::min(16, ITEMS_PER_PRODUCER - next);
+                    for (int i = 0; i < count; ++i)
+                    {
+                        batch[i] = static_cast<uint64_t>(next + i + 1);
+                    }
+                    next += static_cast<int>(ring.TryPushBatch(batch, count));
+                }
+            });
+    }
+
+    for (int c = 0; c < CONSUMERS; ++c)
+    {
+        threads.emplace_back(
+            [&, c]()
+            {
+                uint64_t batch[16];
+                while (consumedCount.load() < PRODUCERS * ITEMS_PER_PRODUCER)
+                {
+                    size_t count = 0;
+                    if (c % 2 == 0)
+                    {
+                        count = ring.TryPop(batch[0]) ? 1 : 0;
+                    }
+                    else
+                    {
+                        count = ring.TryPopBatch(batch, 16);
+                    }
+
+                    uint64_t sum = 0;
+                    for (size_t i = 0; i < count; ++i) sum += batch[i];
+                    consumedSum.fetch_add(sum);
+                    consumedCount.fetch_add(static_cast<int>(count));
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    constexpr uint64_t EXPECTED_SUM = PRODUCERS *
+        (static_cast<uint64_t>(ITEMS_PER_PRODUCER) * (ITEMS_PER_PRODUCER + 1) / 2);
+    return consumedCount.load() == PRODUCERS * ITEMS_PER_PRODUCER &&
+        consumedSum.load() == EXPECTED_SUM && ring.IsEmptyApprox();
+}
+
+/// @brief Test SPSC FIFO ordering across two threads with batch operations
+bool TestSPSCRingBufferOrdering()
+{
+    constexpr uint32_t ITEM_COUNT = 100000;
+
+    SPSCRingBuffer<uint32_t, 256> ring;
+    std::thread producer(
+        [&ring]()
+        {
+            uint32_t batch[32];
+            uint32_t next = 0;
+            while (next < ITEM_COUNT)
+            {
+                if (next % 3 == 0)
+                {
+                    if (ring.TryPush(next)) ++next;
+                    continue;
+                }
+
+                const auto count = std::min<uint32_t>(32, ITEM_COUNT - next);
+                for (uint32_t i = 0; i < count; ++i) batch[i] = next + i;
+                next += static_cast<uint32_t>(ring.TryPushBatch(batch, count));
+            }
+        });
+
+    bool ordered = true;
+    uint32_t expected = 0;
+    uint32_t batch[32];
+    while (expected < ITEM_COUNT)
+    {
+        const auto count = ring.TryPopBatch(batch, 32);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ordered &= batch[i] == expected++;
+        }
+    }
+    producer.join();
+
+    return ordered && ring.IsEmptyApprox() && ring.Front() == nullptr;
+}
+
+// Register all RingBuffer tests with the TestRunner
+VA_REGISTER_TEST(MPMCRingBufferBasics, TestMPMCRingBufferBasics);
+VA_REGISTER_TEST(MPMCRingBufferDestruction, TestMPMCRingBufferDestruction);
+VA_REGISTER_TEST(MPMCRingBufferThreadSafety, TestMPMCRingBufferThreadSafety);
+VA_REGISTER_TEST(SPSCRingBufferOrdering, TestSPSCRingBufferOrdering);
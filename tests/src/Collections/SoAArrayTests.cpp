@@ -0,0 +1,180 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// SoAArray tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Core/Collections/SoAArray.hpp>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Collections;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    struct Packed3
+    {
+        float x, y, z;
+    };
+
+    template <typename T>
+    bool IsColumnAligned(const T* column)
+    {
+        return reinterpret_cast<uintptr_t>(column) % SoAArray<float>::COLUMN_ALIGNMENT == 0;
+    }
+} // namespace
+
+/// @brief Test element insertion, access and removal
+bool TestSoAArrayBasics()
+{
+    SoAArray<int, float, Packed3> soa;
+    if (!soa.IsEmpty() || soa.Size() != 0)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        soa.PushBack(i, static_cast<float>(i) * 0.5f, Packed3{1.0f, 2.0f, static_cast<float>(i)});
+    }
+
+    if (soa.Size() != 100 || soa.Capacity() < 100 ||
+        soa.Capacity() % SoAArray<int>::PADDING_ELEMENTS != 0)
+    {
+        return false;
+    }
+
+    auto [id, value, packed] = soa[42];
+    if (id != 42 || value != 21.0f || packed.z != 42.0f)
+    {
+        return false;
+    }
+
+    // References returned by operator[] write through to the columns
+    value = -1.0f;
+    if (soa.Get<1>(42) != -1.0f)
+    {
+        return false;
+    }
+
+    soa.SwapRemove(0);
+    if (soa.Size() != 99 || soa.Get<0>(0) != 99)
+    {
+        return false;
+    }
+
+    soa.PopBack();
+    soa.Resize(120);
+    if (soa.Size() != 120 || soa.Get<0>(98) != 0 || soa.Get<1>(119) != 0.0f)
+    {
+        return false;
+    }
+
+    soa.Clear();
+    return soa.IsEmpty() && soa.Capacity() >= 120;
+}
+
+/// @brief Test column alignment, padding and span access
+bool TestSoAArrayColumns()
+{
+    SoAArray<float, double, Packed3> soa(37);
+    if (!IsColumnAligned(soa.Data<0>()) || !IsColumnAligned(soa.Data<1>()) ||
+        !IsColumnAligned(soa.Data<2>()))
+    {
+        return false;
+    }
+
+    auto column = soa.Column<0>();
+    auto padded = soa.PaddedColumn<0>();
+    if (column.size() != 37 || padded.size() != 48 || padded.data() != column.data())
+    {
+        return false;
+    }
+
+    // Padding is value-initialized so full-width loops are safe
+    for (size_t i = column.size(); i < padded.size(); ++i)
+    {
+        if (padded[i] != 0.0f) return false;
+    }
+
+    for (size_t i = 0; i < column.size(); ++i)
+    {
+        column[i] = static_cast<float>(i);
+    }
+
+    // Growth keeps existing data and alignment
+    soa.Reserve(1000);
+    if (!IsColumnAligned(soa.Data<2>()) || soa.Get<0>(36) != 36.0f)
+    {
+        return false;
+    }
+
+    // Copies are deep
+    auto copy = soa;
+    copy.Get<0>(0) = 100.0f;
+    return soa.Get<0>(0) == 0.0f && copy.Size() == soa.Size();
+}
+
+/// @brief Test zipped iteration over all and over selected columns
+bool TestSoAArrayZip()
+{
+    SoAArray<float, float, int> soa;
+    for (int i = 0; i < 10; ++i)
+    {
+        soa.PushBack(static_cast<float>(i), 0.0f, i * 2);
+    }
+
+    for (auto [a, b, c] : soa)
+    {
+        b = a + static_cast<float>(c);
+    }
+
+    float sum = 0.0f;
+    for (auto [a, b] : soa.Zip<0, 1>())
+    {
+        sum += b - a;
+    }
+
+    // sum of c = 2 * (0 + ... + 9)
+    if (sum != 90.0f)
+    {
+        return false;
+    }
+
+    const auto& constSoa = soa;
+    size_t count = 0;
+    for (auto [c] : constSoa.Zip<2>())
+    {
+        count += c >= 0 ? 1 : 0;
+    }
+
+    return count == 10 && std::distance(soa.begin(), soa.end()) == 10;
+}
+
+/// @brief Test appending an element of the array itself while the columns have to grow
+bool TestSoAArraySelfPushBack()
+{
+    SoAArray<int, Packed3> soa;
+    soa.PushBack(7, Packed3{1.0f, 2.0f, 3.0f});
+    while (soa.Size() < soa.Capacity())
+    {
+        soa.PushBack(soa.Get<0>(0) + static_cast<int>(soa.Size()), soa.Get<1>(0));
+    }
+
+    const auto capacity = soa.Capacity();
+    soa.PushBack(soa.Get<0>(0), soa.Get<1>(0));
+    if (soa.Capacity() == capacity || soa.Size() != capacity + 1)
+    {
+        return false;
+    }
+
+    const auto& [id, packed] = soa[capacity];
+    return id == 7 && packed.x == 1.0f && packed.y == 2.0f && packed.z == 3.0f;
+}
+
+// Register all SoAArray tests with the TestRunner
+VA_REGISTER_TEST(SoAArrayBasics, TestSoAArrayBasics);
+VA_REGISTER_TEST(SoAArrayColumns, TestSoAArrayColumns);
+VA_REGISTER_TEST(SoAArrayZip, TestSoAArrayZip);
+VA_REGISTER_TEST(SoAArraySelfPushBack, TestSoAArraySelfPushBack);
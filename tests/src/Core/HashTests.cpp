@@ -0,0 +1,45 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// XXHash64 tests integrated with TestRunner
+//
+#include "TestRunner.hpp"
+#include <Core/Hash.hpp>
+
+#include <bit>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test the hashes of the reference implementation, below and above one 32-byte stripe
+bool TestXXHash64Reference()
+{
+    VAArray<uint8_t> bytes(1000);
+    for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = static_cast<uint8_t>(i * 31);
+
+    return XXHash64::Hash("") == 0xEF46DB3751D8E999ull &&
+        XXHash64::Hash("a") == 0xD24EC4F1A98C6E5Bull &&
+        XXHash64::Hash("abc") == 0x44BC2CF5AD770999ull &&
+        XXHash64::Hash("abc", 7) == 0x9E755206156676D7ull &&
+        XXHash64::Hash("Nobody inspects the spammish repetition") == 0xFBCEA83C8A378BF1ull &&
+        XXHash64::Hash("The quick brown fox jumps over the lazy dog, 12345", 7) ==
+        0x9E9D75FF7B62950Full &&
+        XXHash64::Hash(bytes) == 0xB1280F6428126532ull;
+}
+
+/// @brief Test that a value hashes as its bytes and that the seed chains hashes
+bool TestXXHash64Values()
+{
+    constexpr uint32_t value = 0x00636261; // "abc\0" in little endian
+    const char text[] = "abc";
+    const auto bytes = XXHash64::Hash({reinterpret_cast<const uint8_t*>(text), sizeof(text)});
+
+    return (std::endian::native != std::endian::little || XXHash64::HashValue(value) == bytes) &&
+        XXHash64::HashValue(1.0f, XXHash64::HashValue(2)) !=
+        XXHash64::HashValue(2, XXHash64::HashValue(1.0f));
+}
+
+// Register all XXHash64 tests with the TestRunner
+VA_REGISTER_TEST(XXHash64Reference, TestXXHash64Reference);
+VA_REGISTER_TEST(XXHash64Values, TestXXHash64Values);
@@ -0,0 +1,147 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// MemoryTracker tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Core/Memory/MemoryTracker.hpp>
+#include <Core/Memory/PoolAllocator.hpp>
+
+#include <thread>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Memory;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test current/peak bytes and allocation counts of a tag
+bool TestMemoryTrackerCounters()
+{
+    MemoryTracker tracker;
+    tracker.RecordAllocation(MemoryTag::Mesh, 1000);
+    tracker.RecordAllocation(MemoryTag::Mesh, 500);
+    tracker.RecordAllocation(MemoryTag::Texture, 200);
+    tracker.RecordDeallocation(MemoryTag::Mesh, 1000);
+
+    const auto mesh = tracker.GetStats(MemoryTag::Mesh);
+    if (mesh.currentBytes != 500 || mesh.peakBytes != 1500 || mesh.currentAllocations != 1 ||
+        mesh.totalAllocations != 2)
+    {
+        return false;
+    }
+
+    const auto snapshot = tracker.GetSnapshot();
+    if (snapshot.totalCurrentBytes != 700 || snapshot.totalPeakBytes != 1700 ||
+        snapshot[MemoryTag::Texture].currentBytes != 200 ||
+        snapshot[MemoryTag::Jobs].totalAllocations != 0)
+    {
+        return false;
+    }
+
+    tracker.ResetPeaks();
+    return tracker.GetStats(MemoryTag::Mesh).peakBytes == 500;
+}
+
+/// @brief Test soft budgets, which report overruns without failing allocations
+bool TestMemoryTrackerBudgets()
+{
+    MemoryTracker tracker;
+    tracker.SetBudget(MemoryTag::Loader, 1024);
+    if (tracker.GetBudget(MemoryTag::Loader) != 1024 || tracker.GetBudget(MemoryTag::Jobs) != 0)
+    {
+        return false;
+    }
+
+    tracker.RecordAllocation(MemoryTag::Loader, 1000);
+    if (tracker.GetStats(MemoryTag::Loader).IsOverBudget())
+    {
+        return false;
+    }
+
+    tracker.RecordAllocation(MemoryTag::Loader, 1000);
+    if (!tracker.GetSnapshot()[MemoryTag::Loader].IsOverBudget())
+    {
+        return false;
+    }
+
+    tracker.RecordDeallocation(MemoryTag::Loader, 1000);
+    return !tracker.GetStats(MemoryTag::Loader).IsOverBudget();
+}
+
+/// @brief Test concurrent recording from several threads
+bool TestMemoryTrackerThreadSafety()
+{
+    constexpr int THREAD_COUNT = 4;
+    constexpr int ALLOCATIONS_PER_THREAD = 10000;
+
+    MemoryTracker tracker;
+    VAArray<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back(
+            [&tracker]()
+            {
+                for (int i = 0; i < ALLOCATIONS_PER_THREAD; ++i)
+                {
+                    tracker.RecordAllocation(MemoryTag::Jobs, 64);
+                    tracker.RecordDeallocation(MemoryTag::Jobs, 64);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto stats = tracker.GetStats(MemoryTag::Jobs);
+    return stats.currentBytes == 0 && stats.currentAllocations == 0 &&
+        stats.totalAllocations == THREAD_COUNT * ALLOCATIONS_PER_THREAD &&
+        stats.peakBytes >= 64 && stats.peakBytes <= THREAD_COUNT * 64;
+}
+
+/// @brief Test TrackedMemory and tagged pool blocks against the engine tracker
+bool TestTrackedMemory()
+{
+    auto& tracker = GetMemoryTracker();
+    const auto before = tracker.GetSnapshot();
+
+    {
+        TrackedMemory<MemoryTag::Render> tracked(100);
+        auto copy = tracked;
+        auto moved = std::move(tracked);
+        moved.Update(300);
+
+        auto* block = GetPoolAllocator().Allocate(48, alignof(std::max_align_t), MemoryTag::Render);
+        const auto during = tracker.GetStats(MemoryTag::Render);
+        GetPoolAllocator().Deallocate(block);
+
+        if constexpr (MEMORY_TRACKING_ENABLED)
+        {
+            // 100 (copy) + 300 (moved) + 64 (48 bytes rounded up to its size class)
+            if (during.currentBytes != before[MemoryTag::Render].currentBytes + 464 ||
+                during.currentAllocations != before[MemoryTag::Render].currentAllocations + 3 ||
+                copy.GetBytes() != 100 || tracked.GetBytes() != 0)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (during.totalAllocations != before[MemoryTag::Render].totalAllocations ||
+                moved.GetBytes() != 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    const auto after = tracker.GetStats(MemoryTag::Render);
+    return after.currentBytes == before[MemoryTag::Render].currentBytes &&
+        after.currentAllocations == before[MemoryTag::Render].currentAllocations;
+}
+
+// Register all MemoryTracker tests with the TestRunner
+VA_REGISTER_TEST(MemoryTrackerCounters, TestMemoryTrackerCounters);
+VA_REGISTER_TEST(MemoryTrackerBudgets, TestMemoryTrackerBudgets);
+VA_REGISTER_TEST(MemoryTrackerThreadSafety, TestMemoryTrackerThreadSafety);
+VA_REGISTER_TEST(TrackedMemory, TestTrackedMemory);
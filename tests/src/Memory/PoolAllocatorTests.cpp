@@ -0,0 +1,200 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// PoolAllocator tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Core/Memory/PoolAllocator.hpp>
+
+#include <thread>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Memory;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief Polymorphic base used to check release through a base pointer
+    struct PoolTestBase
+    {
+        virtual ~PoolTestBase() = default;
+        int baseValue = 0;
+    };
+
+    /// @brief Unrelated base placed first so the polymorphic base is not at offset 0
+    struct PoolTestPadding
+    {
+        double padding[3] = {};
+    };
+
+    struct PoolTestDerived final : PoolTestPadding, PoolTestBase
+    {
+        explicit PoolTestDerived(int* destroyed)
+            : m_Destroyed(destroyed)
+        {
+        }
+
+        ~PoolTestDerived() override { ++*m_Destroyed; }
+
+        int* m_Destroyed;
+        std::string name = "derived";
+    };
+} // namespace
+
+/// @brief Test size-class selection and basic allocate/deallocate bookkeeping
+bool TestPoolAllocatorBasics()
+{
+    if (PoolAllocator::GetSizeClassIndex(1) != 0 ||
+        PoolAllocator::GetSizeClassIndex(32) != 0 ||
+        PoolAllocator::GetSizeClassIndex(33) != 1 ||
+        PoolAllocator::GetSizeClassIndex(4096) != PoolAllocator::SIZE_CLASS_COUNT - 1 ||
+        PoolAllocator::GetSizeClassIndex(4097) != PoolAllocator::LARGE_POOL_INDEX)
+    {
+        return false;
+    }
+
+    auto& allocator = GetPoolAllocator();
+    const auto poolIndex = PoolAllocator::GetSizeClassIndex(200);
+    const auto before = allocator.GetStats(poolIndex);
+
+    VAArray<void*> blocks;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto* block = allocator.Allocate(200);
+        if (!block || reinterpret_cast<uintptr_t>(block) % PoolAllocator::POOL_ALIGNMENT != 0)
+        {
+            return false;
+        }
+        std::memset(block, i, 200);
+        blocks.push_back(block);
+    }
+
+    // Blocks must not overlap
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(blocks[i]);
+        if (bytes[0] != static_cast<uint8_t>(i) || bytes[199] != static_cast<uint8_t>(i))
+        {
+            return false;
+        }
+    }
+
+    const auto during = allocator.GetStats(poolIndex);
+    if (during.liveBlocks != before.liveBlocks + 100 || during.peakLiveBlocks < 100)
+    {
+        return false;
+    }
+
+    for (auto* block : blocks)
+    {
+        allocator.Deallocate(block);
+    }
+
+    const auto after = allocator.GetStats(poolIndex);
+    return after.liveBlocks == before.liveBlocks && after.threadCacheHits > before.threadCacheHits;
+}
+
+/// @brief Test large and over-aligned requests falling back to the system heap
+bool TestPoolAllocatorLargeBlocks()
+{
+    auto& allocator = GetPoolAllocator();
+    const auto before = allocator.GetStats(PoolAllocator::LARGE_POOL_INDEX);
+
+    auto* large = allocator.Allocate(64 * 1024);
+    auto* aligned = allocator.Allocate(48, 64);
+    if (!large || !aligned || reinterpret_cast<uintptr_t>(aligned) % 64 != 0)
+    {
+        return false;
+    }
+
+    const auto during = allocator.GetStats(PoolAllocator::LARGE_POOL_INDEX);
+    if (during.liveBlocks != before.liveBlocks + 2)
+    {
+        return false;
+    }
+
+    allocator.Deallocate(large);
+    allocator.Deallocate(aligned);
+    allocator.Deallocate(nullptr);
+
+    return allocator.GetStats(PoolAllocator::LARGE_POOL_INDEX).liveBlocks == before.liveBlocks;
+}
+
+/// @brief Test PoolNew/PoolPtr with a derived object released through its base
+bool TestPoolAllocatorTypedHelpers()
+{
+    int destroyed = 0;
+    {
+        PoolPtr<PoolTestBase> object(PoolNew<PoolTestDerived>(&destroyed));
+        object->baseValue = 42;
+        if (object->baseValue != 42)
+        {
+            return false;
+        }
+    }
+
+    return destroyed == 1;
+}
+
+/// @brief Test concurrent allocation, including blocks released by another thread
+bool TestPoolAllocatorThreadSafety()
+{
+    constexpr int THREAD_COUNT = 4;
+    constexpr int ALLOCATIONS_PER_THREAD = 2000;
+
+    auto& allocator = GetPoolAllocator();
+    const auto before = allocator.GetAllStats();
+
+    std::array<VAArray<void*>, THREAD_COUNT> threadBlocks;
+    VAArray<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                for (int i = 0; i < ALLOCATIONS_PER_THREAD; ++i)
+                {
+                    const auto size = static_cast<size_t>(16 + (i * 37) % 3000);
+                    auto* block = allocator.Allocate(size);
+                    *static_cast<int*>(block) = t;
+                    threadBlocks[t].push_back(block);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Release everything from this thread, blocks join this thread's cache
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        for (auto* block : threadBlocks[t])
+        {
+            if (*static_cast<int*>(block) != t)
+            {
+                return false;
+            }
+            allocator.Deallocate(block);
+        }
+    }
+    allocator.FlushThreadCache();
+
+    const auto after = allocator.GetAllStats();
+    for (size_t i = 0; i < after.size(); ++i)
+    {
+        if (after[i].liveBlocks != before[i].liveBlocks)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Register all PoolAllocator tests with the TestRunner
+VA_REGISTER_TEST(PoolAllocatorBasics, TestPoolAllocatorBasics);
+VA_REGISTER_TEST(PoolAllocatorLargeBlocks, TestPoolAllocatorLargeBlocks);
+VA_REGISTER_TEST(PoolAllocatorTypedHelpers, TestPoolAllocatorTypedHelpers);
+VA_REGISTER_TEST(PoolAllocatorThreadSafety, TestPoolAllocatorThreadSafety);
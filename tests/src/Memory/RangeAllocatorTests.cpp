@@ -0,0 +1,84 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// RangeAllocator tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Core/Memory/RangeAllocator.hpp>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Memory;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test that allocation picks the smallest free block that fits
+bool TestRangeAllocatorBestFit()
+{
+    RangeAllocator allocator(100);
+    const auto a = allocator.Allocate(10);
+    const auto b = allocator.Allocate(30);
+    const auto c = allocator.Allocate(10);
+    const auto d = allocator.Allocate(20);
+    if (a != 0 || b != 10 || c != 40 || d != 50) return false;
+
+    // Free blocks of 10, 30 and the 30 trailing elements
+    allocator.Free(a, 10);
+    allocator.Free(b, 30);
+    if (allocator.GetFreeBlockCount() != 2) return false;
+    allocator.Free(d, 20);
+    if (allocator.GetFreeBlockCount() != 2 || allocator.GetLargestFreeBlock() != 50) return false;
+
+    // 40 free elements before c, 50 after it: the smaller block wins
+    const auto e = allocator.Allocate(25);
+    const auto f = allocator.Allocate(15);
+    return e == 0 && f == 25 && allocator.GetUsed() == 50 &&
+        allocator.Allocate(51) == RangeAllocator::INVALID_OFFSET;
+}
+
+/// @brief Test that released ranges merge with both their free neighbours
+bool TestRangeAllocatorCoalesce()
+{
+    RangeAllocator allocator(40);
+    const auto a = allocator.Allocate(10);
+    const auto b = allocator.Allocate(10);
+    const auto c = allocator.Allocate(10);
+    const auto d = allocator.Allocate(10);
+    if (allocator.Allocate(1) != RangeAllocator::INVALID_OFFSET) return false;
+
+    allocator.Free(a, 10);
+    allocator.Free(c, 10);
+    if (allocator.GetFreeBlockCount() != 2 || allocator.GetLargestFreeBlock() != 10) return false;
+
+    // Bridges the two free blocks, then extends the result up to the end
+    allocator.Free(b, 10);
+    if (allocator.GetFreeBlockCount() != 1 || allocator.GetLargestFreeBlock() != 30) return false;
+    allocator.Free(d, 10);
+    return allocator.GetFreeBlockCount() == 1 && allocator.GetLargestFreeBlock() == 40 &&
+        allocator.GetUsed() == 0;
+}
+
+/// @brief Test that growing extends the trailing free block or appends a new one
+bool TestRangeAllocatorGrow()
+{
+    RangeAllocator allocator;
+    if (allocator.Allocate(1) != RangeAllocator::INVALID_OFFSET) return false;
+
+    allocator.Grow(16);
+    const auto a = allocator.Allocate(8);
+    allocator.Grow(32);
+    if (allocator.GetFreeBlockCount() != 1 || allocator.GetLargestFreeBlock() != 24) return false;
+
+    // Full allocator, the new elements form their own block
+    const auto b = allocator.Allocate(24);
+    allocator.Grow(48);
+    if (a != 0 || b != 8 || allocator.GetLargestFreeBlock() != 16) return false;
+
+    allocator.Free(b, 24);
+    return allocator.GetCapacity() == 48 && allocator.GetFreeBlockCount() == 1 &&
+        allocator.Allocate(40) == 8;
+}
+
+// Register all RangeAllocator tests with the TestRunner
+VA_REGISTER_TEST(RangeAllocatorBestFit, TestRangeAllocatorBestFit);
+VA_REGISTER_TEST(RangeAllocatorCoalesce, TestRangeAllocatorCoalesce);
+VA_REGISTER_TEST(RangeAllocatorGrow, TestRangeAllocatorGrow);
@@ -0,0 +1,149 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// AssetPack / VirtualFileSystem tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Platform/FileSystem/VirtualFileSystem.hpp>
+
+#include <cstring>
+#include <filesystem>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Platform;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    const std::filesystem::path& GetTestDirectory()
+    {
+        static const auto directory = std::filesystem::temp_directory_path() / "va_pack_assets";
+        return directory;
+    }
+
+    VAArray<uint8_t> Pattern(const size_t size, const uint8_t period)
+    {
+        VAArray<uint8_t> bytes(size);
+        for (size_t i = 0; i < size; ++i) bytes[i] = static_cast<uint8_t>(i % period);
+        return bytes;
+    }
+
+    void WriteFile(const std::filesystem::path& path, const VAArray<uint8_t>& bytes)
+    {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    /// @brief Directory of a few nested files, returns the path of its pack
+    std::string BuildTestAssets()
+    {
+        const auto& directory = GetTestDirectory();
+        std::filesystem::remove_all(directory);
+        WriteFile(directory / "materials" / "Wall.yaml", Pattern(100, 7));
+        WriteFile(directory / "meshes" / "wall.vam", Pattern(5000, 13));
+        WriteFile(directory / "textures" / "wall.png", Pattern(3, 3));
+        WriteFile(directory / "shaders" / "Wall.vert.hlsl", Pattern(10, 10));
+        WriteFile(directory / "empty.bin", {});
+        return directory.string() + ASSET_PACK_EXTENSION;
+    }
+
+    bool HasContent(const std::shared_ptr<MappedFile>& file, const VAArray<uint8_t>& bytes)
+    {
+        return file && file->GetSize() == bytes.size() &&
+            std::memcmp(file->GetBytes().data(), bytes.data(), bytes.size()) == 0;
+    }
+} // namespace
+
+/// @brief Test that every entry is found by name, aligned, and restored stored or compressed
+bool TestAssetPackRoundTrip()
+{
+    const auto packPath = BuildTestAssets();
+
+    bool valid = true;
+    for (const int level : {0, 1, 9})
+    {
+        AssetPackBuildOptions options;
+        options.compressionLevel = level;
+        options.alignment = 64;
+        options.excludedExtensions = {".hlsl"};
+        const auto result = AssetPack::Build(GetTestDirectory().string(), packPath, options);
+        valid = valid && result.success && result.entryCount == 4 &&
+            (level == 0) == (result.compressedCount == 0);
+
+        const auto pack = AssetPack::Open(packPath);
+        if (!pack) return false;
+        for (const auto& entry : pack->GetEntries())
+        {
+            valid = valid && entry.offset % 64 == 0 && entry.alignmentLog2 == 6 &&
+                pack->Find(pack->GetName(entry)) == &entry;
+        }
+
+        valid = valid && HasContent(pack->OpenFile("materials/Wall.yaml"), Pattern(100, 7)) &&
+            HasContent(pack->OpenFile("meshes/wall.vam"), Pattern(5000, 13)) &&
+            HasContent(pack->OpenFile("textures/wall.png"), Pattern(3, 3)) &&
+            HasContent(pack->OpenFile("empty.bin"), {}) &&
+            !pack->OpenFile("shaders/Wall.vert.hlsl") && !pack->OpenFile("meshes/Wall.vam");
+    }
+
+    std::filesystem::remove(packPath);
+    std::filesystem::remove_all(GetTestDirectory());
+    return valid;
+}
+
+/// @brief Test that a pack with a damaged table of contents is not opened
+bool TestAssetPackCorrupted()
+{
+    const auto packPath = BuildTestAssets();
+    if (!AssetPack::Build(GetTestDirectory().string(), packPath).success) return false;
+
+    {
+        std::fstream file(packPath, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(sizeof(AssetPackHeader) + 8);
+        file.put('\x7F');
+    }
+    const bool rejected = !AssetPack::Open(packPath);
+
+    std::filesystem::remove(packPath);
+    std::filesystem::remove_all(GetTestDirectory());
+    return rejected;
+}
+
+/// @brief Test that a mounted pack serves its directory and loose files fill the gaps
+bool TestVirtualFileSystemMount()
+{
+    const auto packPath = BuildTestAssets();
+    if (!AssetPack::Build(GetTestDirectory().string(), packPath).success) return false;
+
+    // Once mounted, the packed files no longer need to exist on the disk
+    const auto directory = GetTestDirectory().string() + "/";
+    std::filesystem::remove(GetTestDirectory() / "materials" / "Wall.yaml");
+    WriteFile(GetTestDirectory() / "loose.txt", Pattern(20, 5));
+
+    bool valid = !VirtualFileSystem::Exists(directory + "materials/Wall.yaml") &&
+        VirtualFileSystem::MountIfPresent(directory);
+
+    const auto packed = VirtualFileSystem::Open(directory + "textures/../materials/Wall.yaml");
+    valid = valid && HasContent(packed, Pattern(100, 7)) && !packed->IsMapped() &&
+        VirtualFileSystem::Exists(directory + "materials/Wall.yaml") &&
+        VirtualFileSystem::ReadText(directory + "materials/Wall.yaml")->size() == 100 &&
+        HasContent(VirtualFileSystem::Open(directory + "loose.txt"), Pattern(20, 5)) &&
+        !VirtualFileSystem::Exists(directory + "missing.txt") &&
+        !VirtualFileSystem::ReadText(directory + "missing.txt");
+
+    // Files opened from the pack outlive the mount
+    VirtualFileSystem::Unmount(directory);
+    valid = valid && !VirtualFileSystem::Exists(directory + "materials/Wall.yaml") &&
+        HasContent(packed, Pattern(100, 7));
+
+    VirtualFileSystem::UnmountAll();
+    std::filesystem::remove(packPath);
+    std::filesystem::remove_all(GetTestDirectory());
+    return valid;
+}
+
+// Register all AssetPack tests with the TestRunner
+VA_REGISTER_TEST(AssetPackRoundTrip, TestAssetPackRoundTrip);
+VA_REGISTER_TEST(AssetPackCorrupted, TestAssetPackCorrupted);
+VA_REGISTER_TEST(VirtualFileSystemMount, TestVirtualFileSystemMount);
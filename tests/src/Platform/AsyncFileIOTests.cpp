@@ -0,0 +1,150 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// AsyncFileIO tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Platform/FileSystem/AsyncFileIO.hpp>
+#include <Systems/Jobs/JobSystem.hpp>
+
+#include <cstring>
+#include <filesystem>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Platform;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    VAArray<uint8_t> WriteFile(const std::filesystem::path& path, const size_t size)
+    {
+        VAArray<uint8_t> content(size);
+        for (size_t i = 0; i < content.size(); ++i) content[i] = static_cast<uint8_t>(i * 131 + 7);
+
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(content.data()), content.size());
+        return content;
+    }
+
+    bool SameBytes(const std::shared_ptr<MappedFile>& file, const VAArray<uint8_t>& content)
+    {
+        return file && file->GetSize() == content.size() &&
+            std::memcmp(file->GetBytes().data(), content.data(), content.size()) == 0;
+    }
+
+    /// @brief Read files spanning several segments, an empty one and a missing one
+    bool ReadWith(const AsyncFileIOConfig& config)
+    {
+        const auto root = std::filesystem::temp_directory_path() / "va_async_file_io";
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+
+        // Not a multiple of the segment size nor of the alignment
+        const auto large = WriteFile(root / "large.bin", 3 * 64 * 1024 + 123);
+        const auto small = WriteFile(root / "small.bin", 100);
+        const auto empty = WriteFile(root / "empty.bin", 0);
+
+        bool valid;
+        {
+            AsyncFileIO io(config);
+            valid = SameBytes(io.Read((root / "large.bin").string()), large) &&
+                SameBytes(io.Read((root / "empty.bin").string()), empty) &&
+                !io.Read((root / "missing.bin").string());
+
+            // Without a job system the callbacks run on the I/O threads
+            std::mutex mutex;
+            VAArray<std::shared_ptr<MappedFile>> files(2);
+            AsyncFileIO::ReadRequest requests[] = {
+                {
+                    (root / "small.bin").string(),
+                    [&](auto file) { std::lock_guard lock(mutex); files[0] = std::move(file); }
+                },
+                {
+                    (root / "large.bin").string(),
+                    [&](auto file) { std::lock_guard lock(mutex); files[1] = std::move(file); }
+                }
+            };
+            const auto done = io.ReadBatch(requests);
+            while (true)
+            {
+                std::lock_guard lock(mutex);
+                if (files[0] && files[1]) break;
+            }
+
+            const auto stats = io.GetStats();
+            valid = valid && !done.IsValid() && SameBytes(files[0], small) &&
+                SameBytes(files[1], large) && stats.fileCount == 4 && stats.failedCount == 1 &&
+                stats.bytesRead == 2 * large.size() + small.size() && stats.queueDepth == 0 &&
+                stats.maxQueueDepth >= 4;
+        }
+
+        std::filesystem::remove_all(root);
+        return valid;
+    }
+} // namespace
+
+/// @brief Test that the default backend reads the exact bytes of every file
+bool TestAsyncFileIORead()
+{
+    AsyncFileIOConfig config;
+    config.segmentSize = 64 * 1024;
+    return ReadWith(config);
+}
+
+/// @brief Test that the thread pool reads the same bytes, the fallback of io_uring
+bool TestAsyncFileIOThreadPool()
+{
+    AsyncFileIOConfig config;
+    config.segmentSize = 64 * 1024;
+    config.useIoUring = false;
+    return ReadWith(config);
+}
+
+/// @brief Test that direct I/O, or its fallback where refused, reads the same bytes
+bool TestAsyncFileIODirect()
+{
+    AsyncFileIOConfig config;
+    config.segmentSize = 64 * 1024;
+    config.directThreshold = 1;
+    return ReadWith(config);
+}
+
+/// @brief Test that batch callbacks run as jobs and signal the returned sync point
+bool TestAsyncFileIOJobs()
+{
+    const auto path = std::filesystem::temp_directory_path() / "va_async_file_io_jobs.bin";
+    const auto content = WriteFile(path, 200000);
+
+    const auto ownedJobSystem = !Jobs::g_JobSystem;
+    if (ownedJobSystem) Jobs::g_JobSystem = std::make_unique<Jobs::JobSystem>(2);
+
+    bool valid;
+    {
+        AsyncFileIO io;
+        std::atomic<uint32_t> matching{0};
+        VAArray<AsyncFileIO::ReadRequest> requests;
+        for (int i = 0; i < 8; ++i)
+        {
+            requests.push_back({
+                path.string(),
+                [&](const auto& file) { if (SameBytes(file, content)) ++matching; }
+            });
+        }
+
+        const auto done = io.ReadBatch(requests);
+        Jobs::g_JobSystem->WaitFor(done);
+        valid = done.IsValid() && matching == requests.size() &&
+            SameBytes(io.Read(path.string()), content);
+    }
+
+    if (ownedJobSystem) Jobs::g_JobSystem.reset();
+    std::filesystem::remove(path);
+    return valid;
+}
+
+// Register all AsyncFileIO tests with the TestRunner
+VA_REGISTER_TEST(AsyncFileIORead, TestAsyncFileIORead);
+VA_REGISTER_TEST(AsyncFileIOThreadPool, TestAsyncFileIOThreadPool);
+VA_REGISTER_TEST(AsyncFileIODirect, TestAsyncFileIODirect);
+VA_REGISTER_TEST(AsyncFileIOJobs, TestAsyncFileIOJobs);
@@ -0,0 +1,53 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// MappedFile tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Platform/FileSystem/MappedFile.hpp>
+
+#include <cstring>
+#include <filesystem>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Platform;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test that both modes expose the exact bytes of the file
+bool TestMappedFileModes()
+{
+    const auto path = (std::filesystem::temp_directory_path() / "va_mapped_file.bin").string();
+    VAArray<uint8_t> content(10000);
+    for (size_t i = 0; i < content.size(); ++i) content[i] = static_cast<uint8_t>(i * 31);
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(content.data()), content.size());
+    }
+
+    bool valid;
+    {
+        const auto mapped = MappedFile::Open(path);
+        const auto read = MappedFile::Open(path, MappedFile::Mode::Read);
+        valid = mapped && read && !read->IsMapped() && mapped->GetSize() == content.size() &&
+            read->GetSize() == content.size() &&
+            std::memcmp(mapped->GetBytes().data(), content.data(), content.size()) == 0 &&
+            std::memcmp(read->GetBytes().data(), content.data(), content.size()) == 0;
+    }
+
+    // Windows refuses to remove a file that is still mapped
+    std::filesystem::remove(path);
+    return valid;
+}
+
+/// @brief Test that a missing file cannot be opened in either mode
+bool TestMappedFileMissing()
+{
+    const auto path = (std::filesystem::temp_directory_path() / "va_missing_file.bin").string();
+    std::filesystem::remove(path);
+    return !MappedFile::Open(path) && !MappedFile::Open(path, MappedFile::Mode::Read);
+}
+
+// Register all MappedFile tests with the TestRunner
+VA_REGISTER_TEST(MappedFileModes, TestMappedFileModes);
+VA_REGISTER_TEST(MappedFileMissing, TestMappedFileMissing);
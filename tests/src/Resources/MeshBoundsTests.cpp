@@ -0,0 +1,117 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// Bounds and MeshData bounds tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include "TestMeshes.hpp"
+#include <Core/Math/Bounds.hpp>
+#include <Resources/MeshData.hpp>
+
+#include <cmath>
+#include <random>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test the SIMD kernel against a scalar reference, on packed and strided points
+bool TestBoundsFromPoints()
+{
+    // Packed points: the last point ends the allocation, vector loads must not overrun it
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    for (const size_t count : {1u, 2u, 3u, 17u, 1000u})
+    {
+        auto points = std::make_unique<float[]>(count * 3);
+        float min[3] = {1e9f, 1e9f, 1e9f};
+        float max[3] = {-1e9f, -1e9f, -1e9f};
+        for (size_t i = 0; i < count * 3; ++i)
+        {
+            points[i] = distribution(rng);
+            min[i % 3] = std::min(min[i % 3], points[i]);
+            max[i % 3] = std::max(max[i % 3], points[i]);
+        }
+
+        const auto bounds = Math::Bounds::FromPoints(points.get(), count, 3 * sizeof(float));
+        if (!bounds.IsValid() || !NearlyEqual(bounds.min, Math::Vec3(min[0], min[1], min[2])) ||
+            !NearlyEqual(bounds.max, Math::Vec3(max[0], max[1], max[2])))
+        {
+            return false;
+        }
+
+        // Every point lies in the sphere and at least one lies on it
+        float farthest = 0.0f;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto offset = Math::Vec3(points[i * 3], points[i * 3 + 1], points[i * 3 + 2]) -
+                bounds.center;
+            farthest = std::max(farthest, std::sqrt(Math::Vec3::Dot(offset, offset)));
+        }
+        if (!NearlyEqual(farthest, bounds.radius))
+        {
+            return false;
+        }
+    }
+
+    // Empty input gives empty bounds
+    return !Math::Bounds::FromPoints(nullptr, 0, 12).IsValid();
+}
+
+/// @brief Test merging boxes and spheres
+bool TestBoundsMerge()
+{
+    const float a[] = {0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f};
+    const float b[] = {10.0f, 0.0f, 0.0f, 12.0f, 0.0f, 0.0f};
+    const auto boundsA = Math::Bounds::FromPoints(a, 2, 3 * sizeof(float));
+    const auto boundsB = Math::Bounds::FromPoints(b, 2, 3 * sizeof(float));
+
+    const auto merged = Math::Bounds::Merge(boundsA, boundsB);
+    if (!NearlyEqual(merged.min, Math::Vec3(0.0f, 0.0f, 0.0f)) ||
+        !NearlyEqual(merged.max, Math::Vec3(12.0f, 0.0f, 0.0f)) ||
+        !NearlyEqual(merged.center, Math::Vec3(6.0f, 0.0f, 0.0f)) ||
+        !NearlyEqual(merged.radius, 6.0f))
+    {
+        return false;
+    }
+
+    // Empty bounds are the identity of Merge, a contained sphere is absorbed
+    const auto identity = Math::Bounds::Merge(Math::Bounds{}, boundsA);
+    const auto absorbed = Math::Bounds::Merge(merged, boundsA);
+    return NearlyEqual(identity.center, boundsA.center) && identity.radius == boundsA.radius &&
+        NearlyEqual(absorbed.center, merged.center) && absorbed.radius == merged.radius;
+}
+
+/// @brief Test that MeshData keeps its bounds in sync with its vertices
+bool TestMeshDataBounds()
+{
+    VAArray<Resources::MeshVertex> vertices(3);
+    vertices[0].Position = Math::Vec3(-1.0f, 0.0f, 0.0f);
+    vertices[1].Position = Math::Vec3(1.0f, 0.0f, 0.0f);
+    vertices[2].Position = Math::Vec3(0.0f, 2.0f, 0.0f);
+
+    Resources::MeshData meshData(vertices, {0, 1, 2});
+    if (!NearlyEqual(meshData.GetBounds().min, Math::Vec3(-1.0f, 0.0f, 0.0f)) ||
+        !NearlyEqual(meshData.GetBounds().max, Math::Vec3(1.0f, 2.0f, 0.0f)))
+    {
+        return false;
+    }
+
+    // A second submesh extends the bounds
+    for (auto& vertex : vertices) vertex.Position += Math::Vec3(0.0f, 0.0f, 5.0f);
+    meshData.AddSubmesh(vertices, {0, 1, 2});
+    if (!NearlyEqual(meshData.GetBounds().max, Math::Vec3(1.0f, 2.0f, 5.0f)))
+    {
+        return false;
+    }
+
+    // Removing it shrinks them back
+    meshData.RemoveSubmesh(3, 3, 3, 3);
+    return NearlyEqual(meshData.GetBounds().max, Math::Vec3(1.0f, 2.0f, 0.0f)) &&
+        NearlyEqual(meshData.GetBounds().radius, std::sqrt(2.0f));
+}
+
+// Register all Bounds tests with the TestRunner
+VA_REGISTER_TEST(BoundsFromPoints, TestBoundsFromPoints);
+VA_REGISTER_TEST(BoundsMerge, TestBoundsMerge);
+VA_REGISTER_TEST(MeshDataBounds, TestMeshDataBounds);
@@ -0,0 +1,129 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// DirtyRangeSet and MeshData dirty tracking tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include "TestMeshes.hpp"
+#include <Resources/DirtyRanges.hpp>
+#include <Resources/MeshData.hpp>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    bool HasRanges(
+        const Resources::DirtyRangeSet& set,
+        const std::initializer_list<Resources::DirtyRange> expected)
+    {
+        const auto& ranges = set.GetRanges();
+        if (ranges.size() != expected.size()) return false;
+
+        size_t i = 0;
+        for (const auto& range : expected)
+        {
+            if (ranges[i].offset != range.offset || ranges[i].count != range.count) return false;
+            ++i;
+        }
+        return true;
+    }
+
+} // namespace
+
+/// @brief Test that ranges stay sorted and merge when they overlap or touch
+bool TestDirtyRangeMerge()
+{
+    Resources::DirtyRangeSet set;
+    set.Add(10, 5);
+    set.Add(30, 5);
+    set.Add(0, 2);
+    set.Add(5, 0);
+    if (!HasRanges(set, {{0, 2}, {10, 5}, {30, 5}})) return false;
+
+    // Adjacent on both sides, then overlapping two ranges at once
+    set.Add(2, 8);
+    if (!HasRanges(set, {{0, 15}, {30, 5}})) return false;
+    set.Add(12, 20);
+    if (!HasRanges(set, {{0, 35}})) return false;
+
+    // Contained ranges change nothing
+    set.Add(3, 4);
+    return HasRanges(set, {{0, 35}}) && set.GetTotalCount() == 35;
+}
+
+/// @brief Test that the closest ranges merge past the limit and that truncation clips them
+bool TestDirtyRangeLimit()
+{
+    Resources::DirtyRangeSet set;
+    for (uint32_t i = 0; i < Resources::DirtyRangeSet::MAX_RANGES; ++i) set.Add(i * 10, 1);
+    if (set.GetRanges().size() != Resources::DirtyRangeSet::MAX_RANGES) return false;
+
+    // Two elements away from the first range, every other gap is larger
+    set.Add(3, 1);
+    if (set.GetRanges().size() != Resources::DirtyRangeSet::MAX_RANGES) return false;
+    if (set.GetRanges()[0].offset != 0 || set.GetRanges()[0].count != 4) return false;
+
+    set.Truncate(25);
+    if (!HasRanges(set, {{0, 4}, {10, 1}, {20, 1}})) return false;
+    set.Truncate(20);
+    if (!HasRanges(set, {{0, 4}, {10, 1}})) return false;
+
+    set.Clear();
+    return set.IsEmpty() && set.GetTotalCount() == 0;
+}
+
+/// @brief Test the ranges recorded by the mutating methods of MeshData
+bool TestMeshDataDirtyRanges()
+{
+    auto mesh = BuildQuads(4);
+    if (!mesh.GetDirtyVertices().IsEmpty() || !mesh.GetDirtyIndices().IsEmpty()) return false;
+
+    // Exact ranges for in-place updates
+    const auto generation = mesh.GetGeneration();
+    mesh.UpdateVertices(4, VAArray<Resources::MeshVertex>(2));
+    mesh.vertices[10].Position = Math::Vec3(5.0f, 0.0f, 0.0f);
+    mesh.MarkVerticesDirty(10, 1);
+    mesh.UpdateIndices(6, {4, 5, 6});
+    if (mesh.GetGeneration() != generation + 3) return false;
+    if (!HasRanges(mesh.GetDirtyVertices(), {{4, 2}, {10, 1}})) return false;
+    if (!HasRanges(mesh.GetDirtyIndices(), {{6, 3}})) return false;
+
+    // Appended geometry is dirty, nothing else moves
+    mesh.ClearDirtyRanges();
+    mesh.AddSubmesh(VAArray<Resources::MeshVertex>(3), {0, 1, 2});
+    if (!HasRanges(mesh.GetDirtyVertices(), {{16, 3}})) return false;
+    if (!HasRanges(mesh.GetDirtyIndices(), {{24, 3}})) return false;
+
+    // Removal shifts the following vertices and renumbers every index
+    mesh.ClearDirtyRanges();
+    mesh.UpdateVertices(17, VAArray<Resources::MeshVertex>(1));
+    mesh.RemoveSubmesh(4, 4, 6, 6);
+    if (!HasRanges(mesh.GetDirtyVertices(), {{4, 11}})) return false;
+    if (!HasRanges(mesh.GetDirtyIndices(), {{0, 21}})) return false;
+
+    mesh.ClearDirtyRanges();
+    mesh.GenerateNormals();
+    return HasRanges(mesh.GetDirtyVertices(), {{0, 15}}) && mesh.GetDirtyIndices().IsEmpty();
+}
+
+/// @brief Test that dropping the LOD indices drops their dirty ranges with them
+bool TestMeshDataDirtyRangesDropLods()
+{
+    auto mesh = BuildQuads(2);
+
+    // A single simplified level, its indices stored after the 12 indices of LOD 0
+    mesh.indices.insert(mesh.indices.end(), {0, 1, 2});
+    mesh.SetLods({{12, 3, 0.1f, 0}});
+    mesh.MarkIndicesDirty(10, 5);
+
+    return mesh.GetLods().empty() && mesh.indices.size() == 12 &&
+        HasRanges(mesh.GetDirtyIndices(), {{10, 2}});
+}
+
+// Register all dirty range tests with the TestRunner
+VA_REGISTER_TEST(DirtyRangeMerge, TestDirtyRangeMerge);
+VA_REGISTER_TEST(DirtyRangeLimit, TestDirtyRangeLimit);
+VA_REGISTER_TEST(MeshDataDirtyRanges, TestMeshDataDirtyRanges);
+VA_REGISTER_TEST(MeshDataDirtyRangesDropLods, TestMeshDataDirtyRangesDropLods);
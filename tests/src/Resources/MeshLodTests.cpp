@@ -0,0 +1,233 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// MeshSimplifier and LOD selection tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include "TestMeshes.hpp"
+#include <Resources/MeshSimplifier.hpp>
+
+#include <cmath>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    Resources::MeshVertex VertexAt(const float x, const float y, const float z)
+    {
+        Resources::MeshVertex vertex{};
+        vertex.Position = Math::Vec3(x, y, z);
+        return vertex;
+    }
+
+    /// @brief Closed UV sphere without seams: poles and every ring vertex are shared
+    void BuildSphere(
+        VAArray<Resources::MeshVertex>& vertices,
+        VAArray<uint32_t>& indices,
+        const uint32_t rings,
+        const uint32_t segments)
+    {
+        constexpr float PI = 3.14159265f;
+        vertices.push_back(VertexAt(0.0f, 1.0f, 0.0f));
+        for (uint32_t r = 1; r < rings; ++r)
+        {
+            const float theta = PI * static_cast<float>(r) / static_cast<float>(rings);
+            for (uint32_t s = 0; s < segments; ++s)
+            {
+                const float phi = 2.0f * PI * static_cast<float>(s) / static_cast<float>(segments);
+                vertices.push_back(
+                    VertexAt(
+                        std::sin(theta) * std::cos(phi),
+                        std::cos(theta),
+                        std::sin(theta) * std::sin(phi)));
+            }
+        }
+        vertices.push_back(VertexAt(0.0f, -1.0f, 0.0f));
+
+        const auto ring = [&](const uint32_t r, const uint32_t s)
+        {
+            return 1 + (r - 1) * segments + s % segments;
+        };
+        const auto south = static_cast<uint32_t>(vertices.size() - 1);
+        for (uint32_t s = 0; s < segments; ++s)
+        {
+            indices.insert(indices.end(), {0, ring(1, s + 1), ring(1, s)});
+            indices.insert(indices.end(), {south, ring(rings - 1, s), ring(rings - 1, s + 1)});
+            for (uint32_t r = 1; r + 1 < rings; ++r)
+            {
+                indices.insert(
+                    indices.end(),
+                    {ring(r, s), ring(r, s + 1), ring(r + 1, s), ring(r + 1, s), ring(r, s + 1),
+                     ring(r + 1, s + 1)});
+            }
+        }
+    }
+
+    /// @brief Largest distance from the vertices used by the indices to the unit sphere
+    float SphereDeviation(
+        const VAArray<Resources::MeshVertex>& vertices,
+        const VAArray<uint32_t>& indices)
+    {
+        float deviation = 0.0f;
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            // Triangle centroids move inward as the sphere gets coarser
+            const auto& p0 = vertices[indices[i]].Position;
+            const auto& p1 = vertices[indices[i + 1]].Position;
+            const auto& p2 = vertices[indices[i + 2]].Position;
+            const auto centroid = (p0 + p1 + p2) * (1.0f / 3.0f);
+            const float distance = std::sqrt(Math::Vec3::Dot(centroid, centroid));
+            deviation = std::max(deviation, std::abs(1.0f - distance));
+        }
+        return deviation;
+    }
+} // namespace
+
+/// @brief Test that simplification reaches its target on a closed mesh within the error limit
+bool TestMeshSimplify()
+{
+    VAArray<Resources::MeshVertex> vertices;
+    VAArray<uint32_t> indices;
+    BuildSphere(vertices, indices, 32, 64);
+
+    VAArray<uint32_t> simplified;
+    const auto error = Resources::MeshSimplifier::Simplify(
+        vertices,
+        indices,
+        indices.size() / 4,
+        0.05f,
+        simplified);
+
+    if (simplified.empty() || simplified.size() % 3 != 0) return false;
+    if (simplified.size() > indices.size() / 2 || error > 0.05f) return false;
+    for (const auto index : simplified)
+    {
+        if (index >= vertices.size()) return false;
+    }
+
+    // The quadric error is an RMS distance, the worst centroid may deviate a bit more
+    if (SphereDeviation(vertices, simplified) > 0.1f) return false;
+
+    // Nothing is accepted without error budget on a curved surface
+    VAArray<uint32_t> unchanged;
+    Resources::MeshSimplifier::Simplify(vertices, indices, 0, 0.0f, unchanged);
+    return unchanged.size() == indices.size();
+}
+
+/// @brief Test that borders and seams do not move
+bool TestMeshSimplifyLocksBorders()
+{
+    // Flat 9x9 grid: every interior vertex can go, the 32 border vertices must stay
+    constexpr uint32_t SIZE = 9;
+    VAArray<Resources::MeshVertex> vertices;
+    VAArray<uint32_t> indices;
+    AppendGrid(vertices, indices, SIZE);
+
+    VAArray<uint32_t> simplified;
+    Resources::MeshSimplifier::Simplify(vertices, indices, 0, 0.0f, simplified);
+    if (simplified.size() >= indices.size()) return false;
+
+    VAArray<uint8_t> used(vertices.size(), 0);
+    for (const auto index : simplified) used[index] = 1;
+    for (uint32_t v = 0; v < vertices.size(); ++v)
+    {
+        const auto x = v % SIZE;
+        const auto z = v / SIZE;
+        const bool border = x == 0 || z == 0 || x == SIZE - 1 || z == SIZE - 1;
+        if (border && !used[v]) return false;
+    }
+
+    // Faces stay up
+    for (size_t i = 0; i < simplified.size(); i += 3)
+    {
+        const auto& p0 = vertices[simplified[i]].Position;
+        const auto normal = Math::Vec3::Cross(
+            vertices[simplified[i + 1]].Position - p0,
+            vertices[simplified[i + 2]].Position - p0);
+        if (normal.Y() <= 0.0f) return false;
+    }
+    return true;
+}
+
+/// @brief Test the LOD chain layout: coarser levels, growing errors, indices appended
+bool TestMeshLodChain()
+{
+    VAArray<Resources::MeshVertex> vertices;
+    VAArray<uint32_t> indices;
+    BuildSphere(vertices, indices, 32, 64);
+    const auto baseIndexCount = static_cast<uint32_t>(indices.size());
+
+    const Resources::SubMeshDescriptor submesh{
+        "Sphere",
+        InvalidMaterialHandle,
+        0,
+        baseIndexCount,
+        0,
+        static_cast<uint32_t>(vertices.size())
+    };
+
+    VAArray<Resources::MeshLod> lods;
+    Resources::MeshSimplifier::BuildLodChain(vertices, indices, submesh, 3, lods);
+    if (lods.size() < 3 || lods.size() > Resources::MESH_MAX_LODS - 1) return false;
+
+    auto expectedOffset = baseIndexCount;
+    auto previousCount = baseIndexCount;
+    float previousError = 0.0f;
+    for (const auto& lod : lods)
+    {
+        if (lod.submeshIndex != 3 || lod.indexOffset != expectedOffset) return false;
+        if (lod.indexCount >= previousCount || lod.error < previousError) return false;
+
+        expectedOffset += lod.indexCount;
+        previousCount = lod.indexCount;
+        previousError = lod.error;
+    }
+
+    return expectedOffset == indices.size() && lods.back().error <= 0.1f;
+}
+
+/// @brief Test screen-space selection and its hysteresis band
+bool TestMeshLodSelection()
+{
+    const VAArray<Resources::MeshLod> lods = {
+        {0, 300, 0.01f, 0},
+        {0, 150, 0.02f, 0},
+        {0, 60, 0.08f, 0},
+    };
+
+    Math::Bounds bounds;
+    bounds.min = Math::Vec3(-1.0f, -1.0f, -1.0f);
+    bounds.max = Math::Vec3(1.0f, 1.0f, 1.0f);
+    bounds.center = Math::Vec3(0.0f, 0.0f, 0.0f);
+    bounds.radius = 1.0f;
+
+    // 1000 pixels per unit at distance 1: at distance d, error e spans 1000 e / d pixels
+    const auto viewAt = [](const float distance)
+    {
+        return Resources::LodSelectionView{Math::Vec3(0.0f, 0.0f, distance + 1.0f), 1000.0f};
+    };
+    const Resources::LodSettings exact{1.0f, 0.0f};
+
+    if (Resources::SelectLod(lods, bounds, viewAt(-0.5f), exact, 0) != 0) return false;
+    if (Resources::SelectLod(lods, bounds, viewAt(5.0f), exact, 0) != 0) return false;
+    if (Resources::SelectLod(lods, bounds, viewAt(15.0f), exact, 0) != 1) return false;
+    if (Resources::SelectLod(lods, bounds, viewAt(30.0f), exact, 0) != 2) return false;
+    if (Resources::SelectLod(lods, bounds, viewAt(100.0f), exact, 0) != 3) return false;
+    if (Resources::SelectLod({}, bounds, viewAt(100.0f), exact, 0) != 0) return false;
+
+    // LOD 2 needs 20 units, a 20% band keeps it down to 16.7 and LOD 1 up to 25
+    const Resources::LodSettings banded{1.0f, 0.2f};
+    if (Resources::SelectLod(lods, bounds, viewAt(18.0f), banded, 2) != 2) return false;
+    if (Resources::SelectLod(lods, bounds, viewAt(18.0f), banded, 1) != 1) return false;
+    if (Resources::SelectLod(lods, bounds, viewAt(22.0f), banded, 1) != 1) return false;
+    if (Resources::SelectLod(lods, bounds, viewAt(15.0f), banded, 2) != 1) return false;
+    return Resources::SelectLod(lods, bounds, viewAt(25.0f), banded, 1) == 2;
+}
+
+// Register all MeshLod tests with the TestRunner
+VA_REGISTER_TEST(MeshSimplify, TestMeshSimplify);
+VA_REGISTER_TEST(MeshSimplifyLocksBorders, TestMeshSimplifyLocksBorders);
+VA_REGISTER_TEST(MeshLodChain, TestMeshLodChain);
+VA_REGISTER_TEST(MeshLodSelection, TestMeshLodSelection);
@@ -0,0 +1,127 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// MeshNormals tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include "TestMeshes.hpp"
+#include <Resources/MeshNormals.hpp>
+#include <Systems/Jobs/JobSystem.hpp>
+
+#include <cmath>
+#include <cstring>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Testing;
+
+/// @brief Test the vertex -> triangles rows on a small fan
+bool TestVertexTriangleAdjacency()
+{
+    // Vertex 0 is shared by every triangle, vertex 4 by none
+    const VAArray<uint32_t> indices = {0, 1, 2, 0, 2, 3, 3, 1, 0};
+
+    VAArray<uint32_t> offsets;
+    VAArray<uint32_t> triangles;
+    Resources::MeshNormals::BuildVertexTriangles(indices, 5, offsets, triangles);
+
+    return offsets == VAArray<uint32_t>{0, 3, 5, 7, 9, 9} &&
+        triangles == VAArray<uint32_t>{0, 1, 2, 0, 2, 0, 1, 1, 2};
+}
+
+/// @brief Test smooth normals against a serial scatter over the triangles
+bool TestGenerateNormals()
+{
+    Resources::MeshData mesh;
+    BuildWavyGrid(mesh, 64);
+    mesh.vertices.push_back({}); // Unreferenced vertex
+    mesh.GenerateNormals();
+
+    VAArray<Math::Vec3> expected(mesh.vertices.size(), Math::Vec3::Zero());
+    for (size_t i = 0; i < mesh.indices.size(); i += 3)
+    {
+        const auto& p0 = mesh.vertices[mesh.indices[i]].Position;
+        const auto& p1 = mesh.vertices[mesh.indices[i + 1]].Position;
+        const auto& p2 = mesh.vertices[mesh.indices[i + 2]].Position;
+        const auto normal = Math::Vec3::Cross(p1 - p0, p2 - p0);
+        for (size_t c = 0; c < 3; ++c) expected[mesh.indices[i + c]] += normal;
+    }
+
+    for (size_t v = 0; v + 1 < mesh.vertices.size(); ++v)
+    {
+        if (!NearlyEqual(mesh.vertices[v].Normal, expected[v].Normalize())) return false;
+    }
+
+    // The grid is seen counter-clockwise from above and the lone vertex stays at zero
+    return mesh.vertices.front().Normal.Y() > 0.0f &&
+        mesh.vertices.back().Normal.IsZero();
+}
+
+/// @brief Test tangents and handedness on a flat grid, and degenerate UVs
+bool TestGenerateTangents()
+{
+    Resources::MeshData mesh;
+    BuildWavyGrid(mesh, 16);
+    for (auto& vertex : mesh.vertices)
+    {
+        vertex.Position = Math::Vec3(vertex.Position.X(), 0.0f, vertex.Position.Z());
+    }
+    mesh.GenerateNormals();
+    mesh.GenerateTangents();
+
+    // U grows along +X and V along +Z, while cross(normal, tangent) points to -Z
+    for (const auto& vertex : mesh.vertices)
+    {
+        const auto& tangent = vertex.Tangent;
+        if (!NearlyEqual(Math::Vec3(tangent.X(), tangent.Y(), tangent.Z()), Math::Vec3(1, 0, 0)) ||
+            tangent.W() != -1.0f)
+        {
+            return false;
+        }
+    }
+
+    // Mirroring the UVs flips the handedness
+    for (auto& vertex : mesh.vertices) vertex.UV0 = Math::Vec2(vertex.UV0.X(), -vertex.UV0.Y());
+    mesh.GenerateTangents();
+    if (mesh.vertices.front().Tangent.W() != 1.0f) return false;
+
+    // Collapsed UVs contribute nothing instead of spreading NaNs
+    for (auto& vertex : mesh.vertices) vertex.UV0 = Math::Vec2();
+    mesh.GenerateTangents();
+    for (const auto& vertex : mesh.vertices)
+    {
+        if (std::isnan(vertex.Tangent.X()) || vertex.Tangent.X() != 0.0f) return false;
+    }
+
+    return true;
+}
+
+/// @brief Test that splitting the passes in jobs does not change a single bit of the result
+bool TestGenerateNormalsJobs()
+{
+    // Enough triangles and vertices for several jobs in every pass
+    Resources::MeshData mesh;
+    BuildWavyGrid(mesh, 200);
+
+    auto previousJobSystem = std::move(Jobs::g_JobSystem);
+    auto inlineVertices = mesh.vertices;
+    Resources::MeshNormals::GenerateNormals(inlineVertices, mesh.indices);
+    Resources::MeshNormals::GenerateTangents(inlineVertices, mesh.indices);
+
+    Jobs::g_JobSystem = std::make_unique<Jobs::JobSystem>(4);
+    auto jobVertices = mesh.vertices;
+    Resources::MeshNormals::GenerateNormals(jobVertices, mesh.indices);
+    Resources::MeshNormals::GenerateTangents(jobVertices, mesh.indices);
+    Jobs::g_JobSystem = std::move(previousJobSystem);
+
+    return std::memcmp(
+        inlineVertices.data(),
+        jobVertices.data(),
+        inlineVertices.size() * sizeof(Resources::MeshVertex)) == 0;
+}
+
+// Register all MeshNormals tests with the TestRunner
+VA_REGISTER_TEST(VertexTriangleAdjacency, TestVertexTriangleAdjacency);
+VA_REGISTER_TEST(GenerateNormals, TestGenerateNormals);
+VA_REGISTER_TEST(GenerateTangents, TestGenerateTangents);
+VA_REGISTER_TEST(GenerateNormalsJobs, TestGenerateNormalsJobs);
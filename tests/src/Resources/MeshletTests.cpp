@@ -0,0 +1,206 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// Meshlet generation and cluster culling tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include "TestMeshes.hpp"
+#include <Resources/MeshletBuilder.hpp>
+#include <Systems/Renderer/ClusterCulling.hpp>
+
+#include <cmath>
+#include <unordered_set>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    Resources::SubMeshDescriptor MakeGridSubmesh(
+        VAArray<Resources::MeshVertex>& vertices,
+        VAArray<uint32_t>& indices,
+        const uint32_t cells)
+    {
+        Resources::SubMeshDescriptor submesh;
+        submesh.indexOffset = static_cast<uint32_t>(indices.size());
+        submesh.vertexOffset = static_cast<uint32_t>(vertices.size());
+        AppendGrid(vertices, indices, cells + 1);
+        submesh.indexCount = static_cast<uint32_t>(indices.size()) - submesh.indexOffset;
+        submesh.vertexCount = static_cast<uint32_t>(vertices.size()) - submesh.vertexOffset;
+        submesh.bounds = Resources::MeshData::ComputeBounds(
+            std::span(vertices).subspan(submesh.vertexOffset, submesh.vertexCount));
+        return submesh;
+    }
+
+    /// @brief Frustum whose planes accept every point
+    Math::Frustum MakeOpenFrustum()
+    {
+        Math::Frustum frustum;
+        frustum.planes.fill(Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+        return frustum;
+    }
+} // namespace
+
+/// @brief Test that meshlets respect the limits and partition the submeshes exactly
+bool TestMeshletBuildLimits()
+{
+    VAArray<Resources::MeshVertex> vertices;
+    VAArray<uint32_t> indices;
+    VAArray<Resources::SubMeshDescriptor> submeshes;
+    submeshes.push_back(MakeGridSubmesh(vertices, indices, 40));
+    submeshes.push_back(MakeGridSubmesh(vertices, indices, 7));
+
+    for (const auto& [maxVertices, maxTriangles] : {
+             std::pair{Resources::MESHLET_MAX_VERTICES, Resources::MESHLET_MAX_TRIANGLES},
+             std::pair{3u, 1u},
+             std::pair{16u, 124u}
+         })
+    {
+        VAArray<Resources::Meshlet> meshlets;
+        for (uint32_t s = 0; s < submeshes.size(); ++s)
+        {
+            auto& submesh = submeshes[s];
+            submesh.meshletOffset = static_cast<uint32_t>(meshlets.size());
+            Resources::MeshletBuilder::Build(
+                vertices,
+                indices,
+                submesh,
+                s,
+                meshlets,
+                maxVertices,
+                maxTriangles);
+            submesh.meshletCount = static_cast<uint32_t>(meshlets.size()) - submesh.meshletOffset;
+            if (submesh.meshletCount == 0) return false;
+
+            // Meshlets tile the index range of the submesh, in order and without gaps
+            uint32_t expectedOffset = submesh.indexOffset;
+            for (uint32_t m = 0; m < submesh.meshletCount; ++m)
+            {
+                const auto& meshlet = meshlets[submesh.meshletOffset + m];
+                if (meshlet.submeshIndex != s || meshlet.indexOffset != expectedOffset ||
+                    meshlet.triangleCount == 0 || meshlet.triangleCount > maxTriangles ||
+                    meshlet.vertexCount > maxVertices)
+                {
+                    return false;
+                }
+
+                std::unordered_set<uint32_t> unique(
+                    indices.begin() + meshlet.indexOffset,
+                    indices.begin() + meshlet.indexOffset + meshlet.GetIndexCount());
+                if (unique.size() != meshlet.vertexCount) return false;
+
+                expectedOffset += meshlet.GetIndexCount();
+            }
+            if (expectedOffset != submesh.GetIndexEnd()) return false;
+        }
+    }
+
+    // A flat grid has a tight normal cone pointing up and a sphere around its vertices
+    VAArray<Resources::Meshlet> meshlets;
+    Resources::MeshletBuilder::Build(vertices, indices, submeshes[0], 0, meshlets);
+    for (const auto& meshlet : meshlets)
+    {
+        if (std::abs(meshlet.coneAxis.Y() - 1.0f) > 1e-4f || meshlet.coneCutoff > 1e-3f)
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < meshlet.GetIndexCount(); ++i)
+        {
+            const auto& position = vertices[indices[meshlet.indexOffset + i]].Position;
+            const auto offset = position - meshlet.center;
+            if (std::sqrt(Math::Vec3::Dot(offset, offset)) > meshlet.radius + 1e-4f)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/// @brief Test cone and frustum rejection and the merging of visible ranges
+bool TestMeshletCulling()
+{
+    VAArray<Resources::MeshVertex> vertices;
+    VAArray<uint32_t> indices;
+    auto submesh = MakeGridSubmesh(vertices, indices, 40);
+
+    VAArray<Resources::Meshlet> meshlets;
+    Resources::MeshletBuilder::Build(vertices, indices, submesh, 0, meshlets);
+    submesh.meshletCount = static_cast<uint32_t>(meshlets.size());
+
+    Renderer::ClusterCullingView view;
+    view.frustum = MakeOpenFrustum();
+
+    // Seen from above everything is drawn, as a single merged range
+    view.cameraPosition = Math::Vec3(20.0f, 100.0f, 20.0f);
+    VAArray<Renderer::IndexRange> ranges;
+    auto stats = Renderer::ClusterCulling::CullSubMesh(view, submesh, meshlets, ranges);
+    if (ranges.size() != 1 || ranges[0].indexOffset != submesh.indexOffset ||
+        ranges[0].indexCount != submesh.indexCount || stats.tested != meshlets.size() ||
+        stats.frustumCulled != 0 || stats.backfaceCulled != 0)
+    {
+        return false;
+    }
+
+    // Seen from below every cluster is backfacing
+    view.cameraPosition = Math::Vec3(20.0f, -100.0f, 20.0f);
+    ranges.clear();
+    stats = Renderer::ClusterCulling::CullSubMesh(view, submesh, meshlets, ranges);
+    if (!ranges.empty() || stats.backfaceCulled != meshlets.size())
+    {
+        return false;
+    }
+
+    // Keep x <= 10 only: visible clusters are exactly those whose sphere reaches it
+    view.cameraPosition = Math::Vec3(20.0f, 100.0f, 20.0f);
+    view.frustum.planes[Math::Frustum::Left] = Math::Vec4(-1.0f, 0.0f, 0.0f, 10.0f);
+    ranges.clear();
+    stats = Renderer::ClusterCulling::CullSubMesh(view, submesh, meshlets, ranges);
+
+    uint32_t expectedIndices = 0;
+    for (const auto& meshlet : meshlets)
+    {
+        if (meshlet.center.X() - meshlet.radius <= 10.0f)
+        {
+            expectedIndices += meshlet.GetIndexCount();
+        }
+    }
+
+    uint32_t drawnIndices = 0;
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        // Ranges are sorted and touching ranges have been merged
+        if (i > 0 && ranges[i - 1].indexOffset + ranges[i - 1].indexCount >= ranges[i].indexOffset)
+        {
+            return false;
+        }
+        drawnIndices += ranges[i].indexCount;
+    }
+    if (stats.frustumCulled == 0 || drawnIndices == 0 || drawnIndices != expectedIndices)
+    {
+        return false;
+    }
+
+    // A submesh entirely outside is rejected without looking at its meshlets
+    view.frustum.planes[Math::Frustum::Left] = Math::Vec4(-1.0f, 0.0f, 0.0f, -100.0f);
+    ranges.clear();
+    stats = Renderer::ClusterCulling::CullSubMesh(view, submesh, meshlets, ranges);
+    if (!ranges.empty() || stats.frustumCulled != meshlets.size())
+    {
+        return false;
+    }
+
+    // Without meshlets the submesh is drawn whole
+    auto plain = submesh;
+    plain.meshletCount = 0;
+    view.frustum = MakeOpenFrustum();
+    ranges.clear();
+    Renderer::ClusterCulling::CullSubMesh(view, plain, meshlets, ranges);
+    return ranges.size() == 1 && ranges[0].indexCount == plain.indexCount;
+}
+
+// Register all Meshlet tests with the TestRunner
+VA_REGISTER_TEST(MeshletBuildLimits, TestMeshletBuildLimits);
+VA_REGISTER_TEST(MeshletCulling, TestMeshletCulling);
@@ -0,0 +1,283 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// NativeMeshImporter tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Resources/Loaders/NativeMeshImporter.hpp>
+#include <Resources/Loaders/RawMeshLoader.hpp>
+#include <Systems/MaterialSystem.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    bool Near(const float a, const float b) { return std::abs(a - b) < 1e-5f; }
+
+    bool Near(const Math::Vec3& a, const Math::Vec3& b)
+    {
+        return Near(a.X(), b.X()) && Near(a.Y(), b.Y()) && Near(a.Z(), b.Z());
+    }
+
+    /// @brief A quad sharing its diagonal corners between two triangles, then a triangle
+    ///        without normals using relative indices and an unknown material
+    void WriteObjScene(const std::filesystem::path& directory)
+    {
+        std::ofstream(directory / "scene.mtl")
+            << "newmtl Brick\n"
+            << "Kd 0.5 0.25 1\n"
+            << "map_Kd -bm 1 textures\\brick_diffuse.png\n"
+            << "map_Ks brick_spec.tga\n"
+            << "norm brick_normal.png\n";
+
+        std::ofstream(directory / "scene.obj")
+            << "# Test scene\n"
+            << "mtllib scene.mtl\n"
+            << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+            << "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+            << "vn 0 0 1\n"
+            << "o Quad\n"
+            << "usemtl Brick\n"
+            << "f 1/1/1 2/2/1 3/3/1 4/4/1\r\n"
+            << "o Tri\n"
+            << "usemtl Missing\n"
+            << "f -4/1 -3/2 -2/3\n";
+    }
+
+    template <typename T>
+    void Append(std::string& bytes, const T& value)
+    {
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /// @brief A binary glTF placing the same mesh twice under a translated parent, A as it is
+    ///        and B mirrored along X. Primitive 0 is an indexed quad with UVs, primitive 1 the
+    ///        same quad without indices, whose duplicated corners must be welded.
+    void WriteGlbScene(const std::filesystem::path& path)
+    {
+        const float corners[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+        const uint16_t quad[6] = {0, 1, 2, 0, 2, 3};
+
+        std::string bin;
+        for (const auto& corner : corners)
+        {
+            Append(bin, corner[0]);
+            Append(bin, corner[1]);
+            Append(bin, 0.0f);
+        }
+        for (const auto& corner : corners)
+        {
+            Append(bin, corner[0]);
+            Append(bin, corner[1]);
+        }
+        for (const auto index : quad) Append(bin, index);
+        Append(bin, uint32_t{0}); // Keeps the next floats aligned
+        for (const auto index : quad)
+        {
+            Append(bin, corners[index][0]);
+            Append(bin, corners[index][1]);
+            Append(bin, 0.0f);
+        }
+
+        std::string json =
+            R"({"asset": {"version": "2.0"}, "scene": 0, "scenes": [{"nodes": [0]}],)"
+            R"("nodes": [{"name": "Parent", "children": [1, 2], "translation": [0, 0, 5]},)"
+            R"({"name": "A", "mesh": 0}, {"name": "B", "mesh": 0, "scale": [-1, 1, 1]}],)"
+            R"("materials": [{"name": "Red", "pbrMetallicRoughness": )"
+            R"({"baseColorFactor": [1, 0, 0, 1], "baseColorTexture": {"index": 0}}}],)"
+            R"("textures": [{"source": 0}], "images": [{"uri": "red%20paint.png"}],)"
+            R"("meshes": [{"primitives": [)"
+            R"({"attributes": {"POSITION": 0, "TEXCOORD_0": 1}, "indices": 2, "material": 0},)"
+            R"({"attributes": {"POSITION": 3}}]}],)"
+            R"("buffers": [{"byteLength": 168}],)"
+            R"("bufferViews": [{"buffer": 0, "byteLength": 48},)"
+            R"({"buffer": 0, "byteOffset": 48, "byteLength": 32},)"
+            R"({"buffer": 0, "byteOffset": 80, "byteLength": 12},)"
+            R"({"buffer": 0, "byteOffset": 96, "byteLength": 72}],)"
+            R"("accessors": [)"
+            R"({"bufferView": 0, "componentType": 5126, "count": 4, "type": "VEC3"},)"
+            R"({"bufferView": 1, "componentType": 5126, "count": 4, "type": "VEC2"},)"
+            R"({"bufferView": 2, "componentType": 5123, "count": 6, "type": "SCALAR"},)"
+            R"({"bufferView": 3, "componentType": 5126, "count": 6, "type": "VEC3"}]})";
+        while (json.size() % 4 != 0) json += ' ';
+        while (bin.size() % 4 != 0) bin += '\0';
+
+        std::string glb;
+        Append(glb, 0x46546C67u);
+        Append(glb, 2u);
+        Append(glb, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+        Append(glb, static_cast<uint32_t>(json.size()));
+        Append(glb, 0x4E4F534Au);
+        glb += json;
+        Append(glb, static_cast<uint32_t>(bin.size()));
+        Append(glb, 0x004E4942u);
+        glb += bin;
+        std::ofstream(path, std::ios::binary).write(glb.data(), glb.size());
+    }
+} // namespace
+
+/// @brief Test that OBJ corners are welded by their indices, polygons fanned into triangles
+///        and MTL materials read, with normals generated where the file has none
+bool TestNativeMeshImporterObj()
+{
+    const auto root = std::filesystem::temp_directory_path() / "va_native_obj";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    WriteObjScene(root);
+
+    ImportedMesh mesh;
+    const bool imported = NativeMeshImporter::Import((root / "scene.obj").string(), 2.0f, mesh);
+    std::filesystem::remove_all(root);
+    if (!imported || mesh.submeshes.size() != 2 || mesh.materials.size() != 1) return false;
+
+    const auto& quad = mesh.submeshes[0];
+    const auto& tri = mesh.submeshes[1];
+    if (quad.name != "Quad_0" || quad.material != 0 || quad.vertexCount != 4 ||
+        quad.indexCount != 6 || tri.name != "Tri_0" || tri.material != -1 ||
+        tri.vertexOffset != 4 || tri.vertexCount != 3 || tri.indexOffset != 6 ||
+        tri.indexCount != 3 || mesh.vertices.size() != 7 || mesh.indices.size() != 9)
+    {
+        return false;
+    }
+
+    const auto& material = mesh.materials[0];
+    if (material.name != "Brick" || material.diffuseTexture != "brick_diffuse" ||
+        material.specularTexture != "brick_spec" || material.normalTexture != "brick_normal" ||
+        !Near(material.diffuseColor.Y(), 0.25f))
+    {
+        return false;
+    }
+
+    // Scaled positions, +Z normals read or generated, tangents along +U
+    if (!Near(mesh.vertices[2].Position, {2.0f, 2.0f, 0.0f})) return false;
+    for (uint32_t i = 0; i < mesh.vertices.size(); ++i)
+    {
+        const auto& vertex = mesh.vertices[i];
+        const Math::Vec3 tangent(vertex.Tangent.X(), vertex.Tangent.Y(), vertex.Tangent.Z());
+        if (!Near(vertex.Normal, {0.0f, 0.0f, 1.0f}) || !Near(tangent, {1.0f, 0.0f, 0.0f}) ||
+            std::abs(vertex.Tangent.W()) != 1.0f)
+        {
+            return false;
+        }
+    }
+    return mesh.indices[0] == 0 && mesh.indices[3] == 0 && mesh.indices[4] == 2 &&
+        mesh.indices[6] == 0 && mesh.indices[8] == 2;
+}
+
+/// @brief Test that a binary glTF is placed by its node hierarchy, a mirroring node flipping
+///        the tangent handedness, and that non-indexed corners are welded
+bool TestNativeMeshImporterGlb()
+{
+    const auto root = std::filesystem::temp_directory_path() / "va_native_glb";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    WriteGlbScene(root / "quads.glb");
+
+    ImportedMesh mesh;
+    const bool imported = NativeMeshImporter::Import((root / "quads.glb").string(), 1.0f, mesh);
+    std::filesystem::remove_all(root);
+    if (!imported || mesh.submeshes.size() != 4 || mesh.materials.size() != 1) return false;
+
+    const char* names[] = {"A_0", "A_1", "B_0", "B_1"};
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        const auto& submesh = mesh.submeshes[i];
+        if (submesh.name != names[i] || submesh.vertexCount != 4 || submesh.indexCount != 6 ||
+            submesh.vertexOffset != 4 * i || submesh.indexOffset != 6 * i ||
+            submesh.material != (i % 2 == 0 ? 0 : -1))
+        {
+            return false;
+        }
+    }
+    if (mesh.materials[0].name != "Red" || mesh.materials[0].diffuseTexture != "red paint" ||
+        !Near(mesh.materials[0].diffuseColor.X(), 1.0f))
+    {
+        return false;
+    }
+
+    // B is A mirrored along X, its tangents point the other way with the other handedness
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        const auto& a = mesh.vertices[i];
+        const auto& b = mesh.vertices[8 + i];
+        if (!Near(a.Position.Z(), 5.0f) ||
+            !Near(b.Position, {-a.Position.X(), a.Position.Y(), a.Position.Z()}) ||
+            !Near(a.Normal, {0.0f, 0.0f, 1.0f}) || !Near(b.Normal, a.Normal) ||
+            !Near(a.Tangent.X(), 1.0f) || !Near(b.Tangent.X(), -1.0f) ||
+            std::abs(a.Tangent.W()) != 1.0f || b.Tangent.W() != -a.Tangent.W())
+        {
+            return false;
+        }
+    }
+
+    // The welded primitive has the indexed one's positions, V is flipped like by assimp
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        if (!Near(mesh.vertices[4 + i].Position, mesh.vertices[i].Position)) return false;
+    }
+    return Near(mesh.vertices[0].UV0.Y(), 1.0f) &&
+        std::equal(mesh.indices.begin(), mesh.indices.begin() + 6, mesh.indices.begin() + 6);
+}
+
+/// @brief Test that a glTF the importer does not support is rejected, for RawMeshLoader to
+///        fall back to assimp
+bool TestNativeMeshImporterRejects()
+{
+    const auto root = std::filesystem::temp_directory_path() / "va_native_reject";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    std::ofstream(root / "draco.gltf")
+        << R"({"asset": {"version": "2.0"}, "extensionsRequired": ["KHR_draco_mesh_compression"],)"
+        << R"("meshes": [], "nodes": []})";
+    std::ofstream(root / "broken.gltf") << R"({"asset": {"version": "2.0"}, "meshes": [)";
+
+    ImportedMesh mesh;
+    const bool draco = NativeMeshImporter::Import((root / "draco.gltf").string(), 1.0f, mesh);
+    const bool broken = NativeMeshImporter::Import((root / "broken.gltf").string(), 1.0f, mesh);
+    const bool missing = NativeMeshImporter::Import((root / "missing.obj").string(), 1.0f, mesh);
+    std::filesystem::remove_all(root);
+    return !draco && !broken && !missing && NativeMeshImporter::CanImport("a/b.GLB") &&
+        !NativeMeshImporter::CanImport("a/b.fbx");
+}
+
+/// @brief Test that both RawMeshLoader backends import the same geometry
+bool TestRawMeshLoaderNativeBackend()
+{
+    const auto root = std::filesystem::temp_directory_path() / "va_native_backend";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    WriteObjScene(root);
+
+    const auto ownedMaterialSystem = !g_MaterialSystem;
+    if (ownedMaterialSystem) g_MaterialSystem = std::make_unique<MaterialSystem>();
+
+    RawMeshLoader loader(root.string() + "/");
+    const auto assimp = std::dynamic_pointer_cast<MeshDataDefinition>(loader.Load("scene"));
+    loader.SetImporter(MeshImporter::Native);
+    const auto native = std::dynamic_pointer_cast<MeshDataDefinition>(loader.Load("scene"));
+
+    if (ownedMaterialSystem) g_MaterialSystem.reset();
+    std::filesystem::remove_all(root);
+
+    if (!assimp || !native) return false;
+    const auto& a = assimp->GetBounds();
+    const auto& b = native->GetBounds();
+    return assimp->GetVertices().size() == native->GetVertices().size() &&
+        assimp->GetIndices().size() == native->GetIndices().size() &&
+        assimp->GetSubmeshes().size() == native->GetSubmeshes().size() &&
+        Near(a.min, b.min) && Near(a.max, b.max);
+}
+
+// Register all NativeMeshImporter tests with the TestRunner
+VA_REGISTER_TEST(NativeMeshImporterObj, TestNativeMeshImporterObj);
+VA_REGISTER_TEST(NativeMeshImporterGlb, TestNativeMeshImporterGlb);
+VA_REGISTER_TEST(NativeMeshImporterRejects, TestNativeMeshImporterRejects);
+VA_REGISTER_TEST(RawMeshLoaderNativeBackend, TestRawMeshLoaderNativeBackend);
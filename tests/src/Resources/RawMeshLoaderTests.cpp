@@ -0,0 +1,220 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// RawMeshLoader tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Resources/Loaders/RawMeshLoader.hpp>
+#include <Systems/Jobs/JobSystem.hpp>
+#include <Systems/MaterialSystem.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief Enough vertices for the grid to be split across several import jobs
+    constexpr uint32_t GRID_SIZE = 160;
+
+    template <typename T>
+    void Append(VAArray<char>& bytes, const T& value)
+    {
+        const auto* data = reinterpret_cast<const char*>(&value);
+        bytes.insert(bytes.end(), data, data + sizeof(T));
+    }
+
+    /// @brief Global scale applied by RawMeshLoader on top of the node transforms
+    constexpr float IMPORT_SCALE = .01f;
+
+    /// @brief Two triangles per grid quad, indexing the source vertices
+    VAArray<uint32_t> GridIndices()
+    {
+        VAArray<uint32_t> indices;
+        for (uint32_t z = 0; z + 1 < GRID_SIZE; ++z)
+        {
+            for (uint32_t x = 0; x + 1 < GRID_SIZE; ++x)
+            {
+                const auto i0 = z * GRID_SIZE + x;
+                for (const auto index : {i0, i0 + GRID_SIZE, i0 + 1, i0 + 1, i0 + GRID_SIZE,
+                                         i0 + GRID_SIZE + 1})
+                {
+                    indices.push_back(index);
+                }
+            }
+        }
+        return indices;
+    }
+
+    /// @brief Position of a source grid vertex, before any node transform
+    Math::Vec3 GridPosition(const uint32_t index)
+    {
+        const auto x = index % GRID_SIZE;
+        const auto z = index / GRID_SIZE;
+        return {
+            static_cast<float>(x),
+            std::sin(static_cast<float>(x + z) * 0.1f),
+            static_cast<float>(z)
+        };
+    }
+
+    bool Near(const Math::Vec3& a, const Math::Vec3& b)
+    {
+        const auto delta = a - b;
+        return Math::Vec3::Dot(delta, delta) < 1e-8f;
+    }
+
+    /// @brief Write a glTF scene placing the same grid twice, under a translated parent:
+    ///        Left translated by (-2, 0, 0), Right scaled by 2
+    void WriteGridScene(const std::filesystem::path& directory)
+    {
+        constexpr uint32_t vertexCount = GRID_SIZE * GRID_SIZE;
+        VAArray<char> bytes;
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            const auto position = GridPosition(i);
+            Append(bytes, position.X());
+            Append(bytes, position.Y());
+            Append(bytes, position.Z());
+        }
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            Append(bytes, 0.0f);
+            Append(bytes, 1.0f);
+            Append(bytes, 0.0f);
+        }
+        for (uint32_t z = 0; z < GRID_SIZE; ++z)
+        {
+            for (uint32_t x = 0; x < GRID_SIZE; ++x)
+            {
+                Append(bytes, static_cast<float>(x) / GRID_SIZE);
+                Append(bytes, static_cast<float>(z) / GRID_SIZE);
+            }
+        }
+        const auto gridIndices = GridIndices();
+        const auto indexCount = static_cast<uint32_t>(gridIndices.size());
+        for (const auto index : gridIndices)
+        {
+            Append(bytes, index);
+        }
+        std::ofstream(directory / "grid.bin", std::ios::binary).write(bytes.data(), bytes.size());
+
+        const auto positionsSize = vertexCount * 12;
+        const auto uvOffset = positionsSize * 2;
+        const auto indexOffset = uvOffset + vertexCount * 8;
+        std::ofstream gltf(directory / "grid.gltf");
+        gltf << R"({"asset": {"version": "2.0"}, "scene": 0, "scenes": [{"nodes": [0]}],)"
+            << R"("nodes": [{"name": "Root", "children": [1, 2], "translation": [0, 1, 0]},)"
+            << R"({"name": "Left", "mesh": 0, "translation": [-2, 0, 0]},)"
+            << R"({"name": "Right", "mesh": 0, "scale": [2, 2, 2]}],)"
+            << R"("meshes": [{"primitives": [{"attributes": )"
+            << R"({"POSITION": 0, "NORMAL": 1, "TEXCOORD_0": 2}, "indices": 3}]}],)"
+            << R"("buffers": [{"uri": "grid.bin", "byteLength": )" << bytes.size() << "}],"
+            << R"("bufferViews": [)"
+            << R"({"buffer": 0, "byteOffset": 0, "byteLength": )" << positionsSize << "},"
+            << R"({"buffer": 0, "byteOffset": )" << positionsSize << R"(, "byteLength": )"
+            << positionsSize << "},"
+            << R"({"buffer": 0, "byteOffset": )" << uvOffset << R"(, "byteLength": )"
+            << vertexCount * 8 << "},"
+            << R"({"buffer": 0, "byteOffset": )" << indexOffset << R"(, "byteLength": )"
+            << indexCount * 4 << "}],"
+            << R"("accessors": [)"
+            << R"({"bufferView": 0, "componentType": 5126, "count": )" << vertexCount
+            << R"(, "type": "VEC3", "min": [0, -1, 0], "max": [)" << GRID_SIZE - 1 << ", 1, "
+            << GRID_SIZE - 1 << "]},"
+            << R"({"bufferView": 1, "componentType": 5126, "count": )" << vertexCount
+            << R"(, "type": "VEC3"},)"
+            << R"({"bufferView": 2, "componentType": 5126, "count": )" << vertexCount
+            << R"(, "type": "VEC2"},)"
+            << R"({"bufferView": 3, "componentType": 5125, "count": )" << indexCount
+            << R"(, "type": "SCALAR"}]})";
+    }
+
+    bool SameBytes(const MeshDataDefinition& a, const MeshDataDefinition& b)
+    {
+        const auto& va = a.GetVertices();
+        const auto& vb = b.GetVertices();
+        return va.size() == vb.size() && a.GetIndices() == b.GetIndices() &&
+            std::memcmp(va.data(), vb.data(), va.size() * sizeof(MeshVertex)) == 0;
+    }
+} // namespace
+
+/// @brief Test that every instance of a mesh lands in its own range at the positions its node
+///        transforms give, the same to the byte whether imported in parallel or not
+bool TestRawMeshLoaderInstances()
+{
+    const auto root = std::filesystem::temp_directory_path() / "va_raw_mesh_loader";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    WriteGridScene(root);
+
+    const auto ownedMaterialSystem = !g_MaterialSystem;
+    if (ownedMaterialSystem) g_MaterialSystem = std::make_unique<MaterialSystem>();
+
+    RawMeshLoader loader(root.string() + "/");
+    const auto serial = std::dynamic_pointer_cast<MeshDataDefinition>(loader.Load("grid"));
+
+    const auto ownedJobSystem = !Jobs::g_JobSystem;
+    if (ownedJobSystem) Jobs::g_JobSystem = std::make_unique<Jobs::JobSystem>(4);
+    const auto parallel = std::dynamic_pointer_cast<MeshDataDefinition>(loader.Load("grid"));
+
+    if (ownedJobSystem) Jobs::g_JobSystem.reset();
+    if (ownedMaterialSystem) g_MaterialSystem.reset();
+    std::filesystem::remove_all(root);
+
+    if (!serial || !parallel || !SameBytes(*serial, *parallel)) return false;
+
+    const auto& submeshes = parallel->GetSubmeshes();
+    const auto& vertices = parallel->GetVertices();
+    const auto& indices = parallel->GetIndices();
+    const auto gridIndices = GridIndices();
+    const auto indexCount = static_cast<uint32_t>(gridIndices.size());
+    constexpr uint32_t vertexCount = GRID_SIZE * GRID_SIZE;
+    if (submeshes.size() != 2 || indexCount != (GRID_SIZE - 1) * (GRID_SIZE - 1) * 6) return false;
+
+    const auto& left = submeshes[0];
+    const auto& right = submeshes[1];
+    if (left.indexOffset != 0 || left.indexCount != indexCount || left.vertexOffset != 0 ||
+        left.vertexCount != vertexCount || right.indexOffset != indexCount ||
+        right.indexCount != indexCount || right.vertexOffset != vertexCount ||
+        right.vertexCount != vertexCount || vertices.size() != 2 * vertexCount ||
+        indices.size() != 2 * indexCount)
+    {
+        return false;
+    }
+
+    // Every corner of every triangle must land where the parent and node transforms put the
+    // source vertex: Root translates by (0, 1, 0), Left by (-2, 0, 0) and Right scales by 2.
+    // Vertices may be reordered by the import, so they are reached through the indices.
+    const Math::Vec3 up{0.0f, 1.0f, 0.0f};
+    for (uint32_t i = 0; i < indexCount; ++i)
+    {
+        const auto source = GridPosition(gridIndices[i]);
+        const auto leftIndex = indices[left.indexOffset + i];
+        const auto rightIndex = indices[right.indexOffset + i];
+        if (leftIndex >= vertexCount || rightIndex >= vertexCount) return false;
+
+        const auto& leftVertex = vertices[left.vertexOffset + leftIndex];
+        const auto& rightVertex = vertices[right.vertexOffset + rightIndex];
+        const Math::Vec3 leftExpected{source.X() - 2.0f, source.Y() + 1.0f, source.Z()};
+        const Math::Vec3 rightExpected{source.X() * 2.0f, source.Y() * 2.0f + 1.0f,
+                                       source.Z() * 2.0f};
+        if (!Near(leftVertex.Position, leftExpected * IMPORT_SCALE) ||
+            !Near(rightVertex.Position, rightExpected * IMPORT_SCALE) ||
+            !Near(leftVertex.Normal, up) || !Near(rightVertex.Normal, up))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Register all RawMeshLoader tests with the TestRunner
+VA_REGISTER_TEST(RawMeshLoaderInstances, TestRawMeshLoaderInstances);
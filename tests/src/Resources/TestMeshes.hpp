@@ -0,0 +1,122 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+// Procedural meshes and comparisons shared by the mesh tests and benchmarks
+//
+#pragma once
+
+#include <Resources/MeshData.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+namespace VoidArchitect::Testing
+{
+    inline bool NearlyEqual(const float a, const float b, const float epsilon = 1e-4f)
+    {
+        return std::abs(a - b) <= epsilon;
+    }
+
+    inline bool NearlyEqual(const Math::Vec3& a, const Math::Vec3& b, const float epsilon = 1e-4f)
+    {
+        return NearlyEqual(a.X(), b.X(), epsilon) && NearlyEqual(a.Y(), b.Y(), epsilon) &&
+            NearlyEqual(a.Z(), b.Z(), epsilon);
+    }
+
+    /// @brief Append a flat grid of size x size vertices in the XZ plane at the given height,
+    ///        counter-clockwise seen from +Y, UVs along X and Z
+    ///
+    /// Indices are relative to the first vertex of the grid, i.e. to the vertex offset of the
+    /// submesh it becomes.
+    inline void AppendGrid(
+        VAArray<Resources::MeshVertex>& vertices,
+        VAArray<uint32_t>& indices,
+        const uint32_t size,
+        const float height = 0.0f)
+    {
+        vertices.reserve(vertices.size() + size * size);
+        for (uint32_t z = 0; z < size; ++z)
+        {
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                Resources::MeshVertex vertex{};
+                vertex.Position = Math::Vec3(static_cast<float>(x), height, static_cast<float>(z));
+                vertex.Normal = Math::Vec3::Up();
+                vertex.UV0 = Math::Vec2(static_cast<float>(x), static_cast<float>(z));
+                vertices.push_back(vertex);
+            }
+        }
+
+        indices.reserve(indices.size() + (size - 1) * (size - 1) * 6);
+        for (uint32_t z = 0; z + 1 < size; ++z)
+        {
+            for (uint32_t x = 0; x + 1 < size; ++x)
+            {
+                const auto i0 = z * size + x;
+                const auto i1 = i0 + size;
+                indices.insert(indices.end(), {i0, i1, i0 + 1, i0 + 1, i1, i1 + 1});
+            }
+        }
+    }
+
+    /// @brief AppendGrid() with its triangles shuffled, as an exporter that does not optimize
+    ///        may write them
+    inline void AppendShuffledGrid(
+        VAArray<Resources::MeshVertex>& vertices,
+        VAArray<uint32_t>& indices,
+        const uint32_t size,
+        const float height,
+        const uint32_t seed)
+    {
+        VAArray<uint32_t> gridIndices;
+        AppendGrid(vertices, gridIndices, size, height);
+
+        VAArray<std::array<uint32_t, 3>> triangles(gridIndices.size() / 3);
+        for (size_t t = 0; t < triangles.size(); ++t)
+        {
+            triangles[t] = {gridIndices[t * 3], gridIndices[t * 3 + 1], gridIndices[t * 3 + 2]};
+        }
+
+        std::mt19937 rng(seed);
+        std::ranges::shuffle(triangles, rng);
+        for (const auto& triangle : triangles)
+        {
+            indices.insert(indices.end(), triangle.begin(), triangle.end());
+        }
+    }
+
+    /// @brief Grid of size x size vertices with a wavy height, so that no two neighbor
+    ///        triangles share their normal, UVs from 0 to 1 along X and Z
+    inline void BuildWavyGrid(Resources::MeshData& mesh, const uint32_t size)
+    {
+        const auto vertexOffset = mesh.vertices.size();
+        AppendGrid(mesh.vertices, mesh.indices, size);
+
+        const auto scale = 1.0f / static_cast<float>(size);
+        for (auto v = vertexOffset; v < mesh.vertices.size(); ++v)
+        {
+            auto& vertex = mesh.vertices[v];
+            const auto fx = vertex.Position.X();
+            const auto fz = vertex.Position.Z();
+            vertex.Position = Math::Vec3(fx, std::sin(fx * 0.3f) * std::cos(fz * 0.2f), fz);
+            vertex.Normal = Math::Vec3::Zero();
+            vertex.UV0 = Math::Vec2(fx * scale, fz * scale);
+        }
+    }
+
+    /// @brief Disjoint quads along X, four vertices and two triangles each
+    inline Resources::MeshData BuildQuads(const uint32_t quadCount)
+    {
+        VAArray<Resources::MeshVertex> vertices(quadCount * 4);
+        VAArray<uint32_t> indices;
+        for (uint32_t q = 0; q < quadCount; ++q)
+        {
+            const auto v = q * 4;
+            vertices[v].Position = Math::Vec3(static_cast<float>(q), 0.0f, 0.0f);
+            indices.insert(indices.end(), {v, v + 1, v + 2, v + 2, v + 1, v + 3});
+        }
+        return Resources::MeshData(std::move(vertices), std::move(indices));
+    }
+} // namespace VoidArchitect::Testing
@@ -0,0 +1,137 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// VAMCacheManifest tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Resources/Loaders/VamCacheManifest.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    std::string GetTestPath(const char* name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    void WriteText(const std::string& path, const std::string& text)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+} // namespace
+
+/// @brief Test that saved entries are loaded back as they were recorded
+bool TestVamCacheManifestRoundTrip()
+{
+    const auto path = GetTestPath("va_test.manifest");
+
+    VAMCacheManifest manifest;
+    for (int i = 0; i < 100; ++i)
+    {
+        VAMCacheManifest::Entry entry;
+        entry.vamFile = "mesh" + std::to_string(i) + ".vam";
+        entry.sourceFile = i % 2 ? "models/mesh" + std::to_string(i) + ".gltf" : "";
+        entry.sourceHash = 0x1234567890ull * i;
+        entry.settingsHash = VAMCacheManifest::HashSettings(VAMCompressionSettings::Default());
+        entry.sourceSize = i * 1000;
+        entry.sourceTime = -i;
+        manifest.Record("mesh" + std::to_string(i), entry);
+    }
+    manifest.SetDictionaryId(0xDEADBEEF);
+    if (!manifest.Save(path)) return false;
+
+    VAMCacheManifest loaded;
+    bool valid = loaded.Load(path) && loaded.GetSize() == 100 &&
+        loaded.GetDictionaryId() == 0xDEADBEEF;
+    const auto entry = loaded.Find("mesh41");
+    valid = valid && entry && entry->vamFile == "mesh41.vam" &&
+        entry->sourceFile == "models/mesh41.gltf" && entry->sourceHash == 0x1234567890ull * 41 &&
+        entry->sourceSize == 41000 && entry->sourceTime == -41 && loaded.Find("mesh40") &&
+        loaded.Find("mesh40")->sourceFile.empty() && !loaded.Find("mesh100");
+
+    std::filesystem::remove(path);
+    return valid;
+}
+
+/// @brief Test that a damaged manifest is rejected and leaves the manifest empty
+bool TestVamCacheManifestCorrupted()
+{
+    const auto path = GetTestPath("va_test.manifest");
+
+    VAMCacheManifest manifest;
+    manifest.Record("mesh", {"mesh.vam", "mesh.obj", 1, 2, 3, 4});
+    if (!manifest.Save(path)) return false;
+
+    // Flip a bit of the string table, the checksum no longer matches
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-2, std::ios::end);
+        file.put('X');
+    }
+
+    const bool rejected = !manifest.Load(path) && manifest.GetSize() == 0 &&
+        !manifest.Load(GetTestPath("va_missing.manifest"));
+
+    std::filesystem::remove(path);
+    return rejected;
+}
+
+/// @brief Test that only a change of content invalidates a source, not a change of time
+bool TestVamCacheManifestCheckSource()
+{
+    const auto path = GetTestPath("va_test_source.obj");
+    WriteText(path, "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+
+    VAMCacheManifest::Entry entry;
+    if (!VAMCacheManifest::HashSource(path, entry)) return false;
+    bool valid = VAMCacheManifest::CheckSource(path, entry) ==
+        VAMCacheManifest::SourceState::Unchanged;
+
+    // Same content, another write time: the entry is refreshed
+    const auto hash = entry.sourceHash;
+    std::filesystem::last_write_time(
+        path,
+        std::filesystem::last_write_time(path) + std::chrono::hours(1));
+    valid = valid && VAMCacheManifest::CheckSource(path, entry) ==
+        VAMCacheManifest::SourceState::Touched && entry.sourceHash == hash &&
+        VAMCacheManifest::CheckSource(path, entry) == VAMCacheManifest::SourceState::Unchanged;
+
+    WriteText(path, "v 0 0 0\nv 2 0 0\nv 0 1 0\nf 1 2 3\n");
+    valid = valid && VAMCacheManifest::CheckSource(path, entry) ==
+        VAMCacheManifest::SourceState::Modified && entry.sourceHash != hash;
+
+    std::filesystem::remove(path);
+    return valid && VAMCacheManifest::CheckSource(path, entry) ==
+        VAMCacheManifest::SourceState::Missing;
+}
+
+/// @brief Test that every setting changing the baked bytes changes the settings hash
+bool TestVamCacheManifestSettingsHash()
+{
+    const auto defaults = VAMCacheManifest::HashSettings(VAMCompressionSettings::Default());
+    auto level = VAMCompressionSettings::Default();
+    level.compressionLevel = 9;
+    auto compact = VAMCompressionSettings::Default();
+    compact.compactVertices = false;
+    auto dictionary = VAMCompressionSettings::Default();
+    dictionary.dictionaryId = 42;
+
+    return defaults == VAMCacheManifest::HashSettings(VAMCompressionSettings::Default()) &&
+        defaults != VAMCacheManifest::HashSettings(level) &&
+        defaults != VAMCacheManifest::HashSettings(compact) &&
+        defaults != VAMCacheManifest::HashSettings(dictionary);
+}
+
+// Register all VAMCacheManifest tests with the TestRunner
+VA_REGISTER_TEST(VamCacheManifestRoundTrip, TestVamCacheManifestRoundTrip);
+VA_REGISTER_TEST(VamCacheManifestCorrupted, TestVamCacheManifestCorrupted);
+VA_REGISTER_TEST(VamCacheManifestCheckSource, TestVamCacheManifestCheckSource);
+VA_REGISTER_TEST(VamCacheManifestSettingsHash, TestVamCacheManifestSettingsHash);
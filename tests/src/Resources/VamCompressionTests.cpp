@@ -0,0 +1,200 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// VAMCompression tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Resources/Loaders/VamCompression.hpp>
+#include <Resources/Loaders/VAMFormat.hpp>
+
+#include <cmath>
+#include <cstring>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief Repetitive section followed by a noisy one that LZ4 cannot shrink
+    VAArray<uint8_t> BuildSections(const uint32_t repetitiveSize, const uint32_t noisySize)
+    {
+        VAArray<uint8_t> data(repetitiveSize + noisySize);
+        for (uint32_t i = 0; i < repetitiveSize; ++i) data[i] = static_cast<uint8_t>(i % 7);
+
+        uint32_t state = 0x12345678u;
+        for (uint32_t i = repetitiveSize; i < data.size(); ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+            data[i] = static_cast<uint8_t>(state >> 24);
+        }
+        return data;
+    }
+
+    /// @brief Positions of a wavy strip followed by 2-byte attributes, 1000 vertices each
+    VAArray<uint8_t> BuildVertexStreams()
+    {
+        VAArray<uint8_t> data(1000 * 12 + 1000 * 6);
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            const float position[] = {i * 0.25f, std::sin(i * 0.1f), -0.5f * i};
+            const uint16_t attributes[] = {
+                static_cast<uint16_t>(i * 3),
+                static_cast<uint16_t>(40000 - i),
+                static_cast<uint16_t>(i % 17)
+            };
+            std::memcpy(data.data() + i * 12, position, sizeof(position));
+            std::memcpy(data.data() + 12000 + i * 6, attributes, sizeof(attributes));
+        }
+        return data;
+    }
+
+    bool RoundTrip(
+        const VAArray<uint8_t>& data,
+        const VAMCompression::CompressionResult& result,
+        const uint32_t version = VAM_VERSION)
+    {
+        VAArray<uint8_t> decompressed(data.size());
+        return result.success &&
+            VAMCompression::DecompressChunks(result.compressedData, decompressed, version) &&
+            decompressed == data;
+    }
+} // namespace
+
+/// @brief Test that chunks follow the sections and decompress back into the exact bytes
+bool TestVamCompressionChunkRoundTrip()
+{
+    constexpr uint32_t CHUNK_SIZE = 1000;
+    const auto data = BuildSections(2500, 1500);
+    const VAMCompression::Section sections[] = {{2500}, {0}, {1500}};
+    const auto result = VAMCompression::CompressChunks(data, sections, CHUNK_SIZE);
+    if (!result.success) return false;
+
+    // 3 chunks for the first section, 2 for the last, none for the empty one
+    VAMChunkTable table;
+    std::memcpy(&table, result.compressedData.data(), sizeof(table));
+    VAMChunk last;
+    std::memcpy(
+        &last,
+        result.compressedData.data() + sizeof(table) + 4 * sizeof(VAMChunk),
+        sizeof(last));
+    if (table.chunkCount != 5 || last.uncompressedOffset != 3500 || last.uncompressedSize != 500)
+    {
+        return false;
+    }
+
+    VAArray<uint8_t> decompressed(data.size());
+    return VAMCompression::DecompressChunks(result.compressedData, decompressed) &&
+        decompressed == data;
+}
+
+/// @brief Test that a block is rejected when its chunks do not fill the destination
+bool TestVamCompressionChunkValidation()
+{
+    const auto data = BuildSections(3000, 0);
+    const VAMCompression::Section sections[] = {{3000}};
+    auto result = VAMCompression::CompressChunks(data, sections, 1024);
+    if (!result.success) return false;
+
+    VAArray<uint8_t> larger(data.size() + 1);
+    if (VAMCompression::DecompressChunks(result.compressedData, larger)) return false;
+
+    // A chunk pointing past the compressed bytes
+    VAMChunk chunk;
+    auto* firstChunk = result.compressedData.data() + sizeof(VAMChunkTable);
+    std::memcpy(&chunk, firstChunk, sizeof(chunk));
+    chunk.compressedOffset = static_cast<uint32_t>(result.compressedData.size());
+    std::memcpy(firstChunk, &chunk, sizeof(chunk));
+
+    VAArray<uint8_t> decompressed(data.size());
+    return !VAMCompression::DecompressChunks(result.compressedData, decompressed);
+}
+
+/// @brief Test that filtered sections restore at every level, with an odd tail past the lanes
+bool TestVamCompressionFilters()
+{
+    auto data = BuildVertexStreams();
+    data.push_back(0x5a);
+    const VAMCompression::Section sections[] = {
+        {12000, VAMFilter::Delta, 4, 12},
+        {6001, VAMFilter::Shuffle, 2}
+    };
+
+    const auto fast = VAMCompression::CompressChunks(data, sections, 4096, 1);
+    const auto high = VAMCompression::CompressChunks(data, sections, 4096, 12);
+    const VAMCompression::Section unfiltered[] = {{12000}, {6001}};
+    const auto plain = VAMCompression::CompressChunks(data, unfiltered, 4096, 12);
+    return RoundTrip(data, fast) && RoundTrip(data, high) && RoundTrip(data, plain) &&
+        high.compressedSize <= fast.compressedSize && high.compressedSize < plain.compressedSize;
+}
+
+/// @brief Test that a trained dictionary shrinks a small file and is required to read it
+bool TestVamCompressionDictionary()
+{
+    // Samples share the vertex streams, the file to compress is a slice of them
+    const auto streams = BuildVertexStreams();
+    VAArray<VAArray<uint8_t>> samples;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        samples.emplace_back(streams.begin() + i * 256, streams.begin() + i * 256 + 4096);
+    }
+    const auto dictionary = VAMCompression::TrainDictionary(samples);
+    if (dictionary.empty() || dictionary.size() > VAMCompression::MAX_DICTIONARY_SIZE)
+    {
+        return false;
+    }
+
+    const VAArray<uint8_t> data(streams.begin() + 512, streams.begin() + 1536);
+    const VAMCompression::Section sections[] = {{1024}};
+    const auto id = VAMCompression::RegisterDictionary(dictionary);
+    const auto plain = VAMCompression::CompressChunks(data, sections, 4096);
+    auto withDictionary = VAMCompression::CompressChunks(data, sections, 4096, 1, id);
+    if (!RoundTrip(data, plain) || !RoundTrip(data, withDictionary) ||
+        withDictionary.compressedSize >= plain.compressedSize)
+    {
+        return false;
+    }
+
+    // Naming a dictionary nobody registered
+    VAMChunkTable table;
+    std::memcpy(&table, withDictionary.compressedData.data(), sizeof(table));
+    table.dictionaryId = id + 1;
+    std::memcpy(withDictionary.compressedData.data(), &table, sizeof(table));
+    return !RoundTrip(data, withDictionary);
+}
+
+/// @brief Test that a block with the version 9 chunk table and chunks is still read
+bool TestVamCompressionChunkVersion9()
+{
+    const auto data = BuildSections(3000, 1000);
+    const VAMCompression::Section sections[] = {{3000}, {1000}};
+    const auto result = VAMCompression::CompressChunks(data, sections, 1024);
+    if (!result.success) return false;
+
+    // Same chunks without the fields version 10 appends
+    VAMChunkTable table;
+    std::memcpy(&table, result.compressedData.data(), sizeof(table));
+    VAMCompression::CompressionResult legacy = result;
+    auto& block = legacy.compressedData;
+    block.assign(
+        result.compressedData.begin(),
+        result.compressedData.begin() + VAM_CHUNK_TABLE_SIZE_V9);
+    for (uint32_t i = 0; i < table.chunkCount; ++i)
+    {
+        const auto* chunk = result.compressedData.data() + sizeof(table) + i * sizeof(VAMChunk);
+        block.insert(block.end(), chunk, chunk + VAM_CHUNK_SIZE_V9);
+    }
+    block.insert(
+        block.end(),
+        result.compressedData.begin() + sizeof(table) + table.chunkCount * sizeof(VAMChunk),
+        result.compressedData.end());
+    return RoundTrip(data, legacy, 9);
+}
+
+// Register all VAMCompression tests with the TestRunner
+VA_REGISTER_TEST(VamCompressionChunkRoundTrip, TestVamCompressionChunkRoundTrip);
+VA_REGISTER_TEST(VamCompressionChunkValidation, TestVamCompressionChunkValidation);
+VA_REGISTER_TEST(VamCompressionFilters, TestVamCompressionFilters);
+VA_REGISTER_TEST(VamCompressionDictionary, TestVamCompressionDictionary);
+VA_REGISTER_TEST(VamCompressionChunkVersion9, TestVamCompressionChunkVersion9);
@@ -0,0 +1,329 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// VAMLoader tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Resources/Loaders/VamLoader.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Resources::Loaders;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    /// @brief Strip of triangles without submeshes, saving it needs no material system
+    MeshDataDefinition BuildStrip(const uint32_t vertexCount)
+    {
+        VAArray<MeshVertex> vertices(vertexCount);
+        VAArray<uint32_t> indices;
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            const auto t = static_cast<float>(i);
+            vertices[i].Position = Math::Vec3(t, i % 2 ? 1.0f : 0.0f, -t);
+            vertices[i].Normal = Math::Vec3(0.0f, 1.0f, 0.0f);
+            vertices[i].UV0 = Math::Vec2(t / vertexCount, 0.5f);
+            vertices[i].Tangent = Math::Vec4(1.0f, 0.0f, 0.0f, 1.0f);
+            if (i + 2 < vertexCount) indices.insert(indices.end(), {i, i + 1, i + 2});
+        }
+        return {std::move(vertices), std::move(indices)};
+    }
+
+    VAMCompressionSettings Uncompressed()
+    {
+        auto settings = VAMCompressionSettings::Default();
+        settings.enableCompression = false;
+        return settings;
+    }
+
+    std::string GetTestPath()
+    {
+        return (std::filesystem::temp_directory_path() / "va_test.vam").string();
+    }
+} // namespace
+
+/// @brief Test that a mapped file restores the mesh and exposes its aligned GPU streams
+bool TestVamLoaderMappedRoundTrip()
+{
+    const auto source = BuildStrip(100);
+    const auto path = GetTestPath();
+    if (!VAMLoader::SaveMeshToVAM(path, "", source, Uncompressed())) return false;
+
+    bool valid;
+    {
+        const auto loaded = VAMLoader::LoadMeshFromVAM(path);
+        if (!loaded) return false;
+
+        const auto& vertices = loaded->GetVertices();
+        const auto& packed = loaded->GetPackedGeometry();
+        valid = vertices.size() == source.GetVertices().size() &&
+            std::memcmp(
+                vertices.data(),
+                source.GetVertices().data(),
+                vertices.size() * sizeof(MeshVertex)) == 0 &&
+            loaded->GetIndices() == source.GetIndices();
+
+        // Every position then every attribute, with 16-bit indices after them
+        valid = valid && packed.owner && packed.shortIndices && !packed.compactAttributes &&
+            reinterpret_cast<uintptr_t>(packed.positions.data()) % VAM_SECTION_ALIGNMENT == 0 &&
+            packed.positions.size() == vertices.size() * sizeof(VertexPosition) &&
+            packed.attributes.size() == vertices.size() * sizeof(VertexAttributes) &&
+            packed.indices.size() == source.GetIndices().size() * sizeof(uint16_t);
+
+        VertexPosition last;
+        std::memcpy(&last, packed.positions.last(sizeof(VertexPosition)).data(), sizeof(last));
+        valid = valid && last.position[0] == 99.0f && last.position[2] == -99.0f;
+    }
+
+    std::filesystem::remove(path);
+    return valid;
+}
+
+/// @brief Test that a file compressed in many chunks restores the mesh
+bool TestVamLoaderCompressedRoundTrip()
+{
+    const auto source = BuildStrip(1000);
+    const auto path = GetTestPath();
+    auto settings = VAMCompressionSettings::Default();
+    settings.chunkSize = 4096;
+    if (!VAMLoader::SaveMeshToVAM(path, "", source, settings)) return false;
+
+    bool valid;
+    {
+        const auto loaded = VAMLoader::LoadMeshFromVAM(path);
+        valid = loaded && loaded->GetVertices().size() == source.GetVertices().size() &&
+            std::memcmp(
+                loaded->GetVertices().data(),
+                source.GetVertices().data(),
+                source.GetVertices().size() * sizeof(MeshVertex)) == 0 &&
+            loaded->GetIndices() == source.GetIndices() && loaded->GetPackedGeometry().owner;
+    }
+
+    // Without LZ4, the file is stored uncompressed
+    std::ifstream file(path, std::ios::binary);
+    VAMHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    file.close();
+    valid = valid && header.IsCompressed() == VAMCompression::IsLZ4Available();
+
+    std::filesystem::remove(path);
+    return valid;
+}
+
+/// @brief Test that chunks cutting through vertices restore the mesh, written compressed,
+///        uncompressed, and uncompressed again after a compression that did not pay off
+bool TestVamLoaderStreamedBake()
+{
+    const auto source = BuildStrip(3000);
+    const auto path = GetTestPath();
+
+    auto compressed = VAMCompressionSettings::Default();
+    compressed.chunkSize = 1000;
+    auto uncompressed = Uncompressed();
+    uncompressed.chunkSize = 1000;
+    auto rewritten = compressed;
+    rewritten.minCompressionRatio = 2.0f;
+
+    bool valid = true;
+    for (const auto& settings : {compressed, uncompressed, rewritten})
+    {
+        if (!VAMLoader::SaveMeshToVAM(path, "", source, settings)) return false;
+
+        const auto loaded = VAMLoader::LoadMeshFromVAM(path);
+        valid = valid && loaded &&
+            loaded->GetVertices().size() == source.GetVertices().size() &&
+            std::memcmp(
+                loaded->GetVertices().data(),
+                source.GetVertices().data(),
+                source.GetVertices().size() * sizeof(MeshVertex)) == 0 &&
+            loaded->GetIndices() == source.GetIndices();
+    }
+
+    std::filesystem::remove(path);
+    return valid;
+}
+
+/// @brief Test that sections past the 32-bit offsets of the format are refused, with the
+///        sizes of a scan mesh too large for them
+bool TestVamLoaderFileSizeLimit()
+{
+    const uint64_t vertexCount = 200'000'000;
+    const uint64_t scanSections[] = {
+        64,
+        vertexCount * sizeof(VertexPosition),
+        vertexCount * sizeof(VertexAttributes),
+        vertexCount * 6 * sizeof(uint32_t)
+    };
+    const uint64_t largestSections[] = {VAM_MAX_FILE_SIZE - sizeof(VAMHeader) - 16, 16};
+    const uint64_t oneByteOver[] = {VAM_MAX_FILE_SIZE - sizeof(VAMHeader) - 16, 17};
+
+    // Neither section wraps on its own, their sum does
+    const uint64_t wrappingSum[] = {uint64_t{1} << 31, uint64_t{1} << 31};
+
+    return !FitsVAMFile(scanSections) && FitsVAMFile(largestSections) &&
+        !FitsVAMFile(oneByteOver) && !FitsVAMFile(wrappingSum);
+}
+
+/// @brief Test that indices are baked in 16 bits only while they all fit, and widened back
+bool TestVamLoaderShortIndices()
+{
+    const auto path = GetTestPath();
+    bool valid = true;
+    for (const uint32_t vertexCount : {65535u, 65536u})
+    {
+        // The largest index is vertexCount - 1, 65535 is the 16-bit primitive restart value
+        const auto source = BuildStrip(vertexCount);
+        if (!VAMLoader::SaveMeshToVAM(path, "", source, Uncompressed())) return false;
+
+        VAMHeader header{};
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.close();
+
+        const auto loaded = VAMLoader::LoadMeshFromVAM(path);
+        valid = valid && header.HasShortIndices() == (vertexCount == 65535u) &&
+            header.HasShortIndices() == MeshData::FitsShortIndices(source.GetIndices()) &&
+            loaded && loaded->GetIndices() == source.GetIndices();
+    }
+
+    std::filesystem::remove(path);
+    return valid;
+}
+
+/// @brief Test that a file shorter than its header describes is rejected
+bool TestVamLoaderTruncated()
+{
+    const auto source = BuildStrip(100);
+    const auto path = GetTestPath();
+    if (!VAMLoader::SaveMeshToVAM(path, "", source, Uncompressed())) return false;
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+    const bool rejected = VAMLoader::LoadMeshFromVAM(path) == nullptr &&
+        VAMLoader::LoadMeshFromVAM(path, Platform::MappedFile::Mode::Read) == nullptr;
+
+    std::filesystem::remove(path);
+    return rejected;
+}
+
+/// @brief Test that a zero chunk size is rejected and a failed save keeps the previous file
+bool TestVamLoaderZeroChunkSize()
+{
+    const auto source = BuildStrip(100);
+    const auto path = GetTestPath();
+    if (!VAMLoader::SaveMeshToVAM(path, "", source, Uncompressed())) return false;
+    const auto size = std::filesystem::file_size(path);
+
+    auto settings = Uncompressed();
+    settings.chunkSize = 0;
+    const bool rejected = !VAMLoader::SaveMeshToVAM(path, "", BuildStrip(200), settings) &&
+        std::filesystem::file_size(path) == size && !std::filesystem::exists(path + ".tmp") &&
+        VAMLoader::LoadMeshFromVAM(path) != nullptr;
+
+    std::filesystem::remove(path);
+    return rejected;
+}
+
+/// @brief Test that a mesh listed in the cache manifest loads without its asset directory
+bool TestVamLoaderWarmCache()
+{
+    const auto root = std::filesystem::temp_directory_path() / "va_warm_cache";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "assets");
+    const auto assets = (root / "assets").string() + "/";
+    const auto cache = (root / "cache").string() + "/";
+
+    const auto source = BuildStrip(100);
+    bool valid;
+    {
+        VAMLoader loader(assets);
+        loader.SetCacheValidation(VAMCacheManifest::Validation::Trust);
+        const auto& settings = loader.GetCompressionSettings();
+        if (!VAMLoader::SaveMeshToVAM(cache + "strip.vam", "", source, settings)) return false;
+
+        VAMCacheManifest manifest;
+        VAMCacheManifest::Entry entry;
+        entry.vamFile = "strip.vam";
+        entry.sourceFile = "strip.obj";
+        entry.settingsHash = VAMCacheManifest::HashSettings(settings);
+        manifest.Record("strip", entry);
+        if (!manifest.Save(cache + VAM_MANIFEST_FILE_NAME)) return false;
+    }
+
+    // The sources are gone, the manifest alone must find the baked file. The directory stays,
+    // the cache is reached through it.
+    std::filesystem::remove_all(root / "assets");
+    std::filesystem::create_directory(root / "assets");
+    {
+        VAMLoader loader(assets);
+        loader.SetCacheValidation(VAMCacheManifest::Validation::Trust);
+        const auto loaded = std::dynamic_pointer_cast<MeshDataDefinition>(loader.Load("strip"));
+        valid = loader.GetCacheManifest().GetSize() == 1 && loaded &&
+            loaded->GetVertices().size() == source.GetVertices().size() &&
+            loaded->GetIndices() == source.GetIndices();
+    }
+
+    std::filesystem::remove_all(root);
+    return valid;
+}
+
+/// @brief Test that the offline bake lists the sources and skips those baked already
+bool TestVamLoaderBakeUpToDate()
+{
+    const auto root = std::filesystem::temp_directory_path() / "va_bake";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "assets" / "props");
+    const auto assets = (root / "assets").string() + "/";
+    const auto cache = (root / "cache").string() + "/";
+
+    // Any bytes do, the source is only hashed
+    for (const auto* file : {"props/strip.obj", "crate.gltf", "crate.fbx", "notes.txt"})
+    {
+        std::ofstream(assets + file) << file;
+    }
+
+    bool valid;
+    {
+        VAMLoader loader(assets);
+        const auto& settings = loader.GetCompressionSettings();
+        std::filesystem::create_directory(cache + "props");
+        if (!VAMLoader::SaveMeshToVAM(cache + "props/strip.vam", "", BuildStrip(100), settings))
+        {
+            return false;
+        }
+
+        VAMCacheManifest manifest;
+        VAMCacheManifest::Entry entry;
+        entry.vamFile = "props/strip.vam";
+        entry.sourceFile = "props/strip.obj";
+        entry.settingsHash = VAMCacheManifest::HashSettings(settings);
+        if (!VAMCacheManifest::HashSource(assets + entry.sourceFile, entry)) return false;
+        manifest.Record("props/strip", entry);
+        if (!manifest.Save(cache + VAM_MANIFEST_FILE_NAME)) return false;
+    }
+    {
+        VAMLoader loader(assets);
+        const auto names = loader.FindSourceAssets();
+        valid = names == VAArray<std::string>{"crate", "props/strip"} &&
+            loader.Bake("props/strip") == VAMLoader::BakeStatus::UpToDate;
+    }
+
+    std::filesystem::remove_all(root);
+    return valid;
+}
+
+// Register all VAMLoader tests with the TestRunner
+VA_REGISTER_TEST(VamLoaderMappedRoundTrip, TestVamLoaderMappedRoundTrip);
+VA_REGISTER_TEST(VamLoaderCompressedRoundTrip, TestVamLoaderCompressedRoundTrip);
+VA_REGISTER_TEST(VamLoaderStreamedBake, TestVamLoaderStreamedBake);
+VA_REGISTER_TEST(VamLoaderFileSizeLimit, TestVamLoaderFileSizeLimit);
+VA_REGISTER_TEST(VamLoaderShortIndices, TestVamLoaderShortIndices);
+VA_REGISTER_TEST(VamLoaderTruncated, TestVamLoaderTruncated);
+VA_REGISTER_TEST(VamLoaderZeroChunkSize, TestVamLoaderZeroChunkSize);
+VA_REGISTER_TEST(VamLoaderWarmCache, TestVamLoaderWarmCache);
+VA_REGISTER_TEST(VamLoaderBakeUpToDate, TestVamLoaderBakeUpToDate);
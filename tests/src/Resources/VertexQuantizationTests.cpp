@@ -0,0 +1,174 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// VertexQuantization tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Resources/VertexQuantization.hpp>
+
+#include <cmath>
+#include <random>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    float MaxComponentError(const Math::Vec3& a, const Math::Vec3& b)
+    {
+        return std::max(
+            {std::abs(a.X() - b.X()), std::abs(a.Y() - b.Y()), std::abs(a.Z() - b.Z())});
+    }
+
+    Math::Vec3 RandomDirection(std::mt19937& rng)
+    {
+        std::normal_distribution<float> distribution;
+        const Math::Vec3 direction(distribution(rng), distribution(rng), distribution(rng));
+        return direction * (1.0f / std::sqrt(Math::Vec3::Dot(direction, direction)));
+    }
+} // namespace
+
+/// @brief Test half float conversion on edge cases and on every finite half
+bool TestVertexQuantizationHalf()
+{
+    const std::pair<float, uint16_t> cases[] = {
+        {0.0f, 0x0000},
+        {-0.0f, 0x8000},
+        {1.0f, 0x3c00},
+        {-2.0f, 0xc000},
+        {0.5f, 0x3800},
+        {65504.0f, 0x7bff}, // Largest half
+        {65520.0f, 0x7c00}, // Rounds to infinity
+        {std::ldexp(1.0f, -24), 0x0001}, // Smallest subnormal
+        {std::ldexp(1.0f, -14), 0x0400}, // Smallest normal
+        {1.0f + std::ldexp(1.0f, -11), 0x3c00}, // Tie, rounds to even
+        {1.0f + 3.0f * std::ldexp(1.0f, -11), 0x3c02}, // Tie, rounds to even
+        {std::numeric_limits<float>::infinity(), 0x7c00},
+    };
+    for (const auto& [value, expected] : cases)
+    {
+        if (VertexQuantization::FloatToHalf(value) != expected) return false;
+    }
+    if (VertexQuantization::FloatToHalf(std::numeric_limits<float>::quiet_NaN()) != 0x7e00)
+    {
+        return false;
+    }
+
+    // Every finite half survives a round trip through float
+    for (uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        const auto half = static_cast<uint16_t>(bits);
+        if ((half & 0x7c00) == 0x7c00) continue;
+        if (VertexQuantization::FloatToHalf(VertexQuantization::HalfToFloat(half)) != half)
+        {
+            return false;
+        }
+    }
+
+    return VertexQuantization::HalfToFloat(0x3555) == 0.333251953125f;
+}
+
+/// @brief Test octahedral encoding precision over the sphere
+bool TestVertexQuantizationOctahedral()
+{
+    // Axes land exactly on the octahedron vertices
+    const Math::Vec3 axes[] = {
+        Math::Vec3(1.0f, 0.0f, 0.0f),
+        Math::Vec3(-1.0f, 0.0f, 0.0f),
+        Math::Vec3(0.0f, 1.0f, 0.0f),
+        Math::Vec3(0.0f, -1.0f, 0.0f),
+        Math::Vec3(0.0f, 0.0f, 1.0f),
+        Math::Vec3(0.0f, 0.0f, -1.0f),
+    };
+    for (const auto& axis : axes)
+    {
+        const auto decoded = VertexQuantization::DecodeOctahedral(
+            VertexQuantization::EncodeOctahedral(axis));
+        if (MaxComponentError(axis, decoded) > 1e-6f) return false;
+    }
+
+    // Two snorm16 keep every direction within ~5e-5 of the original
+    std::mt19937 rng(11);
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        const auto direction = RandomDirection(rng);
+        const auto decoded = VertexQuantization::DecodeOctahedral(
+            VertexQuantization::EncodeOctahedral(direction));
+        if (MaxComponentError(direction, decoded) > 1e-4f ||
+            std::abs(Math::Vec3::Dot(decoded, decoded) - 1.0f) > 1e-5f)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief Test that a batch round trip keeps every attribute within its quantization error
+bool TestVertexQuantizationRoundTrip()
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> positions(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> uvs(-4.0f, 4.0f);
+
+    // Odd sizes exercise the partial batch padding
+    for (const size_t count : {1u, 3u, 4u, 7u, 1001u})
+    {
+        VAArray<MeshVertex> vertices(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            vertices[i].Position = Math::Vec3(positions(rng), positions(rng), positions(rng));
+            vertices[i].Normal = RandomDirection(rng);
+            vertices[i].UV0 = Math::Vec2(uvs(rng), uvs(rng));
+            vertices[i].Tangent = Math::Vec4(RandomDirection(rng), i % 2 == 0 ? 1.0f : -1.0f);
+        }
+
+        // The handedness fold must survive tangents on the v = -1 edge
+        vertices[0].Tangent = Math::Vec4(0.0f, -1.0f, 0.0f, -1.0f);
+
+        VAArray<CompactVertex> compact(count);
+        VAArray<MeshVertex> decoded(count);
+        VertexQuantization::Encode(vertices, compact);
+        VertexQuantization::Decode(compact, decoded);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto& source = vertices[i];
+            const auto& result = decoded[i];
+            const Math::Vec3 sourceTangent(source.Tangent.X(), source.Tangent.Y(), source.Tangent.Z());
+            const Math::Vec3 resultTangent(result.Tangent.X(), result.Tangent.Y(), result.Tangent.Z());
+
+            if (MaxComponentError(source.Position, result.Position) != 0.0f ||
+                MaxComponentError(source.Normal, result.Normal) > 1e-4f ||
+                MaxComponentError(sourceTangent, resultTangent) > 2e-4f ||
+                result.Tangent.W() != source.Tangent.W())
+            {
+                return false;
+            }
+
+            // Halves keep 11 significant bits, within 2^-11 relative error after rounding
+            if (std::abs(result.UV0.X() - source.UV0.X()) > std::abs(source.UV0.X()) / 2048.0f ||
+                std::abs(result.UV0.Y() - source.UV0.Y()) > std::abs(source.UV0.Y()) / 2048.0f)
+            {
+                return false;
+            }
+
+            // The batch path matches the single-value helpers
+            const auto normal = VertexQuantization::EncodeOctahedral(source.Normal);
+            if (compact[i].normal[0] != normal[0] || compact[i].normal[1] != normal[1] ||
+                compact[i].uv0[0] != VertexQuantization::FloatToHalf(source.UV0.X()))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Register all VertexQuantization tests with the TestRunner
+VA_REGISTER_TEST(VertexQuantizationHalf, TestVertexQuantizationHalf);
+VA_REGISTER_TEST(VertexQuantizationOctahedral, TestVertexQuantizationOctahedral);
+VA_REGISTER_TEST(VertexQuantizationRoundTrip, TestVertexQuantizationRoundTrip);
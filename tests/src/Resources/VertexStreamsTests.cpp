@@ -0,0 +1,82 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+//
+// VertexStreams tests integrated with TestRunner
+//
+#include "../Core/TestRunner.hpp"
+#include <Resources/VertexStreams.hpp>
+
+#include <cstring>
+
+using namespace VoidArchitect;
+using namespace VoidArchitect::Resources;
+using namespace VoidArchitect::Testing;
+
+namespace
+{
+    VAArray<MeshVertex> BuildVertices(const uint32_t count)
+    {
+        VAArray<MeshVertex> vertices(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const auto t = static_cast<float>(i);
+            vertices[i].Position = Math::Vec3(t, -2.0f * t, 0.5f + t);
+            vertices[i].Normal = Math::Vec3(0.0f, i % 2 ? 1.0f : -1.0f, 0.0f);
+            vertices[i].UV0 = Math::Vec2(t / count, 1.0f - t / count);
+            vertices[i].Tangent = Math::Vec4(1.0f, 0.0f, 0.0f, i % 3 ? 1.0f : -1.0f);
+        }
+        return vertices;
+    }
+
+    bool SameVertex(const MeshVertex& a, const MeshVertex& b)
+    {
+        // MeshVertex is tightly packed floats
+        return std::memcmp(&a, &b, sizeof(MeshVertex)) == 0;
+    }
+} // namespace
+
+/// @brief Test that full precision streams interleave back into the exact vertices
+bool TestVertexStreamsRoundTrip()
+{
+    const auto vertices = BuildVertices(37);
+    VAArray<VertexPosition> positions(vertices.size());
+    VAArray<VertexAttributes> attributes(vertices.size());
+    VertexStreams::ExtractPositions(vertices, positions);
+    VertexStreams::ExtractAttributes(vertices, attributes);
+
+    if (positions[5].position[1] != -10.0f || attributes[4].tangent[3] != 1.0f) return false;
+
+    VAArray<MeshVertex> restored(vertices.size());
+    VertexStreams::Interleave(positions, attributes, restored);
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        if (!SameVertex(vertices[i], restored[i])) return false;
+    }
+    return true;
+}
+
+/// @brief Test that compact streams hold the bytes of the quantized interleaved vertices
+bool TestVertexStreamsCompact()
+{
+    // More than one quantization batch, with a partial last one
+    const auto vertices = BuildVertices(600);
+    VAArray<CompactVertex> expected(vertices.size());
+    VertexQuantization::Encode(vertices, expected);
+
+    VAArray<VertexPosition> positions(vertices.size());
+    VAArray<CompactVertexAttributes> attributes(vertices.size());
+    VertexStreams::ExtractPositions(vertices, positions);
+    VertexStreams::ExtractCompactAttributes(vertices, attributes);
+
+    VAArray<CompactVertex> interleaved(vertices.size());
+    VertexStreams::Interleave(positions, attributes, interleaved);
+    return std::memcmp(
+        interleaved.data(),
+        expected.data(),
+        expected.size() * sizeof(CompactVertex)) == 0;
+}
+
+// Register all VertexStreams tests with the TestRunner
+VA_REGISTER_TEST(VertexStreamsRoundTrip, TestVertexStreamsRoundTrip);
+VA_REGISTER_TEST(VertexStreamsCompact, TestVertexStreamsCompact);
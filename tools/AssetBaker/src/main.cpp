@@ -0,0 +1,267 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+// Bake the source assets of a directory ahead of time, so that the game starts on a warm cache
+// and only bakes at runtime what changed since.
+//
+// Meshes are the only cookable assets: their VAM files are written to <directory>/cache/, next
+// to the manifest the runtime validates them with. Textures, materials and shaders are read as
+// they are, shaders being compiled by the build.
+//
+// Usage: VoidArchitect_AssetBaker <directory> [options]
+//   -f, --force             Bake every asset, even the up to date ones
+//   -c, --compress <level>  VAM compression level, 1-2 LZ4, 3-12 LZ4-HC
+//   -j, --jobs <count>      Worker threads, one per core by default
+//   -p, --pack              Pack the directory into <directory>.vapack once baked
+//   -i, --importer <name>   Mesh importer, assimp (default) or native for glTF and OBJ
+//   -t, --train-dictionary  Train cache/vam.dict on the small baked meshes, then bake them
+//                           again against it
+//
+#include <Core/Logger.hpp>
+#include <Platform/FileSystem/AssetPack.hpp>
+#include <Resources/Loaders/VamLoader.hpp>
+#include <Systems/Jobs/JobSystem.hpp>
+#include <Systems/Jobs/ParallelFor.hpp>
+#include <Systems/MaterialSystem.hpp>
+
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+
+using namespace VoidArchitect;
+using Resources::Loaders::MeshImporter;
+using Resources::Loaders::VAMLoader;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct BakedAsset
+    {
+        std::string name;
+        VAMLoader::BakeStatus status = VAMLoader::BakeStatus::Failed;
+        double milliseconds = 0.0;
+    };
+
+    void PrintUsage()
+    {
+        VA_APP_INFO(
+            "Usage: VoidArchitect_AssetBaker <directory> [-f] [-c <level>] [-j <count>] [-p] "
+            "[-i <assimp|native>] [-t]");
+    }
+
+    template <typename T>
+    bool ParseNumber(const std::string_view text, T& value)
+    {
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && end == text.data() + text.size();
+    }
+
+    double MillisecondsSince(const Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    const char* ToString(const VAMLoader::BakeStatus status)
+    {
+        switch (status)
+        {
+            case VAMLoader::BakeStatus::UpToDate:
+                return "up to date";
+            case VAMLoader::BakeStatus::Baked:
+                return "baked";
+            case VAMLoader::BakeStatus::Failed:
+                return "FAILED";
+        }
+        return "unknown";
+    }
+} // namespace
+
+int main(const int argc, char** argv)
+{
+    Logger::Initialize();
+
+    std::string directory;
+    bool force = false;
+    bool pack = false;
+    bool trainDictionary = false;
+    int compressionLevel = 0;
+    uint32_t workerCount = 0;
+    auto importer = MeshImporter::Assimp;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (argument == "-f" || argument == "--force")
+        {
+            force = true;
+        }
+        else if (argument == "-p" || argument == "--pack")
+        {
+            pack = true;
+        }
+        else if (argument == "-t" || argument == "--train-dictionary")
+        {
+            trainDictionary = true;
+        }
+        else if ((argument == "-c" || argument == "--compress") && hasValue)
+        {
+            if (!ParseNumber(argv[++i], compressionLevel) || compressionLevel <= 0)
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if ((argument == "-j" || argument == "--jobs") && hasValue)
+        {
+            if (!ParseNumber(argv[++i], workerCount))
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if ((argument == "-i" || argument == "--importer") && hasValue)
+        {
+            const std::string_view name = argv[++i];
+            if (name != "assimp" && name != "native")
+            {
+                PrintUsage();
+                return 1;
+            }
+            importer = name == "native" ? MeshImporter::Native : MeshImporter::Assimp;
+        }
+        else if (directory.empty() && !argument.starts_with('-'))
+        {
+            directory = argument;
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (directory.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+    while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\'))
+    {
+        directory.pop_back();
+    }
+
+    // Same layout as the ResourceSystem, the cache lands in <directory>/cache/
+    const auto meshDirectory = directory + "/meshes/";
+    if (std::error_code error; !std::filesystem::is_directory(meshDirectory, error))
+    {
+        VA_APP_ERROR("'{}' has no meshes directory.", directory);
+        Logger::Shutdown();
+        return 1;
+    }
+
+    const auto start = Clock::now();
+
+    // Material templates are registered while importing, no renderer is needed for them
+    Jobs::g_JobSystem = std::make_unique<Jobs::JobSystem>(workerCount);
+    g_MaterialSystem = std::make_unique<MaterialSystem>();
+
+    VAMLoader loader(meshDirectory);
+    loader.SetMeshImporter(importer);
+    if (compressionLevel > 0)
+    {
+        auto settings = loader.GetCompressionSettings();
+        settings.compressionLevel = compressionLevel;
+        loader.SetCompressionSettings(settings);
+    }
+
+    const auto names = loader.FindSourceAssets();
+    VAArray<BakedAsset> assets(names.size());
+    for (size_t i = 0; i < names.size(); ++i) assets[i].name = names[i];
+    const auto bakeAll = [&loader, &assets](const bool forceBake)
+    {
+        Jobs::ParallelFor(
+            assets.size(),
+            [&loader, &assets, forceBake](const size_t i)
+            {
+                auto& asset = assets[i];
+                const auto bakeStart = Clock::now();
+                asset.status = loader.Bake(asset.name, forceBake);
+                asset.milliseconds = MillisecondsSince(bakeStart);
+            },
+            "BakeAsset");
+    };
+    bakeAll(force);
+
+    // The dictionary is trained on the files just baked. It changes the compression settings,
+    // so the second pass bakes every entry again against it.
+    bool dictionaryTrained = true;
+    if (trainDictionary)
+    {
+        dictionaryTrained = loader.TrainDictionary();
+        if (dictionaryTrained) bakeAll(false);
+    }
+
+    const bool manifestSaved = loader.SaveCacheManifest();
+    const auto bakeTime = MillisecondsSince(start);
+
+    // Timing report, the slowest assets first
+    std::ranges::sort(assets, std::ranges::greater{}, &BakedAsset::milliseconds);
+    size_t baked = 0;
+    size_t upToDate = 0;
+    size_t failed = 0;
+    double bakeTotal = 0.0;
+    for (const auto& asset : assets)
+    {
+        VA_APP_INFO("  {:>10.1f} ms  {:<10}  {}", asset.milliseconds, ToString(asset.status),
+                    asset.name);
+        bakeTotal += asset.milliseconds;
+        switch (asset.status)
+        {
+            case VAMLoader::BakeStatus::UpToDate:
+                ++upToDate;
+                break;
+            case VAMLoader::BakeStatus::Baked:
+                ++baked;
+                break;
+            case VAMLoader::BakeStatus::Failed:
+                ++failed;
+                break;
+        }
+    }
+    VA_APP_INFO(
+        "Baked {} meshes, {} up to date, {} failed from '{}' in {:.1f} ms ({:.1f} ms of work).",
+        baked,
+        upToDate,
+        failed,
+        meshDirectory,
+        bakeTime,
+        bakeTotal);
+
+    g_MaterialSystem = nullptr;
+    Jobs::g_JobSystem = nullptr;
+
+    bool success = failed == 0 && manifestSaved && dictionaryTrained;
+    if (success && pack)
+    {
+        const auto packStart = Clock::now();
+        const auto packPath = directory + Platform::ASSET_PACK_EXTENSION;
+        const auto result = Platform::AssetPack::Build(directory, packPath);
+        success = result.success;
+        if (success)
+        {
+            VA_APP_INFO(
+                "Packed {} files into '{}' in {:.1f} ms.",
+                result.entryCount,
+                packPath,
+                MillisecondsSince(packStart));
+        }
+        else
+        {
+            VA_APP_ERROR("Failed to pack '{}'.", directory);
+        }
+    }
+
+    Logger::Shutdown();
+    return success ? 0 : 1;
+}
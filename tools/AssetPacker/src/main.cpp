@@ -0,0 +1,123 @@
+//
+// Created by Michael Desmedt on 18/10/2026.
+//
+// Pack a directory of assets into a single file read through the VirtualFileSystem.
+//
+// Usage: VoidArchitect_AssetPacker <directory> [options]
+//   -o, --output <path>     Pack to write, <directory>.vapack by default
+//   -c, --compress <level>  Compress entries that shrink, 1-2 LZ4, 3-12 LZ4-HC
+//   -a, --align <bytes>     Alignment of every entry, 16 by default
+//   -x, --exclude <ext>     Skip files with this extension, may be repeated
+//
+#include <Core/Logger.hpp>
+#include <Platform/FileSystem/AssetPack.hpp>
+
+#include <charconv>
+#include <chrono>
+
+using namespace VoidArchitect;
+
+namespace
+{
+    void PrintUsage()
+    {
+        VA_APP_INFO(
+            "Usage: VoidArchitect_AssetPacker <directory> [-o <pack>] [-c <level>] "
+            "[-a <alignment>] [-x <extension>]...");
+    }
+
+    template <typename T>
+    bool ParseNumber(const std::string_view text, T& value)
+    {
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && end == text.data() + text.size();
+    }
+} // namespace
+
+int main(const int argc, char** argv)
+{
+    Logger::Initialize();
+
+    std::string directory;
+    std::string output;
+    Platform::AssetPackBuildOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if ((argument == "-o" || argument == "--output") && hasValue)
+        {
+            output = argv[++i];
+        }
+        else if ((argument == "-c" || argument == "--compress") && hasValue)
+        {
+            if (!ParseNumber(argv[++i], options.compressionLevel))
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if ((argument == "-a" || argument == "--align") && hasValue)
+        {
+            if (!ParseNumber(argv[++i], options.alignment))
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if ((argument == "-x" || argument == "--exclude") && hasValue)
+        {
+            std::string extension = argv[++i];
+            if (!extension.starts_with('.')) extension.insert(0, 1, '.');
+            options.excludedExtensions.push_back(std::move(extension));
+        }
+        else if (directory.empty() && !argument.starts_with('-'))
+        {
+            directory = argument;
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (directory.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+    if (output.empty())
+    {
+        while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\'))
+        {
+            directory.pop_back();
+        }
+        output = directory + Platform::ASSET_PACK_EXTENSION;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto result = Platform::AssetPack::Build(directory, output, options);
+    const auto elapsed = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    if (!result.success)
+    {
+        VA_APP_ERROR("Failed to pack '{}'.", directory);
+        Logger::Shutdown();
+        return 1;
+    }
+
+    VA_APP_INFO(
+        "Packed {} files ({} compressed) from '{}' into '{}': {:.2f} MiB -> {:.2f} MiB in {:.1f} ms.",
+        result.entryCount,
+        result.compressedCount,
+        directory,
+        output,
+        static_cast<double>(result.uncompressedSize) / (1024.0 * 1024.0),
+        static_cast<double>(result.packSize) / (1024.0 * 1024.0),
+        elapsed);
+
+    Logger::Shutdown();
+    return 0;
+}